@@ -0,0 +1,157 @@
+#include <Core/FileIO.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+using namespace Ilum;
+
+namespace
+{
+std::string GetFilePath(uint32_t i)
+{
+	return (std::filesystem::temp_directory_path() / ("IlumBenchFileIO" + std::to_string(i) + ".bin")).string();
+}
+
+// Async reads of every file per iteration, callbacks keep the data like asset loads do and it is released outside the timed region
+void ReadAll(benchmark::State &state, FileIO &file_io, const std::vector<std::string> &paths)
+{
+	std::vector<std::vector<uint8_t>> results(paths.size());
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < paths.size(); i++)
+		{
+			file_io.ReadAsync(paths[i], [&results, i](bool, std::vector<uint8_t> &&data) { results[i] = std::move(data); });
+		}
+		file_io.Wait();
+
+		state.PauseTiming();
+		for (auto &result : results)
+		{
+			std::vector<uint8_t>().swap(result);
+		}
+		state.ResumeTiming();
+	}
+}
+}        // namespace
+
+// Async reads of a batch of cached files totalling 16 MiB, for each backend and file size in KiB
+static void BM_FileIOReadAsync(benchmark::State &state)
+{
+	auto   backend   = static_cast<FileIO::Backend>(state.range(0));
+	size_t file_size = static_cast<size_t>(state.range(1)) << 10;
+
+	uint32_t file_count = static_cast<uint32_t>((16 << 20) / file_size);
+
+	std::vector<uint8_t>     data(file_size, 0x5a);
+	std::vector<std::string> paths;
+	for (uint32_t i = 0; i < file_count; i++)
+	{
+		paths.push_back(GetFilePath(i));
+		FileIO::Write(paths.back(), data.data(), data.size());
+	}
+
+	FileIO file_io(backend);
+	if (file_io.GetBackend() != backend)
+	{
+		state.SkipWithError("io_uring is unavailable");
+	}
+
+	ReadAll(state, file_io, paths);
+
+	state.SetBytesProcessed(state.iterations() * file_count * file_size);
+
+	for (auto &path : paths)
+	{
+		std::filesystem::remove(path);
+	}
+}
+BENCHMARK(BM_FileIOReadAsync)
+    ->ArgsProduct({{static_cast<int64_t>(FileIO::Backend::Threads), static_cast<int64_t>(FileIO::Backend::Ring)}, {4, 64, 1024}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// 10000 small files per batch, where the per-request overhead dominates, for each backend and file size in KiB
+static void BM_FileIOReadManySmallFiles(benchmark::State &state)
+{
+	auto   backend   = static_cast<FileIO::Backend>(state.range(0));
+	size_t file_size = static_cast<size_t>(state.range(1)) << 10;
+
+	constexpr uint32_t FileCount = 10000;
+
+	std::vector<uint8_t>     data(file_size, 0x5a);
+	std::vector<std::string> paths;
+	for (uint32_t i = 0; i < FileCount; i++)
+	{
+		paths.push_back(GetFilePath(i));
+		FileIO::Write(paths.back(), data.data(), data.size());
+	}
+
+	FileIO file_io(backend);
+	if (file_io.GetBackend() != backend)
+	{
+		state.SkipWithError("io_uring is unavailable");
+	}
+
+	ReadAll(state, file_io, paths);
+
+	state.SetItemsProcessed(state.iterations() * FileCount);
+	state.SetBytesProcessed(state.iterations() * FileCount * file_size);
+
+	for (auto &path : paths)
+	{
+		std::filesystem::remove(path);
+	}
+}
+BENCHMARK(BM_FileIOReadManySmallFiles)
+    ->ArgsProduct({{static_cast<int64_t>(FileIO::Backend::Threads), static_cast<int64_t>(FileIO::Backend::Ring)}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// One file of ILUM_BENCH_LARGE_FILE_GIB GiB read in a single request, for each backend
+// Skipped unless the variable is set since it needs that much disk and memory
+static void BM_FileIOReadLargeFile(benchmark::State &state)
+{
+	auto backend = static_cast<FileIO::Backend>(state.range(0));
+
+	const char *gib = std::getenv("ILUM_BENCH_LARGE_FILE_GIB");
+	if (!gib || std::atoi(gib) <= 0)
+	{
+		state.SkipWithError("set ILUM_BENCH_LARGE_FILE_GIB to the file size in GiB to run");
+		return;
+	}
+
+	size_t file_size = static_cast<size_t>(std::atoi(gib)) << 30;
+
+	// Written in chunks so that only the read has to hold the whole file
+	std::vector<std::string> paths = {GetFilePath(0)};
+	{
+		std::vector<char> chunk(64 << 20, 0x5a);
+		std::ofstream     os(paths[0], std::ios::binary);
+		for (size_t written = 0; written < file_size; written += chunk.size())
+		{
+			os.write(chunk.data(), static_cast<std::streamsize>(std::min(chunk.size(), file_size - written)));
+		}
+	}
+
+	FileIO file_io(backend);
+	if (file_io.GetBackend() != backend)
+	{
+		state.SkipWithError("io_uring is unavailable");
+	}
+
+	ReadAll(state, file_io, paths);
+
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file_size));
+
+	std::filesystem::remove(paths[0]);
+}
+BENCHMARK(BM_FileIOReadLargeFile)
+    ->Arg(static_cast<int64_t>(FileIO::Backend::Threads))
+    ->Arg(static_cast<int64_t>(FileIO::Backend::Ring))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Iterations(1);
@@ -0,0 +1,69 @@
+#include <Core/JobSystem.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+// Throughput of tiny jobs submitted from an external thread, for 1 to 64 workers
+static void BM_ThreadPoolSubmit(benchmark::State &state)
+{
+	ThreadPool pool(static_cast<uint32_t>(state.range(0)));
+
+	constexpr uint32_t JobCount = 16384;
+
+	std::atomic<uint32_t> count = 0;
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < JobCount; i++)
+		{
+			pool.Submit([&count]() { count.fetch_add(1, std::memory_order_relaxed); });
+		}
+		pool.WaitAll();
+	}
+
+	state.SetItemsProcessed(state.iterations() * JobCount);
+}
+BENCHMARK(BM_ThreadPoolSubmit)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+// Parallel-for over a fixed amount of work, for 1 to 64 workers
+static void BM_JobSystemDispatch(benchmark::State &state)
+{
+	JobSystem job_system(static_cast<uint32_t>(state.range(0)));
+
+	constexpr uint32_t ElementCount = 1 << 20;
+	constexpr uint32_t GroupSize    = 1024;
+
+	std::vector<float> data(ElementCount, 1.f);
+
+	for (auto _ : state)
+	{
+		JobHandle handle;
+		job_system.Dispatch(handle, ElementCount, GroupSize, [&data](uint32_t group_id) {
+			for (uint32_t i = group_id * GroupSize; i < (group_id + 1) * GroupSize; i++)
+			{
+				data[i] = data[i] * 0.5f + 1.f;
+			}
+		});
+		job_system.Wait(handle);
+	}
+
+	benchmark::DoNotOptimize(data.data());
+	state.SetItemsProcessed(state.iterations() * ElementCount);
+}
+BENCHMARK(BM_JobSystemDispatch)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+// Future-returning submission, whose shared state comes from the job memory pool
+static void BM_JobSystemExecuteAsync(benchmark::State &state)
+{
+	JobSystem job_system(static_cast<uint32_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		auto future = job_system.ExecuteAsync([]() { return 1; });
+		benchmark::DoNotOptimize(future.get());
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JobSystemExecuteAsync)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
@@ -0,0 +1,195 @@
+#include <Core/Log.hpp>
+
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t MessageCount = 65536;
+constexpr uint32_t BurstCount   = 1024;
+
+// Discards the console output so both sinks only pay for formatting and the stream calls
+class NullBuffer : public std::streambuf
+{
+  protected:
+	virtual int overflow(int c) override
+	{
+		return c;
+	}
+
+	virtual std::streamsize xsputn(const char *, std::streamsize count) override
+	{
+		return count;
+	}
+};
+
+class ScopedNullConsole
+{
+  public:
+	ScopedNullConsole() :
+	    m_previous(std::cout.rdbuf(&m_buffer))
+	{
+	}
+
+	~ScopedNullConsole()
+	{
+		std::cout.rdbuf(m_previous);
+	}
+
+  private:
+	NullBuffer      m_buffer;
+	std::streambuf *m_previous;
+};
+
+// The sink LogSystem used before the ring: format and write to the console under one lock
+class LockedSink : public spdlog::sinks::base_sink<std::mutex>
+{
+  public:
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lock(base_sink<std::mutex>::mutex_);
+		m_log_msgs.clear();
+	}
+
+  protected:
+	virtual void sink_it_(const spdlog::details::log_msg &msg) override
+	{
+		spdlog::details::log_msg_buffer buffer(msg);
+		spdlog::memory_buf_t            formatted;
+		base_sink<std::mutex>::formatter_->format(buffer, formatted);
+		m_log_msgs.push_back({msg.level, fmt::to_string(formatted)});
+		std::cout << fmt::to_string(formatted);
+	}
+
+	virtual void flush_() override
+	{
+		std::cout << std::flush;
+	}
+
+  private:
+	std::deque<std::pair<spdlog::level::level_enum, std::string>> m_log_msgs;
+};
+
+template <typename Callback>
+void LogFromThreads(uint32_t thread_count, Callback &&callback)
+{
+	std::vector<std::thread> threads;
+	threads.reserve(thread_count);
+	for (uint32_t t = 0; t < thread_count; t++)
+	{
+		threads.emplace_back([&callback, t, thread_count]() {
+			for (uint32_t i = t; i < MessageCount; i += thread_count)
+			{
+				callback(t, i);
+			}
+		});
+	}
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+}
+}        // namespace
+
+// Multi-threaded logging through the lock-free ring until every message is flushed, for 1 to 8 threads
+static void BM_LogAsyncSink(benchmark::State &state)
+{
+	ScopedNullConsole console;
+
+	LogSystem log_system;
+
+	uint32_t thread_count = static_cast<uint32_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		LogFromThreads(thread_count, [&log_system](uint32_t t, uint32_t i) {
+			log_system.Log(LogSystem::LogLevel::Info, "Message {} from thread {}", i, t);
+		});
+		log_system.Flush();
+	}
+
+	state.SetItemsProcessed(state.iterations() * MessageCount);
+}
+BENCHMARK(BM_LogAsyncSink)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// The same traffic through the previous locked sink, for 1 to 8 threads
+static void BM_LogLockedSink(benchmark::State &state)
+{
+	ScopedNullConsole console;
+
+	auto sink   = std::make_shared<LockedSink>();
+	auto logger = std::make_shared<spdlog::logger>("Benchmark", sink);
+	logger->set_level(spdlog::level::trace);
+
+	uint32_t thread_count = static_cast<uint32_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		LogFromThreads(thread_count, [&logger](uint32_t t, uint32_t i) {
+			logger->info("Message {} from thread {}", i, t);
+		});
+		logger->flush();
+
+		state.PauseTiming();
+		sink->Clear();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * MessageCount);
+}
+BENCHMARK(BM_LogLockedSink)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Time a caller spends logging a burst that fits in the ring, the drain runs outside the timed region
+static void BM_LogAsyncSinkBurst(benchmark::State &state)
+{
+	ScopedNullConsole console;
+
+	LogSystem log_system;
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < BurstCount; i++)
+		{
+			log_system.Log(LogSystem::LogLevel::Info, "Message {} from thread {}", i, 0);
+		}
+
+		state.PauseTiming();
+		log_system.Flush();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * BurstCount);
+}
+BENCHMARK(BM_LogAsyncSinkBurst)->Unit(benchmark::kMicrosecond);
+
+// The same burst through the previous locked sink, which formats and writes on the caller
+static void BM_LogLockedSinkBurst(benchmark::State &state)
+{
+	ScopedNullConsole console;
+
+	auto sink   = std::make_shared<LockedSink>();
+	auto logger = std::make_shared<spdlog::logger>("Benchmark", sink);
+	logger->set_level(spdlog::level::trace);
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < BurstCount; i++)
+		{
+			logger->info("Message {} from thread {}", i, 0);
+		}
+
+		state.PauseTiming();
+		logger->flush();
+		sink->Clear();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * BurstCount);
+}
+BENCHMARK(BM_LogLockedSinkBurst)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,68 @@
+#include <Geometry/Frustum.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t BoxCount = 100000;
+
+// Same layout as GPUScene::InstanceBound
+struct Bound
+{
+	AABB     aabb;
+	uint32_t mesh_id;
+	uint32_t meshlet_count;
+	bool     animated;
+};
+}        // namespace
+
+// Main view culling of 100k instance bounds, 0 tests one box at a time, 1 uses the batch test
+static void BM_FrustumCull(benchmark::State &state)
+{
+	bool batch = state.range(0) != 0;
+
+	std::mt19937                          rng(37);
+	std::uniform_real_distribution<float> position(-500.f, 500.f);
+
+	std::vector<Bound> bounds(BoxCount);
+	for (auto &bound : bounds)
+	{
+		glm::vec3 min = glm::vec3(position(rng), position(rng) * 0.1f, position(rng));
+		bound.aabb    = AABB(min, min + glm::vec3(4.f));
+	}
+
+	Frustum frustum(glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 300.f) * glm::lookAt(glm::vec3(0.f, 10.f, 0.f), glm::vec3(100.f, 0.f, 100.f), glm::vec3(0.f, 1.f, 0.f)));
+
+	std::vector<uint8_t> visible(BoxCount);
+	for (auto _ : state)
+	{
+		if (batch)
+		{
+			frustum.Intersect(&bounds[0].aabb, bounds.size(), sizeof(Bound), visible.data());
+		}
+		else
+		{
+			for (size_t i = 0; i < bounds.size(); i++)
+			{
+				visible[i] = frustum.Intersect(bounds[i].aabb);
+			}
+		}
+		benchmark::DoNotOptimize(visible.data());
+	}
+
+	size_t count = 0;
+	for (auto flag : visible)
+	{
+		count += flag != 0;
+	}
+
+	state.counters["Visible"] = static_cast<double>(count);
+	state.SetItemsProcessed(state.iterations() * BoxCount);
+}
+BENCHMARK(BM_FrustumCull)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
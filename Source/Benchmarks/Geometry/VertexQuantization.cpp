@@ -0,0 +1,106 @@
+#include <Geometry/VertexQuantization.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+struct Vertex
+{
+	glm::vec3 position;
+	glm::vec3 normal;
+	glm::vec3 tangent;
+	glm::vec2 texcoord;
+};
+
+// Matches the position, normal, tangent and texcoord part of the quantized mesh layouts
+struct QuantizedVertex
+{
+	uint16_t position[3];
+	uint16_t padding;
+	uint32_t normal;
+	uint32_t tangent;
+	uint32_t texcoord;
+};
+
+constexpr size_t VertexCount = 1 << 20;
+
+const std::vector<Vertex> &GetVertices()
+{
+	static std::vector<Vertex> vertices = []() {
+		std::mt19937                          rng(7);
+		std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+		std::vector<Vertex> vertices(VertexCount);
+		for (auto &v : vertices)
+		{
+			v.position = glm::vec3(dist(rng), dist(rng), dist(rng)) * 10.f;
+			v.normal   = glm::normalize(glm::vec3(dist(rng), dist(rng), dist(rng)) + glm::vec3(1e-3f));
+			v.tangent  = glm::normalize(glm::cross(v.normal, glm::vec3(0.f, 1.f, 0.f)) + glm::vec3(1e-3f));
+			v.texcoord = glm::vec2(dist(rng), dist(rng)) * 0.5f + 0.5f;
+		}
+		return vertices;
+	}();
+	return vertices;
+}
+}        // namespace
+
+// Import time cost of quantizing a mesh
+static void BM_QuantizeVertices(benchmark::State &state)
+{
+	const auto &vertices = GetVertices();
+
+	std::vector<QuantizedVertex> quantized(vertices.size());
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			EncodePosition(vertices[i].position, glm::vec3(-10.f), glm::vec3(20.f), quantized[i].position);
+			quantized[i].normal   = EncodeOctahedral(vertices[i].normal);
+			quantized[i].tangent  = EncodeOctahedral(vertices[i].tangent);
+			quantized[i].texcoord = EncodeHalf2(vertices[i].texcoord);
+		}
+		benchmark::DoNotOptimize(quantized.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * vertices.size());
+	state.counters["Bytes"]          = static_cast<double>(sizeof(Vertex));
+	state.counters["QuantizedBytes"] = static_cast<double>(sizeof(QuantizedVertex));
+}
+BENCHMARK(BM_QuantizeVertices)->Unit(benchmark::kMillisecond);
+
+// CPU reference of what the vertex shader pays per vertex
+static void BM_DequantizeVertices(benchmark::State &state)
+{
+	const auto &vertices = GetVertices();
+
+	std::vector<QuantizedVertex> quantized(vertices.size());
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		EncodePosition(vertices[i].position, glm::vec3(-10.f), glm::vec3(20.f), quantized[i].position);
+		quantized[i].normal   = EncodeOctahedral(vertices[i].normal);
+		quantized[i].tangent  = EncodeOctahedral(vertices[i].tangent);
+		quantized[i].texcoord = EncodeHalf2(vertices[i].texcoord);
+	}
+
+	std::vector<Vertex> decoded(vertices.size());
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < quantized.size(); i++)
+		{
+			decoded[i].position = DecodePosition(quantized[i].position, glm::vec3(-10.f), glm::vec3(20.f));
+			decoded[i].normal   = DecodeOctahedral(quantized[i].normal);
+			decoded[i].tangent  = DecodeOctahedral(quantized[i].tangent);
+			decoded[i].texcoord = DecodeHalf2(quantized[i].texcoord);
+		}
+		benchmark::DoNotOptimize(decoded.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * quantized.size());
+}
+BENCHMARK(BM_DequantizeVertices)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,91 @@
+#include <Core/Core.hpp>
+#include <Core/Plugin.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace Ilum;
+
+namespace
+{
+// 24 bit bitmap filled with one color
+void WriteBitmap(const std::filesystem::path &path, uint32_t size, uint8_t color)
+{
+	uint32_t row   = (size * 3 + 3) & ~3u;
+	uint32_t bytes = 54 + row * size;
+
+	uint8_t header[54] = {'B', 'M'};
+	std::memcpy(header + 2, &bytes, 4);
+	header[10] = 54;
+	header[14] = 40;
+	std::memcpy(header + 18, &size, 4);
+	std::memcpy(header + 22, &size, 4);
+	header[26] = 1;
+	header[28] = 24;
+
+	std::ofstream os(path, std::ios::binary);
+	os.write(reinterpret_cast<const char *>(header), sizeof(header));
+	std::vector<char> pixels(row * size, static_cast<char>(color));
+	os.write(pixels.data(), pixels.size());
+}
+
+// Objects of grid x grid quads, every object uses one of four textured materials
+std::string WriteModel(const std::string &name, uint32_t objects, uint32_t grid)
+{
+	auto directory = std::filesystem::temp_directory_path() / name;
+	std::filesystem::create_directories(directory);
+
+	std::ofstream mtl(directory / "model.mtl");
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		WriteBitmap(directory / fmt::format("texture{}.bmp", i), 16, static_cast<uint8_t>(i * 60));
+		mtl << fmt::format("newmtl material{}\nmap_Kd texture{}.bmp\n", i, i);
+	}
+
+	std::ofstream obj(directory / "model.obj");
+	obj << "mtllib model.mtl\n";
+
+	uint32_t base = 1;
+	for (uint32_t o = 0; o < objects; o++)
+	{
+		obj << fmt::format("o object{}\nusemtl material{}\n", o, o % 4);
+		for (uint32_t y = 0; y <= grid; y++)
+		{
+			for (uint32_t x = 0; x <= grid; x++)
+			{
+				obj << fmt::format("v {} {} {}\nvt {} {}\n", x, y, o, float(x) / grid, float(y) / grid);
+			}
+		}
+		for (uint32_t y = 0; y < grid; y++)
+		{
+			for (uint32_t x = 0; x < grid; x++)
+			{
+				uint32_t i = base + y * (grid + 1) + x;
+				obj << fmt::format("f {0}/{0} {1}/{1} {2}/{2} {3}/{3}\n", i, i + 1, i + grid + 2, i + grid + 1);
+			}
+		}
+		base += (grid + 1) * (grid + 1);
+	}
+
+	return (directory / "model.obj").string();
+}
+}        // namespace
+
+// Parse and process a model of 256 meshes with 8K triangles each, serial (0) or on the job system (1)
+static void BM_AssimpProcess(benchmark::State &state)
+{
+	static std::string path = WriteModel("IlumBenchmarkAssimp", 256, 64);
+
+	bool parallel = state.range(0) != 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(PluginManager::GetInstance().Call<size_t>("shared/Importer/Importer.Assimp.dll", "ProcessModel", path, parallel));
+	}
+
+	state.SetItemsProcessed(state.iterations() * 256);
+}
+BENCHMARK(BM_AssimpProcess)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
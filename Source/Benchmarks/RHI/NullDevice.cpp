@@ -0,0 +1,72 @@
+#include "NullRHI.hpp"
+
+#include <RHI/RHIBuffer.hpp>
+#include <RHI/RHICommand.hpp>
+#include <RHI/RHIFrame.hpp>
+#include <RHI/RHIQueue.hpp>
+#include <RHI/RHITexture.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+// Record and submit a frame of passes that each render into a texture and hand it to the next as a shader resource
+// This is the headless CPU cost of command recording plus barrier validation, for 16 to 1024 passes
+static void BM_NullFrameSubmit(benchmark::State &state)
+{
+	auto  device     = Ilum::Test::CreateNullDevice();
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+
+	auto frame = RHIFrame::Create(device.get());
+	auto queue = RHIQueue::Create(device.get());
+
+	uint32_t pass_count = static_cast<uint32_t>(state.range(0));
+
+	std::vector<std::unique_ptr<RHITexture>> textures;
+	for (uint32_t i = 0; i < pass_count; i++)
+	{
+		textures.emplace_back(RHITexture::Create2D(device.get(), 256, 256, RHIFormat::R8G8B8A8_UNORM, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource, false));
+	}
+
+	RHIResourceState initial_state = RHIResourceState::Undefined;
+
+	for (auto _ : state)
+	{
+		frame->Reset();
+
+		auto *cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Graphics);
+		cmd_buffer->Begin();
+		for (auto &texture : textures)
+		{
+			cmd_buffer->ResourceStateTransition({TextureStateTransition{texture.get(), initial_state, RHIResourceState::RenderTarget}}, {});
+			cmd_buffer->Draw(3, 1, 0, 0);
+			cmd_buffer->ResourceStateTransition({TextureStateTransition{texture.get(), RHIResourceState::RenderTarget, RHIResourceState::ShaderResource}}, {});
+		}
+		cmd_buffer->End();
+		queue->Execute(cmd_buffer);
+
+		initial_state = RHIResourceState::ShaderResource;
+	}
+
+	state.SetItemsProcessed(state.iterations() * pass_count);
+	state.counters["barrier_errors"] = static_cast<double>(statistics.barrier_errors.load());
+}
+BENCHMARK(BM_NullFrameSubmit)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+
+// Create and release a transient buffer and texture, the per-resource cost of the Null factories and allocation tracking
+static void BM_NullResourceChurn(benchmark::State &state)
+{
+	auto  device     = Ilum::Test::CreateNullDevice();
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+
+	for (auto _ : state)
+	{
+		auto buffer  = RHIBuffer::Create(device.get(), BufferDesc{"Buffer", RHIBufferUsage::ConstantBuffer, RHIMemoryUsage::CPU_TO_GPU, 4096, 0, 0});
+		auto texture = RHITexture::Create2D(device.get(), 1024, 1024, RHIFormat::R8G8B8A8_UNORM, RHITextureUsage::ShaderResource, true);
+		benchmark::DoNotOptimize(buffer);
+		benchmark::DoNotOptimize(texture);
+	}
+
+	state.counters["peak_memory"] = static_cast<double>(statistics.peak_memory.load());
+}
+BENCHMARK(BM_NullResourceChurn);
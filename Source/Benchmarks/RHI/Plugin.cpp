@@ -0,0 +1,65 @@
+#include <RHI/RHIBuffer.hpp>
+#include <RHI/RHIDevice.hpp>
+#include <RHI/RHIPlugin.hpp>
+#include <RHI/RHITexture.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+namespace
+{
+RHIDevice *GetNullDevice()
+{
+	static std::unique_ptr<RHIDevice> device = RHIDevice::Create("Null");
+	return device.get();
+}
+
+TextureDesc GetTextureDesc()
+{
+	TextureDesc desc = {};
+	desc.width       = 1024;
+	desc.height      = 1024;
+	desc.format      = RHIFormat::R8G8B8A8_UNORM;
+	return desc;
+}
+}        // namespace
+
+// A cheap plugin entry point called by library path and name, the way RHI factories used to dispatch
+static void BM_PluginCallByName(benchmark::State &state)
+{
+	RHIDevice  *device = GetNullDevice();
+	TextureDesc desc   = GetTextureDesc();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(PluginManager::GetInstance().Call<size_t, RHIDevice *, const TextureDesc &>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "GetTextureMemorySize", device, desc));
+	}
+}
+BENCHMARK(BM_PluginCallByName);
+
+// The same entry point through the device's resolved plugin table
+static void BM_PluginCallResolved(benchmark::State &state)
+{
+	RHIDevice  *device = GetNullDevice();
+	TextureDesc desc   = GetTextureDesc();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(RHITexture::QueryMemorySize(device, desc));
+	}
+}
+BENCHMARK(BM_PluginCallResolved);
+
+// Buffer creation on the null backend, dominated by the plugin's own allocation
+static void BM_PluginCreateBuffer(benchmark::State &state)
+{
+	RHIDevice *device = GetNullDevice();
+	BufferDesc desc   = {"Buffer", RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU, 256, 0, 0};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(RHIBuffer::Create(device, desc));
+	}
+}
+BENCHMARK(BM_PluginCreateBuffer);
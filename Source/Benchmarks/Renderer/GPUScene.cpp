@@ -0,0 +1,51 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/RenderData.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t InstanceCount = 50000;
+}        // namespace
+
+// Per frame instance upload, full rebuild versus incremental with 0 (static), 1, 10 and 100 percent of the instances moving
+static void BM_GPUSceneUpload(benchmark::State &state)
+{
+	static RHIContext rhi_context(nullptr, "Null");
+
+	bool     rebuild = state.range(0) < 0;
+	uint32_t percent = rebuild ? 100 : static_cast<uint32_t>(state.range(0));
+
+	std::vector<GPUScene::Instance> instances(InstanceCount);
+
+	std::unique_ptr<RHIBuffer> buffer;
+	UploadInstances(&rhi_context, buffer, instances, nullptr);
+
+	// Scattered movers, sorted as the renderer collects them
+	std::mt19937          rng(7);
+	std::vector<uint32_t> dirty;
+	for (uint32_t i = 0; i < InstanceCount; i++)
+	{
+		if (rng() % 100 < percent)
+		{
+			dirty.push_back(i);
+		}
+	}
+
+	uint64_t bytes = 0;
+	for (auto _ : state)
+	{
+		for (auto i : dirty)
+		{
+			instances[i].transform[3][0] += 1.f;
+		}
+		bytes += UploadInstances(&rhi_context, buffer, instances, rebuild ? nullptr : &dirty);
+	}
+
+	state.counters["UploadBytes"] = benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_GPUSceneUpload)->Arg(-1)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,85 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/ShadowCache.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t CasterCount = 10000;
+constexpr uint32_t LayerSize   = 8;        // 8 x 8 grid of layers, 64 in total
+}        // namespace
+
+// Per frame shadow cache bookkeeping over 10k casters and 64 layers with 0, 1 and 10 percent of the casters moving
+static void BM_ShadowCacheUpdate(benchmark::State &state)
+{
+	uint32_t percent = static_cast<uint32_t>(state.range(0));
+
+	std::mt19937                          rng(3);
+	std::uniform_real_distribution<float> position(0.f, static_cast<float>(LayerSize) * 10.f);
+
+	std::vector<GPUScene::InstanceBound> bounds(CasterCount);
+	for (uint32_t i = 0; i < CasterCount; i++)
+	{
+		glm::vec3 min     = glm::vec3(position(rng), 0.f, position(rng));
+		bounds[i].aabb    = AABB(min, min + glm::vec3(1.f));
+		bounds[i].mesh_id = i;
+	}
+
+	std::vector<ShadowLayerCache::Layer> layers;
+	for (uint32_t i = 0; i < LayerSize * LayerSize; i++)
+	{
+		glm::vec3 min = glm::vec3(static_cast<float>(i % LayerSize) * 10.f, -1.f, static_cast<float>(i / LayerSize) * 10.f);
+		glm::vec3 max = min + glm::vec3(10.f, 3.f, 10.f);
+
+		Frustum frustum;
+		frustum.planes = {
+		    glm::vec4(1.f, 0.f, 0.f, -min.x),
+		    glm::vec4(-1.f, 0.f, 0.f, max.x),
+		    glm::vec4(0.f, 1.f, 0.f, -min.y),
+		    glm::vec4(0.f, -1.f, 0.f, max.y),
+		    glm::vec4(0.f, 0.f, 1.f, -min.z),
+		    glm::vec4(0.f, 0.f, -1.f, max.z),
+		};
+		layers.push_back(ShadowLayerCache::Layer{i, i, frustum});
+	}
+
+	// The same casters keep moving, as they would in a game
+	uint32_t moving_count = CasterCount * percent / 100;
+
+	ShadowCasterHistory    history;
+	ShadowLayerCache       cache;
+	ShadowLayerCache::Plan plan;
+	cache.Reset(static_cast<uint32_t>(layers.size()));
+
+	history.Update(bounds);
+	cache.Update(layers, {ShadowLayerCache::Casters{&bounds, &history.GetDynamic()}}, 0.f, plan);
+
+	uint64_t rebuilt    = 0;
+	uint64_t composited = 0;
+	float    offset     = 0.01f;
+	for (auto _ : state)
+	{
+		// Bob up and down so the casters never leave their layers
+		for (uint32_t i = 0; i < moving_count; i++)
+		{
+			bounds[i].aabb.min.y += offset;
+			bounds[i].aabb.max.y += offset;
+		}
+		offset = -offset;
+
+		history.Update(bounds);
+		cache.Update(layers, {ShadowLayerCache::Casters{&bounds, &history.GetDynamic()}}, 0.f, plan);
+
+		rebuilt += plan.rebuild.size();
+		composited += plan.composite.size();
+	}
+
+	// Layers redrawn per frame, the uncached pass redrew all 64 with every caster
+	state.counters["RebuiltLayers"]    = benchmark::Counter(static_cast<double>(rebuilt), benchmark::Counter::kAvgIterations);
+	state.counters["CompositedLayers"] = benchmark::Counter(static_cast<double>(composited), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ShadowCacheUpdate)->Arg(0)->Arg(1)->Arg(10)->Unit(benchmark::kMicrosecond);
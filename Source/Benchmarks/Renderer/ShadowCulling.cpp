@@ -0,0 +1,58 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/ShadowCulling.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t InstanceCount = 10000;
+}        // namespace
+
+// Shadow work lists for 10k instances spread over 400 units, seen by 1, 4 or 16 point lights (6 faces each)
+static void BM_ShadowTaskCulling(benchmark::State &state)
+{
+	uint32_t light_count = static_cast<uint32_t>(state.range(0));
+
+	std::mt19937                            rng(23);
+	std::uniform_real_distribution<float>   position(-200.f, 200.f);
+	std::uniform_int_distribution<uint32_t> meshlets(1, 256);
+
+	std::vector<GPUScene::InstanceBound> bounds(InstanceCount);
+	uint32_t                             max_meshlet_count = 0;
+	for (uint32_t i = 0; i < InstanceCount; i++)
+	{
+		glm::vec3 min           = glm::vec3(position(rng), position(rng) * 0.05f, position(rng));
+		bounds[i].aabb          = AABB(min, min + glm::vec3(2.f));
+		bounds[i].mesh_id       = i;
+		bounds[i].meshlet_count = meshlets(rng);
+		max_meshlet_count       = std::max(max_meshlet_count, bounds[i].meshlet_count);
+	}
+
+	// Each cube face sees roughly a sixth of the scene
+	std::vector<ShadowView> views;
+	for (uint32_t light = 0; light < light_count; light++)
+	{
+		glm::vec3 light_position = glm::vec3(position(rng), 5.f, position(rng));
+		for (uint32_t face = 0; face < 6; face++)
+		{
+			views.push_back(ShadowView{CubeFaceFrustum(light_position, face).planes, light * 6 + face});
+		}
+	}
+
+	std::vector<ShadowTask> tasks;
+	for (auto _ : state)
+	{
+		CullShadowTasks(views, bounds, nullptr, 0, tasks);
+		benchmark::DoNotOptimize(tasks.data());
+	}
+
+	// Launched task groups against the dense max_meshlet_count x instance x view grid they replace
+	state.counters["TaskGroups"]      = static_cast<double>(tasks.size());
+	state.counters["DenseTaskGroups"] = static_cast<double>((max_meshlet_count + ShadowTaskSize - 1) / ShadowTaskSize * static_cast<uint64_t>(InstanceCount) * views.size());
+	state.SetItemsProcessed(state.iterations() * InstanceCount * views.size());
+}
+BENCHMARK(BM_ShadowTaskCulling)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,42 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/RenderData.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+// Laying out the shared bone palette when animations are reloaded, for 64 to 16k clips with a tenth of them not evaluated
+static void BM_SkinningTable(benchmark::State &state)
+{
+	uint32_t clip_count = static_cast<uint32_t>(state.range(0));
+
+	std::mt19937                            rng(5);
+	std::uniform_int_distribution<uint32_t> bones(1, 256);
+	std::uniform_int_distribution<uint32_t> frames(0, 9);
+
+	std::vector<uint32_t> bone_counts(clip_count);
+	std::vector<uint32_t> frame_counts(clip_count);
+	for (uint32_t i = 0; i < clip_count; i++)
+	{
+		bone_counts[i]  = bones(rng);
+		frame_counts[i] = frames(rng) * 30;
+	}
+
+	std::vector<GPUScene::AnimationBuffer::SkinningEntry> table;
+
+	uint32_t thread_count = 0;
+	for (auto _ : state)
+	{
+		thread_count = BuildSkinningTable(bone_counts, frame_counts, table);
+		bool valid   = ValidateSkinningTable(table, thread_count);
+		benchmark::DoNotOptimize(valid);
+		benchmark::DoNotOptimize(table.data());
+	}
+
+	state.counters["PaletteMatrices"] = static_cast<double>(thread_count);
+	state.counters["TableBytes"]      = static_cast<double>(table.size() * sizeof(GPUScene::AnimationBuffer::SkinningEntry));
+	state.SetItemsProcessed(state.iterations() * clip_count);
+}
+BENCHMARK(BM_SkinningTable)->Arg(64)->Arg(1024)->Arg(16384)->Unit(benchmark::kMicrosecond);
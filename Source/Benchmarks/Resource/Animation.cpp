@@ -0,0 +1,100 @@
+#include <RHI/RHITexture.hpp>
+#include <Resource/Resource/Animation.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t BoneCount   = 1000;
+constexpr float    ClipLength  = 600.f;
+constexpr float    KeyInterval = 1.f / 8.f;
+
+// 1000 bones over a 10 minute clip, 4800 keys per channel
+const std::vector<Bone> &GetBones()
+{
+	static std::vector<Bone> bones = []() {
+		std::vector<Bone> bones;
+		bones.reserve(BoneCount);
+		for (uint32_t i = 0; i < BoneCount; i++)
+		{
+			std::vector<Bone::KeyPosition> positions;
+			std::vector<Bone::KeyRotation> rotations;
+			std::vector<Bone::KeyScale>    scales;
+			for (float time = 0.f; time <= ClipLength; time += KeyInterval)
+			{
+				float phase = time + static_cast<float>(i);
+				positions.push_back(Bone::KeyPosition{glm::vec3(glm::sin(phase), glm::cos(phase), 0.f), time});
+				rotations.push_back(Bone::KeyRotation{glm::angleAxis(phase, glm::vec3(0.f, 1.f, 0.f)), time});
+				scales.push_back(Bone::KeyScale{glm::vec3(1.f), time});
+			}
+			bones.emplace_back(fmt::format("Bone{}", i), i, glm::mat4(1.f), std::move(positions), std::move(rotations), std::move(scales));
+		}
+		return bones;
+	}();
+	return bones;
+}
+}        // namespace
+
+// One frame of every bone per iteration, playback advancing at 30 fps
+// 0: binary search only, 1: per-bone cursors, 2: per-bone cursors with random seeks
+static void BM_AnimationSample(benchmark::State &state)
+{
+	const auto &bones = GetBones();
+
+	std::vector<Bone::Cursor> cursors(bones.size());
+	std::vector<glm::mat4>    matrices(bones.size());
+
+	bool use_cursor = state.range(0) != 0;
+	bool seek       = state.range(0) == 2;
+
+	std::mt19937                          rng(7);
+	std::uniform_real_distribution<float> dist(0.f, ClipLength);
+
+	float time = 0.f;
+	for (auto _ : state)
+	{
+		time = seek ? dist(rng) : std::fmod(time + 1.f / 30.f, ClipLength);
+		for (size_t i = 0; i < bones.size(); i++)
+		{
+			matrices[i] = bones[i].GetLocalTransform(time, use_cursor ? &cursors[i] : nullptr);
+		}
+		benchmark::DoNotOptimize(matrices.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * bones.size());
+}
+BENCHMARK(BM_AnimationSample)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMicrosecond);
+
+// Import time keyframe reduction of one bone with a minute of 30 fps keys, motion with a slow and a fast component
+static void BM_AnimationCompress(benchmark::State &state)
+{
+	std::vector<Bone::KeyPosition> positions;
+	std::vector<Bone::KeyRotation> rotations;
+	std::vector<Bone::KeyScale>    scales;
+	for (float time = 0.f; time <= 60.f; time += 1.f / 30.f)
+	{
+		float swing = glm::sin(time) + 0.05f * glm::sin(time * 7.f);
+		positions.push_back(Bone::KeyPosition{glm::vec3(swing, 1.f, 0.f), time});
+		rotations.push_back(Bone::KeyRotation{glm::angleAxis(swing, glm::vec3(0.f, 0.f, 1.f)), time});
+		scales.push_back(Bone::KeyScale{glm::vec3(1.f), time});
+	}
+
+	Bone bone = Bone("Bone", 0, glm::mat4(1.f), std::move(positions), std::move(rotations), std::move(scales));
+
+	size_t key_count            = bone.GetKeyCount();
+	size_t compressed_key_count = 0;
+	for (auto _ : state)
+	{
+		Bone compressed = bone;
+		compressed.Compress(1e-3f, 1.f);
+		compressed_key_count = compressed.GetKeyCount();
+	}
+
+	state.SetItemsProcessed(state.iterations() * key_count);
+	state.counters["Ratio"] = static_cast<double>(key_count) / static_cast<double>(std::max<size_t>(compressed_key_count, 1));
+}
+BENCHMARK(BM_AnimationCompress)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,156 @@
+#include <Core/Path.hpp>
+#include <RHI/RHIContext.hpp>
+#include <Resource/BinaryAsset.hpp>
+#include <Resource/Resource/Mesh.hpp>
+#include <Resource/Resource/Texture2D.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t GridSize    = 512;         // 262144 vertices, 1.5M indices
+constexpr uint32_t TextureSize = 2048;        // 16 MiB of RGBA8
+
+// The cereal asset keeps the whole payload, the binary one is converted from it so both hold the same data
+std::string GetAssetName(ResourceType type, bool binary)
+{
+	return fmt::format("BenchmarkBinaryAsset{}{}", binary ? "Mapped" : "Cereal", (uint32_t) type);
+}
+
+size_t GetPayloadSize(ResourceType type)
+{
+	return type == ResourceType::Mesh ?
+	           GridSize * GridSize * sizeof(Resource<ResourceType::Mesh>::Vertex) + (GridSize - 1) * (GridSize - 1) * 6 * sizeof(uint32_t) :
+	           4ull * TextureSize * TextureSize;
+}
+
+void WriteLegacyMesh(const std::string &name)
+{
+	std::vector<Resource<ResourceType::Mesh>::Vertex> vertices(GridSize * GridSize);
+	for (uint32_t y = 0; y < GridSize; y++)
+	{
+		for (uint32_t x = 0; x < GridSize; x++)
+		{
+			auto &vertex     = vertices[y * GridSize + x];
+			vertex.position  = glm::vec3(static_cast<float>(x), 0.f, static_cast<float>(y));
+			vertex.normal    = glm::vec3(0.f, 1.f, 0.f);
+			vertex.tangent   = glm::vec3(1.f, 0.f, 0.f);
+			vertex.texcoord0 = glm::vec2(x, y) / static_cast<float>(GridSize);
+			vertex.texcoord1 = vertex.texcoord0;
+		}
+	}
+
+	std::vector<uint32_t> indices;
+	indices.reserve((GridSize - 1) * (GridSize - 1) * 6);
+	for (uint32_t y = 0; y + 1 < GridSize; y++)
+	{
+		for (uint32_t x = 0; x + 1 < GridSize; x++)
+		{
+			uint32_t i = y * GridSize + x;
+			indices.insert(indices.end(), {i, i + GridSize, i + 1, i + 1, i + GridSize, i + GridSize + 1});
+		}
+	}
+
+	std::vector<uint8_t>  thumbnail_data(4 * 128 * 128);
+	std::vector<Meshlet>  meshlets;
+	std::vector<uint32_t> meshlet_data;
+
+	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", name, (uint32_t) ResourceType::Mesh), thumbnail_data, vertices, indices, meshlets, meshlet_data);
+}
+
+void WriteLegacyTexture(const std::string &name)
+{
+	TextureDesc desc = {};
+	desc.name        = name;
+	desc.width       = TextureSize;
+	desc.height      = TextureSize;
+	desc.format      = RHIFormat::R8G8B8A8_UNORM;
+	desc.usage       = RHITextureUsage::ShaderResource | RHITextureUsage::Transfer;
+
+	std::vector<uint8_t> thumbnail_data(4 * 128 * 128);
+	std::vector<uint8_t> data(4ull * TextureSize * TextureSize, 0x80);
+
+	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", name, (uint32_t) ResourceType::Texture2D), thumbnail_data, desc, data);
+}
+
+// Writes the benchmark assets to Asset/Meta once, they are removed again when the process exits
+void PrepareAssets()
+{
+	static bool prepared = false;
+	if (prepared)
+	{
+		return;
+	}
+
+	for (auto type : {ResourceType::Mesh, ResourceType::Texture2D})
+	{
+		for (bool binary : {false, true})
+		{
+			std::string name = GetAssetName(type, binary);
+			if (type == ResourceType::Mesh)
+			{
+				WriteLegacyMesh(name);
+			}
+			else
+			{
+				WriteLegacyTexture(name);
+			}
+
+			if (binary)
+			{
+				BinaryAsset::Convert(name, type);
+			}
+		}
+	}
+
+	std::atexit([]() {
+		for (auto type : {ResourceType::Mesh, ResourceType::Texture2D})
+		{
+			for (bool binary : {false, true})
+			{
+				Path::GetInstance().DeletePath(fmt::format("Asset/Meta/{}.{}.asset", GetAssetName(type, binary), (uint32_t) type));
+				Path::GetInstance().DeletePath(BinaryAsset::GetPath(GetAssetName(type, binary), type));
+			}
+		}
+	});
+
+	prepared = true;
+}
+
+// Decoding plus staging into GPU buffers, mapped pages are only faulted in by the staging copy
+template <ResourceType Type>
+void LoadAsset(benchmark::State &state)
+{
+	RHIContext rhi_context(nullptr, "Null");
+	PrepareAssets();
+
+	bool        binary = state.range(0) != 0;
+	std::string name   = GetAssetName(Type, binary);
+
+	for (auto _ : state)
+	{
+		Resource<Type> resource(&rhi_context, name);
+		resource.Load(&rhi_context);
+		benchmark::DoNotOptimize(resource.Validate());
+	}
+
+	state.SetLabel(binary ? "mapped .bin" : "cereal .asset");
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(GetPayloadSize(Type)));
+}
+}        // namespace
+
+// The same mesh loaded from the legacy cereal payload (0) and from the memory-mapped binary asset (1)
+static void BM_MeshLoad(benchmark::State &state)
+{
+	LoadAsset<ResourceType::Mesh>(state);
+}
+BENCHMARK(BM_MeshLoad)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// The same texture loaded from the legacy cereal payload (0) and from the memory-mapped binary asset (1)
+static void BM_Texture2DLoad(benchmark::State &state)
+{
+	LoadAsset<ResourceType::Texture2D>(state);
+}
+BENCHMARK(BM_Texture2DLoad)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,132 @@
+#include <Core/Path.hpp>
+#include <RHI/RHIContext.hpp>
+#include <Resource/BinaryAsset.hpp>
+#include <Resource/Resource/Texture2D.hpp>
+#include <Resource/ResourceManager.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t TextureCount = 64;
+constexpr uint32_t TextureSize  = 1024;
+
+std::string GetTextureName(uint32_t i)
+{
+	return fmt::format("BenchmarkStreaming{}", i);
+}
+
+// Writes the benchmark textures to Asset/Meta once, they are removed again when the process exits
+void PrepareAssets(RHIContext *rhi_context)
+{
+	static bool prepared = false;
+	if (prepared)
+	{
+		return;
+	}
+
+	for (uint32_t i = 0; i < TextureCount; i++)
+	{
+		TextureDesc desc = {};
+		desc.name        = GetTextureName(i);
+		desc.width       = TextureSize;
+		desc.height      = TextureSize;
+		desc.format      = RHIFormat::R8G8B8A8_UNORM;
+		desc.usage       = RHITextureUsage::ShaderResource | RHITextureUsage::Transfer;
+
+		std::vector<uint8_t> data(4ull * TextureSize * TextureSize, static_cast<uint8_t>(i));
+		Resource<ResourceType::Texture2D>(rhi_context, std::move(data), desc);
+	}
+
+	std::atexit([]() {
+		for (uint32_t i = 0; i < TextureCount; i++)
+		{
+			Path::GetInstance().DeletePath(fmt::format("Asset/Meta/{}.{}.asset", GetTextureName(i), (uint32_t) ResourceType::Texture2D));
+			Path::GetInstance().DeletePath(BinaryAsset::GetPath(GetTextureName(i), ResourceType::Texture2D));
+		}
+	});
+
+	prepared = true;
+}
+}        // namespace
+
+// Every texture is fetched with a blocking Get in one frame, the frame stalls until all of them are resident
+static void BM_ResourceGet(benchmark::State &state)
+{
+	RHIContext rhi_context(nullptr, "Null");
+	PrepareAssets(&rhi_context);
+
+	double stall = 0.0;
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto manager = std::make_unique<ResourceManager>(&rhi_context);
+		state.ResumeTiming();
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < TextureCount; i++)
+		{
+			benchmark::DoNotOptimize(manager->Get<ResourceType::Texture2D>(GetTextureName(i)));
+		}
+		stall += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		state.PauseTiming();
+		manager.reset();
+		state.ResumeTiming();
+	}
+
+	state.counters["WorstFrame(ms)"] = benchmark::Counter(stall / static_cast<double>(state.iterations()));
+	state.SetBytesProcessed(state.iterations() * TextureCount * 4ll * TextureSize * TextureSize);
+}
+BENCHMARK(BM_ResourceGet)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Every texture is requested in one frame and streamed in by following ticks, the longest tick is the worst frame stall
+static void BM_ResourceRequest(benchmark::State &state)
+{
+	RHIContext rhi_context(nullptr, "Null");
+	PrepareAssets(&rhi_context);
+
+	double max_stall = 0.0;
+	double ticks     = 0.0;
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto manager = std::make_unique<ResourceManager>(&rhi_context);
+		state.ResumeTiming();
+
+		std::vector<Resource<ResourceType::Texture2D> *> textures;
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < TextureCount; i++)
+		{
+			textures.push_back(manager->Request<ResourceType::Texture2D>(GetTextureName(i)));
+		}
+		max_stall = std::max(max_stall, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+
+		bool resident = false;
+		while (!resident)
+		{
+			start = std::chrono::high_resolution_clock::now();
+			manager->Tick();
+			max_stall = std::max(max_stall, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+			ticks++;
+
+			resident = std::all_of(textures.begin(), textures.end(), [](auto *texture) { return texture->GetState() == ResourceState::Resident; });
+		}
+
+		state.PauseTiming();
+		manager.reset();
+		state.ResumeTiming();
+	}
+
+	state.counters["WorstFrame(ms)"] = benchmark::Counter(max_stall);
+	state.counters["Ticks"]          = benchmark::Counter(ticks / static_cast<double>(state.iterations()));
+	state.SetBytesProcessed(state.iterations() * TextureCount * 4ll * TextureSize * TextureSize);
+}
+BENCHMARK(BM_ResourceRequest)->Unit(benchmark::kMillisecond)->UseRealTime();
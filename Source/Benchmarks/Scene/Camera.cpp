@@ -0,0 +1,40 @@
+#include <Scene/Components/Camera/PerspectiveCamera.hpp>
+#include <Scene/Components/Transform.hpp>
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+// Frustum planes of an unchanged camera, 0 extracts them from the view projection on every call as before, 1 reads the cache
+static void BM_CameraFrustum(benchmark::State &state)
+{
+	bool cached = state.range(0) != 0;
+
+	Scene scene;
+
+	auto *node   = scene.CreateNode();
+	auto *camera = node->AddComponent<Cmpt::PerspectiveCamera>(std::make_unique<Cmpt::PerspectiveCamera>(node));
+	node->AddComponent<Cmpt::Transform>(std::make_unique<Cmpt::Transform>(node))->SetTranslation(glm::vec3(0.f, 2.f, 10.f));
+
+	// Build the projection once, then clear the update flag so later calls hit the cache
+	scene.Update();
+	camera->SetAspect(16.f / 9.f);
+	camera->GetFrustum();
+	scene.Update();
+
+	for (auto _ : state)
+	{
+		if (cached)
+		{
+			benchmark::DoNotOptimize(camera->GetFrustumPlanes().data());
+		}
+		else
+		{
+			Frustum frustum(camera->GetViewProjectionMatrix());
+			benchmark::DoNotOptimize(frustum.planes.data());
+		}
+	}
+}
+BENCHMARK(BM_CameraFrustum)->Arg(0)->Arg(1);
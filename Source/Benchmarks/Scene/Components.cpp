@@ -0,0 +1,82 @@
+#include "AllocationCounter.hpp"
+
+#include <Scene/Components/AllComponents.hpp>
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t NodeCount = 10000;
+
+std::unique_ptr<Scene> CreateScene()
+{
+	auto scene = std::make_unique<Scene>();
+	for (uint32_t i = 0; i < NodeCount; i++)
+	{
+		auto *node = scene->CreateNode();
+		node->AddComponent<Cmpt::Transform>(std::make_unique<Cmpt::Transform>(node));
+		if (i % 2 == 0)
+		{
+			node->AddComponent<Cmpt::MeshRenderer>(std::make_unique<Cmpt::MeshRenderer>(node));
+		}
+		else
+		{
+			node->AddComponent<Cmpt::PointLight>(std::make_unique<Cmpt::PointLight>(node));
+		}
+	}
+	return scene;
+}
+
+// The component queries the renderer makes every frame
+template <bool Copy>
+size_t QueryFrame(Scene &scene)
+{
+	size_t count = 0;
+
+	auto query = [&](auto view) {
+		if constexpr (Copy)
+		{
+			// What GetComponents used to return
+			std::vector<typename decltype(view)::Iterator::value_type> copy(view.begin(), view.end());
+			count += copy.size();
+		}
+		else
+		{
+			count += view.size();
+		}
+	};
+
+	query(scene.GetComponents<Cmpt::MeshRenderer>());
+	query(scene.GetComponents<Cmpt::SkinnedMeshRenderer>());
+	query(scene.GetComponents<Cmpt::PointLight>());
+	query(scene.GetComponents<Cmpt::SpotLight>());
+	query(scene.GetComponents<Cmpt::DirectionalLight>());
+	query(scene.GetComponents<Cmpt::RectLight>());
+	query(scene.GetComponents<Cmpt::EnvironmentLight>());
+	query(scene.GetComponents<Cmpt::MeshRenderer>());
+	query(scene.GetComponents<Cmpt::SkinnedMeshRenderer>());
+
+	return count;
+}
+}        // namespace
+
+// Per frame component queries, copying into vectors as before versus walking the per-type views
+static void BM_SceneComponentQueries(benchmark::State &state)
+{
+	auto scene = CreateScene();
+
+	bool copy = state.range(0) != 0;
+
+	size_t allocations = Ilum::Test::GetAllocationCount();
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(copy ? QueryFrame<true>(*scene) : QueryFrame<false>(*scene));
+	}
+
+	state.counters["Allocations"] = benchmark::Counter(static_cast<double>(Ilum::Test::GetAllocationCount() - allocations), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_SceneComponentQueries)->Arg(1)->Arg(0);
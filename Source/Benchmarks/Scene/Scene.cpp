@@ -0,0 +1,84 @@
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t NodeCount = 100000;
+}        // namespace
+
+// Erasing 100k roots one by one through their handles, in creation order, reversed and shuffled
+static void BM_SceneEraseNodes(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto                    scene = std::make_unique<Scene>();
+		std::vector<NodeHandle> handles;
+		handles.reserve(NodeCount);
+		for (uint32_t i = 0; i < NodeCount; i++)
+		{
+			handles.push_back(scene->CreateNode()->GetHandle());
+		}
+		if (state.range(0) == 1)
+		{
+			std::reverse(handles.begin(), handles.end());
+		}
+		else if (state.range(0) == 2)
+		{
+			std::shuffle(handles.begin(), handles.end(), std::mt19937(7));
+		}
+		state.ResumeTiming();
+
+		for (auto &handle : handles)
+		{
+			scene->EraseNode(handle);
+		}
+
+		// Scene destruction is not part of the measurement
+		state.PauseTiming();
+		scene.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * NodeCount);
+}
+BENCHMARK(BM_SceneEraseNodes)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
+// Erasing a 100k node tree of the given fanout through its root
+static void BM_SceneEraseSubtree(benchmark::State &state)
+{
+	uint32_t fanout = static_cast<uint32_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto                scene = std::make_unique<Scene>();
+		std::vector<Node *> nodes;
+		nodes.reserve(NodeCount);
+		for (uint32_t i = 0; i < NodeCount; i++)
+		{
+			nodes.push_back(scene->CreateNode());
+			if (i > 0)
+			{
+				nodes.back()->SetParent(nodes[(i - 1) / fanout]);
+			}
+		}
+		state.ResumeTiming();
+
+		scene->EraseNode(nodes[0]);
+
+		state.PauseTiming();
+		scene.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * NodeCount);
+}
+BENCHMARK(BM_SceneEraseSubtree)->Arg(2)->Arg(64)->Arg(NodeCount)->Unit(benchmark::kMillisecond);
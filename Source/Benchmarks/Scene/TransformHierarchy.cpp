@@ -0,0 +1,77 @@
+#include <Scene/Components/Transform.hpp>
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Ilum;
+
+namespace
+{
+constexpr uint32_t NodeCount = 100000;
+
+// Every node gets fanout children until the node count is reached, fanout 2 is 17 levels deep and fanout 64 is 3
+// A single chain is left out, the recursive path walks to the root for every node and would recurse 100k frames deep
+std::unique_ptr<Scene> CreateScene(uint32_t fanout, std::vector<Cmpt::Transform *> &transforms)
+{
+	auto scene = std::make_unique<Scene>();
+
+	transforms.clear();
+	transforms.reserve(NodeCount);
+	for (uint32_t i = 0; i < NodeCount; i++)
+	{
+		auto *node = scene->CreateNode();
+		if (i > 0)
+		{
+			node->SetParent(transforms[(i - 1) / fanout]->GetNode());
+		}
+		auto *transform = node->AddComponent<Cmpt::Transform>(std::make_unique<Cmpt::Transform>(node));
+		transform->SetTranslation(glm::vec3(1.f, 0.f, 0.f));
+		transform->SetRotation(glm::vec3(0.f, 1.f, 0.f));
+		transforms.push_back(transform);
+	}
+
+	scene->Update();
+
+	return scene;
+}
+}        // namespace
+
+// Moving the root, every world matrix is then resolved through the lazy, recursive GetWorldTransform
+static void BM_TransformRecursive(benchmark::State &state)
+{
+	std::vector<Cmpt::Transform *> transforms;
+
+	auto scene = CreateScene(static_cast<uint32_t>(state.range(0)), transforms);
+
+	float x = 0.f;
+	for (auto _ : state)
+	{
+		transforms[0]->SetTranslation(glm::vec3(x += 1.f, 0.f, 0.f));
+		for (auto *transform : transforms)
+		{
+			benchmark::DoNotOptimize(transform->GetWorldTransform());
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * NodeCount);
+}
+BENCHMARK(BM_TransformRecursive)->Arg(2)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Moving the root, world matrices are propagated level by level through the flat hierarchy in Scene::Update
+static void BM_TransformHierarchy(benchmark::State &state)
+{
+	std::vector<Cmpt::Transform *> transforms;
+
+	auto scene = CreateScene(static_cast<uint32_t>(state.range(0)), transforms);
+
+	float x = 0.f;
+	for (auto _ : state)
+	{
+		transforms[0]->SetTranslation(glm::vec3(x += 1.f, 0.f, 0.f));
+		scene->Update();
+	}
+
+	state.SetItemsProcessed(state.iterations() * NodeCount);
+}
+BENCHMARK(BM_TransformHierarchy)->Arg(2)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -16,6 +16,8 @@ add_requires("slang")
 add_requires("volk", {configs = {header_only = true}})
 add_requires("vulkan-headers")
 add_requires("vulkan-memory-allocator v3.0.0")
+add_requires("gtest", {configs = {main = true}})
+add_requires("benchmark")
 
 -- option("CUDA_ENABLE")
 --     on_check(function (option)
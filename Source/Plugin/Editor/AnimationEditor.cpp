@@ -372,13 +372,11 @@ class AnimationEditor : public Widget
 		{
 			VertexInputState vertex_input_state = {};
 			vertex_input_state.input_bindings   = {
-                VertexInputState::InputBinding{0, sizeof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex), RHIVertexInputRate::Vertex}};
+                VertexInputState::InputBinding{0, sizeof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex), RHIVertexInputRate::Vertex}};
 			vertex_input_state.input_attributes = {
-			    VertexInputState::InputAttribute{RHIVertexSemantics::Position, 0, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, position)},
-			    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 1, 0, RHIFormat::R32G32B32A32_SINT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, bones[0])},
-			    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 2, 0, RHIFormat::R32G32B32A32_SINT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, bones[4])},
-			    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 3, 0, RHIFormat::R32G32B32A32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, weights[0])},
-			    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 4, 0, RHIFormat::R32G32B32A32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, weights[4])},
+			    VertexInputState::InputAttribute{RHIVertexSemantics::Position, 0, 0, RHIFormat::R32G32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, position)},
+			    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 1, 0, RHIFormat::R32G32B32A32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, bones)},
+			    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 2, 0, RHIFormat::R32G32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, weights)},
 			};
 
 			InputAssemblyState input_assembly_state = {};
@@ -412,7 +410,6 @@ class AnimationEditor : public Widget
 
 			cmd_buffer->BeginRenderPass(m_render_target.get());
 			cmd_buffer->BindDescriptor(descriptor);
-			cmd_buffer->BindPipelineState(m_pipeline_state.get());
 			cmd_buffer->SetViewport((float) m_render_target->GetWidth(), (float) m_render_target->GetHeight());
 			cmd_buffer->SetScissor(m_render_target->GetWidth(), m_render_target->GetHeight());
 
@@ -421,6 +418,10 @@ class AnimationEditor : public Widget
 				auto *skinned_mesh = p_editor->GetRenderer()->GetResourceManager()->Get<ResourceType::SkinnedMesh>(skinned_mesh_name);
 				if (skinned_mesh)
 				{
+					// Push constants are flushed when binding the pipeline
+					descriptor->SetConstant("position_offset", skinned_mesh->GetPositionOffset())
+					    .SetConstant("position_scale", skinned_mesh->GetPositionScale());
+					cmd_buffer->BindPipelineState(m_pipeline_state.get());
 					cmd_buffer->BindVertexBuffer(0, skinned_mesh->GetVertexBuffer());
 					cmd_buffer->BindIndexBuffer(skinned_mesh->GetIndexBuffer());
 					cmd_buffer->DrawIndexed(static_cast<uint32_t>(skinned_mesh->GetIndexCount()));
@@ -2,6 +2,8 @@
 #include <Editor/Widget.hpp>
 #include <RHI/RHIContext.hpp>
 #include <RenderGraph/RenderGraph.hpp>
+#include <RenderGraph/RenderGraphBlackboard.hpp>
+#include <Renderer/RenderData.hpp>
 #include <Renderer/Renderer.hpp>
 #include <Scene/Components/AllComponents.hpp>
 #include <Scene/Node.hpp>
@@ -175,6 +177,27 @@ class Inspector : public Widget
 			ImGui::TreePop();
 		}
 
+		if (ImGui::TreeNodeEx("GPU Scene", tree_node_flags, "GPU Scene"))
+		{
+			const auto &statistics = renderer->GetRenderGraphBlackboard().Get<GPUScene>()->statistics;
+
+			if (m_upload_sizes.size() >= 100)
+			{
+				m_upload_sizes.erase(m_upload_sizes.begin());
+				m_update_times.erase(m_update_times.begin());
+			}
+			m_upload_sizes.push_back(static_cast<float>(statistics.upload_bytes) / 1024.f);
+			m_update_times.push_back(statistics.cpu_time);
+
+			ImGui::Text("Update: %s", statistics.rebuild ? "Rebuild" : "Incremental");
+			ImGui::Text("Dirty Instances: %u", statistics.dirty_instances);
+			ImGui::Text("TLAS Updates: %u", statistics.tlas_updates);
+			ImGui::Text("Culled Instances: %u", statistics.culled_instances);
+			ImGui::PlotLines(fmt::format("Upload ({:.2f} KB)", m_upload_sizes.back()).c_str(), m_upload_sizes.data(), static_cast<int>(m_upload_sizes.size()), 0, nullptr, 0.f, FLT_MAX, ImVec2{0, 60});
+			ImGui::PlotLines(fmt::format("CPU Time ({:.3f} ms)", m_update_times.back()).c_str(), m_update_times.data(), static_cast<int>(m_update_times.size()), 0, nullptr, 0.f, FLT_MAX, ImVec2{0, 60});
+			ImGui::TreePop();
+		}
+
 		if (render_graph && ImGui::TreeNodeEx("Render Info", tree_node_flags, "Render Info"))
 		{
 			for (const auto &pass : render_graph->GetRenderPasses())
@@ -193,6 +216,10 @@ class Inspector : public Widget
 
   private:
 	std::vector<float> m_frame_times;
+
+	// GPU scene update cost history, uploaded KB and CPU ms per frame
+	std::vector<float> m_upload_sizes;
+	std::vector<float> m_update_times;
 };
 
 extern "C"
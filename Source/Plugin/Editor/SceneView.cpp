@@ -548,7 +548,7 @@ class SceneView : public Widget
 			ImGui::Text("Camera Properties");
 			if ((!perspective_cameras.empty() || !orthographic_cameras.empty()) && ImGui::BeginMenu("Main Camera"))
 			{
-				for (auto &perspective_camera : perspective_cameras)
+				for (auto *perspective_camera : perspective_cameras)
 				{
 					bool selected = perspective_camera == p_editor->GetMainCamera();
 					if (ImGui::MenuItem(perspective_camera->GetNode()->GetName().c_str(), nullptr, &selected))
@@ -556,7 +556,7 @@ class SceneView : public Widget
 						p_editor->SetMainCamera(perspective_camera);
 					}
 				}
-				for (auto &orthographic_camera : orthographic_cameras)
+				for (auto *orthographic_camera : orthographic_cameras)
 				{
 					bool selected = orthographic_camera == p_editor->GetMainCamera();
 					if (ImGui::MenuItem(orthographic_camera->GetNode()->GetName().c_str(), nullptr, &selected))
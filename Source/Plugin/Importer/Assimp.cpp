@@ -5,10 +5,13 @@
 #include <Resource/Resource/Prefab.hpp>
 #include <Resource/Resource/SkinnedMesh.hpp>
 #include <Resource/Resource/Texture2D.hpp>
+#include <Resource/Resource/TextureCube.hpp>
 #include <Resource/ResourceManager.hpp>
 
 #include <Material/MaterialGraph.hpp>
 
+#include <Core/JobSystem.hpp>
+
 #include <Geometry/Meshlet.hpp>
 
 #include <assimp/DefaultLogger.hpp>
@@ -75,12 +78,25 @@ inline glm::quat ToQuaternion(const aiQuaternion &quat)
 class AssimpImporter : public Importer<ResourceType::Prefab>
 {
   public:
+	inline static constexpr uint32_t ImportFlags = aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace;
+
 	struct BoneInfo
 	{
 		uint32_t  id;
 		glm::mat4 offset;
 	};
 
+	struct TextureInfo
+	{
+		// Name handed to the material graph
+		std::string name;
+		bool        pending = false;
+		bool        cube    = false;
+
+		TextureDesc          desc;
+		std::vector<uint8_t> data;
+	};
+
 	struct ModelInfo
 	{
 		std::map<std::string, BoneInfo> bones;
@@ -90,6 +106,9 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		Node root;
 
 		std::map<std::string, std::unordered_set<uint32_t>> skinned_mesh_bones;
+
+		// Texture filename -> decoded texture
+		std::map<std::string, TextureInfo> textures;
 	};
 
 	struct MeshletInfo
@@ -98,29 +117,65 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		std::vector<uint32_t> meshletdata;
 	};
 
-	void ProcessAnimation(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, uint32_t animation_id, const aiScene *assimp_scene, ModelInfo &data)
+	// Per-task result slots, filled by the workers and committed in order on the calling thread
+	struct MeshInfo
 	{
+		std::string name;
+		bool        skinned = false;
+		bool        exist   = false;
+
+		std::vector<Vertex>          vertices;
+		std::vector<SkinnedVertex>   skinned_vertices;
+		std::vector<uint32_t>        indices;
+		std::unordered_set<uint32_t> bones;
+
+		MeshletInfo meshlet;
+	};
+
+	struct AnimationInfo
+	{
+		std::string       name;
+		uint32_t          bone_count = 0;
 		std::vector<Bone> bones;
+	};
 
-		std::string animation_name   = fmt::format("{}.animation.{}", Path::GetInstance().ValidFileName(path), animation_id);
+	void RegisterAnimationBones(uint32_t animation_id, const aiScene *assimp_scene, ModelInfo &data)
+	{
 		const auto *assimp_animation = assimp_scene->mAnimations[animation_id];
 
 		for (uint32_t j = 0; j < assimp_animation->mNumChannels; j++)
 		{
-			auto        channel   = assimp_animation->mChannels[j];
-			std::string bone_name = channel->mNodeName.data;
+			std::string bone_name = assimp_animation->mChannels[j]->mNodeName.data;
 			if (data.bones.find(bone_name) == data.bones.end())
 			{
 				data.bones[bone_name].id = static_cast<uint32_t>(data.bones.size());
 			}
+		}
+	}
+
+	// Only reads the bone table, bones must be registered before
+	void ProcessAnimation(uint32_t animation_id, const aiScene *assimp_scene, const ModelInfo &data, AnimationInfo &info)
+	{
+		std::vector<Bone> &bones = info.bones;
+
+		const auto *assimp_animation = assimp_scene->mAnimations[animation_id];
+
+		for (uint32_t j = 0; j < assimp_animation->mNumChannels; j++)
+		{
+			auto        channel   = assimp_animation->mChannels[j];
+			std::string bone_name = channel->mNodeName.data;
 
 			// Parsing bone key frame data
-			uint32_t bone_id = data.bones[bone_name].id;
+			uint32_t bone_id = data.bones.at(bone_name).id;
 
 			std::vector<Bone::KeyPosition> key_positions;
 			std::vector<Bone::KeyRotation> key_rotations;
 			std::vector<Bone::KeyScale>    key_scales;
 
+			key_positions.reserve(channel->mNumPositionKeys);
+			key_rotations.reserve(channel->mNumRotationKeys);
+			key_scales.reserve(channel->mNumScalingKeys);
+
 			for (uint32_t position_idx = 0; position_idx < channel->mNumPositionKeys; position_idx++)
 			{
 				Bone::KeyPosition data = {};
@@ -151,10 +206,16 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			bones.emplace_back(bone_name, bone_id, data.bones.at(bone_name).offset, std::move(key_positions), std::move(key_rotations), std::move(key_scales));
 		}
 
-		if (bones.size() < data.bones.size())
+		// Bones registered after this animation are not part of it
+		if (bones.size() < info.bone_count)
 		{
 			for (auto &[name, bone] : data.bones)
 			{
+				if (bone.id >= info.bone_count)
+				{
+					continue;
+				}
+
 				bool found = false;
 				for (auto &anim_bone : bones)
 				{
@@ -166,10 +227,16 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 				}
 				if (!found)
 				{
-					bones.emplace_back(name, bone.id, data.bones.at(name).offset, std::vector<Bone::KeyPosition>{}, std::vector<Bone::KeyRotation>{}, std::vector<Bone::KeyScale>{});
+					bones.emplace_back(name, bone.id, bone.offset, std::vector<Bone::KeyPosition>{}, std::vector<Bone::KeyRotation>{}, std::vector<Bone::KeyScale>{});
 				}
 			}
 		}
+	}
+
+	void CommitAnimation(ResourceManager *manager, RHIContext *rhi_context, AnimationInfo &info, ModelInfo &data)
+	{
+		std::vector<Bone> &bones          = info.bones;
+		const std::string &animation_name = info.name;
 
 		std::function<void(HierarchyNode &, Node &)> build_skeleton =
 		    [&](HierarchyNode &hierarchy, Node &node) {
@@ -212,7 +279,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		build_skeleton(hierarchy, data.root);
 
 		data.animations.push_back(animation_name);
-		manager->Add<ResourceType::Animation>(rhi_context, animation_name, std::move(bones), std::move(hierarchy));
+		manager->Add<ResourceType::Animation>(rhi_context, animation_name, std::move(info.bones), std::move(hierarchy));
 	}
 
 	template <typename T>
@@ -285,18 +352,15 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		return meshlet_info;
 	}
 
-	void ProcessMesh(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, uint32_t mesh_id, const aiScene *assimp_scene, ModelInfo &data)
+	void ProcessMesh(uint32_t mesh_id, const aiScene *assimp_scene, MeshInfo &info)
 	{
-		std::string mesh_name   = fmt::format("{}.mesh.{}", Path::GetInstance().ValidFileName(path), mesh_id);
-		aiMesh     *assimp_mesh = assimp_scene->mMeshes[mesh_id];
+		aiMesh *assimp_mesh = assimp_scene->mMeshes[mesh_id];
 
-		if (manager->Has<ResourceType::Mesh>(mesh_name))
-		{
-			return;
-		}
+		std::vector<Vertex>   &vertices = info.vertices;
+		std::vector<uint32_t> &indices  = info.indices;
 
-		std::vector<Vertex>   vertices;
-		std::vector<uint32_t> indices;
+		vertices.reserve(assimp_mesh->mNumVertices);
+		indices.reserve(static_cast<size_t>(assimp_mesh->mNumFaces) * 3);
 
 		// Parsing vertices
 		for (uint32_t j = 0; j < assimp_mesh->mNumVertices; j++)
@@ -319,23 +383,40 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			}
 		}
 
-		MeshletInfo meshlet_info = ProcessMeshlet(vertices, indices);
-		manager->Add<ResourceType::Mesh>(rhi_context, mesh_name, std::move(vertices), std::move(indices), std::move(meshlet_info.meshlets), std::move(meshlet_info.meshletdata));
+		info.meshlet = ProcessMeshlet(vertices, indices);
 	}
 
-	void ProcessSkinnedMesh(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, uint32_t mesh_id, const aiScene *assimp_scene, ModelInfo &data)
+	// Bone ids depend on registration order, so this runs on the calling thread in mesh order
+	void RegisterMeshBones(uint32_t mesh_id, const aiScene *assimp_scene, ModelInfo &data)
 	{
-		std::string mesh_name   = fmt::format("{}.mesh.{}", Path::GetInstance().ValidFileName(path), mesh_id);
-		aiMesh     *assimp_mesh = assimp_scene->mMeshes[mesh_id];
+		aiMesh *assimp_mesh = assimp_scene->mMeshes[mesh_id];
 
-		if (manager->Has<ResourceType::SkinnedMesh>(mesh_name))
+		for (uint32_t bone_index = 0; bone_index < assimp_mesh->mNumBones; bone_index++)
 		{
-			return;
+			std::string bone_name = assimp_mesh->mBones[bone_index]->mName.C_Str();
+
+			if (data.bones.find(bone_name) == data.bones.end())
+			{
+				BoneInfo bone = {};
+				bone.id       = static_cast<uint32_t>(data.bones.size());
+				bone.offset   = ToMatrix(assimp_mesh->mBones[bone_index]->mOffsetMatrix);
+
+				data.bones[bone_name] = bone;
+			}
 		}
+	}
 
-		std::vector<SkinnedVertex>   vertices;
-		std::vector<uint32_t>        indices;
-		std::unordered_set<uint32_t> bones;
+	// Only reads the bone table, bones must be registered before
+	void ProcessSkinnedMesh(uint32_t mesh_id, const aiScene *assimp_scene, const ModelInfo &data, MeshInfo &info)
+	{
+		aiMesh *assimp_mesh = assimp_scene->mMeshes[mesh_id];
+
+		std::vector<SkinnedVertex>   &vertices = info.skinned_vertices;
+		std::vector<uint32_t>        &indices  = info.indices;
+		std::unordered_set<uint32_t> &bones    = info.bones;
+
+		vertices.reserve(assimp_mesh->mNumVertices);
+		indices.reserve(static_cast<size_t>(assimp_mesh->mNumFaces) * 3);
 
 		// Parsing vertices
 		for (uint32_t j = 0; j < assimp_mesh->mNumVertices; j++)
@@ -361,28 +442,10 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		// Parsing bones
 		for (uint32_t bone_index = 0; bone_index < assimp_mesh->mNumBones; bone_index++)
 		{
-			int32_t     bone_id   = -1;
-			std::string bone_name = assimp_mesh->mBones[bone_index]->mName.C_Str();
-
-			if (data.bones.find(bone_name) == data.bones.end())
-			{
-				BoneInfo bone = {};
-				bone.id       = static_cast<uint32_t>(data.bones.size());
-				bone.offset   = ToMatrix(assimp_mesh->mBones[bone_index]->mOffsetMatrix);
-
-				data.bones[bone_name] = bone;
-
-				bone_id = bone.id;
-			}
-			else
-			{
-				bone_id = data.bones.at(bone_name).id;
-			}
+			int32_t bone_id = data.bones.at(assimp_mesh->mBones[bone_index]->mName.C_Str()).id;
 
 			bones.insert(bone_id);
 
-			data.bones[bone_name] = data.bones.at(bone_name);
-
 			auto     weights    = assimp_mesh->mBones[bone_index]->mWeights;
 			uint32_t weight_num = assimp_mesh->mBones[bone_index]->mNumWeights;
 
@@ -403,11 +466,25 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			}
 		}
 
-		MeshletInfo meshlet_info = ProcessMeshlet(vertices, indices);
+		info.meshlet = ProcessMeshlet(vertices, indices);
+	}
 
-		data.skinned_mesh_bones[mesh_name] = bones;
+	void CommitMesh(ResourceManager *manager, RHIContext *rhi_context, MeshInfo &info, ModelInfo &data)
+	{
+		if (info.exist)
+		{
+			return;
+		}
 
-		manager->Add<ResourceType::SkinnedMesh>(rhi_context, mesh_name, std::move(vertices), std::move(indices), std::move(meshlet_info.meshlets), std::move(meshlet_info.meshletdata));
+		if (info.skinned)
+		{
+			data.skinned_mesh_bones[info.name] = std::move(info.bones);
+			manager->Add<ResourceType::SkinnedMesh>(rhi_context, info.name, std::move(info.skinned_vertices), std::move(info.indices), std::move(info.meshlet.meshlets), std::move(info.meshlet.meshletdata));
+		}
+		else
+		{
+			manager->Add<ResourceType::Mesh>(rhi_context, info.name, std::move(info.vertices), std::move(info.indices), std::move(info.meshlet.meshlets), std::move(info.meshlet.meshletdata));
+		}
 	}
 
 	Node ProcessNode(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, const aiScene *assimp_scene, aiNode *assimp_node, ModelInfo &data, aiMatrix4x4 transform = aiMatrix4x4())
@@ -444,7 +521,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		return node;
 	}
 
-	void ProcessMaterial(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, uint32_t material_id, const aiScene *assimp_scene)
+	void ProcessMaterial(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, uint32_t material_id, const aiScene *assimp_scene, ModelInfo &data)
 	{
 		std::string material_name = fmt::format("{}.material.{}", Path::GetInstance().ValidFileName(path), material_id);
 
@@ -501,7 +578,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			assimp_material->Get(AI_MATKEY_BASE_COLOR, base_color.x);
 			assimp_material->GetTexture(AI_MATKEY_BASE_COLOR_TEXTURE, &color_texture);
 
-			std::string color_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, color_texture.C_Str());
+			std::string color_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, color_texture.C_Str());
 			if (!color_texture_name.empty())
 			{
 				MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -551,7 +628,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			if (pack_metallic_roughness)
 			{
 				// Pack Texture: Occlusion (R) [optional] + Roughness G + Metallic B
-				std::string texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, metallic_texture.C_Str());
+				std::string texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, metallic_texture.C_Str());
 				if (!texture_name.empty())
 				{
 					MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -589,7 +666,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			{
 				// Separated Texture
 				// Metallic
-				std::string metallic_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, metallic_texture.C_Str());
+				std::string metallic_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, metallic_texture.C_Str());
 				if (!metallic_texture_name.empty())
 				{
 					MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -614,7 +691,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 				}
 
 				// Roughness
-				std::string roughness_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, roughness_texture.C_Str());
+				std::string roughness_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, roughness_texture.C_Str());
 				if (!roughness_texture_name.empty())
 				{
 					MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -650,7 +727,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			aiString normal_texture;
 			assimp_material->GetTexture(aiTextureType_NORMALS, 0, &normal_texture);
 
-			std::string normal_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, normal_texture.C_Str());
+			std::string normal_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, normal_texture.C_Str());
 			if (!normal_texture_name.empty())
 			{
 				MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -667,7 +744,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			assimp_material->Get(AI_MATKEY_COLOR_EMISSIVE, emissive_color.x);
 			assimp_material->GetTexture(aiTextureType_EMISSIVE, 0, &emissive_texture);
 
-			std::string emissive_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, emissive_texture.C_Str());
+			std::string emissive_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, emissive_texture.C_Str());
 			if (!emissive_texture_name.empty())
 			{
 				MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -714,8 +791,8 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			assimp_material->Get(AI_MATKEY_SHEEN_ROUGHNESS_FACTOR, sheen_roughness);
 			assimp_material->GetTexture(AI_MATKEY_SHEEN_COLOR_TEXTURE, &sheen_color_texture);
 			assimp_material->GetTexture(AI_MATKEY_SHEEN_ROUGHNESS_TEXTURE, &sheen_roughness_texture);
-			ProcessTexture(manager, rhi_context, path, assimp_scene, sheen_color_texture.C_Str());
-			ProcessTexture(manager, rhi_context, path, assimp_scene, sheen_roughness_texture.C_Str());
+			ProcessTexture(manager, rhi_context, path, assimp_scene, data, sheen_color_texture.C_Str());
+			ProcessTexture(manager, rhi_context, path, assimp_scene, data, sheen_roughness_texture.C_Str());
 		}
 
 		// Clearcoat
@@ -731,9 +808,9 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			assimp_material->GetTexture(AI_MATKEY_SHEEN_COLOR_TEXTURE, &clearcoat_texture);
 			assimp_material->GetTexture(AI_MATKEY_SHEEN_COLOR_TEXTURE, &clearcoat_roughness_texture);
 			assimp_material->GetTexture(AI_MATKEY_SHEEN_COLOR_TEXTURE, &clearcoat_normal_texture);
-			ProcessTexture(manager, rhi_context, path, assimp_scene, clearcoat_texture.C_Str());
-			ProcessTexture(manager, rhi_context, path, assimp_scene, clearcoat_roughness_texture.C_Str());
-			ProcessTexture(manager, rhi_context, path, assimp_scene, clearcoat_normal_texture.C_Str());
+			ProcessTexture(manager, rhi_context, path, assimp_scene, data, clearcoat_texture.C_Str());
+			ProcessTexture(manager, rhi_context, path, assimp_scene, data, clearcoat_roughness_texture.C_Str());
+			ProcessTexture(manager, rhi_context, path, assimp_scene, data, clearcoat_normal_texture.C_Str());
 		}
 
 		// Transmission
@@ -743,7 +820,7 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 			assimp_material->Get(AI_MATKEY_TRANSMISSION_FACTOR, transmission_factor);
 			assimp_material->GetTexture(AI_MATKEY_TRANSMISSION_TEXTURE, &transmission_texture);
 
-			std::string transmission_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, transmission_texture.C_Str());
+			std::string transmission_texture_name = ProcessTexture(manager, rhi_context, path, assimp_scene, data, transmission_texture.C_Str());
 			if (!transmission_texture_name.empty())
 			{
 				MaterialNodeDesc &texture_node = desc.AddNode(current_handle++, create_material_node(current_handle, "Texture", "ImageTexture"));
@@ -773,53 +850,115 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 		{
 			aiString displacement_texture;
 			assimp_material->GetTexture(aiTextureType_DISPLACEMENT, 0, &displacement_texture);
-			ProcessTexture(manager, rhi_context, path, assimp_scene, displacement_texture.C_Str());
+			ProcessTexture(manager, rhi_context, path, assimp_scene, data, displacement_texture.C_Str());
 		}
 
 		manager->Add<ResourceType::Material>(rhi_context, material_name, std::move(desc));
 	}
 
-	std::string ProcessTexture(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, const aiScene *assimp_scene, const std::string &filename)
+	// Resolve every texture a material may reference, decoding happens later on the job system
+	void CollectTextures(ResourceManager *manager, const std::string &path, uint32_t material_id, const aiScene *assimp_scene, ModelInfo &data)
 	{
+		std::string material_name = fmt::format("{}.material.{}", Path::GetInstance().ValidFileName(path), material_id);
+
+		if (Exist<ResourceType::Material>(manager, material_name))
+		{
+			return;
+		}
+
+		aiMaterial *assimp_material = assimp_scene->mMaterials[material_id];
+
+		for (uint32_t type = aiTextureType_NONE; type <= AI_TEXTURE_TYPE_MAX; type++)
+		{
+			for (uint32_t i = 0; i < assimp_material->GetTextureCount(static_cast<aiTextureType>(type)); i++)
+			{
+				aiString filename;
+				if (assimp_material->GetTexture(static_cast<aiTextureType>(type), i, &filename) == aiReturn_SUCCESS)
+				{
+					CollectTexture(manager, path, assimp_scene, filename.C_Str(), data);
+				}
+			}
+		}
+	}
+
+	TextureInfo *CollectTexture(ResourceManager *manager, const std::string &path, const aiScene *assimp_scene, const std::string &filename, ModelInfo &data)
+	{
+		auto iter = data.textures.find(filename);
+		if (iter != data.textures.end())
+		{
+			return &iter->second;
+		}
+
 		auto [assimp_texture, texture_id] = assimp_scene->GetEmbeddedTextureAndIndex(filename.c_str());
 		if (texture_id < 0 && filename.empty())
 		{
-			return "";
+			return nullptr;
 		}
 
+		TextureInfo &info = data.textures[filename];
+
 		if (texture_id < 0)
 		{
 			// External texture
-			auto &importer = Importer<ResourceType::Texture2D>::GetInstance("STB");
-			if (importer)
-			{
-				importer->Import(manager, Path::GetInstance().GetFileDirectory(path) + filename, rhi_context);
-				return Path::GetInstance().GetFileDirectory(path) + filename;
-			}
+			info.name      = Path::GetInstance().GetFileDirectory(path) + filename;
+			info.desc.name = Path::GetInstance().ValidFileName(info.name);
+			info.cube      = Path::GetInstance().GetFileExtension(info.name) == ".hdr";
+			info.pending   = info.cube ? !Exist<ResourceType::TextureCube>(manager, info.desc.name) : !Exist<ResourceType::Texture2D>(manager, info.desc.name);
 		}
 		else
 		{
-			std::string texture_name = fmt::format("{}.texture.{}", Path::GetInstance().ValidFileName(path), texture_id);
-			if (manager->Has<ResourceType::Texture2D>(texture_name))
-			{
-				return "";
-			}
+			info.desc.name = fmt::format("{}.texture.{}", Path::GetInstance().ValidFileName(path), texture_id);
+			info.pending   = !Exist<ResourceType::Texture2D>(manager, info.desc.name);
+			info.name      = info.pending ? info.desc.name : "";
+		}
+
+		return &info;
+	}
+
+	// Thread safe, only touches the texture slot
+	void DecodeTexture(const aiScene *assimp_scene, const std::string &filename, TextureInfo &info)
+	{
+		TextureDesc &desc = info.desc;
+
+		desc.width   = 1;
+		desc.height  = 1;
+		desc.depth   = 1;
+		desc.mips    = 1;
+		desc.layers  = 1;
+		desc.samples = 1;
 
-			TextureDesc desc = {};
-			desc.name        = texture_name;
-			desc.width       = 1;
-			desc.height      = 1;
-			desc.depth       = 1;
-			desc.mips        = 1;
-			desc.layers      = 1;
-			desc.samples     = 1;
+		void   *raw_data = nullptr;
+		size_t  size     = 0;
+		int32_t width = 0, height = 0, channel = 0;
 
-			void   *raw_data = nullptr;
-			size_t  size     = 0;
-			int32_t width = 0, height = 0, channel = 0;
+		const int32_t req_channel = 4;
 
-			const int32_t req_channel = 4;
+		auto [assimp_texture, texture_id] = assimp_scene->GetEmbeddedTextureAndIndex(filename.c_str());
 
+		if (texture_id < 0)
+		{
+			// External texture
+			if (stbi_is_hdr(info.name.c_str()))
+			{
+				raw_data    = stbi_loadf(info.name.c_str(), &width, &height, &channel, req_channel);
+				size        = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(req_channel) * sizeof(float);
+				desc.format = RHIFormat::R32G32B32A32_FLOAT;
+			}
+			else if (stbi_is_16_bit(info.name.c_str()))
+			{
+				raw_data    = stbi_load_16(info.name.c_str(), &width, &height, &channel, req_channel);
+				size        = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(req_channel) * sizeof(uint16_t);
+				desc.format = RHIFormat::R16G16B16A16_FLOAT;
+			}
+			else
+			{
+				raw_data    = stbi_load(info.name.c_str(), &width, &height, &channel, req_channel);
+				size        = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(req_channel) * sizeof(uint8_t);
+				desc.format = RHIFormat::R8G8B8A8_UNORM;
+			}
+		}
+		else
+		{
 			stbi_uc *assimp_texture_data     = reinterpret_cast<stbi_uc *>(assimp_texture->pcData);
 			int32_t  assimp_texture_data_len = static_cast<int32_t>(assimp_texture->mWidth * glm::max(1u, assimp_texture->mHeight) * 4);
 
@@ -841,65 +980,251 @@ class AssimpImporter : public Importer<ResourceType::Prefab>
 				size        = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(req_channel) * sizeof(uint8_t);
 				desc.format = RHIFormat::R8G8B8A8_UNORM;
 			}
+		}
 
-			desc.width  = static_cast<uint32_t>(width);
-			desc.height = static_cast<uint32_t>(height);
-			desc.mips   = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
-			desc.usage  = RHITextureUsage::ShaderResource | RHITextureUsage::Transfer;
+		if (!raw_data)
+		{
+			LOG_WARN("Failed to decode texture {}", filename);
+			info.pending = false;
+			return;
+		}
 
-			std::vector<uint8_t> data;
+		desc.width  = static_cast<uint32_t>(width);
+		desc.height = static_cast<uint32_t>(height);
+		desc.mips   = info.cube ? 1 : static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
+		desc.usage  = RHITextureUsage::ShaderResource | RHITextureUsage::Transfer;
 
-			data.resize(size);
-			std::memcpy(data.data(), raw_data, size);
+		info.data.resize(size);
+		std::memcpy(info.data.data(), raw_data, size);
 
-			stbi_image_free(raw_data);
+		stbi_image_free(raw_data);
+	}
 
-			manager->Add<ResourceType::Texture2D>(rhi_context, std::move(data), desc);
+	std::string ProcessTexture(ResourceManager *manager, RHIContext *rhi_context, const std::string &path, const aiScene *assimp_scene, ModelInfo &data, const std::string &filename)
+	{
+		TextureInfo *info = CollectTexture(manager, path, assimp_scene, filename, data);
+		if (!info)
+		{
+			return "";
+		}
 
-			return desc.name;
+		if (info->pending)
+		{
+			// Not known before the decoding pass
+			if (info->data.empty())
+			{
+				DecodeTexture(assimp_scene, filename, *info);
+			}
+
+			if (info->pending)
+			{
+				if (info->cube)
+				{
+					manager->Add<ResourceType::TextureCube>(rhi_context, std::move(info->data), info->desc);
+				}
+				else
+				{
+					manager->Add<ResourceType::Texture2D>(rhi_context, std::move(info->data), info->desc);
+				}
+				info->pending = false;
+			}
 		}
 
-		return false;
+		return info->name;
 	}
 
   protected:
-	virtual void Import_(ResourceManager *manager, const std::string &path, RHIContext *rhi_context) override
+	template <ResourceType Type>
+	static bool Exist(ResourceManager *manager, const std::string &name)
+	{
+		// Nothing exists yet when processing without a resource manager
+		return manager && manager->Has<Type>(name);
+	}
+
+	// CPU side of an import, no resource is committed, returns the number of decoded textures
+	uint32_t Process(ResourceManager *manager, const std::string &path, const aiScene *assimp_scene, ModelInfo &data, std::vector<MeshInfo> &meshes, std::vector<AnimationInfo> &animations, bool parallel)
 	{
 		std::string prefab_name = Path::GetInstance().ValidFileName(path);
 
-		Assimp::Importer importer;
+		meshes.resize(assimp_scene->mNumMeshes);
+		animations.resize(assimp_scene->mNumAnimations);
 
-		if (const aiScene *assimp_scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace))
+		// Resolve names, bone ids and texture slots on the calling thread so that the results don't depend on scheduling
+		for (uint32_t i = 0; i < assimp_scene->mNumMeshes; i++)
 		{
-			ModelInfo data;
+			aiMesh   *assimp_mesh = assimp_scene->mMeshes[i];
+			MeshInfo &mesh        = meshes[i];
 
-			for (uint32_t i = 0; i < assimp_scene->mNumMeshes; i++)
+			mesh.name    = fmt::format("{}.mesh.{}", prefab_name, i);
+			mesh.skinned = assimp_mesh->HasBones();
+			mesh.exist   = mesh.skinned ? Exist<ResourceType::SkinnedMesh>(manager, mesh.name) : Exist<ResourceType::Mesh>(manager, mesh.name);
+
+			if (mesh.skinned && !mesh.exist)
 			{
-				aiMesh *assimp_mesh = assimp_scene->mMeshes[i];
-				if (assimp_mesh->HasBones())
+				RegisterMeshBones(i, assimp_scene, data);
+			}
+
+			CollectTextures(manager, path, assimp_mesh->mMaterialIndex, assimp_scene, data);
+		}
+
+		for (uint32_t i = 0; i < assimp_scene->mNumAnimations; i++)
+		{
+			RegisterAnimationBones(i, assimp_scene, data);
+			animations[i].name       = fmt::format("{}.animation.{}", prefab_name, i);
+			animations[i].bone_count = static_cast<uint32_t>(data.bones.size());
+		}
+
+		std::vector<std::pair<const std::string *, TextureInfo *>> textures;
+		for (auto &[filename, texture] : data.textures)
+		{
+			if (texture.pending)
+			{
+				textures.emplace_back(&filename, &texture);
+			}
+		}
+
+		// Mesh processing, texture decoding and animation conversion are independent
+		uint32_t mesh_count      = static_cast<uint32_t>(meshes.size());
+		uint32_t texture_count   = static_cast<uint32_t>(textures.size());
+		uint32_t animation_count = static_cast<uint32_t>(animations.size());
+
+		auto process = [&](uint32_t i) {
+			if (i < mesh_count)
+			{
+				if (meshes[i].exist)
+				{
+					return;
+				}
+				if (meshes[i].skinned)
 				{
-					ProcessSkinnedMesh(manager, rhi_context, path, i, assimp_scene, data);
+					ProcessSkinnedMesh(i, assimp_scene, data, meshes[i]);
 				}
 				else
 				{
-					ProcessMesh(manager, rhi_context, path, i, assimp_scene, data);
+					ProcessMesh(i, assimp_scene, meshes[i]);
 				}
+			}
+			else if (i < mesh_count + texture_count)
+			{
+				auto &[filename, texture] = textures[i - mesh_count];
+				DecodeTexture(assimp_scene, *filename, *texture);
+			}
+			else
+			{
+				ProcessAnimation(i - mesh_count - texture_count, assimp_scene, data, animations[i - mesh_count - texture_count]);
+			}
+		};
 
-				ProcessMaterial(manager, rhi_context, path, assimp_mesh->mMaterialIndex, assimp_scene);
+		if (parallel)
+		{
+			JobHandle handle;
+			JobSystem::GetInstance().Dispatch(handle, mesh_count + texture_count + animation_count, 1, process);
+			JobSystem::GetInstance().Wait(handle);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < mesh_count + texture_count + animation_count; i++)
+			{
+				process(i);
+			}
+		}
+
+		return texture_count;
+	}
+
+	// Hash of everything Process produces for a model, it must not depend on scheduling
+	size_t Digest(const std::string &path, bool parallel)
+	{
+		Assimp::Importer importer;
+
+		const aiScene *assimp_scene = importer.ReadFile(path, ImportFlags);
+		if (!assimp_scene)
+		{
+			return 0;
+		}
+
+		ModelInfo                  data;
+		std::vector<MeshInfo>      meshes;
+		std::vector<AnimationInfo> animations;
+		Process(nullptr, path, assimp_scene, data, meshes, animations, parallel);
+
+		std::ostringstream os(std::ios::binary);
+		{
+			OutputArchive archive(os);
+			for (auto &mesh : meshes)
+			{
+				std::vector<uint32_t> bones(mesh.bones.begin(), mesh.bones.end());
+				std::sort(bones.begin(), bones.end());
+				archive(mesh.name, mesh.vertices, mesh.skinned_vertices, mesh.indices, mesh.meshlet.meshlets, mesh.meshlet.meshletdata, bones);
+			}
+			for (auto &[filename, texture] : data.textures)
+			{
+				archive(filename, texture.name, texture.desc, texture.data);
+			}
+			for (auto &[name, bone] : data.bones)
+			{
+				archive(name, bone.id, bone.offset);
+			}
+			for (auto &animation : animations)
+			{
+				archive(animation.name, animation.bone_count, animation.bones);
+			}
+		}
+
+		return Hash(os.str());
+	}
+
+	virtual void Import_(ResourceManager *manager, const std::string &path, RHIContext *rhi_context) override
+	{
+		std::string prefab_name = Path::GetInstance().ValidFileName(path);
+
+		Assimp::Importer importer;
+
+		auto start_time = std::chrono::high_resolution_clock::now();
+
+		if (const aiScene *assimp_scene = importer.ReadFile(path, ImportFlags))
+		{
+			auto parse_time = std::chrono::high_resolution_clock::now();
+
+			ModelInfo data;
+
+			std::vector<MeshInfo>      meshes;
+			std::vector<AnimationInfo> animations;
+			uint32_t                   texture_count = Process(manager, path, assimp_scene, data, meshes, animations, true);
+
+			uint32_t mesh_count      = static_cast<uint32_t>(meshes.size());
+			uint32_t animation_count = static_cast<uint32_t>(animations.size());
+
+			auto process_time = std::chrono::high_resolution_clock::now();
+
+			// Commit in scene order
+			for (uint32_t i = 0; i < assimp_scene->mNumMeshes; i++)
+			{
+				CommitMesh(manager, rhi_context, meshes[i], data);
+				ProcessMaterial(manager, rhi_context, path, assimp_scene->mMeshes[i]->mMaterialIndex, assimp_scene, data);
 			}
 
 			aiMatrix4x4 identity;
 			data.root = ProcessNode(manager, rhi_context, path, assimp_scene, assimp_scene->mRootNode, data, identity);
 
-			for (uint32_t i = 0; i < assimp_scene->mNumAnimations; i++)
+			for (auto &animation : animations)
 			{
-				ProcessAnimation(manager, rhi_context, path, i, assimp_scene, data);
+				CommitAnimation(manager, rhi_context, animation, data);
 			}
 
 			if (!manager->Has<ResourceType::Prefab>(prefab_name))
 			{
 				manager->Add<ResourceType::Prefab>(rhi_context, prefab_name, std::move(data.root));
 			}
+
+			auto end_time = std::chrono::high_resolution_clock::now();
+
+			LOG_INFO("Import {}: {} meshes, {} textures, {} animations, parse {:.2f} ms, process {:.2f} ms, commit {:.2f} ms, total {:.2f} ms",
+			         path, mesh_count, texture_count, animation_count,
+			         std::chrono::duration<float, std::milli>(parse_time - start_time).count(),
+			         std::chrono::duration<float, std::milli>(process_time - parse_time).count(),
+			         std::chrono::duration<float, std::milli>(end_time - process_time).count(),
+			         std::chrono::duration<float, std::milli>(end_time - start_time).count());
 		}
 	}
 };
@@ -910,4 +1235,10 @@ extern "C"
 	{
 		return new AssimpImporter;
 	}
+
+	// Process a model without committing it, for tests and benchmarks
+	EXPORT_API size_t ProcessModel(const std::string &path, bool parallel)
+	{
+		return AssimpImporter().Digest(path, parallel);
+	}
 }
\ No newline at end of file
@@ -453,7 +453,7 @@ class DDSImporter : public Importer<ResourceType::Texture2D>
 		desc.samples = 1;
 
 		std::vector<uint8_t> raw_data;
-		Path::GetInstance().Read(path, raw_data, true);
+		Path::GetInstance().Read(path, raw_data);
 
 		size_t   data_size = raw_data.size();
 		uint8_t *data      = raw_data.data();
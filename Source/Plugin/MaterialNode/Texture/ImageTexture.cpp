@@ -113,7 +113,7 @@ class ImageTexture : public MaterialNode<ImageTexture>
 		auto *resource_manager = editor->GetRenderer()->GetResourceManager();
 		if (resource_manager->Has<ResourceType::Texture2D>(config.filename))
 		{
-			if (ImGui::ImageButton(resource_manager->Get<ResourceType::Texture2D>(config.filename)->GetTexture(), ImVec2(100, 100)))
+			if (ImGui::ImageButton(resource_manager->GetOrPlaceholder<ResourceType::Texture2D>(config.filename)->GetTexture(), ImVec2(100, 100)))
 			{
 				std::memset(config.filename, '\0', 200);
 			}
@@ -175,6 +175,10 @@ void Command::BlitTexture(RHITexture *src_texture, const TextureRange &src_range
 {
 }
 
+void Command::CopyTexture(RHITexture *src_texture, const TextureRange &src_range, const RHIResourceState &src_state, RHITexture *dst_texture, const TextureRange &dst_range, const RHIResourceState &dst_state)
+{
+}
+
 void Command::FillBuffer(RHIBuffer *buffer, RHIResourceState state, size_t size, size_t offset, uint32_t data)
 {
 }
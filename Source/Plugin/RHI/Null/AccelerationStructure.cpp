@@ -0,0 +1,17 @@
+#include "AccelerationStructure.hpp"
+
+namespace Ilum::Null
+{
+AccelerationStructure::AccelerationStructure(RHIDevice *device) :
+    RHIAccelerationStructure(device)
+{
+}
+
+void AccelerationStructure::Update(RHICommand *cmd_buffer, const TLASDesc &desc)
+{
+}
+
+void AccelerationStructure::Update(RHICommand *cmd_buffer, const BLASDesc &desc)
+{
+}
+}        // namespace Ilum::Null
\ No newline at end of file
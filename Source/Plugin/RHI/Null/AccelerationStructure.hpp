@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class AccelerationStructure : public RHIAccelerationStructure
+{
+  public:
+	AccelerationStructure(RHIDevice *device);
+
+	virtual ~AccelerationStructure() override = default;
+
+	virtual void Update(RHICommand *cmd_buffer, const TLASDesc &desc) override;
+
+	virtual void Update(RHICommand *cmd_buffer, const BLASDesc &desc) override;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
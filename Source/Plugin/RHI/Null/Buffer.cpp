@@ -0,0 +1,89 @@
+#include "Buffer.hpp"
+#include "Device.hpp"
+
+namespace Ilum::Null
+{
+Buffer::Buffer(RHIDevice *device, const BufferDesc &desc) :
+    RHIBuffer(device, desc)
+{
+	m_desc.size = m_desc.size == 0 ? m_desc.stride * m_desc.count : m_desc.size;
+
+	static_cast<Device *>(p_device)->Allocate(m_desc.size);
+	static_cast<Device *>(p_device)->GetStatistics().buffer_count++;
+}
+
+Buffer::Buffer(RHIDevice *device, const BufferDesc &desc, const std::shared_ptr<std::vector<uint8_t>> &memory, size_t offset) :
+    RHIBuffer(device, desc), m_memory(memory), m_offset(offset), m_alias(true)
+{
+	m_desc.size = m_desc.size == 0 ? m_desc.stride * m_desc.count : m_desc.size;
+}
+
+Buffer::~Buffer()
+{
+	if (!m_alias)
+	{
+		static_cast<Device *>(p_device)->Free(m_desc.size);
+		static_cast<Device *>(p_device)->GetStatistics().buffer_count--;
+	}
+}
+
+std::unique_ptr<RHIBuffer> Buffer::Alias(const BufferDesc &desc, size_t offset)
+{
+	BufferDesc alias_desc = desc;
+	alias_desc.size       = alias_desc.size == 0 ? alias_desc.stride * alias_desc.count : alias_desc.size;
+
+	if (offset + alias_desc.size > m_desc.size)
+	{
+		LOG_ERROR("Buffer alias {} [{}, {}) exceeds {} of size {}", alias_desc.name, offset, offset + alias_desc.size, m_desc.name, m_desc.size);
+		return nullptr;
+	}
+
+	GetMemory();
+
+	return std::unique_ptr<Buffer>(new Buffer(p_device, alias_desc, m_memory, m_offset + offset));
+}
+
+void Buffer::CopyToDevice(const void *data, size_t size, size_t offset)
+{
+	assert(offset + size <= m_desc.size);
+	std::memcpy(GetMemory() + offset, data, size);
+}
+
+void Buffer::CopyToHost(void *data, size_t size, size_t offset)
+{
+	assert(offset + size <= m_desc.size);
+	std::memcpy(data, GetMemory() + offset, size);
+}
+
+void *Buffer::Map()
+{
+	return GetMemory();
+}
+
+void Buffer::Unmap()
+{
+}
+
+void Buffer::Flush(size_t offset, size_t size)
+{
+}
+
+RHIResourceState Buffer::GetState() const
+{
+	return m_state;
+}
+
+void Buffer::SetState(RHIResourceState state)
+{
+	m_state = state;
+}
+
+uint8_t *Buffer::GetMemory()
+{
+	if (!m_memory)
+	{
+		m_memory = std::make_shared<std::vector<uint8_t>>(m_desc.size);
+	}
+	return m_memory->data() + m_offset;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class Buffer : public RHIBuffer
+{
+  public:
+	Buffer(RHIDevice *device, const BufferDesc &desc);
+
+	virtual ~Buffer() override;
+
+	virtual std::unique_ptr<RHIBuffer> Alias(const BufferDesc &desc, size_t offset = 0) override;
+
+	virtual void CopyToDevice(const void *data, size_t size, size_t offset = 0) override;
+
+	virtual void CopyToHost(void *data, size_t size, size_t offset = 0) override;
+
+	virtual void *Map() override;
+
+	virtual void Unmap() override;
+
+	virtual void Flush(size_t offset, size_t size) override;
+
+	RHIResourceState GetState() const;
+
+	void SetState(RHIResourceState state);
+
+  private:
+	// Alias placed at offset in another buffer's memory, not counted against the device
+	Buffer(RHIDevice *device, const BufferDesc &desc, const std::shared_ptr<std::vector<uint8_t>> &memory, size_t offset);
+
+	uint8_t *GetMemory();
+
+  private:
+	// Host copy of the contents, only created once the buffer is accessed
+	std::shared_ptr<std::vector<uint8_t>> m_memory = nullptr;
+
+	size_t m_offset = 0;
+	bool   m_alias  = false;
+
+	RHIResourceState m_state = RHIResourceState::Undefined;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,308 @@
+#include "Command.hpp"
+#include "Buffer.hpp"
+#include "Device.hpp"
+#include "RenderTarget.hpp"
+#include "Texture.hpp"
+
+namespace Ilum::Null
+{
+// Mismatches are counted every time, only the first ones are logged to keep the console readable
+static constexpr uint64_t MaxLoggedBarrierErrors = 32;
+
+Command::Command(RHIDevice *device, RHIQueueFamily family) :
+    RHICommand(device, family)
+{
+}
+
+void Command::SetState(CommandState state)
+{
+	m_state = state;
+}
+
+void Command::Execute()
+{
+	auto &statistics = static_cast<Device *>(p_device)->GetStatistics();
+
+	for (auto &access : m_texture_accesses)
+	{
+		if (!static_cast<Texture *>(access.texture)->Transition(access.range, access.src, access.dst))
+		{
+			if (statistics.barrier_errors++ < MaxLoggedBarrierErrors)
+			{
+				LOG_WARN("Command {}: texture {} mips [{}, {}) layers [{}, {}) is not in state {}",
+				         m_name, access.texture->GetDesc().name,
+				         access.range.base_mip, access.range.base_mip + access.range.mip_count,
+				         access.range.base_layer, access.range.base_layer + access.range.layer_count,
+				         static_cast<uint32_t>(access.src));
+			}
+		}
+	}
+
+	for (auto &access : m_buffer_accesses)
+	{
+		auto *buffer = static_cast<Buffer *>(access.buffer);
+		if (access.src != RHIResourceState::Undefined && buffer->GetState() != access.src)
+		{
+			if (statistics.barrier_errors++ < MaxLoggedBarrierErrors)
+			{
+				LOG_WARN("Command {}: buffer {} is in state {} instead of {}",
+				         m_name, buffer->GetDesc().name, static_cast<uint32_t>(buffer->GetState()), static_cast<uint32_t>(access.src));
+			}
+		}
+		buffer->SetState(access.dst);
+	}
+
+	statistics.submitted_commands++;
+	statistics.draw_calls += m_draw_calls;
+	statistics.dispatches += m_dispatches;
+	statistics.copies += m_copies;
+	statistics.barriers += m_barriers;
+
+	if (statistics.record_submissions)
+	{
+		Device::Submission submission = {m_name, m_family};
+		for (auto &access : m_texture_accesses)
+		{
+			if (access.src != access.dst)
+			{
+				submission.transitions.push_back(Device::Submission::Transition{access.texture->GetDesc().name, access.src, access.dst});
+			}
+		}
+		for (auto &access : m_buffer_accesses)
+		{
+			if (access.src != access.dst)
+			{
+				submission.transitions.push_back(Device::Submission::Transition{access.buffer->GetDesc().name, access.src, access.dst});
+			}
+		}
+		submission.draw_calls = m_draw_calls;
+		submission.dispatches = m_dispatches;
+		submission.copies     = m_copies;
+
+		std::lock_guard<std::mutex> lock(statistics.submission_mutex);
+		statistics.submissions.emplace_back(std::move(submission));
+	}
+
+	m_state = CommandState::Pending;
+}
+
+void Command::SetName(const std::string &name)
+{
+	m_name = name;
+}
+
+void Command::Begin()
+{
+	assert(m_state == CommandState::Initial);
+
+	m_texture_accesses.clear();
+	m_buffer_accesses.clear();
+
+	m_draw_calls = 0;
+	m_dispatches = 0;
+	m_copies     = 0;
+	m_barriers   = 0;
+
+	m_state = CommandState::Recording;
+}
+
+void Command::End()
+{
+	assert(m_state == CommandState::Recording);
+	m_state = CommandState::Executable;
+}
+
+void Command::BeginMarker(const std::string &name, float r, float g, float b, float a)
+{
+}
+
+void Command::EndMarker()
+{
+}
+
+void Command::BeginRenderPass(RHIRenderTarget *render_target)
+{
+	auto *null_render_target = static_cast<RenderTarget *>(render_target);
+
+	for (auto &[texture, range] : null_render_target->GetColorAttachments())
+	{
+		if (texture)
+		{
+			Access(texture, range, RHIResourceState::RenderTarget, RHIResourceState::RenderTarget);
+		}
+	}
+
+	if (null_render_target->GetDepthAttachment())
+	{
+		auto &[texture, range] = null_render_target->GetDepthAttachment().value();
+		Access(texture, range, RHIResourceState::DepthWrite, RHIResourceState::DepthWrite);
+	}
+}
+
+void Command::EndRenderPass()
+{
+}
+
+void Command::BindVertexBuffer(uint32_t binding, RHIBuffer *vertex_buffer)
+{
+}
+
+void Command::BindIndexBuffer(RHIBuffer *index_buffer, bool is_short)
+{
+}
+
+void Command::BindDescriptor(RHIDescriptor *descriptor)
+{
+}
+
+void Command::BindPipelineState(RHIPipelineState *pipeline_state)
+{
+}
+
+void Command::SetViewport(float width, float height, float x, float y)
+{
+}
+
+void Command::SetScissor(uint32_t width, uint32_t height, int32_t offset_x, int32_t offset_y)
+{
+}
+
+void Command::Dispatch(uint32_t thread_x, uint32_t thread_y, uint32_t thread_z, uint32_t block_x, uint32_t block_y, uint32_t block_z)
+{
+	m_dispatches++;
+}
+
+void Command::DispatchIndirect(RHIBuffer *buffer, size_t offset)
+{
+	m_dispatches++;
+}
+
+void Command::Draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawIndirect(RHIBuffer *buffer, size_t offset, uint32_t draw_count, uint32_t stride)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawIndirectCount(RHIBuffer *buffer, size_t offset, RHIBuffer *count_buffer, size_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawIndexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, uint32_t vertex_offset, uint32_t first_instance)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawIndexedIndirect(RHIBuffer *buffer, size_t offset, uint32_t draw_count, uint32_t stride)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawIndexedIndirectCount(RHIBuffer *buffer, size_t offset, RHIBuffer *count_buffer, size_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawMeshTask(uint32_t thread_x, uint32_t thread_y, uint32_t thread_z, uint32_t block_x, uint32_t block_y, uint32_t block_z)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawMeshTasksIndirect(RHIBuffer *buffer, size_t offset, uint32_t draw_count, uint32_t stride)
+{
+	m_draw_calls++;
+}
+
+void Command::DrawMeshTasksIndirectCount(RHIBuffer *buffer, size_t offset, RHIBuffer *count_buffer, size_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+	m_draw_calls++;
+}
+
+void Command::TraceRay(uint32_t width, uint32_t height, uint32_t depth)
+{
+	m_dispatches++;
+}
+
+void Command::CopyBufferToTexture(RHIBuffer *src_buffer, RHITexture *dst_texture, uint32_t mip_level, uint32_t base_layer, uint32_t layer_count)
+{
+	Access(dst_texture, TextureRange{RHITextureDimension::Texture2D, mip_level, 1, base_layer, layer_count}, RHIResourceState::TransferDest, RHIResourceState::TransferDest);
+	m_copies++;
+}
+
+void Command::CopyTextureToBuffer(RHITexture *src_texture, RHIBuffer *dst_buffer, uint32_t mip_level, uint32_t base_layer, uint32_t layer_count)
+{
+	Access(src_texture, TextureRange{RHITextureDimension::Texture2D, mip_level, 1, base_layer, layer_count}, RHIResourceState::TransferSource, RHIResourceState::TransferSource);
+	m_copies++;
+}
+
+void Command::CopyBufferToBuffer(RHIBuffer *src_buffer, RHIBuffer *dst_buffer, size_t size, size_t src_offset, size_t dst_offset)
+{
+	// Contents are kept on the host, so the copy happens at record time
+	std::vector<uint8_t> data(size);
+	src_buffer->CopyToHost(data.data(), size, src_offset);
+	dst_buffer->CopyToDevice(data.data(), size, dst_offset);
+	m_copies++;
+}
+
+void Command::GenerateMipmaps(RHITexture *texture, RHIResourceState initial_state, RHIFilter filter)
+{
+	Access(texture, TextureRange{RHITextureDimension::Texture2D, 0, texture->GetDesc().mips, 0, texture->GetDesc().layers}, initial_state, RHIResourceState::TransferDest);
+	m_copies++;
+}
+
+void Command::BlitTexture(RHITexture *src_texture, const TextureRange &src_range, const RHIResourceState &src_state, RHITexture *dst_texture, const TextureRange &dst_range, const RHIResourceState &dst_state, RHIFilter filter)
+{
+	Access(src_texture, src_range, src_state, src_state == RHIResourceState::Undefined ? RHIResourceState::TransferSource : src_state);
+	Access(dst_texture, dst_range, dst_state, dst_state == RHIResourceState::Undefined ? RHIResourceState::TransferDest : dst_state);
+	m_copies++;
+}
+
+void Command::CopyTexture(RHITexture *src_texture, const TextureRange &src_range, const RHIResourceState &src_state, RHITexture *dst_texture, const TextureRange &dst_range, const RHIResourceState &dst_state)
+{
+	Access(src_texture, src_range, src_state, src_state == RHIResourceState::Undefined ? RHIResourceState::TransferSource : src_state);
+	Access(dst_texture, dst_range, dst_state, dst_state == RHIResourceState::Undefined ? RHIResourceState::TransferDest : dst_state);
+	m_copies++;
+}
+
+void Command::FillBuffer(RHIBuffer *buffer, RHIResourceState state, size_t size, size_t offset, uint32_t data)
+{
+	m_buffer_accesses.push_back(BufferAccess{buffer, state, state == RHIResourceState::Undefined ? RHIResourceState::TransferDest : state});
+	m_copies++;
+}
+
+void Command::FillTexture(RHITexture *texture, RHIResourceState state, const TextureRange &range, const glm::vec4 &color)
+{
+	Access(texture, range, state, state == RHIResourceState::Undefined ? RHIResourceState::TransferDest : state);
+	m_copies++;
+}
+
+void Command::FillTexture(RHITexture *texture, RHIResourceState state, const TextureRange &range, float depth)
+{
+	Access(texture, range, state, state == RHIResourceState::Undefined ? RHIResourceState::TransferDest : state);
+	m_copies++;
+}
+
+void Command::ResourceStateTransition(const std::vector<TextureStateTransition> &texture_transitions, const std::vector<BufferStateTransition> &buffer_transitions)
+{
+	for (auto &transition : texture_transitions)
+	{
+		Access(transition.texture, transition.range, transition.src, transition.dst);
+	}
+
+	for (auto &transition : buffer_transitions)
+	{
+		m_buffer_accesses.push_back(BufferAccess{transition.buffer, transition.src, transition.dst});
+	}
+
+	m_barriers += static_cast<uint32_t>(texture_transitions.size() + buffer_transitions.size());
+}
+
+void Command::Access(RHITexture *texture, const TextureRange &range, RHIResourceState src, RHIResourceState dst)
+{
+	m_texture_accesses.push_back(TextureAccess{texture, range, src, dst});
+}
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "Descriptor.hpp"
+
+namespace Ilum::Null
+{
+Descriptor::Descriptor(RHIDevice *device, const ShaderMeta &meta) :
+    RHIDescriptor(device, meta)
+{
+	for (auto &descriptor : m_meta.descriptors)
+	{
+		m_bindings[descriptor.name] = {};
+	}
+
+	for (auto &constant : m_meta.constants)
+	{
+		auto &data = m_constants[constant.name];
+		data.resize(std::max<size_t>(data.size(), constant.size));
+	}
+}
+
+RHIDescriptor &Descriptor::BindTexture(const std::string &name, RHITexture *texture, RHITextureDimension dimension)
+{
+	return BindTexture(name, std::vector<RHITexture *>{texture}, dimension);
+}
+
+RHIDescriptor &Descriptor::BindTexture(const std::string &name, RHITexture *texture, const TextureRange &range)
+{
+	return BindTexture(name, std::vector<RHITexture *>{texture}, range.dimension);
+}
+
+RHIDescriptor &Descriptor::BindTexture(const std::string &name, const std::vector<RHITexture *> &textures, RHITextureDimension dimension)
+{
+	auto iter = m_bindings.find(name);
+	if (iter != m_bindings.end())
+	{
+		iter->second.assign(textures.begin(), textures.end());
+	}
+	return *this;
+}
+
+RHIDescriptor &Descriptor::BindSampler(const std::string &name, RHISampler *sampler)
+{
+	return BindSampler(name, std::vector<RHISampler *>{sampler});
+}
+
+RHIDescriptor &Descriptor::BindSampler(const std::string &name, const std::vector<RHISampler *> &samplers)
+{
+	auto iter = m_bindings.find(name);
+	if (iter != m_bindings.end())
+	{
+		iter->second.assign(samplers.begin(), samplers.end());
+	}
+	return *this;
+}
+
+RHIDescriptor &Descriptor::BindBuffer(const std::string &name, RHIBuffer *buffer)
+{
+	return BindBuffer(name, std::vector<RHIBuffer *>{buffer});
+}
+
+RHIDescriptor &Descriptor::BindBuffer(const std::string &name, RHIBuffer *buffer, size_t offset, size_t range)
+{
+	return BindBuffer(name, std::vector<RHIBuffer *>{buffer});
+}
+
+RHIDescriptor &Descriptor::BindBuffer(const std::string &name, const std::vector<RHIBuffer *> &buffers)
+{
+	auto iter = m_bindings.find(name);
+	if (iter != m_bindings.end())
+	{
+		iter->second.assign(buffers.begin(), buffers.end());
+	}
+	return *this;
+}
+
+RHIDescriptor &Descriptor::BindConstant(const std::string &name, const void *constant)
+{
+	auto iter = m_constants.find(name);
+	if (iter != m_constants.end())
+	{
+		std::memcpy(iter->second.data(), constant, iter->second.size());
+	}
+	return *this;
+}
+
+RHIDescriptor &Descriptor::BindAccelerationStructure(const std::string &name, RHIAccelerationStructure *acceleration_structure)
+{
+	auto iter = m_bindings.find(name);
+	if (iter != m_bindings.end())
+	{
+		iter->second = {acceleration_structure};
+	}
+	return *this;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
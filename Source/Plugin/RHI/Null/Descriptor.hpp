@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class Descriptor : public RHIDescriptor
+{
+  public:
+	Descriptor(RHIDevice *device, const ShaderMeta &meta);
+
+	virtual ~Descriptor() override = default;
+
+	virtual RHIDescriptor &BindTexture(const std::string &name, RHITexture *texture, RHITextureDimension dimension) override;
+	virtual RHIDescriptor &BindTexture(const std::string &name, RHITexture *texture, const TextureRange &range) override;
+	virtual RHIDescriptor &BindTexture(const std::string &name, const std::vector<RHITexture *> &textures, RHITextureDimension dimension) override;
+
+	virtual RHIDescriptor &BindSampler(const std::string &name, RHISampler *sampler) override;
+	virtual RHIDescriptor &BindSampler(const std::string &name, const std::vector<RHISampler *> &samplers) override;
+
+	virtual RHIDescriptor &BindBuffer(const std::string &name, RHIBuffer *buffer) override;
+	virtual RHIDescriptor &BindBuffer(const std::string &name, RHIBuffer *buffer, size_t offset, size_t range) override;
+	virtual RHIDescriptor &BindBuffer(const std::string &name, const std::vector<RHIBuffer *> &buffers) override;
+
+	virtual RHIDescriptor &BindConstant(const std::string &name, const void *constant) override;
+
+	virtual RHIDescriptor &BindAccelerationStructure(const std::string &name, RHIAccelerationStructure *acceleration_structure) override;
+
+  private:
+	// Like the other backends, names missing from the shader meta are ignored
+	std::unordered_map<std::string, std::vector<void *>>  m_bindings;
+	std::unordered_map<std::string, std::vector<uint8_t>> m_constants;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "Device.hpp"
+
+namespace Ilum::Null
+{
+Device::Device() :
+    RHIDevice("Null")
+{
+	LOG_INFO("Initializing RHI backend Null...");
+
+	m_name = "Null Device";
+}
+
+Device::~Device()
+{
+	LOG_INFO("Null device: {} command buffers, {} draws, {} dispatches, {} copies, {} barriers, peak memory {} bytes",
+	         m_statistics.submitted_commands.load(), m_statistics.draw_calls.load(), m_statistics.dispatches.load(),
+	         m_statistics.copies.load(), m_statistics.barriers.load(), m_statistics.peak_memory.load());
+
+	if (m_statistics.barrier_errors > 0)
+	{
+		LOG_WARN("Null device: {} resource state transitions did not match the tracked state", m_statistics.barrier_errors.load());
+	}
+
+	if (m_statistics.allocated_memory > 0)
+	{
+		LOG_WARN("Null device: {} bytes in {} buffers and {} textures were not released",
+		         m_statistics.allocated_memory.load(), m_statistics.buffer_count.load(), m_statistics.texture_count.load());
+	}
+}
+
+void Device::WaitIdle()
+{
+}
+
+bool Device::IsFeatureSupport(RHIFeature feature)
+{
+	// Report every feature so that all render paths get exercised
+	return true;
+}
+
+void Device::Allocate(size_t size)
+{
+	size_t allocated = m_statistics.allocated_memory.fetch_add(size) + size;
+	size_t peak      = m_statistics.peak_memory.load();
+	while (allocated > peak && !m_statistics.peak_memory.compare_exchange_weak(peak, allocated))
+	{
+	}
+}
+
+void Device::Free(size_t size)
+{
+	m_statistics.allocated_memory.fetch_sub(size);
+}
+
+Device::Statistics &Device::GetStatistics()
+{
+	return m_statistics;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+// Headless device, resources only keep the bookkeeping needed to measure CPU cost, memory and barrier correctness
+class Device : public RHIDevice
+{
+  public:
+	// A submitted command, kept to compare two recordings of the same frame
+	struct Submission
+	{
+		struct Transition
+		{
+			std::string      resource;
+			RHIResourceState src;
+			RHIResourceState dst;
+		};
+
+		std::string    name;
+		RHIQueueFamily family;
+
+		std::vector<Transition> transitions;
+
+		uint32_t draw_calls = 0;
+		uint32_t dispatches = 0;
+		uint32_t copies     = 0;
+	};
+
+	struct Statistics
+	{
+		std::atomic<size_t> allocated_memory = 0;
+		std::atomic<size_t> peak_memory      = 0;
+
+		std::atomic<uint32_t> buffer_count  = 0;
+		std::atomic<uint32_t> texture_count = 0;
+
+		std::atomic<uint64_t> submitted_commands = 0;
+		std::atomic<uint64_t> draw_calls         = 0;
+		std::atomic<uint64_t> dispatches         = 0;
+		std::atomic<uint64_t> copies             = 0;
+		std::atomic<uint64_t> barriers           = 0;
+		// Transitions whose source state does not match the tracked state
+		std::atomic<uint64_t> barrier_errors = 0;
+
+		// Off by default, the log grows with every submission
+		std::atomic<bool>       record_submissions = false;
+		std::mutex              submission_mutex;
+		std::vector<Submission> submissions;
+	};
+
+  public:
+	Device();
+
+	~Device();
+
+	virtual void WaitIdle() override;
+
+	virtual bool IsFeatureSupport(RHIFeature feature) override;
+
+	void Allocate(size_t size);
+
+	void Free(size_t size);
+
+	Statistics &GetStatistics();
+
+  private:
+	Statistics m_statistics;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
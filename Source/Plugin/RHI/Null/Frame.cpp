@@ -0,0 +1,95 @@
+#include "Frame.hpp"
+#include "Command.hpp"
+#include "Descriptor.hpp"
+#include "Synchronization.hpp"
+
+namespace Ilum::Null
+{
+Frame::Frame(RHIDevice *device) :
+    RHIFrame(device)
+{
+}
+
+RHIFence *Frame::AllocateFence()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	while (m_fences.size() <= m_active_fence_index)
+	{
+		m_fences.emplace_back(std::make_unique<Fence>(p_device));
+	}
+
+	return m_fences[m_active_fence_index++].get();
+}
+
+RHISemaphore *Frame::AllocateSemaphore()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	while (m_semaphores.size() <= m_active_semaphore_index)
+	{
+		m_semaphores.emplace_back(std::make_unique<Semaphore>(p_device));
+	}
+
+	return m_semaphores[m_active_semaphore_index++].get();
+}
+
+RHICommand *Frame::AllocateCommand(RHIQueueFamily family)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto &commands     = m_commands[family];
+	auto &active_index = m_active_cmd_index[family];
+
+	while (commands.size() <= active_index)
+	{
+		commands.emplace_back(std::make_unique<Command>(p_device, family));
+	}
+
+	auto &cmd = commands[active_index++];
+	cmd->Init();
+	return cmd.get();
+}
+
+RHIDescriptor *Frame::AllocateDescriptor(const ShaderMeta &meta)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto &descriptors  = m_descriptors[meta.hash];
+	auto &active_index = m_active_descriptor_index[meta.hash];
+
+	while (descriptors.size() <= active_index)
+	{
+		descriptors.emplace_back(std::make_unique<Descriptor>(p_device, meta));
+	}
+
+	return descriptors[active_index++].get();
+}
+
+void Frame::Reset()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	for (uint32_t i = 0; i < m_active_fence_index; i++)
+	{
+		m_fences[i]->Reset();
+	}
+
+	for (auto &[family, commands] : m_commands)
+	{
+		for (auto &cmd : commands)
+		{
+			cmd->SetState(CommandState::Available);
+		}
+		m_active_cmd_index[family] = 0;
+	}
+
+	for (auto &[hash, index] : m_active_descriptor_index)
+	{
+		index = 0;
+	}
+
+	m_active_fence_index     = 0;
+	m_active_semaphore_index = 0;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
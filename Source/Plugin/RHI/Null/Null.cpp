@@ -0,0 +1,116 @@
+#include "Fwd.hpp"
+
+#include "AccelerationStructure.hpp"
+#include "Buffer.hpp"
+#include "Command.hpp"
+#include "Descriptor.hpp"
+#include "Device.hpp"
+#include "Frame.hpp"
+#include "PipelineState.hpp"
+#include "Profiler.hpp"
+#include "Queue.hpp"
+#include "RenderTarget.hpp"
+#include "Sampler.hpp"
+#include "Shader.hpp"
+#include "Swapchain.hpp"
+#include "Synchronization.hpp"
+#include "Texture.hpp"
+
+using namespace Ilum;
+using namespace Ilum::Null;
+
+#undef CreateSemaphore
+
+extern "C"
+{
+	EXPORT_API RHIDevice *CreateDevice()
+	{
+		return new Device;
+	}
+
+	// Headless tests read the tracked allocations and barrier errors through this
+	EXPORT_API Device::Statistics *GetStatistics(Device *device)
+	{
+		return &device->GetStatistics();
+	}
+
+	EXPORT_API RHIFrame *CreateFrame(Device *device)
+	{
+		return new Frame(device);
+	}
+
+	EXPORT_API RHISwapchain *CreateSwapchain(Device *device, void *window_handle, uint32_t width, uint32_t height, bool vsync)
+	{
+		return new Swapchain(device, window_handle, width, height, vsync);
+	}
+
+	EXPORT_API RHIQueue *CreateQueue(Device *device)
+	{
+		return new Queue(device);
+	}
+
+	EXPORT_API RHIBuffer *CreateBuffer(Device *device, const BufferDesc &desc)
+	{
+		return new Buffer(device, desc);
+	}
+
+	EXPORT_API RHITexture *CreateTexture(Device *device, const TextureDesc &desc)
+	{
+		return new Texture(device, desc);
+	}
+
+	EXPORT_API RHITexture *CreateTextureHeap(Device *device, size_t size, const std::vector<TextureDesc> &descs)
+	{
+		return new Texture(device, size, descs);
+	}
+
+	EXPORT_API size_t GetTextureMemorySize(Device *device, const TextureDesc &desc)
+	{
+		return Texture::GetMemorySize(desc);
+	}
+
+	EXPORT_API RHISampler *CreateSampler(Device *device, const SamplerDesc &desc)
+	{
+		return new Sampler(device, desc);
+	}
+
+	EXPORT_API RHIShader *CreateShader(RHIDevice *device, const std::string &entry_point, const std::vector<uint8_t> &source)
+	{
+		return new Shader(device, entry_point, source);
+	}
+
+	EXPORT_API RHIRenderTarget *CreateRenderTarget(Device *device)
+	{
+		return new RenderTarget(device);
+	}
+
+	EXPORT_API RHISemaphore *CreateSemaphore(Device *device)
+	{
+		return new Semaphore(device);
+	}
+
+	EXPORT_API RHIFence *CreateFence(Device *device)
+	{
+		return new Fence(device);
+	}
+
+	EXPORT_API RHIDescriptor *CreateDescriptor(Device *device, const ShaderMeta &meta)
+	{
+		return new Descriptor(device, meta);
+	}
+
+	EXPORT_API RHIPipelineState *CreatePipelineState(Device *device)
+	{
+		return new PipelineState(device);
+	}
+
+	EXPORT_API RHIProfiler *CreateProfiler(RHIDevice *device, uint32_t frame_count)
+	{
+		return new Profiler(device, frame_count);
+	}
+
+	EXPORT_API RHIAccelerationStructure *CreateAccelerationStructure(Device *device)
+	{
+		return new AccelerationStructure(device);
+	}
+}
\ No newline at end of file
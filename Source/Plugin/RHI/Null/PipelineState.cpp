@@ -0,0 +1,9 @@
+#include "PipelineState.hpp"
+
+namespace Ilum::Null
+{
+PipelineState::PipelineState(RHIDevice *device) :
+    RHIPipelineState(device)
+{
+}
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class PipelineState : public RHIPipelineState
+{
+  public:
+	PipelineState(RHIDevice *device);
+
+	virtual ~PipelineState() override = default;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
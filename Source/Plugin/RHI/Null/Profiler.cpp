@@ -0,0 +1,23 @@
+#include "Profiler.hpp"
+
+namespace Ilum::Null
+{
+Profiler::Profiler(RHIDevice *device, uint32_t frame_count) :
+    RHIProfiler(device, frame_count)
+{
+}
+
+void Profiler::Begin(RHICommand *cmd_buffer, uint32_t frame_index)
+{
+	m_current_index = frame_index;
+
+	m_state.thread_id = std::this_thread::get_id();
+	m_state.cpu_time  = std::chrono::duration<float, std::milli>(m_state.cpu_end - m_state.cpu_start).count();
+	m_state.cpu_start = std::chrono::high_resolution_clock::now();
+}
+
+void Profiler::End(RHICommand *cmd_buffer)
+{
+	m_state.cpu_end = std::chrono::high_resolution_clock::now();
+}
+}        // namespace Ilum::Null
\ No newline at end of file
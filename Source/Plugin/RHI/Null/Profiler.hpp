@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+// Only measures CPU time, GPU time stays zero
+class Profiler : public RHIProfiler
+{
+  public:
+	Profiler(RHIDevice *device, uint32_t frame_count);
+
+	virtual ~Profiler() override = default;
+
+	virtual void Begin(RHICommand *cmd_buffer, uint32_t frame_index) override;
+
+	virtual void End(RHICommand *cmd_buffer) override;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
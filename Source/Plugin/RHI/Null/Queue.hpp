@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+// Command buffers are replayed on the calling thread at submission
+class Queue : public RHIQueue
+{
+  public:
+	Queue(RHIDevice *device);
+
+	virtual ~Queue() override = default;
+
+	virtual void Execute(RHIQueueFamily family, const std::vector<SubmitInfo> &submit_infos, RHIFence *fence = nullptr) override;
+
+	virtual void Execute(RHICommand *cmd_buffer) override;
+
+	virtual void Wait() override;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "RenderTarget.hpp"
+
+namespace Ilum::Null
+{
+RenderTarget::RenderTarget(RHIDevice *device) :
+    RHIRenderTarget(device)
+{
+}
+
+RHIRenderTarget &RenderTarget::Set(uint32_t slot, RHITexture *texture, RHITextureDimension dimension, const ColorAttachment &attachment)
+{
+	return Set(slot, texture, TextureRange{dimension, 0, texture->GetDesc().mips, 0, texture->GetDesc().layers}, attachment);
+}
+
+RHIRenderTarget &RenderTarget::Set(uint32_t slot, RHITexture *texture, const TextureRange &range, const ColorAttachment &attachment)
+{
+	while (slot >= m_color_attachments.size())
+	{
+		m_color_attachments.push_back({});
+	}
+
+	m_color_attachments[slot] = std::make_pair(texture, range);
+
+	Resize(texture);
+
+	return *this;
+}
+
+RHIRenderTarget &RenderTarget::Set(RHITexture *texture, RHITextureDimension dimension, const DepthStencilAttachment &attachment)
+{
+	return Set(texture, TextureRange{dimension, 0, texture->GetDesc().mips, 0, texture->GetDesc().layers}, attachment);
+}
+
+RHIRenderTarget &RenderTarget::Set(RHITexture *texture, const TextureRange &range, const DepthStencilAttachment &attachment)
+{
+	m_depth_attachment = std::make_pair(texture, range);
+
+	Resize(texture);
+
+	return *this;
+}
+
+RHIRenderTarget &RenderTarget::Clear()
+{
+	m_color_attachments.clear();
+	m_depth_attachment.reset();
+
+	m_width  = 0;
+	m_height = 0;
+
+	return *this;
+}
+
+const std::vector<std::pair<RHITexture *, TextureRange>> &RenderTarget::GetColorAttachments() const
+{
+	return m_color_attachments;
+}
+
+const std::optional<std::pair<RHITexture *, TextureRange>> &RenderTarget::GetDepthAttachment() const
+{
+	return m_depth_attachment;
+}
+
+void RenderTarget::Resize(RHITexture *texture)
+{
+	m_width  = std::max(m_width, texture->GetDesc().width);
+	m_height = std::max(m_height, texture->GetDesc().height);
+	m_layers = std::max(m_layers, texture->GetDesc().layers);
+}
+}        // namespace Ilum::Null
\ No newline at end of file
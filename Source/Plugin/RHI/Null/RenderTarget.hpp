@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class RenderTarget : public RHIRenderTarget
+{
+  public:
+	RenderTarget(RHIDevice *device);
+
+	virtual ~RenderTarget() override = default;
+
+	virtual RHIRenderTarget &Set(uint32_t slot, RHITexture *texture, RHITextureDimension dimension, const ColorAttachment &attachment) override;
+	virtual RHIRenderTarget &Set(uint32_t slot, RHITexture *texture, const TextureRange &range, const ColorAttachment &attachment) override;
+	virtual RHIRenderTarget &Set(RHITexture *texture, RHITextureDimension dimension, const DepthStencilAttachment &attachment) override;
+	virtual RHIRenderTarget &Set(RHITexture *texture, const TextureRange &range, const DepthStencilAttachment &attachment) override;
+
+	virtual RHIRenderTarget &Clear() override;
+
+	// Checked against the tracked texture states when a render pass begins
+	const std::vector<std::pair<RHITexture *, TextureRange>> &GetColorAttachments() const;
+
+	const std::optional<std::pair<RHITexture *, TextureRange>> &GetDepthAttachment() const;
+
+  private:
+	void Resize(RHITexture *texture);
+
+  private:
+	std::vector<std::pair<RHITexture *, TextureRange>>   m_color_attachments;
+	std::optional<std::pair<RHITexture *, TextureRange>> m_depth_attachment;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
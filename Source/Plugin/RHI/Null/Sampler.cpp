@@ -0,0 +1,9 @@
+#include "Sampler.hpp"
+
+namespace Ilum::Null
+{
+Sampler::Sampler(RHIDevice *device, const SamplerDesc &desc) :
+    RHISampler(device, desc)
+{
+}
+}        // namespace Ilum::Null
\ No newline at end of file
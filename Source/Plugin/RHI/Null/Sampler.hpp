@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class Sampler : public RHISampler
+{
+  public:
+	Sampler(RHIDevice *device, const SamplerDesc &desc);
+
+	virtual ~Sampler() override = default;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,14 @@
+#include "Shader.hpp"
+
+namespace Ilum::Null
+{
+Shader::Shader(RHIDevice *device, const std::string &entry_point, const std::vector<uint8_t> &source) :
+    RHIShader(device, entry_point, source), m_size(source.size())
+{
+}
+
+size_t Shader::GetSize() const
+{
+	return m_size;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
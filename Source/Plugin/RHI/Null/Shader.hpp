@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class Shader : public RHIShader
+{
+  public:
+	Shader(RHIDevice *device, const std::string &entry_point, const std::vector<uint8_t> &source);
+
+	virtual ~Shader() override = default;
+
+	size_t GetSize() const;
+
+  private:
+	size_t m_size = 0;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
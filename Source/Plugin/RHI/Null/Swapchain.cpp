@@ -0,0 +1,87 @@
+#include "Swapchain.hpp"
+#include "Device.hpp"
+#include "Synchronization.hpp"
+#include "Texture.hpp"
+
+namespace Ilum::Null
+{
+Swapchain::Swapchain(RHIDevice *device, void *window_handle, uint32_t width, uint32_t height, bool vsync) :
+    RHISwapchain(device, width, height, vsync)
+{
+	Resize(width, height, vsync);
+}
+
+uint32_t Swapchain::GetTextureCount()
+{
+	return static_cast<uint32_t>(m_textures.size());
+}
+
+void Swapchain::AcquireNextTexture(RHISemaphore *signal_semaphore, RHIFence *signal_fence)
+{
+	m_frame_index = (m_frame_index + 1) % GetTextureCount();
+
+	if (signal_semaphore)
+	{
+		static_cast<Semaphore *>(signal_semaphore)->Signal();
+	}
+
+	if (signal_fence)
+	{
+		static_cast<Fence *>(signal_fence)->Signal();
+	}
+}
+
+RHITexture *Swapchain::GetCurrentTexture()
+{
+	return m_textures[m_frame_index].get();
+}
+
+uint32_t Swapchain::GetCurrentFrameIndex()
+{
+	return m_frame_index;
+}
+
+bool Swapchain::Present(RHISemaphore *semaphore)
+{
+	if (semaphore)
+	{
+		static_cast<Semaphore *>(semaphore)->Wait();
+	}
+
+	if (!m_textures[m_frame_index]->Transition(TextureRange{RHITextureDimension::Texture2D, 0, 1, 0, 1}, RHIResourceState::Present, RHIResourceState::Present))
+	{
+		static_cast<Device *>(p_device)->GetStatistics().barrier_errors++;
+		LOG_WARN("Swapchain image {} is not in Present state when presenting", m_frame_index);
+	}
+
+	return true;
+}
+
+void Swapchain::Resize(uint32_t width, uint32_t height, bool vsync)
+{
+	m_width  = width;
+	m_height = height;
+	m_vsync  = vsync;
+
+	m_textures.clear();
+
+	TextureDesc desc = {};
+	desc.width       = width;
+	desc.height      = height;
+	desc.depth       = 1;
+	desc.mips        = 1;
+	desc.layers      = 1;
+	desc.samples     = 1;
+	desc.format      = RHIFormat::B8G8R8A8_UNORM;
+	desc.usage       = RHITextureUsage::RenderTarget | RHITextureUsage::UnorderedAccess;
+
+	for (uint32_t i = 0; i < TextureCount; i++)
+	{
+		desc.name = "Swapchain Image " + std::to_string(i);
+		m_textures.emplace_back(std::make_unique<Texture>(p_device, desc));
+		m_textures.back()->Transition(TextureRange{RHITextureDimension::Texture2D, 0, 1, 0, 1}, RHIResourceState::Undefined, RHIResourceState::Present);
+	}
+
+	m_frame_index = 0;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
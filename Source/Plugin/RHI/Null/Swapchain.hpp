@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+// Offscreen back buffers, presenting only checks that the back buffer was transitioned to Present
+class Swapchain : public RHISwapchain
+{
+  public:
+	static constexpr uint32_t TextureCount = 3;
+
+  public:
+	Swapchain(RHIDevice *device, void *window_handle, uint32_t width, uint32_t height, bool vsync);
+
+	virtual ~Swapchain() override = default;
+
+	virtual uint32_t GetTextureCount() override;
+
+	virtual void AcquireNextTexture(RHISemaphore *signal_semaphore, RHIFence *signal_fence) override;
+
+	virtual RHITexture *GetCurrentTexture() override;
+
+	virtual uint32_t GetCurrentFrameIndex() override;
+
+	virtual bool Present(RHISemaphore *semaphore) override;
+
+	virtual void Resize(uint32_t width, uint32_t height, bool vsync) override;
+
+  private:
+	std::vector<std::unique_ptr<Texture>> m_textures;
+
+	uint32_t m_frame_index = 0;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
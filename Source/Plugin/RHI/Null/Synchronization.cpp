@@ -0,0 +1,49 @@
+#include "Synchronization.hpp"
+
+namespace Ilum::Null
+{
+Fence::Fence(RHIDevice *device) :
+    RHIFence(device)
+{
+}
+
+void Fence::Wait(uint64_t timeout)
+{
+}
+
+void Fence::Reset()
+{
+	m_signaled = false;
+}
+
+void Fence::Signal()
+{
+	m_signaled = true;
+}
+
+bool Fence::IsSignaled() const
+{
+	return m_signaled;
+}
+
+Semaphore::Semaphore(RHIDevice *device) :
+    RHISemaphore(device)
+{
+}
+
+void Semaphore::SetName(const std::string &name)
+{
+}
+
+void Semaphore::Signal()
+{
+	m_signaled = true;
+}
+
+bool Semaphore::Wait()
+{
+	bool signaled = m_signaled;
+	m_signaled    = false;
+	return signaled;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
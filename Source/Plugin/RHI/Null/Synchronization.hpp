@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+// Work completes at submission, fences and semaphores only keep their signal state
+class Fence : public RHIFence
+{
+  public:
+	Fence(RHIDevice *device);
+
+	virtual ~Fence() override = default;
+
+	virtual void Wait(uint64_t timeout) override;
+
+	virtual void Reset() override;
+
+	void Signal();
+
+	bool IsSignaled() const;
+
+  private:
+	bool m_signaled = false;
+};
+
+class Semaphore : public RHISemaphore
+{
+  public:
+	Semaphore(RHIDevice *device);
+
+	virtual ~Semaphore() override = default;
+
+	virtual void SetName(const std::string &name) override;
+
+	void Signal();
+
+	// Return false if nothing signaled the semaphore since the last wait
+	bool Wait();
+
+  private:
+	bool m_signaled = false;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "Texture.hpp"
+#include "Device.hpp"
+
+namespace Ilum::Null
+{
+Texture::Texture(RHIDevice *device, const TextureDesc &desc) :
+    Texture(device, desc, false)
+{
+}
+
+Texture::Texture(RHIDevice *device, const TextureDesc &desc, bool alias) :
+    RHITexture(device, desc), m_alias(alias)
+{
+	m_memory_size = GetMemorySize(m_desc);
+	m_states.resize(static_cast<size_t>(m_desc.layers) * m_desc.mips, RHIResourceState::Undefined);
+
+	if (!m_alias)
+	{
+		static_cast<Device *>(p_device)->Allocate(m_memory_size);
+		static_cast<Device *>(p_device)->GetStatistics().texture_count++;
+	}
+}
+
+Texture::Texture(RHIDevice *device, size_t size, const std::vector<TextureDesc> &descs) :
+    RHITexture(device, TextureDesc{"Texture Heap"})
+{
+	m_memory_size = size;
+	m_states.resize(static_cast<size_t>(m_desc.layers) * m_desc.mips, RHIResourceState::Undefined);
+
+	static_cast<Device *>(p_device)->Allocate(m_memory_size);
+	static_cast<Device *>(p_device)->GetStatistics().texture_count++;
+}
+
+Texture::~Texture()
+{
+	if (!m_alias)
+	{
+		static_cast<Device *>(p_device)->Free(m_memory_size);
+		static_cast<Device *>(p_device)->GetStatistics().texture_count--;
+	}
+}
+
+std::unique_ptr<RHITexture> Texture::Alias(const TextureDesc &desc, size_t offset)
+{
+	size_t memory_size = GetMemorySize(desc);
+	if (offset + memory_size > m_memory_size)
+	{
+		LOG_ERROR("Texture alias {} [{}, {}) exceeds {} of size {}", desc.name, offset, offset + memory_size, m_desc.name, m_memory_size);
+		return nullptr;
+	}
+
+	return std::unique_ptr<Texture>(new Texture(p_device, desc, true));
+}
+
+size_t Texture::GetMemorySize() const
+{
+	return m_memory_size;
+}
+
+size_t Texture::GetMemorySize(const TextureDesc &desc)
+{
+	size_t size = 0;
+	for (uint32_t mip = 0; mip < desc.mips; mip++)
+	{
+		size += static_cast<size_t>(std::max(desc.width >> mip, 1u)) *
+		        static_cast<size_t>(std::max(desc.height >> mip, 1u)) *
+		        static_cast<size_t>(std::max(desc.depth >> mip, 1u));
+	}
+	return size * GetFormatStride(desc.format) * desc.layers * desc.samples;
+}
+
+bool Texture::Transition(const TextureRange &range, RHIResourceState src, RHIResourceState dst)
+{
+	bool match = true;
+
+	uint32_t layer_end = std::min(range.base_layer + range.layer_count, m_desc.layers);
+	uint32_t mip_end   = std::min(range.base_mip + range.mip_count, m_desc.mips);
+
+	for (uint32_t layer = range.base_layer; layer < layer_end; layer++)
+	{
+		for (uint32_t mip = range.base_mip; mip < mip_end; mip++)
+		{
+			auto &state = m_states[static_cast<size_t>(layer) * m_desc.mips + mip];
+			if (src != RHIResourceState::Undefined && state != src)
+			{
+				match = false;
+			}
+			state = dst;
+		}
+	}
+
+	return match;
+}
+}        // namespace Ilum::Null
\ No newline at end of file
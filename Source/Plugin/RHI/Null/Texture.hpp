@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+namespace Ilum::Null
+{
+class Texture : public RHITexture
+{
+  public:
+	Texture(RHIDevice *device, const TextureDesc &desc);
+
+	// Memory only texture, backs aliases
+	Texture(RHIDevice *device, size_t size, const std::vector<TextureDesc> &descs);
+
+	virtual ~Texture() override;
+
+	virtual std::unique_ptr<RHITexture> Alias(const TextureDesc &desc, size_t offset = 0) override;
+
+	virtual size_t GetMemorySize() const override;
+
+	static size_t GetMemorySize(const TextureDesc &desc);
+
+	// Move every subresource in range to dst, return false if one of them was not in src
+	// Undefined source discards the contents and always matches
+	bool Transition(const TextureRange &range, RHIResourceState src, RHIResourceState dst);
+
+  private:
+	// Alias of another texture's memory, not counted against the device
+	Texture(RHIDevice *device, const TextureDesc &desc, bool alias);
+
+  private:
+	size_t m_memory_size = 0;
+	bool   m_alias       = false;
+
+	// Tracked state per layer and mip
+	std::vector<RHIResourceState> m_states;
+};
+}        // namespace Ilum::Null
\ No newline at end of file
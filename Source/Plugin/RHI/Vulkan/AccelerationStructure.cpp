@@ -46,6 +46,14 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const TLASDesc &desc)
 		instances.emplace_back(std::move(vk_instance));
 	}
 
+	// A refit is only valid when the instance count and BLAS references are unchanged
+	bool refit = m_handle && m_instances.size() == instances.size();
+	for (size_t i = 0; refit && i < instances.size(); i++)
+	{
+		refit = instances[i].accelerationStructureReference == m_instances[i].accelerationStructureReference &&
+		        instances[i].instanceShaderBindingTableRecordOffset == m_instances[i].instanceShaderBindingTableRecordOffset;
+	}
+
 	if (!m_instance_buffer || m_instance_buffer->GetDesc().size < instances.size() * sizeof(VkAccelerationStructureInstanceKHR))
 	{
 		m_instance_buffer = std::make_unique<Buffer>(
@@ -55,9 +63,34 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const TLASDesc &desc)
 		        RHIBufferUsage::AccelerationStructure | RHIBufferUsage::Transfer,
 		        RHIMemoryUsage::CPU_TO_GPU,
 		        instances.size() * sizeof(VkAccelerationStructureInstanceKHR)});
+		refit = false;
 	}
 
-	m_instance_buffer->CopyToDevice(instances.data(), instances.size() * sizeof(VkAccelerationStructureInstanceKHR), 0);
+	if (refit)
+	{
+		// Only copy the runs of instances that actually moved
+		for (size_t begin = 0; begin < instances.size();)
+		{
+			if (std::memcmp(&instances[begin], &m_instances[begin], sizeof(VkAccelerationStructureInstanceKHR)) == 0)
+			{
+				begin++;
+				continue;
+			}
+			size_t end = begin + 1;
+			while (end < instances.size() && std::memcmp(&instances[end], &m_instances[end], sizeof(VkAccelerationStructureInstanceKHR)) != 0)
+			{
+				end++;
+			}
+			m_instance_buffer->CopyToDevice(instances.data() + begin, (end - begin) * sizeof(VkAccelerationStructureInstanceKHR), begin * sizeof(VkAccelerationStructureInstanceKHR));
+			begin = end;
+		}
+	}
+	else
+	{
+		m_instance_buffer->CopyToDevice(instances.data(), instances.size() * sizeof(VkAccelerationStructureInstanceKHR), 0);
+	}
+
+	m_instances = std::move(instances);
 
 	VkAccelerationStructureGeometryKHR as_geometry    = {};
 	as_geometry.sType                                 = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
@@ -70,7 +103,7 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const TLASDesc &desc)
 	VkAccelerationStructureBuildRangeInfoKHR range_info = {};
 	range_info.primitiveCount                           = static_cast<uint32_t>(desc.instances.size());
 
-	Update(cmd_buffer, as_geometry, range_info, VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR);
+	Update(cmd_buffer, as_geometry, range_info, VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR, refit);
 
 	if (!desc.name.empty())
 	{
@@ -106,7 +139,11 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const BLASDesc &desc)
 	range_info.firstVertex     = desc.vertices_offset;
 	range_info.transformOffset = 0;
 
-	Update(cmd_buffer, as_geometry, range_info, VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR);
+	bool refit = m_handle && m_primitive_count == range_info.primitiveCount && m_vertex_count == desc.vertices_count;
+
+	m_vertex_count = desc.vertices_count;
+
+	Update(cmd_buffer, as_geometry, range_info, VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR, refit);
 
 	if (!desc.name.empty())
 	{
@@ -129,7 +166,7 @@ uint64_t AccelerationStructure::GetDeviceAddress() const
 	return m_device_address;
 }
 
-void AccelerationStructure::Update(RHICommand *cmd_buffer, const VkAccelerationStructureGeometryKHR &geometry, const VkAccelerationStructureBuildRangeInfoKHR &range_info, VkAccelerationStructureTypeKHR type)
+void AccelerationStructure::Update(RHICommand *cmd_buffer, const VkAccelerationStructureGeometryKHR &geometry, const VkAccelerationStructureBuildRangeInfoKHR &range_info, VkAccelerationStructureTypeKHR type, bool refit)
 {
 	VkAccelerationStructureBuildGeometryInfoKHR build_geometry_info = {};
 
@@ -137,7 +174,7 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const VkAccelerationS
 	build_geometry_info.type  = type;
 	build_geometry_info.flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
 
-	if (m_handle)
+	if (refit)
 	{
 		build_geometry_info.mode                     = VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
 		build_geometry_info.srcAccelerationStructure = m_handle;
@@ -188,13 +225,17 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const VkAccelerationS
 		build_geometry_info.srcAccelerationStructure = VK_NULL_HANDLE;
 	}
 
+	m_primitive_count = range_info.primitiveCount;
+
 	// Get the acceleration structure's handle
 	VkAccelerationStructureDeviceAddressInfoKHR acceleration_device_address_info = {};
 	acceleration_device_address_info.sType                                       = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
 	acceleration_device_address_info.accelerationStructure                       = m_handle;
 	m_device_address                                                             = vkGetAccelerationStructureDeviceAddressKHR(static_cast<Device *>(p_device)->GetDevice(), &acceleration_device_address_info);
 
-	if (!m_scratch_buffer || m_scratch_buffer->GetDesc().size != build_sizes_info.buildScratchSize)
+	// Refits need less scratch memory than full builds, keep the larger buffer around
+	VkDeviceSize scratch_size = build_geometry_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR ? build_sizes_info.updateScratchSize : build_sizes_info.buildScratchSize;
+	if (!m_scratch_buffer || m_scratch_buffer->GetDesc().size < scratch_size)
 	{
 		m_scratch_buffer = std::make_unique<Buffer>(
 		    p_device,
@@ -202,7 +243,7 @@ void AccelerationStructure::Update(RHICommand *cmd_buffer, const VkAccelerationS
 		        "AS Scratch Buffer",
 		        RHIBufferUsage::UnorderedAccess,
 		        RHIMemoryUsage::GPU_Only,
-		        build_sizes_info.buildScratchSize});
+		        scratch_size});
 	}
 
 	VkPhysicalDeviceAccelerationStructurePropertiesKHR properties = {};
@@ -22,7 +22,8 @@ class AccelerationStructure : public RHIAccelerationStructure
 	uint64_t GetDeviceAddress() const;
 
   private:
-	void Update(RHICommand *cmd_buffer, const VkAccelerationStructureGeometryKHR &geometry, const VkAccelerationStructureBuildRangeInfoKHR &range_info, VkAccelerationStructureTypeKHR type);
+	void Update(RHICommand *cmd_buffer, const VkAccelerationStructureGeometryKHR &geometry, const VkAccelerationStructureBuildRangeInfoKHR &range_info, VkAccelerationStructureTypeKHR type, bool refit);
+
   private:
 	VkAccelerationStructureKHR m_handle = VK_NULL_HANDLE;
 
@@ -33,6 +34,12 @@ class AccelerationStructure : public RHIAccelerationStructure
 	// Only TLAS
 	std::unique_ptr<Buffer> m_instance_buffer = nullptr;
 
+	// Last uploaded instances, used to decide between refit and rebuild
+	std::vector<VkAccelerationStructureInstanceKHR> m_instances;
+
+	uint32_t m_primitive_count = 0;
+	uint32_t m_vertex_count    = 0;
+
 	uint64_t m_device_address = 0;
 };
 }        // namespace Ilum::Vulkan
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Command.hpp"
 #include "Device.hpp"
 #include "Queue.hpp"
+#include "StagingRing.hpp"
 #include "Synchronization.hpp"
 
 #include <dxgi1_2.h>
@@ -185,8 +186,36 @@ Buffer::Buffer(RHIDevice *device, const BufferDesc &desc) :
 	}
 }
 
+Buffer::Buffer(RHIDevice *device, const BufferDesc &desc, VkBuffer buffer) :
+    RHIBuffer(device, desc), m_handle(buffer)
+{
+	if (static_cast<Device *>(p_device)->IsFeatureSupport(RHIFeature::BufferDeviceAddress))
+	{
+		VkBufferDeviceAddressInfoKHR buffer_device_address_info = {};
+		buffer_device_address_info.sType                        = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+		buffer_device_address_info.buffer                       = m_handle;
+		m_device_address                                        = vkGetBufferDeviceAddress(static_cast<Device *>(p_device)->GetDevice(), &buffer_device_address_info);
+	}
+
+	if (!m_desc.name.empty())
+	{
+		VkDebugUtilsObjectNameInfoEXT info = {};
+		info.sType                         = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+		info.pObjectName                   = m_desc.name.c_str();
+		info.objectHandle                  = (uint64_t) m_handle;
+		info.objectType                    = VK_OBJECT_TYPE_BUFFER;
+		static_cast<Device *>(p_device)->SetVulkanObjectName(info);
+	}
+}
+
 Buffer::~Buffer()
 {
+	// The staging ring owns a buffer itself and is already detached from the device while it is destroyed
+	if (auto *staging_ring = static_cast<Device *>(p_device)->GetStagingRing())
+	{
+		staging_ring->Discard(m_handle);
+	}
+
 	vkDeviceWaitIdle(static_cast<Device *>(p_device)->GetDevice());
 
 	Unmap();
@@ -210,6 +239,49 @@ Buffer::~Buffer()
 	}
 }
 
+std::unique_ptr<RHIBuffer> Buffer::Alias(const BufferDesc &desc, size_t offset)
+{
+	if (!m_allocation)
+	{
+		return std::make_unique<Buffer>(p_device, desc);
+	}
+
+	BufferDesc alias_desc = desc;
+	alias_desc.size       = alias_desc.size == 0 ? alias_desc.stride * alias_desc.count : alias_desc.size;
+
+	VkBufferCreateInfo buffer_create_info = {};
+	buffer_create_info.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buffer_create_info.size               = alias_desc.size;
+	buffer_create_info.usage              = ToVulkanBufferUsage(alias_desc.usage);
+	buffer_create_info.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (static_cast<Device *>(p_device)->IsFeatureSupport(RHIFeature::BufferDeviceAddress))
+	{
+		buffer_create_info.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+	}
+
+	VkBuffer buffer = VK_NULL_HANDLE;
+	vkCreateBuffer(static_cast<Device *>(p_device)->GetDevice(), &buffer_create_info, nullptr, &buffer);
+
+	VkMemoryRequirements memory_req = {};
+	vkGetBufferMemoryRequirements(static_cast<Device *>(p_device)->GetDevice(), buffer, &memory_req);
+
+	VmaAllocationInfo info = {};
+	vmaGetAllocationInfo(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, &info);
+
+	// Placement must respect the buffer's size, alignment and memory type, otherwise use a dedicated allocation
+	if (offset + memory_req.size > info.size ||
+	    (info.offset + offset) % memory_req.alignment != 0 ||
+	    !(memory_req.memoryTypeBits & (1u << info.memoryType)) ||
+	    vmaBindBufferMemory2(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, offset, buffer, nullptr) != VK_SUCCESS)
+	{
+		vkDestroyBuffer(static_cast<Device *>(p_device)->GetDevice(), buffer, nullptr);
+		return std::make_unique<Buffer>(p_device, alias_desc);
+	}
+
+	return std::make_unique<Buffer>(p_device, alias_desc, buffer);
+}
+
 void Buffer::CopyToDevice(const void *data, size_t size, size_t offset)
 {
 	if (m_desc.memory == RHIMemoryUsage::CPU_TO_GPU)
@@ -221,34 +293,8 @@ void Buffer::CopyToDevice(const void *data, size_t size, size_t offset)
 	}
 	else
 	{
-		auto    fence = std::make_unique<Fence>(p_device);
-		VkQueue queue = VK_NULL_HANDLE;
-		vkGetDeviceQueue(static_cast<Device *>(p_device)->GetDevice(), static_cast<Device *>(p_device)->GetQueueFamily(RHIQueueFamily::Transfer), 0, &queue);
-		auto staging_buffer = std::make_unique<Buffer>(p_device, BufferDesc{"", RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU, size});
-
-		{
-			std::memcpy((uint8_t *) staging_buffer->Map(), data, size);
-			auto cmd_buffer = std::make_unique<Command>(p_device, RHIQueueFamily::Transfer);
-			cmd_buffer->Init();
-			cmd_buffer->Begin();
-			cmd_buffer->CopyBufferToBuffer(staging_buffer.get(), this, size, 0, offset);
-			cmd_buffer->End();
-
-			auto vk_cmd_buffer = cmd_buffer->GetHandle();
-
-			VkSubmitInfo submit_info         = {};
-			submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-			submit_info.commandBufferCount   = 1;
-			submit_info.pCommandBuffers      = &vk_cmd_buffer;
-			submit_info.signalSemaphoreCount = 0;
-			submit_info.pSignalSemaphores    = nullptr;
-			submit_info.waitSemaphoreCount   = 0;
-			submit_info.pWaitSemaphores      = nullptr;
-			submit_info.pWaitDstStageMask    = nullptr;
-
-			vkQueueSubmit(queue, 1, &submit_info, fence ? fence->GetHandle() : nullptr);
-			fence->Wait();
-		}
+		// Staged and submitted with the next queue submission, which waits for the copy
+		static_cast<Device *>(p_device)->GetStagingRing()->Upload(this, data, size, offset);
 	}
 }
 
@@ -263,9 +309,7 @@ void Buffer::CopyToHost(void *data, size_t size, size_t offset)
 	}
 	else
 	{
-		auto    fence = std::make_unique<Fence>(p_device);
-		VkQueue queue = VK_NULL_HANDLE;
-		vkGetDeviceQueue(static_cast<Device *>(p_device)->GetDevice(), static_cast<Device *>(p_device)->GetQueueFamily(RHIQueueFamily::Transfer), 0, &queue);
+		auto fence          = std::make_unique<Fence>(p_device);
 		auto staging_buffer = std::make_unique<Buffer>(p_device, BufferDesc{"", RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_TO_CPU, size});
 
 		{
@@ -275,19 +319,8 @@ void Buffer::CopyToHost(void *data, size_t size, size_t offset)
 			cmd_buffer->CopyBufferToBuffer(this, staging_buffer.get(), size, 0, offset);
 			cmd_buffer->End();
 
-			auto vk_cmd_buffer = cmd_buffer->GetHandle();
-
-			VkSubmitInfo submit_info         = {};
-			submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-			submit_info.commandBufferCount   = 1;
-			submit_info.pCommandBuffers      = &vk_cmd_buffer;
-			submit_info.signalSemaphoreCount = 0;
-			submit_info.pSignalSemaphores    = nullptr;
-			submit_info.waitSemaphoreCount   = 0;
-			submit_info.pWaitSemaphores      = nullptr;
-			submit_info.pWaitDstStageMask    = nullptr;
-
-			vkQueueSubmit(queue, 1, &submit_info, fence->GetHandle());
+			// Submitted on the transfer queue behind the uploads still staged for this buffer
+			static_cast<Device *>(p_device)->GetStagingRing()->Execute(cmd_buffer->GetHandle(), fence->GetHandle());
 			fence->Wait();
 
 			std::memcpy(data, (uint8_t *) staging_buffer->Map(), size);
@@ -332,7 +365,7 @@ void Buffer::Flush(size_t offset, size_t size)
 {
 	if (m_allocation)
 	{
-		vmaFlushAllocation(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, 0, m_desc.size);
+		vmaFlushAllocation(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, offset, size);
 	}
 	else
 	{
@@ -23,8 +23,12 @@ class Buffer : public RHIBuffer
   public:
 	Buffer(RHIDevice *device, const BufferDesc &desc);
 
+	Buffer(RHIDevice *device, const BufferDesc &desc, VkBuffer buffer);
+
 	virtual ~Buffer() override;
 
+	virtual std::unique_ptr<RHIBuffer> Alias(const BufferDesc &desc, size_t offset = 0) override;
+
 	virtual void CopyToDevice(const void *data, size_t size, size_t offset = 0) override;
 
 	virtual void CopyToHost(void *data, size_t size, size_t offset) override;
@@ -487,6 +487,48 @@ void Command::BlitTexture(RHITexture *src_texture, const TextureRange &src_range
 	}
 }
 
+void Command::CopyTexture(RHITexture *src_texture, const TextureRange &src_range, const RHIResourceState &src_state, RHITexture *dst_texture, const TextureRange &dst_range, const RHIResourceState &dst_state)
+{
+	if (src_state != RHIResourceState::TransferSource)
+	{
+		ResourceStateTransition({TextureStateTransition{src_texture, src_state, RHIResourceState::TransferSource, src_range}}, {});
+	}
+
+	if (dst_state != RHIResourceState::TransferDest)
+	{
+		ResourceStateTransition({TextureStateTransition{dst_texture, dst_state, RHIResourceState::TransferDest, dst_range}}, {});
+	}
+
+	// Transfer src/dst are mandatory for every sampled format, blit src/dst are not for depth
+	VkImageCopy region = {};
+
+	region.srcSubresource.aspectMask     = IsDepthFormat(src_texture->GetDesc().format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+	region.srcSubresource.baseArrayLayer = src_range.base_layer;
+	region.srcSubresource.layerCount     = src_range.layer_count;
+	region.srcSubresource.mipLevel       = src_range.base_mip;
+
+	region.dstSubresource.aspectMask     = IsDepthFormat(dst_texture->GetDesc().format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+	region.dstSubresource.baseArrayLayer = dst_range.base_layer;
+	region.dstSubresource.layerCount     = dst_range.layer_count;
+	region.dstSubresource.mipLevel       = dst_range.base_mip;
+
+	region.extent.width  = std::max(src_texture->GetDesc().width >> src_range.base_mip, 1u);
+	region.extent.height = std::max(src_texture->GetDesc().height >> src_range.base_mip, 1u);
+	region.extent.depth  = 1;
+
+	vkCmdCopyImage(m_handle, static_cast<Texture *>(src_texture)->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, static_cast<Texture *>(dst_texture)->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+	if (src_state != RHIResourceState::TransferSource && src_state != RHIResourceState::Undefined)
+	{
+		ResourceStateTransition({TextureStateTransition{src_texture, RHIResourceState::TransferSource, src_state, src_range}}, {});
+	}
+
+	if (dst_state != RHIResourceState::TransferDest && dst_state != RHIResourceState::Undefined)
+	{
+		ResourceStateTransition({TextureStateTransition{dst_texture, RHIResourceState::TransferDest, dst_state, dst_range}}, {});
+	}
+}
+
 void Command::FillBuffer(RHIBuffer *buffer, RHIResourceState state, size_t size, size_t offset, uint32_t data)
 {
 	if (state != RHIResourceState::TransferDest)
@@ -549,6 +591,37 @@ void Command::FillTexture(RHITexture *texture, RHIResourceState state, const Tex
 
 void Command::FillTexture(RHITexture *texture, RHIResourceState state, const TextureRange &range, float depth)
 {
+	VkClearDepthStencilValue clear_value = {};
+	clear_value.depth                    = depth;
+
+	VkImageSubresourceRange vk_range = {};
+	vk_range.aspectMask              = VK_IMAGE_ASPECT_DEPTH_BIT;
+	vk_range.baseArrayLayer          = range.base_layer;
+	vk_range.baseMipLevel            = range.base_mip;
+	vk_range.layerCount              = range.layer_count;
+	vk_range.levelCount              = range.mip_count;
+
+	if (state != RHIResourceState::TransferDest)
+	{
+		ResourceStateTransition({TextureStateTransition{
+		                            texture,
+		                            state,
+		                            RHIResourceState::TransferDest,
+		                            range}},
+		                        {});
+	}
+
+	vkCmdClearDepthStencilImage(m_handle, static_cast<Texture *>(texture)->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_value, 1, &vk_range);
+
+	if (state != RHIResourceState::TransferDest)
+	{
+		ResourceStateTransition({TextureStateTransition{
+		                            texture,
+		                            RHIResourceState::TransferDest,
+		                            state,
+		                            range}},
+		                        {});
+	}
 }
 
 void Command::ResourceStateTransition(const std::vector<TextureStateTransition> &texture_transitions, const std::vector<BufferStateTransition> &buffer_transitions)
@@ -11,6 +11,7 @@ namespace Ilum::Vulkan
 inline static std::unordered_map<std::thread::id, VkDescriptorPool> DescriptorPools;
 inline static std::unordered_map<size_t, VkDescriptorSetLayout>     DescriptorSetLayouts;
 inline static std::unordered_map<size_t, VkDescriptorSet>           DescriptorSet;
+inline static std::mutex                                            DescriptorMutex;
 
 inline static std::atomic<uint32_t> DescriptorCount    = 0;
 inline static uint32_t              MaxDescriptorCount = 16384ul;
@@ -87,7 +88,7 @@ Descriptor::Descriptor(RHIDevice *device, const ShaderMeta &meta) :
 
 	for (auto &[set, meta] : set_meta)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::mutex> lock(DescriptorMutex);
 		// Create descriptor set layout
 		VkDescriptorSetLayout layout = VK_NULL_HANDLE;
 		if (DescriptorSetLayouts.find(meta.hash) == DescriptorSetLayouts.end())
@@ -360,17 +361,24 @@ const std::unordered_map<uint32_t, VkDescriptorSet> &Descriptor::GetDescriptorSe
 			}
 		}
 
-		if (DescriptorSet.find(hash) != DescriptorSet.end())
+		bool exhausted = false;
+
 		{
-			VkDescriptorSet descriptor_set = DescriptorSet[hash];
-			m_descriptor_sets[set]         = descriptor_set;
-			return m_descriptor_sets;
+			std::lock_guard<std::mutex> lock(DescriptorMutex);
+			if (DescriptorSet.find(hash) != DescriptorSet.end())
+			{
+				VkDescriptorSet descriptor_set = DescriptorSet[hash];
+				m_descriptor_sets[set]         = descriptor_set;
+				return m_descriptor_sets;
+			}
+			exhausted = DescriptorSet.size() >= MaxDescriptorCount;
 		}
 
-		if (DescriptorSet.size() >= MaxDescriptorCount)
+		if (exhausted)
 		{
 			p_device->WaitIdle();
 			vkResetDescriptorPool(static_cast<Device *>(p_device)->GetDevice(), CreateDescriptorPool(std::this_thread::get_id()), 0);
+			std::lock_guard<std::mutex> lock(DescriptorMutex);
 			DescriptorSet.clear();
 		}
 
@@ -385,8 +393,15 @@ const std::unordered_map<uint32_t, VkDescriptorSet> &Descriptor::GetDescriptorSe
 		vkAllocateDescriptorSets(static_cast<Device *>(p_device)->GetDevice(), &allocate_info, &descriptor_set);
 
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-			DescriptorSet.emplace(hash, descriptor_set);
+			std::lock_guard<std::mutex> lock(DescriptorMutex);
+			// Same-key allocations may race between the lookup and here, hand the duplicate back to its pool
+			auto [iter, inserted] = DescriptorSet.emplace(hash, descriptor_set);
+			if (!inserted)
+			{
+				vkFreeDescriptorSets(static_cast<Device *>(p_device)->GetDevice(), allocate_info.descriptorPool, 1, &descriptor_set);
+				m_descriptor_sets[set] = iter->second;
+				continue;
+			}
 			m_descriptor_sets[set] = descriptor_set;
 		}
 
@@ -497,6 +512,8 @@ const std::map<std::string, ConstantResolve> &Descriptor::GetConstantResolve() c
 
 VkDescriptorPool Descriptor::CreateDescriptorPool(const std::thread::id &thread_id)
 {
+	std::lock_guard<std::mutex> lock(DescriptorMutex);
+
 	if (DescriptorPools.find(thread_id) != DescriptorPools.end())
 	{
 		return DescriptorPools.at(thread_id);
@@ -522,11 +539,8 @@ VkDescriptorPool Descriptor::CreateDescriptorPool(const std::thread::id &thread_
 	descriptor_pool_create_info.maxSets                    = MaxDescriptorCount;
 	descriptor_pool_create_info.flags                      = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT | VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
 
-	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-		DescriptorPools[thread_id] = VK_NULL_HANDLE;
-		vkCreateDescriptorPool(static_cast<Device *>(p_device)->GetDevice(), &descriptor_pool_create_info, nullptr, &DescriptorPools[thread_id]);
-	}
+	DescriptorPools[thread_id] = VK_NULL_HANDLE;
+	vkCreateDescriptorPool(static_cast<Device *>(p_device)->GetDevice(), &descriptor_pool_create_info, nullptr, &DescriptorPools[thread_id]);
 
 	return DescriptorPools[thread_id];
 }
@@ -86,7 +86,5 @@ class Descriptor : public RHIDescriptor
 	std::unordered_map<std::string, size_t> m_binding_hash;
 
 	std::unordered_map<uint32_t, bool> m_binding_dirty;
-
-	std::mutex m_mutex;
 };
 }        // namespace Ilum::Vulkan
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Device.hpp"
+#include "StagingRing.hpp"
 
 #ifdef _WIN64
 #	include <VersionHelpers.h>
@@ -726,12 +727,16 @@ Device::Device() :
 	CreateInstance();
 	CreatePhysicalDevice();
 	CreateLogicalDevice();
+
+	m_staging_ring = std::make_unique<StagingRing>(this);
 }
 
 Device::~Device()
 {
 	vkDeviceWaitIdle(m_logical_device);
 
+	m_staging_ring.reset();
+
 	if (m_allocator)
 	{
 		vmaDestroyAllocator(m_allocator);
@@ -755,6 +760,7 @@ Device::~Device()
 
 void Device::WaitIdle()
 {
+	m_staging_ring->Wait();
 	vkDeviceWaitIdle(m_logical_device);
 }
 
@@ -768,6 +774,16 @@ bool Device::IsFeatureSupport(VulkanFeature feature)
 	return m_vulkan_feature_support[feature];
 }
 
+UploadStatistics Device::GetUploadStatistics() const
+{
+	return m_staging_ring->GetStatistics();
+}
+
+void Device::FlushUploads()
+{
+	m_staging_ring->Flush();
+}
+
 VkInstance Device::GetInstance() const
 {
 	return m_instance;
@@ -820,6 +836,11 @@ uint32_t Device::GetQueueCount(RHIQueueFamily family)
 	return m_graphics_queue_count;
 }
 
+StagingRing *Device::GetStagingRing() const
+{
+	return m_staging_ring.get();
+}
+
 void Device::SetVulkanObjectName(const VkDebugUtilsObjectNameInfoEXT &info)
 {
 	vkSetDebugUtilsObjectNameEXT(m_logical_device, &info);
@@ -4,6 +4,8 @@
 
 namespace Ilum::Vulkan
 {
+class StagingRing;
+
 class Device : public RHIDevice
 {
   private:
@@ -22,6 +24,10 @@ class Device : public RHIDevice
 
 	bool IsFeatureSupport(VulkanFeature feature);
 
+	virtual UploadStatistics GetUploadStatistics() const override;
+
+	virtual void FlushUploads() override;
+
 	VkInstance       GetInstance() const;
 	VkPhysicalDevice GetPhysicalDevice() const;
 	VkDevice         GetDevice() const;
@@ -30,6 +36,8 @@ class Device : public RHIDevice
 	uint32_t GetQueueFamily(RHIQueueFamily family);
 	uint32_t GetQueueCount(RHIQueueFamily family);
 
+	StagingRing *GetStagingRing() const;
+
 	void SetVulkanObjectName(const VkDebugUtilsObjectNameInfoEXT &info);
 
 	void BeginDebugUtilsLabel(VkCommandBuffer cmd_buffer, const VkDebugUtilsLabelEXT &label);
@@ -61,5 +69,7 @@ class Device : public RHIDevice
 	uint32_t m_graphics_queue_count = 0;
 	uint32_t m_compute_queue_count  = 0;
 	uint32_t m_transfer_queue_count = 0;
+
+	std::unique_ptr<StagingRing> m_staging_ring = nullptr;
 };
 }        // namespace Ilum::Vulkan
\ No newline at end of file
@@ -29,6 +29,8 @@ Frame::~Frame()
 
 RHIFence *Frame::AllocateFence()
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
 	if (m_fences.size() > m_active_fence_index)
 	{
 		return m_fences[m_active_fence_index++].get();
@@ -46,6 +48,8 @@ RHIFence *Frame::AllocateFence()
 
 RHISemaphore *Frame::AllocateSemaphore()
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
 	if (m_semaphores.size() > m_active_semaphore_index)
 	{
 		return m_semaphores[m_active_semaphore_index++].get();
@@ -66,10 +70,11 @@ RHICommand *Frame::AllocateCommand(RHIQueueFamily family)
 	size_t hash = 0;
 	HashCombine(hash, family, std::this_thread::get_id());
 
+	// Pools are per (family, thread), only the bookkeeping maps are shared between recording threads
+	std::lock_guard<std::mutex> lock(m_mutex);
+
 	if (m_command_pools.find(hash) == m_command_pools.end())
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-
 		VkCommandPoolCreateInfo create_info = {};
 		create_info.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
 		create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
@@ -83,28 +88,29 @@ RHICommand *Frame::AllocateCommand(RHIQueueFamily family)
 
 	if (m_commands.find(hash) == m_commands.end())
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
 		m_commands.emplace(hash, std::vector<std::unique_ptr<Command>>{});
 		m_active_cmd_index[hash] = 0;
 	}
 
-	if (m_commands.at(hash).size() > m_active_cmd_index.at(hash))
+	auto &commands     = m_commands.at(hash);
+	auto &active_index = m_active_cmd_index.at(hash);
+
+	if (commands.size() > active_index)
 	{
-		auto &cmd = m_commands.at(hash).at(m_active_cmd_index.at(hash));
+		auto &cmd = commands.at(active_index);
 		cmd->Init();
-		m_active_cmd_index[hash]++;
+		active_index++;
 		return cmd.get();
 	}
 
-	while (m_commands.at(hash).size() <= m_active_cmd_index.at(hash))
+	while (commands.size() <= active_index)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-		m_commands[hash].emplace_back(std::make_unique<Command>(p_device, m_command_pools[hash], family));
+		commands.emplace_back(std::make_unique<Command>(p_device, m_command_pools.at(hash), family));
 	}
 
-	m_active_cmd_index[hash]++;
+	active_index++;
 
-	auto &cmd = m_commands[hash].back();
+	auto &cmd = commands.back();
 	cmd->Init();
 	return cmd.get();
 }
@@ -114,29 +120,32 @@ RHIDescriptor *Frame::AllocateDescriptor(const ShaderMeta &meta)
 	size_t hash = 0;
 	HashCombine(hash, meta.hash, std::this_thread::get_id());
 
+	std::lock_guard<std::mutex> lock(m_mutex);
+
 	if (m_descriptors.find(hash) == m_descriptors.end())
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
 		m_descriptors.emplace(hash, std::vector<std::unique_ptr<Descriptor>>{});
 		m_active_descriptor_index[hash] = 0;
 	}
 
-	if (m_descriptors[hash].size() > m_active_descriptor_index[hash])
+	auto &descriptors  = m_descriptors.at(hash);
+	auto &active_index = m_active_descriptor_index.at(hash);
+
+	if (descriptors.size() > active_index)
 	{
-		auto &descriptor = m_descriptors[hash][m_active_descriptor_index[hash]];
-		m_active_descriptor_index[hash]++;
+		auto &descriptor = descriptors[active_index];
+		active_index++;
 		return descriptor.get();
 	}
 
-	while (m_descriptors[hash].size() <= m_active_descriptor_index[hash])
+	while (descriptors.size() <= active_index)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-		m_descriptors[hash].emplace_back(std::make_unique<Descriptor>(p_device, meta));
+		descriptors.emplace_back(std::make_unique<Descriptor>(p_device, meta));
 	}
 
-	m_active_descriptor_index[hash]++;
+	active_index++;
 
-	auto &descriptor = m_descriptors[hash].back();
+	auto &descriptor = descriptors.back();
 	return descriptor.get();
 }
 
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstring>
+#include <vector>
+
+namespace Ilum::Vulkan
+{
+// Check a serialized pipeline cache against the header layout of the current device
+// Kept free of any device object so it can be tested without a GPU
+inline bool ValidatePipelineCacheData(const std::vector<uint8_t> &data, const VkPhysicalDeviceProperties &properties)
+{
+	VkPipelineCacheHeaderVersionOne header = {};
+
+	if (data.size() < sizeof(header))
+	{
+		return false;
+	}
+
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	return header.headerSize >= sizeof(header) &&
+	       header.headerSize <= data.size() &&
+	       header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+	       header.vendorID == properties.vendorID &&
+	       header.deviceID == properties.deviceID &&
+	       std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+}        // namespace Ilum::Vulkan
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Definitions.hpp"
 #include "Descriptor.hpp"
 #include "Device.hpp"
+#include "PipelineCache.hpp"
 #include "RenderTarget.hpp"
 #include "Shader.hpp"
 
@@ -103,6 +104,12 @@ static std::mutex
 
 static std::atomic<uint32_t> PipelineCount = 0;
 
+// Seed data of every per-thread pipeline cache, loaded from disk once
+static std::vector<uint8_t> PipelineCacheData;
+static bool                 PipelineCacheLoaded = false;
+
+static const std::string PipelineCachePath = "./bin/Vulkan.pipelinecache";
+
 PipelineState::PipelineState(RHIDevice *device) :
     RHIPipelineState(device)
 {
@@ -115,6 +122,8 @@ PipelineState ::~PipelineState()
 
 	if (PipelineCount == 0)
 	{
+		SavePipelineCache();
+
 		for (auto &[hash, pipeline] : Pipelines)
 		{
 			vkDestroyPipeline(static_cast<Device *>(p_device)->GetDevice(), pipeline, nullptr);
@@ -132,8 +141,11 @@ PipelineState ::~PipelineState()
 		for (auto &[thread_id, pipeline_cache] : PipelineCaches)
 		{
 			vkDestroyPipelineCache(static_cast<Device *>(p_device)->GetDevice(), pipeline_cache, nullptr);
-			pipeline_cache = VK_NULL_HANDLE;
 		}
+
+		PipelineCaches.clear();
+		PipelineCacheData.clear();
+		PipelineCacheLoaded = false;
 	}
 }
 
@@ -142,9 +154,12 @@ VkPipelineLayout PipelineState::GetPipelineLayout(Descriptor *descriptor)
 	size_t hash = 0;
 	HashCombine(hash, descriptor->GetShaderMeta().hash, GetHash());
 
-	if (PipelineLayouts.find(hash) != PipelineLayouts.end())
 	{
-		return PipelineLayouts[hash];
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (PipelineLayouts.find(hash) != PipelineLayouts.end())
+		{
+			return PipelineLayouts[hash];
+		}
 	}
 
 	return CreatePipelineLayout(descriptor);
@@ -174,6 +189,8 @@ VkPipeline PipelineState::GetPipeline(Descriptor *descriptor, RenderTarget *rend
 ShaderBindingTable PipelineState::GetShaderBindingTable(VkPipeline pipeline)
 {
 	ShaderBindingTable sbt;
+
+	std::lock_guard<std::mutex> lock(Mutex);
 	if (ShaderBindingTables.find(pipeline) != ShaderBindingTables.end())
 	{
 		auto &shader_binding_table_infos = ShaderBindingTables.at(pipeline);
@@ -208,17 +225,80 @@ VkPipelineBindPoint PipelineState::GetPipelineBindPoint() const
 
 VkPipelineCache PipelineState::CreatePipelineCache(const std::thread::id &thread_id)
 {
+	std::lock_guard<std::mutex> lock(Mutex);
+
+	if (!PipelineCacheLoaded)
+	{
+		PipelineCacheLoaded = true;
+
+		if (Path::GetInstance().IsExist(PipelineCachePath))
+		{
+			VkPhysicalDeviceProperties properties = {};
+			vkGetPhysicalDeviceProperties(static_cast<Device *>(p_device)->GetPhysicalDevice(), &properties);
+
+			Path::GetInstance().Read(PipelineCachePath, PipelineCacheData);
+			if (!ValidatePipelineCacheData(PipelineCacheData, properties))
+			{
+				// Driver or device changed, the blob must not be fed to the driver
+				LOG_INFO("Discard outdated pipeline cache {}", PipelineCachePath);
+				PipelineCacheData.clear();
+			}
+		}
+	}
+
 	if (PipelineCaches.find(thread_id) == PipelineCaches.end())
 	{
-		std::lock_guard<std::mutex> lock(Mutex);
 		PipelineCaches[thread_id]             = VK_NULL_HANDLE;
 		VkPipelineCacheCreateInfo create_info = {};
 		create_info.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		create_info.initialDataSize           = PipelineCacheData.size();
+		create_info.pInitialData              = PipelineCacheData.empty() ? nullptr : PipelineCacheData.data();
 		vkCreatePipelineCache(static_cast<Device *>(p_device)->GetDevice(), &create_info, nullptr, &PipelineCaches[thread_id]);
 	}
 	return PipelineCaches.at(thread_id);
 }
 
+void PipelineState::SavePipelineCache()
+{
+	if (PipelineCaches.empty())
+	{
+		return;
+	}
+
+	VkDevice device = static_cast<Device *>(p_device)->GetDevice();
+
+	// Merge every per-thread cache into a single one
+	std::vector<VkPipelineCache> src_caches;
+	src_caches.reserve(PipelineCaches.size());
+	for (auto &[thread_id, pipeline_cache] : PipelineCaches)
+	{
+		src_caches.push_back(pipeline_cache);
+	}
+
+	VkPipelineCache dst_cache = VK_NULL_HANDLE;
+
+	VkPipelineCacheCreateInfo create_info = {};
+	create_info.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	if (vkCreatePipelineCache(device, &create_info, nullptr, &dst_cache) != VK_SUCCESS)
+	{
+		return;
+	}
+
+	vkMergePipelineCaches(device, dst_cache, static_cast<uint32_t>(src_caches.size()), src_caches.data());
+
+	size_t data_size = 0;
+	vkGetPipelineCacheData(device, dst_cache, &data_size, nullptr);
+
+	std::vector<uint8_t> data(data_size);
+	if (data_size > 0 && vkGetPipelineCacheData(device, dst_cache, &data_size, data.data()) == VK_SUCCESS)
+	{
+		data.resize(data_size);
+		Path::GetInstance().Save(PipelineCachePath, data);
+	}
+
+	vkDestroyPipelineCache(device, dst_cache, nullptr);
+}
+
 VkPipelineLayout PipelineState::CreatePipelineLayout(Descriptor *descriptor)
 {
 	size_t hash = 0;
@@ -281,7 +361,16 @@ VkPipelineLayout PipelineState::CreatePipelineLayout(Descriptor *descriptor)
 	VkPipelineLayout layout = VK_NULL_HANDLE;
 	vkCreatePipelineLayout(static_cast<Device *>(p_device)->GetDevice(), &pipeline_layout_create_info, nullptr, &layout);
 
-	PipelineLayouts.emplace(hash, layout);
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		// Another thread may have built the same layout meanwhile, keep the first one
+		auto [iter, inserted] = PipelineLayouts.emplace(hash, layout);
+		if (!inserted)
+		{
+			vkDestroyPipelineLayout(static_cast<Device *>(p_device)->GetDevice(), layout, nullptr);
+			return iter->second;
+		}
+	}
 
 	return layout;
 }
@@ -305,9 +394,12 @@ VkPipeline PipelineState::CreateGraphicsPipeline(Descriptor *descriptor, RenderT
 		}
 	}
 
-	if (Pipelines.find(hash) != Pipelines.end())
 	{
-		return Pipelines[hash];
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (Pipelines.find(hash) != Pipelines.end())
+		{
+			return Pipelines[hash];
+		}
 	}
 
 	// Input Assembly State
@@ -475,7 +567,13 @@ VkPipeline PipelineState::CreateGraphicsPipeline(Descriptor *descriptor, RenderT
 
 	{
 		std::lock_guard<std::mutex> lock(Mutex);
-		Pipelines.emplace(hash, pipeline);
+		// Another thread may have built the same pipeline meanwhile, keep the first one
+		auto [iter, inserted] = Pipelines.emplace(hash, pipeline);
+		if (!inserted)
+		{
+			vkDestroyPipeline(static_cast<Device *>(p_device)->GetDevice(), pipeline, nullptr);
+			return iter->second;
+		}
 	}
 
 	return pipeline;
@@ -486,9 +584,12 @@ VkPipeline PipelineState::CreateComputePipeline(Descriptor *descriptor)
 	size_t hash = 0;
 	HashCombine(hash, descriptor->GetShaderMeta().hash, GetHash());
 
-	if (Pipelines.find(hash) != Pipelines.end())
 	{
-		return Pipelines[hash];
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (Pipelines.find(hash) != Pipelines.end())
+		{
+			return Pipelines[hash];
+		}
 	}
 
 	VkPipelineShaderStageCreateInfo shader_stage_create_info = {};
@@ -516,7 +617,13 @@ VkPipeline PipelineState::CreateComputePipeline(Descriptor *descriptor)
 
 	{
 		std::lock_guard<std::mutex> lock(Mutex);
-		Pipelines.emplace(hash, pipeline);
+		// Another thread may have built the same pipeline meanwhile, keep the first one
+		auto [iter, inserted] = Pipelines.emplace(hash, pipeline);
+		if (!inserted)
+		{
+			vkDestroyPipeline(static_cast<Device *>(p_device)->GetDevice(), pipeline, nullptr);
+			return iter->second;
+		}
 	}
 
 	return pipeline;
@@ -527,9 +634,12 @@ VkPipeline PipelineState::CreateRayTracingPipeline(Descriptor *descriptor)
 	size_t hash = 0;
 	HashCombine(hash, descriptor->GetShaderMeta().hash, GetHash());
 
-	if (Pipelines.find(hash) != Pipelines.end())
 	{
-		return Pipelines[hash];
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (Pipelines.find(hash) != Pipelines.end())
+		{
+			return Pipelines[hash];
+		}
 	}
 
 	VkPipeline pipeline = VK_NULL_HANDLE;
@@ -715,11 +825,6 @@ VkPipeline PipelineState::CreateRayTracingPipeline(Descriptor *descriptor)
 
 	vkCreateRayTracingPipelinesKHR(static_cast<Device *>(p_device)->GetDevice(), VK_NULL_HANDLE, CreatePipelineCache(std::this_thread::get_id()), 1, &raytracing_pipeline_create_info, nullptr, &pipeline);
 
-	{
-		std::lock_guard<std::mutex> lock(Mutex);
-		Pipelines.emplace(hash, pipeline);
-	}
-
 	// Create shader binding table
 	/*
 	    SBT Layout:
@@ -785,7 +890,14 @@ VkPipeline PipelineState::CreateRayTracingPipeline(Descriptor *descriptor)
 	}
 
 	{
+		// Publish the pipeline only once its binding table exists, so a cache hit never sees it half built
 		std::lock_guard<std::mutex> lock(Mutex);
+		auto [iter, inserted] = Pipelines.emplace(hash, pipeline);
+		if (!inserted)
+		{
+			vkDestroyPipeline(static_cast<Device *>(p_device)->GetDevice(), pipeline, nullptr);
+			return iter->second;
+		}
 		ShaderBindingTables.emplace(pipeline, std::move(sbt));
 	}
 
@@ -32,6 +32,7 @@ class PipelineState : public RHIPipelineState
 
   private:
 	VkPipelineCache  CreatePipelineCache(const std::thread::id &thread_id);
+	void             SavePipelineCache();
 	VkPipelineLayout CreatePipelineLayout(Descriptor *descriptor);
 	VkPipeline       CreateGraphicsPipeline(Descriptor *descriptor, RenderTarget *render_target);
 	VkPipeline       CreateComputePipeline(Descriptor *descriptor);
@@ -1,6 +1,7 @@
 #include "Queue.hpp"
 #include "Command.hpp"
 #include "Device.hpp"
+#include "StagingRing.hpp"
 #include "Synchronization.hpp"
 
 namespace Ilum::Vulkan
@@ -96,6 +97,9 @@ void Queue::Execute(RHIQueueFamily family, const std::vector<SubmitInfo> &submit
 		vkResetFences(p_device->GetDevice(), 1, &vk_fence);
 	}
 
+	// Buffer uploads are flushed once per frame by the context, every batch waits for the last flushed ones on the upload timeline
+	uint64_t upload_value = p_device->GetStagingRing()->GetValue();
+
 	std::vector<VkSubmitInfo> vk_submit_infos;
 	vk_submit_infos.reserve(submit_infos.size());
 
@@ -103,6 +107,8 @@ void Queue::Execute(RHIQueueFamily family, const std::vector<SubmitInfo> &submit
 	std::vector<std::vector<VkCommandBuffer>>      cmd_buffers(submit_infos.size());
 	std::vector<std::vector<VkSemaphore>>          wait_semaphores(submit_infos.size());
 	std::vector<std::vector<VkSemaphore>>          signal_semaphores(submit_infos.size());
+	std::vector<std::vector<uint64_t>>             wait_values(submit_infos.size());
+	std::vector<VkTimelineSemaphoreSubmitInfo>     timeline_infos(submit_infos.size());
 
 	for (uint32_t i = 0; i < submit_infos.size(); i++)
 	{
@@ -137,6 +143,21 @@ void Queue::Execute(RHIQueueFamily family, const std::vector<SubmitInfo> &submit
 		VkSubmitInfo vk_submit_info = {};
 		vk_submit_info.sType        = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
+		if (upload_value > 0)
+		{
+			// Values of binary semaphores are ignored
+			wait_values[i].resize(wait_semaphores[i].size(), 0);
+			wait_values[i].push_back(upload_value);
+			wait_semaphores[i].push_back(p_device->GetStagingRing()->GetSemaphore());
+			pipeline_stage_flags[i].push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+			timeline_infos[i].sType                   = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+			timeline_infos[i].waitSemaphoreValueCount = static_cast<uint32_t>(wait_values[i].size());
+			timeline_infos[i].pWaitSemaphoreValues    = wait_values[i].data();
+
+			vk_submit_info.pNext = &timeline_infos[i];
+		}
+
 		vk_submit_info.commandBufferCount   = static_cast<uint32_t>(cmd_buffers[i].size());
 		vk_submit_info.pCommandBuffers      = cmd_buffers[i].data();
 		vk_submit_info.signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores[i].size());
@@ -148,7 +169,7 @@ void Queue::Execute(RHIQueueFamily family, const std::vector<SubmitInfo> &submit
 		vk_submit_infos.push_back(std::move(vk_submit_info));
 	}
 
-	vkQueueSubmit(queue, static_cast<uint32_t>(vk_submit_infos.size()), vk_submit_infos.data(), vk_fence);
+	p_device->GetStagingRing()->Submit(queue, static_cast<uint32_t>(vk_submit_infos.size()), vk_submit_infos.data(), vk_fence);
 
 	m_queue_index[family] = m_queue_index[family] % p_device->GetQueueCount(family);
 }
@@ -169,17 +190,27 @@ void Queue::Execute(RHICommand *cmd_buffer)
 		vkResetFences(p_device->GetDevice(), 1, &fence);
 	}
 
+	uint64_t             upload_value     = p_device->GetStagingRing()->GetValue();
+	VkSemaphore          upload_semaphore = p_device->GetStagingRing()->GetSemaphore();
+	VkPipelineStageFlags upload_stage     = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+	VkTimelineSemaphoreSubmitInfo timeline_info = {};
+	timeline_info.sType                         = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+	timeline_info.waitSemaphoreValueCount       = 1;
+	timeline_info.pWaitSemaphoreValues          = &upload_value;
+
 	VkSubmitInfo submit_info         = {};
 	submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext                = upload_value > 0 ? &timeline_info : nullptr;
 	submit_info.commandBufferCount   = 1;
 	submit_info.pCommandBuffers      = &vk_cmd_buffer;
 	submit_info.signalSemaphoreCount = 0;
 	submit_info.pSignalSemaphores    = nullptr;
-	submit_info.waitSemaphoreCount   = 0;
-	submit_info.pWaitSemaphores      = nullptr;
-	submit_info.pWaitDstStageMask    = nullptr;
+	submit_info.waitSemaphoreCount   = upload_value > 0 ? 1 : 0;
+	submit_info.pWaitSemaphores      = &upload_semaphore;
+	submit_info.pWaitDstStageMask    = &upload_stage;
 
-	vkQueueSubmit(m_queues[family][index], 1, &submit_info, fence);
+	p_device->GetStagingRing()->Submit(m_queues[family][index], 1, &submit_info, fence);
 	vkWaitForFences(p_device->GetDevice(), 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
 	vkResetFences(p_device->GetDevice(), 1, &fence);
 }
@@ -0,0 +1,346 @@
+#include "StagingRing.hpp"
+#include "Buffer.hpp"
+#include "Device.hpp"
+
+namespace Ilum::Vulkan
+{
+StagingRing::StagingRing(Device *device) :
+    p_device(device), m_schedule(RingSize, Alignment)
+{
+	m_buffer = std::make_unique<Buffer>(p_device, BufferDesc{"Staging Ring", RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU, RingSize});
+	m_mapped = static_cast<uint8_t *>(m_buffer->Map());
+
+	vkGetDeviceQueue(p_device->GetDevice(), p_device->GetQueueFamily(RHIQueueFamily::Transfer), 0, &m_queue);
+
+	VkCommandPoolCreateInfo pool_create_info = {};
+	pool_create_info.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	pool_create_info.queueFamilyIndex        = p_device->GetQueueFamily(RHIQueueFamily::Transfer);
+	vkCreateCommandPool(p_device->GetDevice(), &pool_create_info, nullptr, &m_pool);
+
+	VkSemaphoreTypeCreateInfo type_create_info = {};
+	type_create_info.sType                     = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+	type_create_info.semaphoreType             = VK_SEMAPHORE_TYPE_TIMELINE;
+	type_create_info.initialValue              = 0;
+
+	VkSemaphoreCreateInfo semaphore_create_info = {};
+	semaphore_create_info.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+	semaphore_create_info.pNext                 = &type_create_info;
+	vkCreateSemaphore(p_device->GetDevice(), &semaphore_create_info, nullptr, &m_semaphore);
+
+	{
+		VkDebugUtilsObjectNameInfoEXT info = {};
+		info.sType                         = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+		info.pObjectName                   = "Staging Ring Timeline";
+		info.objectHandle                  = (uint64_t) m_semaphore;
+		info.objectType                    = VK_OBJECT_TYPE_SEMAPHORE;
+		p_device->SetVulkanObjectName(info);
+	}
+}
+
+StagingRing::~StagingRing()
+{
+	Wait();
+
+	if (!m_free_cmd_buffers.empty())
+	{
+		vkFreeCommandBuffers(p_device->GetDevice(), m_pool, static_cast<uint32_t>(m_free_cmd_buffers.size()), m_free_cmd_buffers.data());
+		m_free_cmd_buffers.clear();
+	}
+
+	if (m_pool)
+	{
+		vkDestroyCommandPool(p_device->GetDevice(), m_pool, nullptr);
+		m_pool = VK_NULL_HANDLE;
+	}
+
+	if (m_semaphore)
+	{
+		vkDestroySemaphore(p_device->GetDevice(), m_semaphore, nullptr);
+		m_semaphore = VK_NULL_HANDLE;
+	}
+
+	m_buffer.reset();
+}
+
+void StagingRing::Upload(Buffer *buffer, const void *data, size_t size, size_t offset)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_statistics.uploads++;
+
+	// Large uploads are streamed through the ring in chunks
+	for (size_t copied = 0; copied < size;)
+	{
+		size_t chunk_size = std::min(size - copied, MaxChunkSize);
+		size_t src_offset = Allocate(chunk_size);
+
+		std::memcpy(m_mapped + src_offset, static_cast<const uint8_t *>(data) + copied, chunk_size);
+
+		Copy copy             = {};
+		copy.buffer           = buffer->GetHandle();
+		copy.region.srcOffset = src_offset;
+		copy.region.dstOffset = offset + copied;
+		copy.region.size      = chunk_size;
+
+		// Copies are unordered within a command buffer and across submissions, later writes to the same range must wait for earlier ones
+		copy.barrier = m_schedule.Write((uint64_t) copy.buffer, copy.region.dstOffset, chunk_size);
+
+		m_copies.push_back(copy);
+
+		m_statistics.bytes += chunk_size;
+		copied += chunk_size;
+	}
+}
+
+void StagingRing::Discard(VkBuffer buffer)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (!m_schedule.Discard((uint64_t) buffer))
+	{
+		return;
+	}
+
+	m_copies.erase(std::remove_if(m_copies.begin(), m_copies.end(), [buffer](const Copy &copy) { return copy.buffer == buffer; }), m_copies.end());
+
+	// Nothing left to submit, hand the staged memory back
+	if (m_copies.empty())
+	{
+		m_schedule.Rewind();
+	}
+}
+
+uint64_t StagingRing::Flush()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	SubmitCopies();
+	Retire();
+
+	return m_schedule.GetValue();
+}
+
+void StagingRing::Wait()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	SubmitCopies();
+
+	uint64_t value = m_schedule.GetValue();
+	if (value > 0)
+	{
+		VkSemaphoreWaitInfo wait_info = {};
+		wait_info.sType               = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+		wait_info.semaphoreCount      = 1;
+		wait_info.pSemaphores         = &m_semaphore;
+		wait_info.pValues             = &value;
+		vkWaitSemaphores(p_device->GetDevice(), &wait_info, std::numeric_limits<uint64_t>::max());
+	}
+
+	Retire();
+}
+
+void StagingRing::Submit(VkQueue queue, uint32_t submit_count, const VkSubmitInfo *submit_infos, VkFence fence)
+{
+	// The transfer queue may be shared with another family, only submissions to it are serialized
+	if (queue != m_queue)
+	{
+		vkQueueSubmit(queue, submit_count, submit_infos, fence);
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	vkQueueSubmit(queue, submit_count, submit_infos, fence);
+}
+
+void StagingRing::Execute(VkCommandBuffer cmd_buffer, VkFence fence)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// Pending uploads may target the buffer being read back
+	SubmitCopies();
+
+	uint64_t             value = m_schedule.GetValue();
+	VkPipelineStageFlags stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+	VkTimelineSemaphoreSubmitInfo timeline_info = {};
+	timeline_info.sType                         = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+	timeline_info.waitSemaphoreValueCount       = 1;
+	timeline_info.pWaitSemaphoreValues          = &value;
+
+	VkSubmitInfo submit_info       = {};
+	submit_info.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext              = value > 0 ? &timeline_info : nullptr;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers    = &cmd_buffer;
+	submit_info.waitSemaphoreCount = value > 0 ? 1 : 0;
+	submit_info.pWaitSemaphores    = &m_semaphore;
+	submit_info.pWaitDstStageMask  = &stage;
+
+	vkQueueSubmit(m_queue, 1, &submit_info, fence);
+
+	Retire();
+}
+
+uint64_t StagingRing::GetValue() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_schedule.GetValue();
+}
+
+VkSemaphore StagingRing::GetSemaphore() const
+{
+	return m_semaphore;
+}
+
+UploadStatistics StagingRing::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+size_t StagingRing::Allocate(size_t size)
+{
+	size_t offset = 0;
+
+	while (!m_schedule.Allocate(size, offset))
+	{
+		size_t used = m_schedule.GetUsedSize();
+		Retire();
+		if (m_schedule.GetUsedSize() != used)
+		{
+			continue;
+		}
+
+		// The ring is full of pending copies, submit them so that their memory can be released
+		if (m_schedule.GetOldestValue() == 0)
+		{
+			SubmitCopies();
+		}
+
+		uint64_t value = m_schedule.GetOldestValue();
+
+		VkSemaphoreWaitInfo wait_info = {};
+		wait_info.sType               = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+		wait_info.semaphoreCount      = 1;
+		wait_info.pSemaphores         = &m_semaphore;
+		wait_info.pValues             = &value;
+		vkWaitSemaphores(p_device->GetDevice(), &wait_info, std::numeric_limits<uint64_t>::max());
+
+		m_statistics.stalls++;
+
+		Retire();
+	}
+
+	return offset;
+}
+
+void StagingRing::SubmitCopies()
+{
+	if (m_copies.empty())
+	{
+		return;
+	}
+
+	VkCommandBuffer cmd_buffer = VK_NULL_HANDLE;
+	if (!m_free_cmd_buffers.empty())
+	{
+		cmd_buffer = m_free_cmd_buffers.back();
+		m_free_cmd_buffers.pop_back();
+	}
+	else
+	{
+		VkCommandBufferAllocateInfo allocate_info = {};
+		allocate_info.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocate_info.commandPool                 = m_pool;
+		allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocate_info.commandBufferCount          = 1;
+		vkAllocateCommandBuffers(p_device->GetDevice(), &allocate_info, &cmd_buffer);
+	}
+
+	VkCommandBufferBeginInfo begin_info = {};
+	begin_info.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(cmd_buffer, &begin_info);
+
+	// Consecutive copies into the same buffer are merged into one command
+	std::vector<VkBufferCopy> regions;
+	for (size_t i = 0; i < m_copies.size(); i++)
+	{
+		const auto &copy = m_copies[i];
+
+		if (copy.barrier)
+		{
+			VkMemoryBarrier barrier = {};
+			barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+			vkCmdPipelineBarrier(cmd_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+		}
+
+		regions.push_back(copy.region);
+
+		if (i + 1 == m_copies.size() || m_copies[i + 1].buffer != copy.buffer || m_copies[i + 1].barrier)
+		{
+			vkCmdCopyBuffer(cmd_buffer, m_buffer->GetHandle(), copy.buffer, static_cast<uint32_t>(regions.size()), regions.data());
+			regions.clear();
+		}
+	}
+
+	vkEndCommandBuffer(cmd_buffer);
+
+	// Only the ring memory written since the last batch has to be made visible
+	for (auto &span : m_schedule.GetDirtySpans())
+	{
+		m_buffer->Flush(span.offset, span.size);
+	}
+
+	uint64_t signal_value = m_schedule.Submit();
+
+	VkTimelineSemaphoreSubmitInfo timeline_info = {};
+	timeline_info.sType                         = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+	timeline_info.signalSemaphoreValueCount     = 1;
+	timeline_info.pSignalSemaphoreValues        = &signal_value;
+
+	VkSubmitInfo submit_info         = {};
+	submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext                = &timeline_info;
+	submit_info.commandBufferCount   = 1;
+	submit_info.pCommandBuffers      = &cmd_buffer;
+	submit_info.signalSemaphoreCount = 1;
+	submit_info.pSignalSemaphores    = &m_semaphore;
+
+	vkQueueSubmit(m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+	m_batches.push_back(Batch{signal_value, cmd_buffer});
+
+	m_copies.clear();
+
+	m_statistics.batches++;
+}
+
+void StagingRing::Retire()
+{
+	if (m_batches.empty())
+	{
+		return;
+	}
+
+	uint64_t completed = 0;
+	vkGetSemaphoreCounterValue(p_device->GetDevice(), m_semaphore, &completed);
+
+	while (!m_batches.empty() && m_batches.front().value <= completed)
+	{
+		m_free_cmd_buffers.push_back(m_batches.front().cmd_buffer);
+		m_batches.pop_front();
+	}
+
+	m_schedule.Retire(completed);
+}
+}        // namespace Ilum::Vulkan
\ No newline at end of file
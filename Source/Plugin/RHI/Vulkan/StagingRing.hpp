@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Fwd.hpp"
+#include "StagingSchedule.hpp"
+
+#include <deque>
+#include <mutex>
+
+namespace Ilum::Vulkan
+{
+class Buffer;
+class Device;
+
+// Persistently mapped upload ring for device local buffers
+// Uploads are copied into the ring and recorded as pending copies, pending copies are submitted
+// to the transfer queue as one batch when the ring is flushed, once per frame.
+// Every batch signals a timeline semaphore value that later submissions wait on,
+// ring memory is released once the value of the batch that used it has been reached.
+// The ring owns the transfer queue, every submission to it goes through the ring's lock
+class StagingRing
+{
+  public:
+	static constexpr size_t RingSize     = 64 << 20;
+	static constexpr size_t MaxChunkSize = 16 << 20;
+	static constexpr size_t Alignment    = 16;
+
+  public:
+	StagingRing(Device *device);
+
+	~StagingRing();
+
+	void Upload(Buffer *buffer, const void *data, size_t size, size_t offset);
+
+	// Drop pending copies into a buffer that is being destroyed
+	void Discard(VkBuffer buffer);
+
+	// Submit pending copies, returns the timeline value to wait on before using uploaded data, 0 if nothing was uploaded yet
+	uint64_t Flush();
+
+	// Submit pending copies and block until all of them have completed
+	void Wait();
+
+	// Submit to a device queue, submissions to the transfer queue are serialized with the ring's own
+	void Submit(VkQueue queue, uint32_t submit_count, const VkSubmitInfo *submit_infos, VkFence fence);
+
+	// Submit a command buffer to the transfer queue after every staged upload, for readbacks of device local buffers
+	void Execute(VkCommandBuffer cmd_buffer, VkFence fence);
+
+	// Timeline value of the last flushed batch, 0 if nothing was uploaded yet
+	uint64_t GetValue() const;
+
+	VkSemaphore GetSemaphore() const;
+
+	UploadStatistics GetStatistics() const;
+
+  private:
+	struct Copy
+	{
+		VkBuffer     buffer;
+		VkBufferCopy region;
+		bool         barrier;        // Overlaps a copy of this batch or of a batch still in flight
+	};
+
+	struct Batch
+	{
+		uint64_t        value;
+		VkCommandBuffer cmd_buffer;
+	};
+
+	size_t Allocate(size_t size);
+
+	void SubmitCopies();
+
+	void Retire();
+
+  private:
+	Device *p_device = nullptr;
+
+	std::unique_ptr<Buffer> m_buffer = nullptr;
+	uint8_t                *m_mapped = nullptr;
+
+	VkQueue       m_queue     = VK_NULL_HANDLE;
+	VkCommandPool m_pool      = VK_NULL_HANDLE;
+	VkSemaphore   m_semaphore = VK_NULL_HANDLE;
+
+	StagingSchedule m_schedule;
+
+	std::vector<Copy> m_copies;
+
+	std::deque<Batch>            m_batches;
+	std::vector<VkCommandBuffer> m_free_cmd_buffers;
+
+	UploadStatistics m_statistics;
+
+	mutable std::mutex m_mutex;
+};
+}        // namespace Ilum::Vulkan
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace Ilum::Vulkan
+{
+// Bookkeeping of the staging ring: ring positions, ordering of copies into the same range and the span written since the last submission
+// Batches are identified by the timeline value they signal, kept free of any device object so it can be tested without a GPU
+class StagingSchedule
+{
+  public:
+	struct Span
+	{
+		size_t offset;
+		size_t size;
+	};
+
+  public:
+	StagingSchedule(size_t ring_size, size_t alignment) :
+	    m_ring_size(ring_size), m_alignment(alignment)
+	{
+	}
+
+	~StagingSchedule() = default;
+
+	// Reserve size bytes in the ring, false if they only fit once in flight batches retire
+	bool Allocate(size_t size, size_t &offset)
+	{
+		size = (size + m_alignment - 1) & ~(m_alignment - 1);
+
+		// Allocations never straddle the end of the ring
+		size_t position = static_cast<size_t>(m_head % m_ring_size);
+		size_t padding  = position + size > m_ring_size ? m_ring_size - position : 0;
+
+		if (m_head + padding + size - m_tail > m_ring_size)
+		{
+			return false;
+		}
+
+		m_head += padding;
+		offset = static_cast<size_t>(m_head % m_ring_size);
+		m_head += size;
+		return true;
+	}
+
+	// Record a copy of the batch being built into [offset, offset + size) of a buffer
+	// Returns true if it overlaps a copy of this batch or of a batch still in flight, so a transfer barrier has to order them
+	bool Write(uint64_t buffer, size_t offset, size_t size)
+	{
+		auto &ranges = m_ranges[buffer];
+
+		ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [this](const Range &range) { return range.value <= m_completed; }), ranges.end());
+
+		bool overlap = std::any_of(ranges.begin(), ranges.end(), [offset, size](const Range &range) {
+			return offset < range.offset + range.size && range.offset < offset + size;
+		});
+
+		ranges.push_back(Range{offset, size, m_value + 1});
+
+		return overlap;
+	}
+
+	// Forget a destroyed buffer, returns false if nothing was written to it
+	bool Discard(uint64_t buffer)
+	{
+		return m_ranges.erase(buffer) > 0;
+	}
+
+	// Release memory staged since the last submission, once all of its copies were discarded
+	void Rewind()
+	{
+		m_head = m_submitted;
+
+		for (auto &[buffer, ranges] : m_ranges)
+		{
+			ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [this](const Range &range) { return range.value > m_value; }), ranges.end());
+		}
+	}
+
+	// Ring memory written since the last submission, split in two when it wraps
+	std::vector<Span> GetDirtySpans() const
+	{
+		std::vector<Span> spans;
+
+		size_t offset = static_cast<size_t>(m_submitted % m_ring_size);
+		size_t size   = static_cast<size_t>(m_head - m_submitted);
+
+		if (size == 0)
+		{
+			return spans;
+		}
+
+		if (offset + size > m_ring_size)
+		{
+			spans.push_back(Span{offset, m_ring_size - offset});
+			spans.push_back(Span{0, offset + size - m_ring_size});
+		}
+		else
+		{
+			spans.push_back(Span{offset, size});
+		}
+
+		return spans;
+	}
+
+	// Close the batch being built, it signals the returned timeline value
+	uint64_t Submit()
+	{
+		m_batches.push_back(Batch{++m_value, m_head});
+		m_submitted = m_head;
+		return m_value;
+	}
+
+	// Release ring memory and ranges of every batch up to the completed timeline value
+	void Retire(uint64_t completed)
+	{
+		m_completed = std::max(m_completed, completed);
+
+		while (!m_batches.empty() && m_batches.front().value <= m_completed)
+		{
+			m_tail = m_batches.front().end;
+			m_batches.pop_front();
+		}
+	}
+
+	// Timeline value of the last submitted batch, 0 before the first one
+	uint64_t GetValue() const
+	{
+		return m_value;
+	}
+
+	// Timeline value to wait for to release ring memory, 0 if no batch is in flight
+	uint64_t GetOldestValue() const
+	{
+		return m_batches.empty() ? 0 : m_batches.front().value;
+	}
+
+	size_t GetUsedSize() const
+	{
+		return static_cast<size_t>(m_head - m_tail);
+	}
+
+  private:
+	struct Range
+	{
+		size_t   offset;
+		size_t   size;
+		uint64_t value;        // Batch that writes the range
+	};
+
+	struct Batch
+	{
+		uint64_t value;
+		uint64_t end;
+	};
+
+  private:
+	size_t m_ring_size = 0;
+	size_t m_alignment = 0;
+
+	// Ring positions grow monotonically, [m_tail, m_head) is in use and [m_submitted, m_head) is not submitted yet
+	uint64_t m_head      = 0;
+	uint64_t m_tail      = 0;
+	uint64_t m_submitted = 0;
+
+	uint64_t m_value     = 0;
+	uint64_t m_completed = 0;
+
+	std::unordered_map<uint64_t, std::vector<Range>> m_ranges;
+	std::deque<Batch>                                m_batches;
+};
+}        // namespace Ilum::Vulkan
\ No newline at end of file
@@ -52,6 +52,12 @@ TextureState TextureState::Create(RHIResourceState state)
 			vk_state.access_mask = VK_ACCESS_MEMORY_READ_BIT;
 			vk_state.stage       = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 			break;
+		case RHIResourceState::Undefined:
+			// Contents are discarded, but the memory may have been written through an aliased texture
+			vk_state.layout      = VK_IMAGE_LAYOUT_UNDEFINED;
+			vk_state.access_mask = VK_ACCESS_MEMORY_WRITE_BIT;
+			vk_state.stage       = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			break;
 		default:
 			vk_state.layout      = VK_IMAGE_LAYOUT_UNDEFINED;
 			vk_state.access_mask = VK_ACCESS_NONE_KHR;
@@ -61,8 +67,7 @@ TextureState TextureState::Create(RHIResourceState state)
 	return vk_state;
 }
 
-Texture::Texture(RHIDevice *device, const TextureDesc &desc) :
-    RHITexture(device, desc)
+static VkImageCreateInfo CreateImageInfo(const TextureDesc &desc)
 {
 	VkImageCreateInfo create_info = {};
 	create_info.sType             = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -91,6 +96,14 @@ Texture::Texture(RHIDevice *device, const TextureDesc &desc) :
 		create_info.flags = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
 	}
 
+	return create_info;
+}
+
+Texture::Texture(RHIDevice *device, const TextureDesc &desc) :
+    RHITexture(device, desc)
+{
+	VkImageCreateInfo create_info = CreateImageInfo(desc);
+
 	// External memory use vkallocate method
 #ifdef CUDA_ENABLE
 	VkExternalMemoryImageCreateInfo external_create_info = {};
@@ -191,46 +204,48 @@ Texture::Texture(RHIDevice *device, const TextureDesc &desc, VkImage image, bool
 	}
 }
 
-std::unique_ptr<RHITexture> Texture::Alias(const TextureDesc &desc)
+Texture::Texture(RHIDevice *device, size_t size, const std::vector<TextureDesc> &descs) :
+    RHITexture(device, TextureDesc{"Texture Heap"})
 {
-	if (!m_allocation)
+	m_memory_size = size;
+
+	// External memory textures can not be placed, aliases fall back to their own allocation
+#ifndef CUDA_ENABLE
+	VkMemoryRequirements memory_req = {};
+	memory_req.size                 = size;
+	memory_req.alignment            = 1;
+	memory_req.memoryTypeBits       = ~0u;
+
+	for (auto &desc : descs)
 	{
-		return std::make_unique<Texture>(p_device, desc);
+		VkMemoryRequirements desc_memory_req = GetMemoryRequirements(p_device, desc);
+		memory_req.alignment                 = std::max(memory_req.alignment, desc_memory_req.alignment);
+		memory_req.memoryTypeBits &= desc_memory_req.memoryTypeBits;
 	}
 
-	VkImageCreateInfo create_info = {};
-	create_info.sType             = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-	create_info.imageType         = VK_IMAGE_TYPE_2D;
-	create_info.format            = ToVulkanFormat[desc.format];
-	create_info.extent            = VkExtent3D{desc.width, desc.height, desc.depth};
-	create_info.samples           = ToVulkanSampleCountFlag[desc.samples];
-	create_info.mipLevels         = desc.mips;
-	create_info.arrayLayers       = desc.layers;
-	create_info.tiling            = VK_IMAGE_TILING_OPTIMAL;
-	create_info.usage             = ToVulkanImageUsage(desc.usage);
-	create_info.sharingMode       = VK_SHARING_MODE_EXCLUSIVE;
-	create_info.initialLayout     = VK_IMAGE_LAYOUT_UNDEFINED;
-	create_info.flags             = VK_IMAGE_CREATE_ALIAS_BIT;
+	VmaAllocationCreateInfo allocation_create_info = {};
+	allocation_create_info.usage                   = VMA_MEMORY_USAGE_GPU_ONLY;
 
-	// Render Target Setting
-	if (desc.usage & RHITextureUsage::RenderTarget)
+	if (memory_req.memoryTypeBits == 0 ||
+	    vmaAllocateMemory(static_cast<Device *>(p_device)->GetAllocator(), &memory_req, &allocation_create_info, &m_allocation, nullptr) != VK_SUCCESS)
 	{
-		create_info.usage |= IsDepthFormat(desc.format) ?
-		                         VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT :
-                                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+		m_allocation = VK_NULL_HANDLE;
 	}
+#endif        // CUDA_ENABLE
+}
 
-	// Cubemap Setting
-	if (desc.layers % 6 == 0 && desc.width == desc.height && desc.depth == 1)
+std::unique_ptr<RHITexture> Texture::Alias(const TextureDesc &desc, size_t offset)
+{
+	if (!m_allocation)
 	{
-		create_info.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+		return std::make_unique<Texture>(p_device, desc);
 	}
 
-	VkImage image = VK_NULL_HANDLE;
-	vmaCreateAliasingImage(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, &create_info, &image);
-	return std::make_unique<Texture>(p_device, desc, image, false);
+	VkImageCreateInfo create_info = CreateImageInfo(desc);
+	create_info.flags |= VK_IMAGE_CREATE_ALIAS_BIT;
 
-	/*vkCreateImage(static_cast<Device *>(p_device)->GetDevice(), &create_info, nullptr, &image);
+	VkImage image = VK_NULL_HANDLE;
+	vkCreateImage(static_cast<Device *>(p_device)->GetDevice(), &create_info, nullptr, &image);
 
 	VkMemoryRequirements memory_req = {};
 	vkGetImageMemoryRequirements(static_cast<Device *>(p_device)->GetDevice(), image, &memory_req);
@@ -238,16 +253,19 @@ std::unique_ptr<RHITexture> Texture::Alias(const TextureDesc &desc)
 	VmaAllocationInfo info = {};
 	vmaGetAllocationInfo(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, &info);
 
-	if (info.size >= memory_req.size)
-	{
-		vmaBindImageMemory(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, image);
-		return std::make_unique<Texture>(p_device, desc, image, false);
-	}
-	else
+	// Placement must respect the image's size, alignment and memory type, otherwise use a dedicated allocation
+	if (offset + memory_req.size > info.size ||
+	    (info.offset + offset) % memory_req.alignment != 0 ||
+	    !(memory_req.memoryTypeBits & (1u << info.memoryType)) ||
+	    vmaBindImageMemory2(static_cast<Device *>(p_device)->GetAllocator(), m_allocation, offset, image, nullptr) != VK_SUCCESS)
 	{
 		vkDestroyImage(static_cast<Device *>(p_device)->GetDevice(), image, nullptr);
 		return std::make_unique<Texture>(p_device, desc);
-	}*/
+	}
+
+	auto texture           = std::make_unique<Texture>(p_device, desc, image, false);
+	texture->m_memory_size = memory_req.size;
+	return texture;
 }
 
 Texture::~Texture()
@@ -294,6 +312,22 @@ size_t Texture::GetMemorySize() const
 	return m_memory_size;
 }
 
+VkMemoryRequirements Texture::GetMemoryRequirements(RHIDevice *device, const TextureDesc &desc)
+{
+	VkImageCreateInfo create_info = CreateImageInfo(desc);
+	create_info.flags |= VK_IMAGE_CREATE_ALIAS_BIT;
+
+	VkImage image = VK_NULL_HANDLE;
+	vkCreateImage(static_cast<Device *>(device)->GetDevice(), &create_info, nullptr, &image);
+
+	VkMemoryRequirements memory_req = {};
+	vkGetImageMemoryRequirements(static_cast<Device *>(device)->GetDevice(), image, &memory_req);
+
+	vkDestroyImage(static_cast<Device *>(device)->GetDevice(), image, nullptr);
+
+	return memory_req;
+}
+
 VkImageView Texture::GetView(const TextureRange &range) const
 {
 	size_t hash = range.Hash();
@@ -27,7 +27,10 @@ class Texture : public RHITexture
 
 	Texture(RHIDevice *device, const TextureDesc &desc, VkImage image, bool is_swapchain_buffer = true);
 
-	virtual std::unique_ptr<RHITexture> Alias(const TextureDesc &desc) override;
+	// Memory only, used as a heap for aliasing textures
+	Texture(RHIDevice *device, size_t size, const std::vector<TextureDesc> &descs);
+
+	virtual std::unique_ptr<RHITexture> Alias(const TextureDesc &desc, size_t offset = 0) override;
 
 	virtual ~Texture() override;
 
@@ -39,6 +42,8 @@ class Texture : public RHITexture
 
 	VkImageView GetView(const TextureRange &range) const;
 
+	static VkMemoryRequirements GetMemoryRequirements(RHIDevice *device, const TextureDesc &desc);
+
   private:
 	VkImage        m_handle     = VK_NULL_HANDLE;
 	VmaAllocation  m_allocation = VK_NULL_HANDLE;
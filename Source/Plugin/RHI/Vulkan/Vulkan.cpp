@@ -53,6 +53,16 @@ extern "C"
 		return new Texture(device, desc);
 	}
 
+	EXPORT_API RHITexture *CreateTextureHeap(Device *device, size_t size, const std::vector<TextureDesc> &descs)
+	{
+		return new Texture(device, size, descs);
+	}
+
+	EXPORT_API size_t GetTextureMemorySize(Device *device, const TextureDesc &desc)
+	{
+		return Texture::GetMemoryRequirements(device, desc).size;
+	}
+
 	EXPORT_API RHISampler *CreateSampler(Device *device, const SamplerDesc &desc)
 	{
 		return new Sampler(device, desc);
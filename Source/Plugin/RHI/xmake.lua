@@ -26,6 +26,23 @@ target("RHI.Vulkan")
     set_group("Plugin/RHI")
 target_end()
 
+target("RHI.Null")
+    set_kind("shared")
+
+    add_rules("plugin")
+
+    add_files("Null/**.cpp")
+    add_headerfiles("Null/**.hpp")
+
+    add_deps("Core", "RHI")
+
+    target("Plugin")
+        add_deps("RHI.Null")
+    target_end()
+
+    set_group("Plugin/RHI")
+target_end()
+
 if has_config("CUDA_ENABLE") and is_plat("windows")  then
     target("RHI.CUDA")
         set_kind("shared")
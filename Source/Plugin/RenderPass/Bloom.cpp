@@ -39,7 +39,8 @@ class Bloom : public RenderPass<Bloom>
 		    .SetCategory("PostProcess")
 		    .SetConfig(Config())
 		    .ReadTexture2D(handle++, "Input", RHIResourceState::ShaderResource)
-		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Output");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -247,6 +248,15 @@ class Bloom : public RenderPass<Bloom>
 
 		return pipeline_desc;
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/Bloom.hlsl", "BloomMask", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/Bloom.hlsl", "BloomDownSampling", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/Bloom.hlsl", "BloomBlur", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/Bloom.hlsl", "BloomUpSampling", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/Bloom.hlsl", "BloomBlend", RHIShaderStage::Compute}});
+	}
 };
 
 CONFIGURATION_PASS(Bloom)
\ No newline at end of file
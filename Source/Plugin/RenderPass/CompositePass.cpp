@@ -21,7 +21,8 @@ class CompositePass : public RenderPass<CompositePass>
 		    .ReadTexture2D(handle++, "Light DI", RHIResourceState::ShaderResource)
 		    .ReadTexture2D(handle++, "Environment", RHIResourceState::ShaderResource)
 		    .ReadTexture2D(handle++, "AO", RHIResourceState::ShaderResource)
-		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Output");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -86,6 +87,11 @@ class CompositePass : public RenderPass<CompositePass>
 	virtual void OnImGui(Variant *config)
 	{
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shading/Composite.hlsl", "CSmain", RHIShaderStage::Compute}, {{"HAS_LIGHT_DIRECT_ILLUMINATION", "NO_LIGHT_DIRECT_ILLUMINATION"}, {"HAS_ENV_DIRECT_ILLUMINATION", "NO_ENV_DIRECT_ILLUMINATION"}, {"HAS_AMBIENT_OCCLUSION", "NO_AMBIENT_OCCLUSION"}, {"HAS_ENVIRONMENT", "NO_ENVIRONMENT"}}});
+	}
 };
 
 CONFIGURATION_PASS(CompositePass)
\ No newline at end of file
@@ -34,7 +34,8 @@ class FXAA : public RenderPass<FXAA>
 		    .SetCategory("PostProcess")
 		    .SetConfig(Config())
 		    .ReadTexture2D(handle++, "Input", RHIResourceState::ShaderResource)
-		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Output");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -85,6 +86,11 @@ class FXAA : public RenderPass<FXAA>
 		ImGui::SliderFloat("Relative Threshold", &config_data->relative_threshold, 0.063f, 0.333f, "%.4f");
 		ImGui::SliderFloat("Subpixel Blending", &config_data->subpixel_blending, 0.f, 1.f, "%.2f");
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/FXAA.hlsl", "CSmain", RHIShaderStage::Compute}, {{"FXAA_QUALITY_LOW", "FXAA_QUALITY_MEDIUM", "FXAA_QUALITY_HIGH"}}});
+	}
 };
 
 CONFIGURATION_PASS(FXAA)
\ No newline at end of file
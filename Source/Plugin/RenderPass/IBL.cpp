@@ -189,6 +189,13 @@ class IBL : public RenderPass<IBL>
 	virtual void OnImGui(Variant *config)
 	{
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shading/IBL.hlsl", "CubemapSHProjection", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shading/IBL.hlsl", "CubemapSHAdd", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shading/IBL.hlsl", "CubmapPrefilter", RHIShaderStage::Compute}});
+	}
 };
 
 CONFIGURATION_PASS(IBL)
\ No newline at end of file
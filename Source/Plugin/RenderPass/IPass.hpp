@@ -6,6 +6,7 @@
 #include <RenderGraph/RenderGraphBuilder.hpp>
 #include <Renderer/RenderData.hpp>
 #include <Renderer/Renderer.hpp>
+#include <ShaderCompiler/ShaderBuilder.hpp>
 
 #include <imgui.h>
 
@@ -46,6 +47,11 @@ class RenderPass
 	virtual void OnImGui(Variant *config)
 	{
 	}
+
+	// Shaders CreateCallback may require, the shader precompiler builds all of their permutations
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+	}
 };
 
 #define CONFIGURATION_PASS(Pass)                                                                                                                   \
@@ -64,4 +70,8 @@ class RenderPass
 			ImGui::SetCurrentContext(context);                                                                                                     \
 			Pass::GetInstance().OnImGui(config);                                                                                                   \
 		}                                                                                                                                          \
+		EXPORT_API void RegisterShaders(std::vector<ShaderVariants> *variants)                                                                     \
+		{                                                                                                                                          \
+			Pass::GetInstance().RegisterShaders(*variants);                                                                                        \
+		}                                                                                                                                          \
 	}
\ No newline at end of file
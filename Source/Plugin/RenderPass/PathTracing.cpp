@@ -163,6 +163,14 @@ class PathTracing : public RenderPass<PathTracing>
 			config_data->frame_count = 0;
 		}
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RayTracing/PathTracing.hlsl", "RayGenMain", RHIShaderStage::RayGen, {"RAYGEN_SHADER", "RAYTRACING_PIPELINE"}}, {{"USE_SKYBOX", "NO_SKYBOX"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RayTracing/PathTracing.hlsl", "ClosesthitMain", RHIShaderStage::ClosestHit, {"CLOSESTHIT_SHADER", "RAYTRACING_PIPELINE"}, {"Material/Material.hlsli"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RayTracing/PathTracing.hlsl", "ClosesthitMain", RHIShaderStage::ClosestHit, {"CLOSESTHIT_SHADER", "RAYTRACING_PIPELINE"}}, {}, true});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RayTracing/PathTracing.hlsl", "MissMain", RHIShaderStage::Miss, {"MISS_SHADER", "RAYTRACING_PIPELINE"}}});
+	}
 };
 
 CONFIGURATION_PASS(PathTracing)
\ No newline at end of file
@@ -22,7 +22,8 @@ class SSAO : public RenderPass<SSAO>
 		    .SetCategory("AO")
 		    .ReadTexture2D(handle++, "PositionDepth", RHIResourceState::ShaderResource)
 		    .ReadTexture2D(handle++, "Normal", RHIResourceState::ShaderResource)
-		    .WriteTexture2D(handle++, "Output", RHIFormat::R32_FLOAT, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Output", RHIFormat::R32_FLOAT, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Output");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -148,6 +149,12 @@ class SSAO : public RenderPass<SSAO>
 	virtual void OnImGui(Variant *config)
 	{
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/AmbientOcclusion/SSAO.hlsl", "SSAO", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/AmbientOcclusion/SSAO.hlsl", "SSAOBlur", RHIShaderStage::Compute}});
+	}
 };
 
 CONFIGURATION_PASS(SSAO)
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "IPass.hpp"
 #include "PassData.hpp"
 
+#include <Geometry/Frustum.hpp>
+#include <Renderer/ShadowCache.hpp>
+#include <Renderer/ShadowCulling.hpp>
 #include <Resource/Resource/Mesh.hpp>
 #include <Resource/Resource/SkinnedMesh.hpp>
 #include <Resource/ResourceManager.hpp>
@@ -44,6 +47,63 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 
 		float bias  = 16.f;
 		float slope = 4.5f;
+
+		// Layers of the last frame whose static casters were redrawn, that only redrew their dynamic casters over the static cache, and that were reused as is
+		uint32_t rebuilt_layers    = 0;
+		uint32_t composited_layers = 0;
+		uint32_t cached_layers     = 0;
+
+		// Task groups launched from the culled work lists, against the dense meshlet x instance x layer grid
+		uint32_t task_groups       = 0;
+		uint32_t dense_task_groups = 0;
+	};
+
+	// Views and culled work lists of one draw into a shadow map array
+	struct ShadowDraw
+	{
+		std::vector<ShadowView>    views;
+		std::vector<ShadowTask>    mesh_tasks;
+		std::vector<ShadowTask>    skinned_mesh_tasks;
+		std::unique_ptr<RHIBuffer> view_buffer              = nullptr;
+		std::unique_ptr<RHIBuffer> mesh_task_buffer         = nullptr;
+		std::unique_ptr<RHIBuffer> skinned_mesh_task_buffer = nullptr;
+
+		// Mesh draw followed by skinned mesh draw
+		std::unique_ptr<RHIBuffer> indirect_buffer = nullptr;
+	};
+
+	// Static casters are drawn into static_texture when their layer is rebuilt, composited layers copy it back and draw the dynamic casters on top
+	struct LayerCache
+	{
+		RHITexture                 *texture        = nullptr;
+		std::unique_ptr<RHITexture> static_texture = nullptr;
+
+		ShadowLayerCache       layers;
+		ShadowLayerCache::Plan plan;
+
+		// Shadow map layers copied from static_texture this frame
+		std::vector<uint32_t> composite_layers;
+
+		ShadowDraw static_draw;
+		ShadowDraw dynamic_draw;
+	};
+
+	struct ShadowLayer
+	{
+		uint32_t draw_index;
+		uint32_t layer;
+		size_t   signature;        // Light transform and depth bias, the casters are hashed by ShadowLayerCache
+		Frustum  frustum;
+	};
+
+	struct ShadowCache
+	{
+		ShadowCasterHistory mesh_casters;
+		ShadowCasterHistory skinned_mesh_casters;
+
+		LayerCache spot;
+		LayerCache cascade;
+		LayerCache omni;
 	};
 
   public:
@@ -76,6 +136,13 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 		std::shared_ptr<RHIRenderTarget> cascade_shadowmap_render_target = std::shared_ptr<RHIRenderTarget>(std::move(renderer->GetRHIContext()->CreateRenderTarget()));
 		std::shared_ptr<RHIRenderTarget> omni_shadowmap_render_target    = std::shared_ptr<RHIRenderTarget>(std::move(renderer->GetRHIContext()->CreateRenderTarget()));
 
+		// Static casters are drawn into the caches through their own render targets
+		std::shared_ptr<RHIRenderTarget> static_shadowmap_render_target         = std::shared_ptr<RHIRenderTarget>(std::move(renderer->GetRHIContext()->CreateRenderTarget()));
+		std::shared_ptr<RHIRenderTarget> static_cascade_shadowmap_render_target = std::shared_ptr<RHIRenderTarget>(std::move(renderer->GetRHIContext()->CreateRenderTarget()));
+		std::shared_ptr<RHIRenderTarget> static_omni_shadowmap_render_target    = std::shared_ptr<RHIRenderTarget>(std::move(renderer->GetRHIContext()->CreateRenderTarget()));
+
+		std::shared_ptr<ShadowCache> shadow_cache = std::make_shared<ShadowCache>();
+
 		*task = [=](RenderGraph &render_graph, RHICommand *cmd_buffer, Variant &config, RenderGraphBlackboard &black_board) {
 			auto   *rhi_context = renderer->GetRHIContext();
 			auto   *scene       = renderer->GetScene();
@@ -106,11 +173,22 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				}
 			}
 
+			config_data->rebuilt_layers    = 0;
+			config_data->composited_layers = 0;
+			config_data->cached_layers     = 0;
+			config_data->task_groups       = 0;
+			config_data->dense_task_groups = 0;
+
+			float animation_time = renderer->GetAnimationTime();
+
+			shadow_cache->mesh_casters.Update(gpu_scene->opaque_mesh.bounds);
+			shadow_cache->skinned_mesh_casters.Update(gpu_scene->opaque_skinned_mesh.bounds);
+
 			// Render shadow map for spot light
 			{
 				auto     spot_lights = scene->GetComponents<Cmpt::SpotLight>();
 				uint32_t layers      = 0;
-				for (auto &light : spot_lights)
+				for (auto *light : spot_lights)
 				{
 					layers += static_cast<uint32_t>(light->CastShadow());
 				}
@@ -120,7 +198,7 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				    shadow_map->GetDesc().width != size ||
 				    shadow_map->GetDesc().layers < spot_lights.size())
 				{
-					shadow_map_cache->shadow_map = render_graph.SetTexture(desc.GetPin("ShadowMap").handle, std::move(rhi_context->CreateTexture2DArray(size, size, layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource, false)));
+					shadow_map_cache->shadow_map = render_graph.SetTexture(desc.GetPin("ShadowMap").handle, std::move(rhi_context->CreateTexture2DArray(size, size, layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource | RHITextureUsage::Transfer, false)));
 					shadow_map                   = render_graph.GetTexture(desc.GetPin("ShadowMap").handle);
 
 					cmd_buffer->ResourceStateTransition({TextureStateTransition{
@@ -131,7 +209,28 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 					                                    {});
 				}
 
-				RenderShadowMap(cmd_buffer, mesh_shadow_pipeline, skinned_mesh_shadow_pipeline, renderer, scene, gpu_scene, config_data, shadow_map, shadowmap_render_target.get());
+				std::vector<ShadowLayer> shadow_layers;
+				for (uint32_t i = 0; i < spot_lights.size(); i++)
+				{
+					auto *light = spot_lights[i];
+					if (light->GetShadowID() == ~0u)
+					{
+						continue;
+					}
+
+					Frustum frustum = Frustum(light->GetViewProjection());
+
+					size_t signature = Hash(i, config_data->bias, config_data->slope);
+					HashMatrix(signature, light->GetViewProjection());
+
+					shadow_layers.push_back(ShadowLayer{i, light->GetShadowID(), signature, frustum});
+				}
+
+				UpdateLayerCache(cmd_buffer, rhi_context, gpu_scene, config_data, shadow_map, *shadow_cache, shadow_cache->spot, shadow_layers, animation_time);
+
+				RenderShadowMap(cmd_buffer, mesh_shadow_pipeline, skinned_mesh_shadow_pipeline, renderer, scene, gpu_scene, config_data, shadow_cache->spot.static_texture.get(), static_shadowmap_render_target.get(), shadow_cache->spot.static_draw);
+				CompositeLayers(cmd_buffer, shadow_map, shadow_cache->spot);
+				RenderShadowMap(cmd_buffer, mesh_shadow_pipeline, skinned_mesh_shadow_pipeline, renderer, scene, gpu_scene, config_data, shadow_map, shadowmap_render_target.get(), shadow_cache->spot.dynamic_draw);
 			}
 
 			// Render cascade shadow map for directional light
@@ -144,7 +243,7 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				    cascade_shadow_map->GetDesc().width != size ||
 				    cascade_shadow_map->GetDesc().layers < directional_lights.size() * 4)
 				{
-					shadow_map_cache->cascade_shadow_map = render_graph.SetTexture(desc.GetPin("CascadeShadowMap").handle, std::move(rhi_context->CreateTexture2DArray(size, size, layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource, false)));
+					shadow_map_cache->cascade_shadow_map = render_graph.SetTexture(desc.GetPin("CascadeShadowMap").handle, std::move(rhi_context->CreateTexture2DArray(size, size, layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource | RHITextureUsage::Transfer, false)));
 					cascade_shadow_map                   = render_graph.GetTexture(desc.GetPin("CascadeShadowMap").handle);
 					cmd_buffer->ResourceStateTransition({TextureStateTransition{
 					                                        cascade_shadow_map,
@@ -154,7 +253,31 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 					                                    {});
 				}
 
-				RenderCascadeShadowMap(cmd_buffer, mesh_cascade_shadow_pipeline, skinned_mesh_cascade_shadow_pipeline, renderer, scene, gpu_scene, config_data, cascade_shadow_map, cascade_shadowmap_render_target.get());
+				std::vector<ShadowLayer> shadow_layers;
+				for (uint32_t i = 0; i < directional_lights.size(); i++)
+				{
+					auto *light = directional_lights[i];
+					if (light->GetShadowID() == ~0u)
+					{
+						continue;
+					}
+
+					for (uint32_t cascade = 0; cascade < 4; cascade++)
+					{
+						Frustum frustum = Frustum(light->GetViewProjection(cascade));
+
+						size_t signature = Hash(i, cascade, config_data->bias, config_data->slope);
+						HashMatrix(signature, light->GetViewProjection(cascade));
+
+						shadow_layers.push_back(ShadowLayer{i * 4 + cascade, light->GetShadowID() * 4 + cascade, signature, frustum});
+					}
+				}
+
+				UpdateLayerCache(cmd_buffer, rhi_context, gpu_scene, config_data, cascade_shadow_map, *shadow_cache, shadow_cache->cascade, shadow_layers, animation_time);
+
+				RenderCascadeShadowMap(cmd_buffer, mesh_cascade_shadow_pipeline, skinned_mesh_cascade_shadow_pipeline, renderer, scene, gpu_scene, config_data, shadow_cache->cascade.static_texture.get(), static_cascade_shadowmap_render_target.get(), shadow_cache->cascade.static_draw);
+				CompositeLayers(cmd_buffer, cascade_shadow_map, shadow_cache->cascade);
+				RenderCascadeShadowMap(cmd_buffer, mesh_cascade_shadow_pipeline, skinned_mesh_cascade_shadow_pipeline, renderer, scene, gpu_scene, config_data, cascade_shadow_map, cascade_shadowmap_render_target.get(), shadow_cache->cascade.dynamic_draw);
 			}
 
 			// Render omnidirection shadow map for point light
@@ -167,7 +290,7 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				    omni_shadow_map->GetDesc().width != size ||
 				    omni_shadow_map->GetDesc().layers < point_lights.size() * 6)
 				{
-					shadow_map_cache->omni_shadow_map = render_graph.SetTexture(desc.GetPin("OmniShadowMap").handle, std::move(rhi_context->CreateTexture2DArray(size, size, layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource, false)));
+					shadow_map_cache->omni_shadow_map = render_graph.SetTexture(desc.GetPin("OmniShadowMap").handle, std::move(rhi_context->CreateTexture2DArray(size, size, layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource | RHITextureUsage::Transfer, false)));
 					omni_shadow_map                   = render_graph.GetTexture(desc.GetPin("OmniShadowMap").handle);
 					cmd_buffer->ResourceStateTransition({TextureStateTransition{
 					                                        omni_shadow_map,
@@ -176,11 +299,190 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 					                                        TextureRange{RHITextureDimension::Texture2DArray, 0, 1, 0, layers}}},
 					                                    {});
 				}
-				RenderOmniShadowMap(cmd_buffer, mesh_omni_shadow_pipeline, skinned_mesh_omni_shadow_pipeline, renderer, scene, gpu_scene, config_data, omni_shadow_map, omni_shadowmap_render_target.get());
+
+				std::vector<ShadowLayer> shadow_layers;
+				for (uint32_t i = 0; i < point_lights.size(); i++)
+				{
+					auto *light = point_lights[i];
+					if (light->GetShadowID() == ~0u)
+					{
+						continue;
+					}
+
+					for (uint32_t face = 0; face < 6; face++)
+					{
+						Frustum frustum = CubeFaceFrustum(light->GetPosition(), face);
+
+						size_t signature = Hash(i, face, config_data->bias, config_data->slope);
+						HashCombine(signature, light->GetPosition().x, light->GetPosition().y, light->GetPosition().z);
+
+						shadow_layers.push_back(ShadowLayer{i * 6 + face, light->GetShadowID() * 6 + face, signature, frustum});
+					}
+				}
+
+				UpdateLayerCache(cmd_buffer, rhi_context, gpu_scene, config_data, omni_shadow_map, *shadow_cache, shadow_cache->omni, shadow_layers, animation_time);
+
+				RenderOmniShadowMap(cmd_buffer, mesh_omni_shadow_pipeline, skinned_mesh_omni_shadow_pipeline, renderer, scene, gpu_scene, config_data, shadow_cache->omni.static_texture.get(), static_omni_shadowmap_render_target.get(), shadow_cache->omni.static_draw);
+				CompositeLayers(cmd_buffer, omni_shadow_map, shadow_cache->omni);
+				RenderOmniShadowMap(cmd_buffer, mesh_omni_shadow_pipeline, skinned_mesh_omni_shadow_pipeline, renderer, scene, gpu_scene, config_data, omni_shadow_map, omni_shadowmap_render_target.get(), shadow_cache->omni.dynamic_draw);
 			}
 		};
 	}
 
+	static void HashMatrix(size_t &seed, const glm::mat4 &matrix)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			HashCombine(seed, matrix[i].x, matrix[i].y, matrix[i].z, matrix[i].w);
+		}
+	}
+
+	template <typename T>
+	static void UploadBuffer(RHIContext *rhi_context, std::unique_ptr<RHIBuffer> &buffer, const std::vector<T> &data)
+	{
+		if (data.empty())
+		{
+			return;
+		}
+
+		if (!buffer || buffer->GetDesc().count < data.size())
+		{
+			buffer = rhi_context->CreateBuffer<T>(data.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+		}
+		buffer->CopyToDevice(data.data(), data.size() * sizeof(T));
+	}
+
+	// Clears contiguous runs of layers at once
+	static void ClearLayers(RHICommand *cmd_buffer, RHITexture *texture, std::vector<uint32_t> layers)
+	{
+		std::sort(layers.begin(), layers.end());
+		for (size_t i = 0; i < layers.size();)
+		{
+			size_t j = i + 1;
+			while (j < layers.size() && layers[j] == layers[j - 1] + 1)
+			{
+				j++;
+			}
+			cmd_buffer->FillTexture(texture, RHIResourceState::DepthWrite, TextureRange{RHITextureDimension::Texture2DArray, 0, 1, layers[i], static_cast<uint32_t>(j - i)}, 1.f);
+			i = j;
+		}
+	}
+
+	// Culls the static or dynamic casters against the given layers and uploads the work lists
+	static void BuildShadowDraw(RHIContext *rhi_context, GPUScene *gpu_scene, Config *config, const ShadowCache &shadow_cache, const std::vector<ShadowLayer> &layers, const std::vector<uint32_t> &indices, uint8_t dynamic, ShadowDraw &draw)
+	{
+		draw.views.clear();
+		draw.mesh_tasks.clear();
+		draw.skinned_mesh_tasks.clear();
+
+		for (auto index : indices)
+		{
+			draw.views.push_back(ShadowView{layers[index].frustum.planes, layers[index].draw_index});
+		}
+
+		uint32_t view_count = static_cast<uint32_t>(draw.views.size());
+		if (view_count == 0)
+		{
+			return;
+		}
+
+		CullShadowTasks(draw.views, gpu_scene->opaque_mesh.bounds, &shadow_cache.mesh_casters.GetDynamic(), dynamic, draw.mesh_tasks);
+		CullShadowTasks(draw.views, gpu_scene->opaque_skinned_mesh.bounds, &shadow_cache.skinned_mesh_casters.GetDynamic(), dynamic, draw.skinned_mesh_tasks);
+
+		config->task_groups += static_cast<uint32_t>(draw.mesh_tasks.size() + draw.skinned_mesh_tasks.size());
+		config->dense_task_groups += (gpu_scene->opaque_mesh.max_meshlet_count + ShadowTaskSize - 1) / ShadowTaskSize * gpu_scene->opaque_mesh.instance_count * view_count;
+		config->dense_task_groups += (gpu_scene->opaque_skinned_mesh.max_meshlet_count + ShadowTaskSize - 1) / ShadowTaskSize * gpu_scene->opaque_skinned_mesh.instance_count * view_count;
+
+		UploadBuffer(rhi_context, draw.view_buffer, draw.views);
+		UploadBuffer(rhi_context, draw.mesh_task_buffer, draw.mesh_tasks);
+		UploadBuffer(rhi_context, draw.skinned_mesh_task_buffer, draw.skinned_mesh_tasks);
+
+		if (!draw.indirect_buffer)
+		{
+			draw.indirect_buffer = rhi_context->CreateBuffer<RHIDrawMeshTasksIndirectCommand>(2, RHIBufferUsage::Indirect, RHIMemoryUsage::CPU_TO_GPU);
+		}
+
+		RHIDrawMeshTasksIndirectCommand commands[2] = {
+		    {static_cast<uint32_t>(draw.mesh_tasks.size()), 1, 1},
+		    {static_cast<uint32_t>(draw.skinned_mesh_tasks.size()), 1, 1},
+		};
+		draw.indirect_buffer->CopyToDevice(commands, sizeof(commands));
+	}
+
+	// Decides which layers are rebuilt, composited or kept, clears the rebuilt ones in the static cache and builds both draws
+	void UpdateLayerCache(RHICommand *cmd_buffer, RHIContext *rhi_context, GPUScene *gpu_scene, Config *config, RHITexture *texture, const ShadowCache &shadow_cache, LayerCache &cache, const std::vector<ShadowLayer> &layers, float animation_time)
+	{
+		// A new texture has undefined contents, and so has its cache
+		if (cache.texture != texture)
+		{
+			const auto &desc = texture->GetDesc();
+
+			cache.texture        = texture;
+			cache.static_texture = rhi_context->CreateTexture2DArray(desc.width, desc.height, desc.layers, RHIFormat::D32_FLOAT, RHITextureUsage::RenderTarget | RHITextureUsage::Transfer, false);
+			cache.layers.Reset(desc.layers);
+
+			cmd_buffer->ResourceStateTransition({TextureStateTransition{
+			                                        cache.static_texture.get(),
+			                                        RHIResourceState::Undefined,
+			                                        RHIResourceState::DepthWrite,
+			                                        TextureRange{RHITextureDimension::Texture2DArray, 0, 1, 0, desc.layers}}},
+			                                    {});
+		}
+
+		std::vector<ShadowLayerCache::Layer> cache_layers;
+		cache_layers.reserve(layers.size());
+		for (auto &layer : layers)
+		{
+			cache_layers.push_back(ShadowLayerCache::Layer{layer.layer, layer.signature, layer.frustum});
+		}
+
+		cache.layers.Update(
+		    cache_layers,
+		    {ShadowLayerCache::Casters{&gpu_scene->opaque_mesh.bounds, &shadow_cache.mesh_casters.GetDynamic()},
+		     ShadowLayerCache::Casters{&gpu_scene->opaque_skinned_mesh.bounds, &shadow_cache.skinned_mesh_casters.GetDynamic()}},
+		    animation_time,
+		    cache.plan);
+
+		config->rebuilt_layers += static_cast<uint32_t>(cache.plan.rebuild.size());
+		config->composited_layers += static_cast<uint32_t>(cache.plan.composite.size() - cache.plan.rebuild.size());
+		config->cached_layers += cache.plan.cached;
+
+		std::vector<uint32_t> rebuild_layers;
+		for (auto index : cache.plan.rebuild)
+		{
+			rebuild_layers.push_back(layers[index].layer);
+		}
+		ClearLayers(cmd_buffer, cache.static_texture.get(), rebuild_layers);
+
+		cache.composite_layers.clear();
+		for (auto index : cache.plan.composite)
+		{
+			cache.composite_layers.push_back(layers[index].layer);
+		}
+		std::sort(cache.composite_layers.begin(), cache.composite_layers.end());
+
+		BuildShadowDraw(rhi_context, gpu_scene, config, shadow_cache, layers, cache.plan.rebuild, 0, cache.static_draw);
+		BuildShadowDraw(rhi_context, gpu_scene, config, shadow_cache, layers, cache.plan.composite, 1, cache.dynamic_draw);
+	}
+
+	// Restores the static depth of the composited layers, the dynamic casters are drawn on top afterwards
+	static void CompositeLayers(RHICommand *cmd_buffer, RHITexture *texture, const LayerCache &cache)
+	{
+		auto &layers = cache.composite_layers;
+		for (size_t i = 0; i < layers.size();)
+		{
+			size_t j = i + 1;
+			while (j < layers.size() && layers[j] == layers[j - 1] + 1)
+			{
+				j++;
+			}
+
+			TextureRange range = {RHITextureDimension::Texture2DArray, 0, 1, layers[i], static_cast<uint32_t>(j - i)};
+			cmd_buffer->CopyTexture(cache.static_texture.get(), range, RHIResourceState::DepthWrite, texture, range, RHIResourceState::DepthWrite);
+			i = j;
+		}
+	}
+
 	PipelineDesc
 	    CreatePipeline(const std::string &path, Renderer *renderer, bool has_skinned)
 	{
@@ -224,14 +526,12 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 			{
 				VertexInputState vertex_input_state = {};
 				vertex_input_state.input_bindings   = {
-                    VertexInputState::InputBinding{0, sizeof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex), RHIVertexInputRate::Vertex}};
+                    VertexInputState::InputBinding{0, sizeof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex), RHIVertexInputRate::Vertex}};
 				vertex_input_state.input_attributes = {
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Position, 0, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, position)},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Texcoord, 3, 0, RHIFormat::R32G32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, texcoord0)},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 5, 0, RHIFormat::R32G32B32A32_SINT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, bones[0])},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 6, 0, RHIFormat::R32G32B32A32_SINT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, bones[4])},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 7, 0, RHIFormat::R32G32B32A32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, weights[0])},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 8, 0, RHIFormat::R32G32B32A32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, weights[4])},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Position, 0, 0, RHIFormat::R32G32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, position)},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Texcoord, 3, 0, RHIFormat::R32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, texcoord0)},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 5, 0, RHIFormat::R32G32B32A32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, bones)},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 6, 0, RHIFormat::R32G32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, weights)},
 				};
 
 				pipeline_desc.pipeline->SetVertexInputState(vertex_input_state);
@@ -265,10 +565,15 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 	    GPUScene           *gpu_scene,
 	    Config             *config,
 	    RHITexture         *shadow_map,
-	    RHIRenderTarget    *render_target)
+	    RHIRenderTarget    *render_target,
+	    const ShadowDraw   &draw)
 	{
+		if (draw.views.empty())
+		{
+			return;
+		}
+
 		auto *rhi_context = renderer->GetRHIContext();
-		auto  spot_lights = scene->GetComponents<Cmpt::SpotLight>();
 
 		RasterizationState rasterization_state;
 		rasterization_state.cull_mode         = RHICullMode::None;
@@ -279,8 +584,12 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 		mesh_pipeline.pipeline->SetRasterizationState(rasterization_state);
 		skinned_mesh_pipeline.pipeline->SetRasterizationState(rasterization_state);
 
+		// Rebuilt layers are cleared and composited layers copied beforehand, the others keep their cached depth
+		DepthStencilAttachment depth_stencil_attachment = {};
+		depth_stencil_attachment.depth_load             = RHILoadAction::Load;
+
 		render_target->Clear();
-		render_target->Set(shadow_map, RHITextureDimension::Texture2DArray, DepthStencilAttachment{});
+		render_target->Set(shadow_map, RHITextureDimension::Texture2DArray, depth_stencil_attachment);
 
 		if (rhi_context->IsFeatureSupport(RHIFeature::MeshShading))
 		{
@@ -292,7 +601,7 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 			cmd_buffer->BeginRenderPass(render_target);
 
 			// Draw Opaque Mesh
-			if (gpu_scene->opaque_mesh.instance_count > 0)
+			if (!draw.mesh_tasks.empty())
 			{
 				auto *descriptor = rhi_context->CreateDescriptor(mesh_pipeline.meta);
 				descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_mesh.instances.get())
@@ -301,29 +610,32 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				    .BindBuffer("MeshletBuffer", gpu_scene->mesh_buffer.meshlet_buffers)
 				    .BindBuffer("MeshletDataBuffer", gpu_scene->mesh_buffer.meshlet_data_buffers)
 				    .BindBuffer("SpotLightBuffer", gpu_scene->light.spot_light_buffer.get())
-				    .BindBuffer("LightInfoBuffer", gpu_scene->light.light_info_buffer.get());
+				    .BindBuffer("ShadowViews", draw.view_buffer.get())
+				    .BindBuffer("ShadowTasks", draw.mesh_task_buffer.get());
 
 				cmd_buffer->BindDescriptor(descriptor);
 				cmd_buffer->BindPipelineState(mesh_pipeline.pipeline.get());
-				cmd_buffer->DrawMeshTask(gpu_scene->opaque_mesh.max_meshlet_count, gpu_scene->opaque_mesh.instance_count, static_cast<uint32_t>(spot_lights.size()), 32, 1, 1);
+				cmd_buffer->DrawMeshTasksIndirect(draw.indirect_buffer.get(), 0, 1, sizeof(RHIDrawMeshTasksIndirectCommand));
 			}
 
 			// Draw Skinned Mesh
-			if (gpu_scene->opaque_skinned_mesh.instance_count > 0)
+			if (!draw.skinned_mesh_tasks.empty())
 			{
 				auto *descriptor = rhi_context->CreateDescriptor(skinned_mesh_pipeline.meta);
 				descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_skinned_mesh.instances.get())
-				    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics)
+				    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics.get())
+				    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get())
 				    .BindBuffer("VertexBuffer", gpu_scene->skinned_mesh_buffer.vertex_buffers)
 				    .BindBuffer("IndexBuffer", gpu_scene->skinned_mesh_buffer.index_buffers)
 				    .BindBuffer("MeshletBuffer", gpu_scene->skinned_mesh_buffer.meshlet_buffers)
 				    .BindBuffer("MeshletDataBuffer", gpu_scene->skinned_mesh_buffer.meshlet_data_buffers)
 				    .BindBuffer("SpotLightBuffer", gpu_scene->light.spot_light_buffer.get())
-				    .BindBuffer("LightInfoBuffer", gpu_scene->light.light_info_buffer.get());
+				    .BindBuffer("ShadowViews", draw.view_buffer.get())
+				    .BindBuffer("ShadowTasks", draw.skinned_mesh_task_buffer.get());
 
 				cmd_buffer->BindDescriptor(descriptor);
 				cmd_buffer->BindPipelineState(skinned_mesh_pipeline.pipeline.get());
-				cmd_buffer->DrawMeshTask(gpu_scene->opaque_skinned_mesh.max_meshlet_count, gpu_scene->opaque_skinned_mesh.instance_count, static_cast<uint32_t>(spot_lights.size()), 32, 1, 1);
+				cmd_buffer->DrawMeshTasksIndirect(draw.indirect_buffer.get(), sizeof(RHIDrawMeshTasksIndirectCommand), 1, sizeof(RHIDrawMeshTasksIndirectCommand));
 			}
 
 			cmd_buffer->EndRenderPass();
@@ -410,10 +722,15 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 	    GPUScene           *gpu_scene,
 	    Config             *config,
 	    RHITexture         *cascade_shadow_map,
-	    RHIRenderTarget    *render_target)
+	    RHIRenderTarget    *render_target,
+	    const ShadowDraw   &draw)
 	{
-		auto *rhi_context        = renderer->GetRHIContext();
-		auto  directional_lights = scene->GetComponents<Cmpt::DirectionalLight>();
+		if (draw.views.empty())
+		{
+			return;
+		}
+
+		auto *rhi_context = renderer->GetRHIContext();
 
 		RasterizationState rasterization_state;
 		rasterization_state.cull_mode         = RHICullMode::None;
@@ -424,8 +741,12 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 		mesh_pipeline.pipeline->SetRasterizationState(rasterization_state);
 		skinned_mesh_pipeline.pipeline->SetRasterizationState(rasterization_state);
 
+		// Rebuilt layers are cleared and composited layers copied beforehand, the others keep their cached depth
+		DepthStencilAttachment depth_stencil_attachment = {};
+		depth_stencil_attachment.depth_load             = RHILoadAction::Load;
+
 		render_target->Clear();
-		render_target->Set(cascade_shadow_map, RHITextureDimension::Texture2DArray, DepthStencilAttachment{});
+		render_target->Set(cascade_shadow_map, RHITextureDimension::Texture2DArray, depth_stencil_attachment);
 
 		if (rhi_context->IsFeatureSupport(RHIFeature::MeshShading))
 		{
@@ -437,7 +758,7 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 			cmd_buffer->BeginRenderPass(render_target);
 
 			// Draw Mesh
-			if (gpu_scene->opaque_mesh.instance_count > 0)
+			if (!draw.mesh_tasks.empty())
 			{
 				auto *descriptor = rhi_context->CreateDescriptor(mesh_pipeline.meta);
 				descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_mesh.instances.get())
@@ -446,29 +767,32 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				    .BindBuffer("MeshletBuffer", gpu_scene->mesh_buffer.meshlet_buffers)
 				    .BindBuffer("MeshletDataBuffer", gpu_scene->mesh_buffer.meshlet_data_buffers)
 				    .BindBuffer("DirectionalLightBuffer", gpu_scene->light.directional_light_buffer.get())
-				    .BindBuffer("LightInfoBuffer", gpu_scene->light.light_info_buffer.get());
+				    .BindBuffer("ShadowViews", draw.view_buffer.get())
+				    .BindBuffer("ShadowTasks", draw.mesh_task_buffer.get());
 
 				cmd_buffer->BindDescriptor(descriptor);
 				cmd_buffer->BindPipelineState(mesh_pipeline.pipeline.get());
-				cmd_buffer->DrawMeshTask(gpu_scene->opaque_mesh.max_meshlet_count, gpu_scene->opaque_mesh.instance_count, static_cast<uint32_t>(directional_lights.size() * 4), 32, 1, 1);
+				cmd_buffer->DrawMeshTasksIndirect(draw.indirect_buffer.get(), 0, 1, sizeof(RHIDrawMeshTasksIndirectCommand));
 			}
 
 			// Draw Opaque Skinned Mesh
-			if (gpu_scene->opaque_skinned_mesh.instance_count > 0)
+			if (!draw.skinned_mesh_tasks.empty())
 			{
 				auto *descriptor = rhi_context->CreateDescriptor(skinned_mesh_pipeline.meta);
 				descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_skinned_mesh.instances.get())
-				    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics)
+				    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics.get())
+				    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get())
 				    .BindBuffer("VertexBuffer", gpu_scene->skinned_mesh_buffer.vertex_buffers)
 				    .BindBuffer("IndexBuffer", gpu_scene->skinned_mesh_buffer.index_buffers)
 				    .BindBuffer("MeshletBuffer", gpu_scene->skinned_mesh_buffer.meshlet_buffers)
 				    .BindBuffer("MeshletDataBuffer", gpu_scene->skinned_mesh_buffer.meshlet_data_buffers)
 				    .BindBuffer("DirectionalLightBuffer", gpu_scene->light.directional_light_buffer.get())
-				    .BindBuffer("LightInfoBuffer", gpu_scene->light.light_info_buffer.get());
+				    .BindBuffer("ShadowViews", draw.view_buffer.get())
+				    .BindBuffer("ShadowTasks", draw.skinned_mesh_task_buffer.get());
 
 				cmd_buffer->BindDescriptor(descriptor);
 				cmd_buffer->BindPipelineState(skinned_mesh_pipeline.pipeline.get());
-				cmd_buffer->DrawMeshTask(gpu_scene->opaque_skinned_mesh.max_meshlet_count, gpu_scene->opaque_skinned_mesh.instance_count, static_cast<uint32_t>(directional_lights.size() * 4), 32, 1, 1);
+				cmd_buffer->DrawMeshTasksIndirect(draw.indirect_buffer.get(), sizeof(RHIDrawMeshTasksIndirectCommand), 1, sizeof(RHIDrawMeshTasksIndirectCommand));
 			}
 
 			cmd_buffer->EndRenderPass();
@@ -561,13 +885,22 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 	    GPUScene           *gpu_scene,
 	    Config             *config,
 	    RHITexture         *omni_shadow_map,
-	    RHIRenderTarget    *render_target)
+	    RHIRenderTarget    *render_target,
+	    const ShadowDraw   &draw)
 	{
-		auto *rhi_context  = renderer->GetRHIContext();
-		auto  point_lights = scene->GetComponents<Cmpt::PointLight>();
+		if (draw.views.empty())
+		{
+			return;
+		}
+
+		auto *rhi_context = renderer->GetRHIContext();
+
+		// Rebuilt layers are cleared and composited layers copied beforehand, the others keep their cached depth
+		DepthStencilAttachment depth_stencil_attachment = {};
+		depth_stencil_attachment.depth_load             = RHILoadAction::Load;
 
 		render_target->Clear();
-		render_target->Set(omni_shadow_map, RHITextureDimension::Texture2DArray, DepthStencilAttachment{});
+		render_target->Set(omni_shadow_map, RHITextureDimension::Texture2DArray, depth_stencil_attachment);
 
 		if (rhi_context->IsFeatureSupport(RHIFeature::MeshShading))
 		{
@@ -579,7 +912,7 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 			cmd_buffer->BeginRenderPass(render_target);
 
 			// Draw Opaque Mesh
-			if (gpu_scene->opaque_mesh.instance_count > 0)
+			if (!draw.mesh_tasks.empty())
 			{
 				auto *descriptor = rhi_context->CreateDescriptor(mesh_pipeline.meta);
 				descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_mesh.instances.get())
@@ -588,29 +921,32 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 				    .BindBuffer("MeshletBuffer", gpu_scene->mesh_buffer.meshlet_buffers)
 				    .BindBuffer("MeshletDataBuffer", gpu_scene->mesh_buffer.meshlet_data_buffers)
 				    .BindBuffer("PointLightBuffer", gpu_scene->light.point_light_buffer.get())
-				    .BindBuffer("LightInfoBuffer", gpu_scene->light.light_info_buffer.get());
+				    .BindBuffer("ShadowViews", draw.view_buffer.get())
+				    .BindBuffer("ShadowTasks", draw.mesh_task_buffer.get());
 
 				cmd_buffer->BindDescriptor(descriptor);
 				cmd_buffer->BindPipelineState(mesh_pipeline.pipeline.get());
-				cmd_buffer->DrawMeshTask(gpu_scene->opaque_mesh.max_meshlet_count, gpu_scene->opaque_mesh.instance_count, static_cast<uint32_t>(point_lights.size() * 6), 32, 1, 1);
+				cmd_buffer->DrawMeshTasksIndirect(draw.indirect_buffer.get(), 0, 1, sizeof(RHIDrawMeshTasksIndirectCommand));
 			}
 
 			// Draw Opaque Skinned Mesh
-			if (gpu_scene->opaque_skinned_mesh.instance_count > 0)
+			if (!draw.skinned_mesh_tasks.empty())
 			{
 				auto *descriptor = rhi_context->CreateDescriptor(skinned_mesh_pipeline.meta);
 				descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_skinned_mesh.instances.get())
-				    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics)
+				    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics.get())
+				    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get())
 				    .BindBuffer("VertexBuffer", gpu_scene->skinned_mesh_buffer.vertex_buffers)
 				    .BindBuffer("IndexBuffer", gpu_scene->skinned_mesh_buffer.index_buffers)
 				    .BindBuffer("MeshletBuffer", gpu_scene->skinned_mesh_buffer.meshlet_buffers)
 				    .BindBuffer("MeshletDataBuffer", gpu_scene->skinned_mesh_buffer.meshlet_data_buffers)
 				    .BindBuffer("PointLightBuffer", gpu_scene->light.point_light_buffer.get())
-				    .BindBuffer("LightInfoBuffer", gpu_scene->light.light_info_buffer.get());
+				    .BindBuffer("ShadowViews", draw.view_buffer.get())
+				    .BindBuffer("ShadowTasks", draw.skinned_mesh_task_buffer.get());
 
 				cmd_buffer->BindDescriptor(descriptor);
 				cmd_buffer->BindPipelineState(skinned_mesh_pipeline.pipeline.get());
-				cmd_buffer->DrawMeshTask(gpu_scene->opaque_skinned_mesh.max_meshlet_count, gpu_scene->opaque_skinned_mesh.instance_count, static_cast<uint32_t>(point_lights.size() * 6), 32, 1, 1);
+				cmd_buffer->DrawMeshTasksIndirect(draw.indirect_buffer.get(), sizeof(RHIDrawMeshTasksIndirectCommand), 1, sizeof(RHIDrawMeshTasksIndirectCommand));
 			}
 
 			cmd_buffer->EndRenderPass();
@@ -702,8 +1038,32 @@ class ShadowMapPass : public RenderPass<ShadowMapPass>
 		ImGui::Combo("Point Light", reinterpret_cast<int32_t *>(&config_data->omni_map_resolution), resolution, 5);
 		ImGui::Combo("Directional Light", reinterpret_cast<int32_t *>(&config_data->cascade_shadow_map_resolution), resolution, 5);
 
+		ImGui::Text("Rebuilt Layers: %d", config_data->rebuilt_layers);
+		ImGui::Text("Composited Layers: %d", config_data->composited_layers);
+		ImGui::Text("Cached Layers: %d", config_data->cached_layers);
+		ImGui::Text("Task Groups: %d / %d", config_data->task_groups, config_data->dense_task_groups);
+
 		ImGui::PopItemWidth();
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/ShadowMap.hlsl", "ASmain", RHIShaderStage::Task}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/ShadowMap.hlsl", "MSmain", RHIShaderStage::Mesh}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/ShadowMap.hlsl", "PSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/ShadowMap.hlsl", "VSmain", RHIShaderStage::Vertex}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/ShadowMap.hlsl", "FSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/CascadeShadowMap.hlsl", "ASmain", RHIShaderStage::Task}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/CascadeShadowMap.hlsl", "MSmain", RHIShaderStage::Mesh}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/CascadeShadowMap.hlsl", "PSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/CascadeShadowMap.hlsl", "VSmain", RHIShaderStage::Vertex}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/CascadeShadowMap.hlsl", "FSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/OmniShadowMap.hlsl", "ASmain", RHIShaderStage::Task}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/OmniShadowMap.hlsl", "MSmain", RHIShaderStage::Mesh}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/OmniShadowMap.hlsl", "PSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/OmniShadowMap.hlsl", "VSmain", RHIShaderStage::Vertex}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shadow/OmniShadowMap.hlsl", "FSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+	}
 };
 
 CONFIGURATION_PASS(ShadowMapPass)
\ No newline at end of file
@@ -18,7 +18,8 @@ class SkyboxPass : public RenderPass<SkyboxPass>
 		    .SetName("SkyboxPass")
 		    .SetCategory("Shading")
 		    .ReadTexture2D(handle++, "Depth", RHIResourceState::DepthRead)
-		    .WriteTexture2D(handle++, "Output", RHIFormat::R16G16B16A16_FLOAT, RHIResourceState::RenderTarget);
+		    .WriteTexture2D(handle++, "Output", RHIFormat::R16G16B16A16_FLOAT, RHIResourceState::RenderTarget)
+		    .SetTransient("Output");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -84,6 +85,12 @@ class SkyboxPass : public RenderPass<SkyboxPass>
 	virtual void OnImGui(Variant *config)
 	{
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shading/Skybox.hlsl", "VSmain", RHIShaderStage::Vertex}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/Shading/Skybox.hlsl", "PSmain", RHIShaderStage::Fragment}});
+	}
 };
 
 CONFIGURATION_PASS(SkyboxPass)
\ No newline at end of file
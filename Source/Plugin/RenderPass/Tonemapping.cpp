@@ -31,7 +31,8 @@ class Tonemapping : public RenderPass<Tonemapping>
 		    .SetCategory("PostProcess")
 		    .SetConfig(Config())
 		    .ReadTexture2D(handle++, "Input", RHIResourceState::ShaderResource)
-		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Output", RHIFormat::R32G32B32A32_FLOAT, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Output");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -99,6 +100,11 @@ class Tonemapping : public RenderPass<Tonemapping>
 
 		config_data->auto_exposure = b.to_ulong();
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/PostProcess/Tonemapping.hlsl", "CSmain", RHIShaderStage::Compute}});
+	}
 };
 
 CONFIGURATION_PASS(Tonemapping)
\ No newline at end of file
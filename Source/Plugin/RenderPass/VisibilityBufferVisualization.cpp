@@ -18,7 +18,9 @@ class VisibilityBufferVisualization : public RenderPass<VisibilityBufferVisualiz
 		    .ReadTexture2D(handle++, "Visibility Buffer", RHIResourceState::ShaderResource)
 		    .ReadTexture2D(handle++, "Depth Buffer", RHIResourceState::ShaderResource)
 		    .WriteTexture2D(handle++, "Instance ID", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess)
-		    .WriteTexture2D(handle++, "Primitive ID", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Primitive ID", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Instance ID")
+		    .SetTransient("Primitive ID");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -54,6 +56,11 @@ class VisibilityBufferVisualization : public RenderPass<VisibilityBufferVisualiz
 	virtual void OnImGui(Variant *config)
 	{
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityBufferVisualization.hlsl", "CSmain", RHIShaderStage::Compute}});
+	}
 };
 
 CONFIGURATION_PASS(VisibilityBufferVisualization)
@@ -2,9 +2,6 @@
 
 #include <Resource/Resource/Mesh.hpp>
 #include <Resource/Resource/SkinnedMesh.hpp>
-#include <Resource/ResourceManager.hpp>
-#include <Scene/Components/AllComponents.hpp>
-#include <Scene/Scene.hpp>
 
 using namespace Ilum;
 
@@ -28,7 +25,9 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 		    .SetName("VisibilityGeometryPass")
 		    .SetCategory("RenderPath")
 		    .WriteTexture2D(handle++, "Visibility Buffer", RHIFormat::R32_UINT, RHIResourceState::RenderTarget)
-		    .WriteTexture2D(handle++, "Depth Buffer", RHIFormat::D32_FLOAT, RHIResourceState::DepthWrite);
+		    .WriteTexture2D(handle++, "Depth Buffer", RHIFormat::D32_FLOAT, RHIResourceState::DepthWrite)
+		    .SetTransient("Visibility Buffer")
+		    .SetTransient("Depth Buffer");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -56,11 +55,12 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 				cmd_buffer->SetScissor(render_target->GetWidth(), render_target->GetHeight());
 				cmd_buffer->BeginRenderPass(render_target.get());
 
-				// Draw Opaque Mesh
-				if (gpu_scene->opaque_mesh.instance_count > 0)
+				// Draw Opaque Mesh, instances outside the view are culled on the CPU
+				if (!gpu_scene->opaque_mesh.visible_instances.empty())
 				{
 					auto *descriptor = rhi_context->CreateDescriptor(mesh_pipeline.meta);
 					descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_mesh.instances.get())
+					    .BindBuffer("VisibleInstances", gpu_scene->opaque_mesh.visible_instance_buffer.get())
 					    .BindBuffer("ViewBuffer", view->buffer.get())
 					    .BindBuffer("VertexBuffer", gpu_scene->mesh_buffer.vertex_buffers)
 					    .BindBuffer("IndexBuffer", gpu_scene->mesh_buffer.index_buffers)
@@ -69,16 +69,18 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 
 					cmd_buffer->BindDescriptor(descriptor);
 					cmd_buffer->BindPipelineState(mesh_pipeline.pipeline.get());
-					cmd_buffer->DrawMeshTask(gpu_scene->opaque_mesh.max_meshlet_count, gpu_scene->opaque_mesh.instance_count, 1, 32, 1, 1);
+					cmd_buffer->DrawMeshTask(gpu_scene->opaque_mesh.max_meshlet_count, static_cast<uint32_t>(gpu_scene->opaque_mesh.visible_instances.size()), 1, 32, 1, 1);
 				}
 
 				// Draw Opaque Skinned Mesh
-				if (gpu_scene->opaque_skinned_mesh.instance_count > 0)
+				if (!gpu_scene->opaque_skinned_mesh.visible_instances.empty())
 				{
 					auto *descriptor = rhi_context->CreateDescriptor(skinned_mesh_pipeline.meta);
 					descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_skinned_mesh.instances.get())
+					    .BindBuffer("VisibleInstances", gpu_scene->opaque_skinned_mesh.visible_instance_buffer.get())
 					    .BindBuffer("ViewBuffer", view->buffer.get())
-					    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics)
+					    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics.get())
+					    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get())
 					    .BindBuffer("VertexBuffer", gpu_scene->skinned_mesh_buffer.vertex_buffers)
 					    .BindBuffer("IndexBuffer", gpu_scene->skinned_mesh_buffer.index_buffers)
 					    .BindBuffer("MeshletBuffer", gpu_scene->skinned_mesh_buffer.meshlet_buffers)
@@ -86,7 +88,7 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 
 					cmd_buffer->BindDescriptor(descriptor);
 					cmd_buffer->BindPipelineState(skinned_mesh_pipeline.pipeline.get());
-					cmd_buffer->DrawMeshTask(gpu_scene->opaque_skinned_mesh.max_meshlet_count, gpu_scene->opaque_skinned_mesh.instance_count, 1, 32, 1, 1);
+					cmd_buffer->DrawMeshTask(gpu_scene->opaque_skinned_mesh.max_meshlet_count, static_cast<uint32_t>(gpu_scene->opaque_skinned_mesh.visible_instances.size()), 1, 32, 1, 1);
 				}
 
 				cmd_buffer->EndRenderPass();
@@ -100,8 +102,6 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 				// Draw Opaque Mesh
 				if (gpu_scene->opaque_mesh.instance_count > 0)
 				{
-					auto meshes = renderer->GetScene()->GetComponents<Cmpt::MeshRenderer>();
-
 					auto *descriptor = rhi_context->CreateDescriptor(mesh_pipeline.meta);
 					descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_mesh.instances.get())
 					    .BindBuffer("ViewBuffer", view->buffer.get());
@@ -109,52 +109,38 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 					cmd_buffer->BindDescriptor(descriptor);
 					cmd_buffer->BindPipelineState(mesh_pipeline.pipeline.get());
 
-					uint32_t instance_id = 0;
-					for (auto &mesh : meshes)
+					// Recorded on JobSystem workers, so draw what UpdateMesh already made resident rather than touching the resource manager
+					for (uint32_t instance_id = 0; instance_id < gpu_scene->opaque_mesh.instance_count; instance_id++)
 					{
-						auto &submeshes = mesh->GetSubmeshes();
-						for (auto &submesh : submeshes)
-						{
-							auto *resource = renderer->GetResourceManager()->Get<ResourceType::Mesh>(submesh);
-							if (resource)
-							{
-								cmd_buffer->BindVertexBuffer(0, resource->GetVertexBuffer());
-								cmd_buffer->BindIndexBuffer(resource->GetIndexBuffer());
-								cmd_buffer->DrawIndexed(static_cast<uint32_t>(resource->GetIndexCount()), 1, 0, 0, instance_id);
-								instance_id++;
-							}
-						}
+						uint32_t mesh_id = gpu_scene->opaque_mesh.bounds[instance_id].mesh_id;
+
+						auto *index_buffer = gpu_scene->mesh_buffer.index_buffers[mesh_id];
+						cmd_buffer->BindVertexBuffer(0, gpu_scene->mesh_buffer.vertex_buffers[mesh_id]);
+						cmd_buffer->BindIndexBuffer(index_buffer);
+						cmd_buffer->DrawIndexed(static_cast<uint32_t>(index_buffer->GetDesc().size / sizeof(uint32_t)), 1, 0, 0, instance_id);
 					}
 				}
 
 				// Draw Opaque Skinned Mesh
 				if (gpu_scene->opaque_skinned_mesh.instance_count > 0)
 				{
-					auto skinned_meshes = renderer->GetScene()->GetComponents<Cmpt::SkinnedMeshRenderer>();
-
 					auto *descriptor = rhi_context->CreateDescriptor(skinned_mesh_pipeline.meta);
 					descriptor->BindBuffer("InstanceBuffer", gpu_scene->opaque_skinned_mesh.instances.get())
 					    .BindBuffer("ViewBuffer", view->buffer.get())
-					    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics);
+					    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics.get())
+					    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get());
 
 					cmd_buffer->BindDescriptor(descriptor);
 					cmd_buffer->BindPipelineState(skinned_mesh_pipeline.pipeline.get());
 
-					uint32_t instance_id = 0;
-					for (auto &skinned_mesh : skinned_meshes)
+					for (uint32_t instance_id = 0; instance_id < gpu_scene->opaque_skinned_mesh.instance_count; instance_id++)
 					{
-						auto &submeshes = skinned_mesh->GetSubmeshes();
-						for (auto &submesh : submeshes)
-						{
-							auto *resource = renderer->GetResourceManager()->Get<ResourceType::SkinnedMesh>(submesh);
-							if (resource)
-							{
-								cmd_buffer->BindVertexBuffer(0, resource->GetVertexBuffer());
-								cmd_buffer->BindIndexBuffer(resource->GetIndexBuffer());
-								cmd_buffer->DrawIndexed(static_cast<uint32_t>(resource->GetIndexCount()), 1, 0, 0, instance_id);
-								instance_id++;
-							}
-						}
+						uint32_t mesh_id = gpu_scene->opaque_skinned_mesh.bounds[instance_id].mesh_id;
+
+						auto *index_buffer = gpu_scene->skinned_mesh_buffer.index_buffers[mesh_id];
+						cmd_buffer->BindVertexBuffer(0, gpu_scene->skinned_mesh_buffer.vertex_buffers[mesh_id]);
+						cmd_buffer->BindIndexBuffer(index_buffer);
+						cmd_buffer->DrawIndexed(static_cast<uint32_t>(index_buffer->GetDesc().size / sizeof(uint32_t)), 1, 0, 0, instance_id);
 					}
 				}
 
@@ -228,14 +214,12 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 			if (has_skinned)
 			{
 				vertex_input_state.input_bindings = {
-				    VertexInputState::InputBinding{0, sizeof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex), RHIVertexInputRate::Vertex}};
+				    VertexInputState::InputBinding{0, sizeof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex), RHIVertexInputRate::Vertex}};
 				vertex_input_state.input_attributes = {
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Position, 0, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, position)},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Texcoord, 3, 0, RHIFormat::R32G32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, texcoord0)},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 5, 0, RHIFormat::R32G32B32A32_SINT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, bones[0])},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 6, 0, RHIFormat::R32G32B32A32_SINT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, bones[4])},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 7, 0, RHIFormat::R32G32B32A32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, weights[0])},
-				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 8, 0, RHIFormat::R32G32B32A32_FLOAT, offsetof(Resource<ResourceType::SkinnedMesh>::SkinnedVertex, weights[4])},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Position, 0, 0, RHIFormat::R32G32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, position)},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Texcoord, 3, 0, RHIFormat::R32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, texcoord0)},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Indices, 5, 0, RHIFormat::R32G32B32A32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, bones)},
+				    VertexInputState::InputAttribute{RHIVertexSemantics::Blend_Weights, 6, 0, RHIFormat::R32G32_UINT, offsetof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex, weights)},
 				};
 			}
 			else
@@ -255,6 +239,15 @@ class VisibilityGeometryPass : public RenderPass<VisibilityGeometryPass>
 
 		return pipeline_desc;
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityGeometryPass.hlsl", "ASmain", RHIShaderStage::Task}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityGeometryPass.hlsl", "MSmain", RHIShaderStage::Mesh}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityGeometryPass.hlsl", "PSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityGeometryPass.hlsl", "VSmain", RHIShaderStage::Vertex}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityGeometryPass.hlsl", "FSmain", RHIShaderStage::Fragment}, {{"HAS_SKINNED", "NO_SKINNED"}}});
+	}
 };
 
 CONFIGURATION_PASS(VisibilityGeometryPass)
\ No newline at end of file
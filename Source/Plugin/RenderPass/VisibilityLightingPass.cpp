@@ -2,7 +2,6 @@
 #include "PassData.hpp"
 
 #include <Material/MaterialData.hpp>
-#include <Resource/ResourceManager.hpp>
 
 using namespace Ilum;
 
@@ -51,7 +50,12 @@ class VisibilityLightingPass : public RenderPass<VisibilityLightingPass>
 		    .WriteTexture2D(handle++, "Normal Roughness", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess)
 		    .WriteTexture2D(handle++, "Albedo Metallic", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess)
 		    .WriteTexture2D(handle++, "Env DI", RHIFormat::R16G16B16A16_FLOAT, RHIResourceState::UnorderedAccess)
-		    .WriteTexture2D(handle++, "Light DI", RHIFormat::R16G16B16A16_FLOAT, RHIResourceState::UnorderedAccess);
+		    .WriteTexture2D(handle++, "Light DI", RHIFormat::R16G16B16A16_FLOAT, RHIResourceState::UnorderedAccess)
+		    .SetTransient("Position Depth")
+		    .SetTransient("Normal Roughness")
+		    .SetTransient("Albedo Metallic")
+		    .SetTransient("Env DI")
+		    .SetTransient("Light DI");
 	}
 
 	virtual void CreateCallback(RenderGraph::RenderTask *task, const RenderPassDesc &desc, RenderGraphBuilder &builder, Renderer *renderer)
@@ -88,7 +92,7 @@ class VisibilityLightingPass : public RenderPass<VisibilityLightingPass>
 
 			LightingPassData *pass_data = black_board.Has<LightingPassData>() ? black_board.Get<LightingPassData>() : black_board.Add<LightingPassData>();
 
-			size_t material_count = renderer->GetResourceManager()->GetValidResourceCount<ResourceType::Material>() + 1;
+			size_t material_count = gpu_scene->material.data.size() + 1;
 
 			bool has_mesh              = gpu_scene->opaque_mesh.instance_count != 0;
 			bool has_skinned_mesh      = gpu_scene->opaque_skinned_mesh.instance_count != 0;
@@ -387,7 +391,8 @@ class VisibilityLightingPass : public RenderPass<VisibilityLightingPass>
 					{
 						descriptor->BindBuffer("SkinnedMeshVertexBuffer", gpu_scene->skinned_mesh_buffer.vertex_buffers)
 						    .BindBuffer("SkinnedMeshIndexBuffer", gpu_scene->skinned_mesh_buffer.index_buffers)
-						    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics)
+						    .BindBuffer("BoneMatrices", gpu_scene->animation.bone_matrics.get())
+						    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get())
 						    .BindBuffer("SkinnedMeshInstanceBuffer", gpu_scene->opaque_skinned_mesh.instances.get());
 					}
 
@@ -472,6 +477,15 @@ class VisibilityLightingPass : public RenderPass<VisibilityLightingPass>
 		const char *const shadow_filter_modes[] = {"None", "Hard", "PCF", "PCSS"};
 		ImGui::Combo("Shadow Filter Mode", reinterpret_cast<int32_t *>(&config_data->shadow_filter_mode), shadow_filter_modes, 4);
 	}
+
+	virtual void RegisterShaders(std::vector<ShaderVariants> &variants)
+	{
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityLightingPass.hlsl", "CollectMaterialCount", RHIShaderStage::Compute}, {{"HAS_MESH", "NO_MESH"}, {"HAS_SKINNED_MESH", "NO_SKINNED_MESH"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityLightingPass.hlsl", "CalculateMaterialOffset", RHIShaderStage::Compute}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityLightingPass.hlsl", "CalculatePixelBuffer", RHIShaderStage::Compute}, {{"HAS_MESH", "NO_MESH"}, {"HAS_SKINNED_MESH", "NO_SKINNED_MESH"}}});
+		variants.push_back(ShaderVariants{ShaderPermutation{"Source/Shaders/RenderPath/VisibilityLightingPass.hlsl", "CalculateIndirectArgument", RHIShaderStage::Compute}});
+		// DispatchIndirect is compiled per scene material index, it is only rebuilt from recorded manifests
+	}
 };
 
 CONFIGURATION_PASS(VisibilityLightingPass)
@@ -0,0 +1,579 @@
+#include "FileIO.hpp"
+#include "JobSystem.hpp"
+#include "MappedFile.hpp"
+
+#include <cstdio>
+
+#ifdef __linux__
+#	include <cerrno>
+#	include <cstring>
+#	include <fcntl.h>
+#	include <linux/io_uring.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <sys/syscall.h>
+#	include <sys/uio.h>
+#	include <unistd.h>
+#endif
+
+namespace Ilum
+{
+#ifdef __linux__
+// Minimal io_uring over the raw system calls, so there is no liburing dependency
+class IoRing
+{
+  public:
+	static constexpr uint32_t QueueDepth = 64;
+
+  public:
+	// Returns nullptr if the kernel does not support io_uring or a sandbox blocks it
+	static std::unique_ptr<IoRing> Create()
+	{
+		std::unique_ptr<IoRing> ring(new IoRing);
+		if (!ring->Init())
+		{
+			return nullptr;
+		}
+		return ring;
+	}
+
+	~IoRing()
+	{
+		if (m_sqes)
+		{
+			munmap(m_sqes, m_sqes_size);
+		}
+		if (m_cq_ptr && m_cq_ptr != m_sq_ptr)
+		{
+			munmap(m_cq_ptr, m_cq_size);
+		}
+		if (m_sq_ptr)
+		{
+			munmap(m_sq_ptr, m_sq_size);
+		}
+		if (m_fd >= 0)
+		{
+			close(m_fd);
+		}
+	}
+
+	// Queue a vectored read or write, the caller keeps at most QueueDepth operations in flight
+	void Push(uint8_t opcode, int fd, const iovec *vector, uint64_t offset, uint64_t user_data)
+	{
+		uint32_t tail  = *m_sq_tail;
+		uint32_t index = tail & *m_sq_mask;
+
+		io_uring_sqe &sqe = m_sqes[index];
+		std::memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode    = opcode;
+		sqe.fd        = fd;
+		sqe.addr      = reinterpret_cast<uint64_t>(vector);
+		sqe.len       = 1;
+		sqe.off       = offset;
+		sqe.user_data = user_data;
+
+		m_sq_array[index] = index;
+		__atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+		m_unsubmitted++;
+	}
+
+	// Submit queued operations and wait for at least one completion
+	bool Submit()
+	{
+		while (true)
+		{
+			int result = static_cast<int>(syscall(__NR_io_uring_enter, m_fd, m_unsubmitted, 1, IORING_ENTER_GETEVENTS, nullptr, 0));
+			if (result >= 0)
+			{
+				m_unsubmitted -= static_cast<uint32_t>(result);
+				return true;
+			}
+			if (errno != EINTR)
+			{
+				return false;
+			}
+		}
+	}
+
+	// Calls callback(user_data, result) for every completion, result is a byte count or a negated errno
+	template <typename Callback>
+	void Reap(Callback &&callback)
+	{
+		uint32_t head = *m_cq_head;
+		uint32_t tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+
+		for (; head != tail; head++)
+		{
+			const io_uring_cqe &cqe = m_cqes[head & *m_cq_mask];
+			callback(cqe.user_data, cqe.res);
+		}
+
+		__atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+	}
+
+  private:
+	IoRing() = default;
+
+	bool Init()
+	{
+		io_uring_params params = {};
+
+		m_fd = static_cast<int>(syscall(__NR_io_uring_setup, QueueDepth, &params));
+		if (m_fd < 0)
+		{
+			return false;
+		}
+
+		m_sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		m_cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		if (params.features & IORING_FEAT_SINGLE_MMAP)
+		{
+			m_sq_size = m_cq_size = std::max(m_sq_size, m_cq_size);
+		}
+
+		m_sq_ptr = Map(m_sq_size, IORING_OFF_SQ_RING);
+		m_cq_ptr = (params.features & IORING_FEAT_SINGLE_MMAP) ? m_sq_ptr : Map(m_cq_size, IORING_OFF_CQ_RING);
+
+		m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		m_sqes      = static_cast<io_uring_sqe *>(Map(m_sqes_size, IORING_OFF_SQES));
+
+		if (!m_sq_ptr || !m_cq_ptr || !m_sqes)
+		{
+			return false;
+		}
+
+		uint8_t *sq = static_cast<uint8_t *>(m_sq_ptr);
+		uint8_t *cq = static_cast<uint8_t *>(m_cq_ptr);
+
+		m_sq_tail  = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+		m_sq_mask  = reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+		m_sq_array = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+
+		m_cq_head = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+		m_cq_tail = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+		m_cq_mask = reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+		m_cqes    = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+		return true;
+	}
+
+	void *Map(size_t size, off_t offset)
+	{
+		void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, offset);
+		return ptr == MAP_FAILED ? nullptr : ptr;
+	}
+
+  private:
+	int m_fd = -1;
+
+	void  *m_sq_ptr  = nullptr;
+	void  *m_cq_ptr  = nullptr;
+	size_t m_sq_size = 0;
+	size_t m_cq_size = 0;
+
+	io_uring_sqe *m_sqes      = nullptr;
+	size_t        m_sqes_size = 0;
+
+	uint32_t *m_sq_tail  = nullptr;
+	uint32_t *m_sq_mask  = nullptr;
+	uint32_t *m_sq_array = nullptr;
+
+	uint32_t     *m_cq_head = nullptr;
+	uint32_t     *m_cq_tail = nullptr;
+	uint32_t     *m_cq_mask = nullptr;
+	io_uring_cqe *m_cqes    = nullptr;
+
+	uint32_t m_unsubmitted = 0;
+};
+#else
+class IoRing
+{
+  public:
+	static std::unique_ptr<IoRing> Create()
+	{
+		return nullptr;
+	}
+};
+#endif
+
+FileIO::FileIO(Backend backend)
+{
+	// Completion callbacks run on the job system, construct it first so that it outlives the I/O threads
+	JobSystem::GetInstance();
+
+	if (backend == Backend::Ring)
+	{
+		m_ring = IoRing::Create();
+	}
+
+	if (m_ring)
+	{
+		m_workers.emplace_back([this]() { RingLoop(); });
+		return;
+	}
+
+	uint32_t thread_count = std::clamp(std::thread::hardware_concurrency() / 4, 1u, 4u);
+	for (uint32_t i = 0; i < thread_count; i++)
+	{
+		m_workers.emplace_back([this]() { WorkerLoop(); });
+	}
+}
+
+FileIO::~FileIO()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+
+	m_condition.notify_all();
+
+	for (auto &worker : m_workers)
+	{
+		worker.join();
+	}
+
+	Wait();
+}
+
+FileIO &FileIO::GetInstance()
+{
+	static FileIO file_io;
+	return file_io;
+}
+
+bool FileIO::Read(const std::string &path, std::vector<uint8_t> &data, size_t offset, size_t size)
+{
+	data.clear();
+
+	std::error_code error;
+	size_t          file_size = static_cast<size_t>(std::filesystem::file_size(std::filesystem::u8path(path), error));
+	if (error || offset > file_size)
+	{
+		return false;
+	}
+
+	size = size == 0 ? file_size - offset : std::min(size, file_size - offset);
+	if (size == 0)
+	{
+		return true;
+	}
+
+	if (file_size >= MapThreshold)
+	{
+		MappedFile file(path);
+		if (file.IsValid() && file.GetSize() >= offset + size)
+		{
+			data.assign(file.GetData() + offset, file.GetData() + offset + size);
+			return true;
+		}
+	}
+
+	std::FILE *file = std::fopen(path.c_str(), "rb");
+	if (!file)
+	{
+		return false;
+	}
+
+	data.resize(size);
+
+	bool success = std::fseek(file, static_cast<long>(offset), SEEK_SET) == 0 &&
+	               std::fread(data.data(), 1, size, file) == size;
+
+	std::fclose(file);
+
+	if (!success)
+	{
+		data.clear();
+	}
+
+	return success;
+}
+
+bool FileIO::Write(const std::string &path, const uint8_t *data, size_t size)
+{
+	std::error_code error;
+
+	auto directory = std::filesystem::u8path(path).parent_path();
+	if (!directory.empty())
+	{
+		std::filesystem::create_directories(directory, error);
+	}
+
+	std::FILE *file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		return false;
+	}
+
+	bool success = std::fwrite(data, 1, size, file) == size;
+	success &= std::fclose(file) == 0;
+
+	return success;
+}
+
+void FileIO::ReadAsync(const std::string &path, ReadCallback &&callback, Priority priority)
+{
+	auto request           = std::make_shared<Request>();
+	request->path          = path;
+	request->read_callback = std::move(callback);
+	Submit(priority, std::move(request));
+}
+
+void FileIO::WriteAsync(const std::string &path, std::vector<uint8_t> &&data, WriteCallback &&callback, Priority priority)
+{
+	auto request            = std::make_shared<Request>();
+	request->write          = true;
+	request->path           = path;
+	request->data           = std::move(data);
+	request->write_callback = std::move(callback);
+	Submit(priority, std::move(request));
+}
+
+void FileIO::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_idle.wait(lock, [this]() { return m_in_flight == 0; });
+}
+
+FileIO::Backend FileIO::GetBackend() const
+{
+	return m_ring ? Backend::Ring : Backend::Threads;
+}
+
+void FileIO::Submit(Priority priority, std::shared_ptr<Request> &&request)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_requests.emplace(std::make_pair(priority, m_sequence++), std::move(request));
+		m_in_flight++;
+	}
+
+	m_condition.notify_one();
+}
+
+void FileIO::WorkerLoop()
+{
+	while (true)
+	{
+		std::shared_ptr<Request> request = nullptr;
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return m_stop || !m_requests.empty(); });
+
+			// Drain pending requests before shutting down
+			if (m_requests.empty())
+			{
+				return;
+			}
+
+			request = std::move(m_requests.begin()->second);
+			m_requests.erase(m_requests.begin());
+		}
+
+		bool success = request->write ?
+		                   Write(request->path, request->data.data(), request->data.size()) :
+		                   Read(request->path, request->data);
+
+		Complete(std::move(request), success);
+	}
+}
+
+// Keeps up to IoRing::QueueDepth requests in the ring, new requests are picked up whenever one completes
+void FileIO::RingLoop()
+{
+#ifdef __linux__
+	// Larger files are read and written in several chunks, io_uring reports results as 32-bit integers
+	constexpr size_t MaxChunkSize = 1 << 30;
+
+	struct Operation
+	{
+		std::shared_ptr<Request> request = nullptr;
+
+		int    fd     = -1;
+		size_t size   = 0;
+		size_t done   = 0;
+		iovec  vector = {};
+	};
+
+	// Operations are indexed by their io_uring user data
+	std::array<Operation, IoRing::QueueDepth> operations;
+	std::vector<uint32_t>                     free_list;
+	std::vector<uint32_t>                     started;
+
+	for (uint32_t i = IoRing::QueueDepth; i > 0; i--)
+	{
+		free_list.push_back(i - 1);
+	}
+
+	// Queue the next chunk, an operation has at most one chunk in the ring
+	auto push = [&](uint32_t index) {
+		Operation &operation = operations[index];
+
+		operation.vector.iov_base = operation.request->data.data() + operation.done;
+		operation.vector.iov_len  = std::min(operation.size - operation.done, MaxChunkSize);
+		m_ring->Push(operation.request->write ? IORING_OP_WRITEV : IORING_OP_READV, operation.fd, &operation.vector, operation.done, index);
+	};
+
+	auto finish = [&](uint32_t index, bool success) {
+		Operation &operation = operations[index];
+
+		if (operation.fd >= 0)
+		{
+			success &= close(operation.fd) == 0;
+		}
+		if (!success && !operation.request->write)
+		{
+			operation.request->data.clear();
+		}
+
+		Complete(std::move(operation.request), success);
+
+		operation = {};
+		free_list.push_back(index);
+	};
+
+	while (true)
+	{
+		started.clear();
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			if (free_list.size() == IoRing::QueueDepth)
+			{
+				m_condition.wait(lock, [this]() { return m_stop || !m_requests.empty(); });
+
+				// Drain pending requests before shutting down
+				if (m_requests.empty())
+				{
+					return;
+				}
+			}
+
+			while (!free_list.empty() && !m_requests.empty())
+			{
+				uint32_t index = free_list.back();
+				free_list.pop_back();
+
+				operations[index].request = std::move(m_requests.begin()->second);
+				m_requests.erase(m_requests.begin());
+				started.push_back(index);
+			}
+		}
+
+		for (uint32_t index : started)
+		{
+			Operation &operation = operations[index];
+			Request   &request   = *operation.request;
+
+			if (request.write)
+			{
+				std::error_code error;
+
+				auto directory = std::filesystem::u8path(request.path).parent_path();
+				if (!directory.empty())
+				{
+					std::filesystem::create_directories(directory, error);
+				}
+
+				operation.fd   = open(request.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+				operation.size = request.data.size();
+			}
+			else
+			{
+				struct stat status = {};
+
+				operation.fd = open(request.path.c_str(), O_RDONLY | O_CLOEXEC);
+				if (operation.fd >= 0 && fstat(operation.fd, &status) == 0)
+				{
+					operation.size = static_cast<size_t>(status.st_size);
+					request.data.resize(operation.size);
+				}
+				else if (operation.fd >= 0)
+				{
+					close(operation.fd);
+					operation.fd = -1;
+				}
+			}
+
+			if (operation.fd < 0 || operation.size == 0)
+			{
+				finish(index, operation.fd >= 0);
+				continue;
+			}
+
+			push(index);
+		}
+
+		if (free_list.size() == IoRing::QueueDepth)
+		{
+			continue;
+		}
+
+		if (!m_ring->Submit())
+		{
+			// Out of kernel resources, completions still in the ring free them up
+			std::this_thread::yield();
+		}
+
+		m_ring->Reap([&](uint64_t user_data, int32_t result) {
+			uint32_t   index     = static_cast<uint32_t>(user_data);
+			Operation &operation = operations[index];
+
+			if (result == -EINTR || result == -EAGAIN)
+			{
+				push(index);
+				return;
+			}
+
+			// Zero bytes before the end means the file shrank under us
+			if (result <= 0)
+			{
+				finish(index, false);
+				return;
+			}
+
+			operation.done += static_cast<size_t>(result);
+			if (operation.done < operation.size)
+			{
+				push(index);
+			}
+			else
+			{
+				finish(index, true);
+			}
+		});
+	}
+#endif
+}
+
+void FileIO::Complete(std::shared_ptr<Request> &&request, bool success)
+{
+	auto finish = [this]() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_in_flight == 0)
+		{
+			m_idle.notify_all();
+		}
+	};
+
+	if (!request->read_callback && !request->write_callback)
+	{
+		finish();
+		return;
+	}
+
+	JobSystem::GetInstance().ExecuteAsync([request, success, finish]() {
+		if (request->write)
+		{
+			request->write_callback(success);
+		}
+		else
+		{
+			request->read_callback(success, std::move(request->data));
+		}
+		finish();
+	});
+}
+}        // namespace Ilum
@@ -19,29 +19,218 @@ void SpinLock::Unlock()
 	m_flag.clear(std::memory_order_release);
 }
 
+JobMemoryPool &JobMemoryPool::GetInstance()
+{
+	// Never destroyed, futures and contexts may be released after every other static is gone
+	static JobMemoryPool *pool = new JobMemoryPool;
+	return *pool;
+}
+
+void *JobMemoryPool::Allocate(size_t size)
+{
+	if (size > BlockSize)
+	{
+		return ::operator new(size);
+	}
+
+	m_lock.Lock();
+	if (!m_free)
+	{
+		m_chunks.emplace_back(new std::byte[BlockSize * ChunkBlock]);
+		for (size_t i = 0; i < ChunkBlock; i++)
+		{
+			auto *block = reinterpret_cast<Block *>(m_chunks.back().get() + i * BlockSize);
+			block->next = m_free;
+			m_free      = block;
+		}
+	}
+	Block *block = m_free;
+	m_free       = block->next;
+	m_lock.Unlock();
+
+	return block;
+}
+
+void JobMemoryPool::Free(void *ptr, size_t size)
+{
+	if (size > BlockSize)
+	{
+		::operator delete(ptr);
+		return;
+	}
+
+	auto *block = static_cast<Block *>(ptr);
+
+	m_lock.Lock();
+	block->next = m_free;
+	m_free      = block;
+	m_lock.Unlock();
+}
+
+size_t JobMemoryPool::GetBlockCount() const
+{
+	return m_chunks.size() * ChunkBlock;
+}
+
+Job::~Job()
+{
+	Reset();
+}
+
+Job::Job(Job &&other) noexcept
+{
+	*this = std::move(other);
+}
+
+Job &Job::operator=(Job &&other) noexcept
+{
+	if (this != &other)
+	{
+		Reset();
+		if (other.m_relocate)
+		{
+			other.m_relocate(m_storage, other.m_storage);
+			m_invoke         = other.m_invoke;
+			m_relocate       = other.m_relocate;
+			m_tag            = other.m_tag;
+			other.m_invoke   = nullptr;
+			other.m_relocate = nullptr;
+			other.m_tag      = nullptr;
+		}
+	}
+	return *this;
+}
+
+Job::operator bool() const
+{
+	return m_invoke != nullptr;
+}
+
+void Job::operator()()
+{
+	assert(m_invoke && "Invoking an empty job");
+	m_invoke(m_storage);
+	Reset();
+}
+
+const void *Job::GetTag() const
+{
+	return m_tag;
+}
+
+void Job::Reset()
+{
+	if (m_relocate)
+	{
+		m_relocate(nullptr, m_storage);
+	}
+	m_invoke   = nullptr;
+	m_relocate = nullptr;
+	m_tag      = nullptr;
+}
+
+bool WorkStealingQueue::Push(Job &&job)
+{
+	m_lock.Lock();
+	if (m_bottom - m_top >= Capacity)
+	{
+		m_lock.Unlock();
+		return false;
+	}
+	m_jobs[m_bottom % Capacity] = std::move(job);
+	m_bottom++;
+	m_size.store(m_bottom - m_top, std::memory_order_release);
+	m_lock.Unlock();
+	return true;
+}
+
+bool WorkStealingQueue::Pop(Job &job)
+{
+	if (Empty())
+	{
+		return false;
+	}
+
+	m_lock.Lock();
+	if (m_bottom == m_top)
+	{
+		m_lock.Unlock();
+		return false;
+	}
+	m_bottom--;
+	job = std::move(m_jobs[m_bottom % Capacity]);
+	m_size.store(m_bottom - m_top, std::memory_order_release);
+	m_lock.Unlock();
+	return true;
+}
+
+bool WorkStealingQueue::Steal(Job &job)
+{
+	if (Empty())
+	{
+		return false;
+	}
+
+	m_lock.Lock();
+	if (m_bottom == m_top)
+	{
+		m_lock.Unlock();
+		return false;
+	}
+	job = std::move(m_jobs[m_top % Capacity]);
+	m_top++;
+	m_size.store(m_bottom - m_top, std::memory_order_release);
+	m_lock.Unlock();
+	return true;
+}
+
+bool WorkStealingQueue::Steal(Job &job, const void *tag)
+{
+	if (Empty())
+	{
+		return false;
+	}
+
+	m_lock.Lock();
+	for (size_t i = m_top; i < m_bottom; i++)
+	{
+		if (m_jobs[i % Capacity].GetTag() == tag)
+		{
+			job = std::move(m_jobs[i % Capacity]);
+			// Close the gap by shifting the older jobs towards the bottom
+			for (size_t j = i; j > m_top; j--)
+			{
+				m_jobs[j % Capacity] = std::move(m_jobs[(j - 1) % Capacity]);
+			}
+			m_top++;
+			m_size.store(m_bottom - m_top, std::memory_order_release);
+			m_lock.Unlock();
+			return true;
+		}
+	}
+	m_lock.Unlock();
+	return false;
+}
+
+bool WorkStealingQueue::Empty() const
+{
+	return m_size.load(std::memory_order_acquire) == 0;
+}
+
+// Worker identity of the calling thread, used to route submissions to the local queue
+static thread_local ThreadPool *t_thread_pool  = nullptr;
+static thread_local uint32_t    t_worker_index = ~0u;
+
 ThreadPool::ThreadPool(uint32_t max_threads_num)
 {
 	for (uint32_t i = 0; i < max_threads_num; i++)
 	{
-		m_workers.emplace_back(
-		    [this]() {
-			    while (true)
-			    {
-				    std::function<void()> task;
-
-				    {
-					    std::unique_lock<std::mutex> lock(m_mutex);
-					    m_condition.wait(lock, [this]() { return m_stop || !m_task_queue.Empty(); });
-					    if (m_stop && m_task_queue.Empty())
-					    {
-						    return;
-					    }
-					    m_task_queue.TryPop(task);
-				    }
+		m_queues.emplace_back(std::make_unique<WorkStealingQueue>());
+	}
 
-				    task();
-			    }
-		    });
+	for (uint32_t i = 0; i < max_threads_num; i++)
+	{
+		m_workers.emplace_back([this, i]() { WorkerLoop(i); });
 	}
 }
 
@@ -64,20 +253,133 @@ size_t ThreadPool::GetThreadCount() const
 	return m_workers.size();
 }
 
-void ThreadPool::WaitAll()
+void ThreadPool::Submit(Job &&job)
 {
+	if (m_queues.empty())
+	{
+		job();
+		return;
+	}
+
+	uint32_t index = t_thread_pool == this ?
+	                     t_worker_index :
+	                     m_next_queue.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(m_queues.size());
+
+	m_unfinished.fetch_add(1);
+	m_pending.fetch_add(1);
+
+	if (!m_queues[index]->Push(std::move(job)))
+	{
+		// Queue is full, execute in place rather than growing
+		m_pending.fetch_sub(1);
+		Run(job);
+		return;
+	}
+
+	if (m_sleeping.load() > 0)
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
-		m_condition.notify_all();
+		m_condition.notify_one();
 	}
+}
 
-	for (auto &worker : m_workers)
+bool ThreadPool::RunPendingJob(const void *tag)
+{
+	Job job;
+	if (t_thread_pool == this || !tag ? TryAcquire(t_thread_pool == this ? t_worker_index : 0, job) : TryAcquire(tag, job))
+	{
+		Run(job);
+		return true;
+	}
+	return false;
+}
+
+void ThreadPool::WaitAll()
+{
+	while (m_unfinished.load() > 0)
+	{
+		if (!RunPendingJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void ThreadPool::WorkerLoop(uint32_t index)
+{
+	t_thread_pool  = this;
+	t_worker_index = index;
+
+	while (true)
+	{
+		Job job;
+		if (TryAcquire(index, job))
+		{
+			Run(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (m_stop && m_pending.load() == 0)
+		{
+			return;
+		}
+		m_sleeping.fetch_add(1);
+		m_condition.wait(lock, [this]() { return m_stop || m_pending.load() > 0; });
+		m_sleeping.fetch_sub(1);
+	}
+}
+
+bool ThreadPool::TryAcquire(uint32_t index, Job &job)
+{
+	if (m_pending.load() == 0)
+	{
+		return false;
+	}
+
+	uint32_t queue_count = static_cast<uint32_t>(m_queues.size());
+
+	if (index < queue_count && m_queues[index]->Pop(job))
+	{
+		m_pending.fetch_sub(1);
+		return true;
+	}
+
+	for (uint32_t i = 1; i <= queue_count; i++)
+	{
+		if (m_queues[(index + i) % queue_count]->Steal(job))
+		{
+			m_pending.fetch_sub(1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ThreadPool::TryAcquire(const void *tag, Job &job)
+{
+	if (m_pending.load() == 0)
+	{
+		return false;
+	}
+
+	for (auto &queue : m_queues)
 	{
-		if (worker.joinable())
+		if (queue->Steal(job, tag))
 		{
-			worker.join();
+			m_pending.fetch_sub(1);
+			return true;
 		}
 	}
+
+	return false;
+}
+
+void ThreadPool::Run(Job &job)
+{
+	job();
+	m_unfinished.fetch_sub(1);
 }
 
 JobNode::JobNode(std::function<void()> &&task) :
@@ -206,9 +508,14 @@ void JobGraph::Run()
 	}
 }
 
-JobSystem::JobSystem()
+JobSystem::JobSystem() :
+    JobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1)
+{
+}
+
+JobSystem::JobSystem(uint32_t thread_count)
 {
-	m_thread_pool = std::make_unique<ThreadPool>(std::thread::hardware_concurrency() - 1);
+	m_thread_pool = std::make_unique<ThreadPool>(thread_count);
 }
 
 JobSystem::~JobSystem()
@@ -243,20 +550,22 @@ void JobSystem::Execute(JobHandle &handle, JobGraph &graph)
 
 				if (node->GetType() == typeid(JobNode))
 				{
-					m_thread_pool->AddTask([&node, &handle]() {
+					m_thread_pool->Submit(Job([node, &handle]() {
 						node->Run();
 						handle.m_counter.fetch_sub(1);
-					});
+					}, &handle));
 				}
 				else
 				{
-					m_thread_pool->AddTask([&node, &handle, this]() {
+					m_thread_pool->Submit(Job([node, &handle, this]() {
 						handle.m_counter.fetch_sub(1);
 						Execute(handle, *static_cast<JobGraph *>(node));
-					});
+					}, &handle));
 				}
 			}
 		}
+
+		m_thread_pool->RunPendingJob(&handle);
 	}
 }
 
@@ -264,22 +573,10 @@ void JobSystem::Execute(JobHandle &handle, JobNode &node)
 {
 	handle.m_counter.fetch_add(1);
 
-	m_thread_pool->AddTask([&node, &handle]() { node.Run();handle.m_counter.fetch_sub(1); });
-}
-
-void JobSystem::Dispatch(JobHandle &handle, uint32_t job_count, uint32_t group_size, const std::function<void(uint32_t)> &task)
-{
-	uint32_t group_count = (job_count + group_size - 1) / group_size;
-
-	handle.m_counter.fetch_add(group_count);
-
-	for (uint32_t group_id = 0; group_id < group_count; group_id++)
-	{
-		m_thread_pool->AddTask([task, &handle, group_id]() {
-			task(group_id);
-			handle.m_counter.fetch_sub(1);
-		});
-	}
+	m_thread_pool->Submit(Job([&node, &handle]() {
+		node.Run();
+		handle.m_counter.fetch_sub(1);
+	}, &handle));
 }
 
 bool JobSystem::IsBusy(const JobHandle &handle)
@@ -289,9 +586,13 @@ bool JobSystem::IsBusy(const JobHandle &handle)
 
 void JobSystem::Wait(const JobHandle &handle)
 {
+	// Help draining the queues instead of spinning, this also keeps waiting from a worker deadlock-free
 	while (IsBusy(handle))
 	{
-		// wait...
+		if (!m_thread_pool->RunPendingJob(&handle))
+		{
+			std::this_thread::yield();
+		}
 	}
 }
 
@@ -1,71 +1,375 @@
 #include "Log.hpp"
 
-#include <spdlog/async.h>
 #include <spdlog/details/log_msg_buffer.h>
-#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/pattern_formatter.h>
+#include <spdlog/sinks/sink.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 namespace Ilum
 {
-class Sink : public spdlog::sinks::base_sink<std::mutex>
+// Bounded multi-producer single-consumer ring
+// Every slot carries a sequence number, producers claim slots with a CAS on the enqueue position
+// and publish them by bumping the sequence, so producers never take a lock
+class LogRing
 {
   public:
-	struct LogMsg
+	explicit LogRing(size_t capacity) :
+	    m_slots(new Slot[capacity]), m_mask(capacity - 1)
+	{
+		assert((capacity & m_mask) == 0 && "Log ring capacity must be a power of two");
+
+		for (size_t i = 0; i < capacity; i++)
+		{
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	// Producer side, returns false if the ring is full
+	bool TryPush(const spdlog::details::log_msg &msg)
+	{
+		Slot  *slot = nullptr;
+		size_t pos  = m_enqueue.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			slot          = &m_slots[pos & m_mask];
+			size_t   seq  = slot->sequence.load(std::memory_order_acquire);
+			intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+			if (diff == 0)
+			{
+				if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = m_enqueue.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->msg = spdlog::details::log_msg_buffer(msg);
+		slot->sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	// Consumer side only
+	bool TryPop(spdlog::details::log_msg_buffer &msg)
+	{
+		Slot &slot = m_slots[m_dequeue & m_mask];
+		if (slot.sequence.load(std::memory_order_acquire) != m_dequeue + 1)
+		{
+			return false;
+		}
+
+		msg = std::move(slot.msg);
+		slot.sequence.store(m_dequeue + m_mask + 1, std::memory_order_release);
+		m_dequeue++;
+
+		return true;
+	}
+
+	// Consumer side only, true if the next slot has been published
+	bool HasPending() const
+	{
+		return m_slots[m_dequeue & m_mask].sequence.load(std::memory_order_acquire) == m_dequeue + 1;
+	}
+
+	// Number of slots claimed by producers so far
+	size_t GetPushedCount() const
+	{
+		return m_enqueue.load(std::memory_order_acquire);
+	}
+
+	// Consumer side only
+	size_t GetPoppedCount() const
+	{
+		return m_dequeue;
+	}
+
+  private:
+	struct alignas(64) Slot
 	{
-		spdlog::level::level_enum level;
-		std::string               msg;
+		std::atomic<size_t>             sequence;
+		spdlog::details::log_msg_buffer msg;
 	};
 
+	std::unique_ptr<Slot[]> m_slots;
+	size_t                  m_mask;
+
+	alignas(64) std::atomic<size_t> m_enqueue = 0;
+	alignas(64) size_t m_dequeue              = 0;
+};
+
+// Producers only copy the formatted payload into the ring,
+// a background thread applies the pattern and writes to the console, the log file and the editor history
+class AsyncSink : public spdlog::sinks::sink
+{
   public:
-	// Thread unsafe
-	const std::deque<LogMsg> &GetLogs() const
+	static constexpr size_t RingCapacity = 4096;
+	static constexpr size_t HistorySize  = 4096;
+	static constexpr size_t SpinCount    = 64;
+
+  public:
+	AsyncSink() :
+	    m_ring(RingCapacity), m_formatter(std::make_unique<spdlog::pattern_formatter>())
+	{
+		m_thread = std::thread([this]() { Drain(); });
+	}
+
+	~AsyncSink()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_wake_mutex);
+			m_stop.store(true, std::memory_order_release);
+		}
+		m_wake.notify_one();
+		m_thread.join();
+	}
+
+	virtual void log(const spdlog::details::log_msg &msg) override
+	{
+		while (!m_ring.TryPush(msg))
+		{
+			if (m_policy.load(std::memory_order_relaxed) == LogSystem::OverflowPolicy::Drop)
+			{
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			Wake();
+			std::this_thread::yield();
+		}
+
+		Wake();
+	}
+
+	// The caller drains the ring itself instead of waiting on the background thread
+	virtual void flush() override
+	{
+		size_t target = m_ring.GetPushedCount();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		while (m_ring.GetPoppedCount() < target)
+		{
+			if (Write() == 0)
+			{
+				// A producer has claimed a slot but not published it yet
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	virtual void set_pattern(const std::string &pattern) override
+	{
+		set_formatter(std::make_unique<spdlog::pattern_formatter>(pattern));
+	}
+
+	virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_formatter = std::move(sink_formatter);
+	}
+
+	void SetOverflowPolicy(LogSystem::OverflowPolicy policy)
+	{
+		m_policy.store(policy, std::memory_order_relaxed);
+	}
+
+	void SetLogFile(const std::string &path)
 	{
-		return m_log_msgs;
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_file.close();
+		if (!path.empty())
+		{
+			m_file.open(path, std::ios::out | std::ios::trunc);
+		}
 	}
 
-	// Thread safe
-	std::vector<LogMsg> CopyLogs() const
+	std::vector<LogSystem::LogMessage> CopyLogs() const
 	{
-		std::lock_guard<std::mutex> lock(const_cast<std::mutex &>(base_sink<std::mutex>::mutex_));
-		std::vector<LogMsg>         res(m_log_msgs.begin(), m_log_msgs.end());
-		return res;
+		std::lock_guard<std::mutex> lock(m_history_mutex);
+		return std::vector<LogSystem::LogMessage>(m_history.begin(), m_history.end());
 	}
 
 	void Clear()
 	{
-		std::lock_guard<std::mutex> lock(base_sink<std::mutex>::mutex_);
-		m_log_msgs.clear();
+		std::lock_guard<std::mutex> lock(m_history_mutex);
+		m_history.clear();
+	}
+
+	size_t GetDroppedCount() const
+	{
+		return m_dropped.load(std::memory_order_relaxed);
+	}
+
+  private:
+	static LogSystem::LogLevel ToLogLevel(spdlog::level::level_enum level)
+	{
+		switch (level)
+		{
+			case spdlog::level::info:
+				return LogSystem::LogLevel::Info;
+			case spdlog::level::warn:
+				return LogSystem::LogLevel::Warn;
+			case spdlog::level::err:
+				return LogSystem::LogLevel::Error;
+			case spdlog::level::critical:
+				return LogSystem::LogLevel::Fatal;
+			default:
+				return LogSystem::LogLevel::Debug;
+		}
+	}
+
+	// Producer side, the fence pairs with the one in Drain:
+	// either the consumer sees the published slot or the producer sees the consumer asleep
+	void Wake()
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_sleeping.load(std::memory_order_relaxed))
+		{
+			// The consumer holds the mutex from raising the flag until it waits, so the notify cannot be missed
+			{
+				std::lock_guard<std::mutex> lock(m_wake_mutex);
+			}
+			m_wake.notify_one();
+		}
 	}
 
-  protected:
-	virtual void sink_it_(const spdlog::details::log_msg &msg) override
+	// Writes every published message, m_mutex must be held
+	size_t Write()
 	{
-		spdlog::details::log_msg_buffer buffer(msg);
-		spdlog::memory_buf_t            formatted;
-		base_sink<std::mutex>::formatter_->format(buffer, formatted);
-		m_log_msgs.push_back({msg.level, fmt::to_string(formatted)});
-		std::cout << fmt::to_string(formatted);
+		size_t count = 0;
+
+		while (m_ring.TryPop(m_msg))
+		{
+			m_formatted.clear();
+			m_formatter->format(m_msg, m_formatted);
+			std::cout.write(m_formatted.data(), m_formatted.size());
+			if (m_file.is_open())
+			{
+				m_file.write(m_formatted.data(), m_formatted.size());
+			}
+			m_batch.push_back({ToLogLevel(m_msg.level), fmt::to_string(m_formatted)});
+			count++;
+		}
+
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		std::cout.flush();
+		if (m_file.is_open())
+		{
+			m_file.flush();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_history_mutex);
+			for (auto &log_msg : m_batch)
+			{
+				m_history.emplace_back(std::move(log_msg));
+			}
+			while (m_history.size() > HistorySize)
+			{
+				m_history.pop_front();
+			}
+		}
+		m_batch.clear();
+
+		return count;
 	}
 
-	virtual void flush_() override
+	void Drain()
 	{
-		std::cout << std::flush;
+		while (true)
+		{
+			size_t count = 0;
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				count = Write();
+			}
+
+			if (count > 0)
+			{
+				continue;
+			}
+
+			// Give producers in the middle of a burst a chance before paying for a sleep and a wake up
+			for (uint32_t i = 0; i < SpinCount && !HasPending(); i++)
+			{
+				std::this_thread::yield();
+			}
+
+			std::unique_lock<std::mutex> lock(m_wake_mutex);
+			m_sleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			m_wake.wait(lock, [this]() { return m_stop.load(std::memory_order_acquire) || HasPending(); });
+			m_sleeping.store(false, std::memory_order_relaxed);
+
+			if (m_stop.load(std::memory_order_acquire) && !HasPending())
+			{
+				break;
+			}
+		}
+	}
+
+	bool HasPending()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+		// A flushing caller owns the ring, go back around and wait for it in Write
+		return !lock.owns_lock() || m_ring.HasPending();
 	}
 
   private:
-	std::deque<LogMsg> m_log_msgs;
+	LogRing m_ring;
+
+	std::atomic<LogSystem::OverflowPolicy> m_policy   = LogSystem::OverflowPolicy::Block;
+	std::atomic<size_t>                    m_dropped  = 0;
+	std::atomic<bool>                      m_sleeping = false;
+	std::atomic<bool>                      m_stop     = false;
+
+	// Consumer state, owned by whoever holds m_mutex: the background thread or a flushing caller
+	std::mutex                         m_mutex;
+	std::unique_ptr<spdlog::formatter> m_formatter;
+	std::ofstream                      m_file;
+	spdlog::details::log_msg_buffer    m_msg;
+	spdlog::memory_buf_t               m_formatted;
+	std::vector<LogSystem::LogMessage> m_batch;
+
+	mutable std::mutex                m_history_mutex;
+	std::deque<LogSystem::LogMessage> m_history;
+
+	std::mutex              m_wake_mutex;
+	std::condition_variable m_wake;
+
+	std::thread m_thread;
 };
 
 LogSystem::LogSystem()
 {
-	m_logger = spdlog::synchronous_factory::create<Sink>("Ilum");
+	m_sink   = std::make_shared<AsyncSink>();
+	m_logger = std::make_shared<spdlog::logger>("Ilum", m_sink);
 
 	m_logger->set_level(spdlog::level::trace);
+	// Fatal messages throw right after logging, make sure they are written out first
+	m_logger->flush_on(spdlog::level::critical);
 }
 
 LogSystem::~LogSystem()
 {
 	m_logger->flush();
-	spdlog::drop_all();
+	m_logger.reset();
+	m_sink.reset();
 }
 
 LogSystem &LogSystem::GetInstance()
@@ -74,4 +378,34 @@ LogSystem &LogSystem::GetInstance()
 	return log_system;
 }
 
+void LogSystem::SetOverflowPolicy(OverflowPolicy policy)
+{
+	m_sink->SetOverflowPolicy(policy);
+}
+
+void LogSystem::SetLogFile(const std::string &path)
+{
+	m_sink->SetLogFile(path);
+}
+
+void LogSystem::Flush()
+{
+	m_logger->flush();
+}
+
+std::vector<LogSystem::LogMessage> LogSystem::CopyLogs() const
+{
+	return m_sink->CopyLogs();
+}
+
+void LogSystem::ClearLogs()
+{
+	m_sink->Clear();
+}
+
+size_t LogSystem::GetDroppedCount() const
+{
+	return m_sink->GetDroppedCount();
+}
+
 }        // namespace Ilum
\ No newline at end of file
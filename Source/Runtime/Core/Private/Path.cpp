@@ -1,5 +1,6 @@
 #include "Path.hpp"
 #include "Core.hpp"
+#include "FileIO.hpp"
 
 namespace Ilum
 {
@@ -186,21 +187,17 @@ const std::string Path::GetRelativePath(const std::string &path)
 	return std::filesystem::relative(path, std::filesystem::current_path()).u8string();
 }
 
-bool Path::Save(const std::string &path, const std::vector<uint8_t> &data, bool binary)
+bool Path::Save(const std::string &path, const std::vector<uint8_t> &data)
 {
-	std::string dir = GetFileDirectory(path);
-	if (!IsExist(dir))
+	if (!FileIO::Write(path, data.data(), data.size()))
 	{
-		CreatePath(dir);
+		LOG_ERROR("Failed to save file {}", path);
+		return false;
 	}
-	std::ofstream output(path, binary ? std::ofstream::binary : 2);
-	output.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(uint8_t));
-	output.flush();
-	output.close();
 	return true;
 }
 
-bool Path::Read(const std::string &path, std::vector<uint8_t> &data, bool binary, uint32_t begin, uint32_t end)
+bool Path::Read(const std::string &path, std::vector<uint8_t> &data, uint32_t begin, uint32_t end)
 {
 	if (!IsFile(path))
 	{
@@ -208,31 +205,21 @@ bool Path::Read(const std::string &path, std::vector<uint8_t> &data, bool binary
 		return false;
 	}
 
-	data.clear();
-
-	std::ifstream file;
-
-	file.open(path, std::ios::in | (binary ? std::ios::binary : 0));
+	size_t offset = begin;
+	size_t size   = end - begin;
 
-	if (!file.is_open())
+	if ((end == begin && begin == 0) || end < begin)
 	{
-		LOG_ERROR("Failed to read file {}", path);
-		return false;
+		offset = 0;
+		size   = 0;
 	}
 
-	uint64_t read_count = end - begin;
-
-	if ((end == begin && begin == 0) || end < begin)
+	if (!FileIO::Read(path, data, offset, size))
 	{
-		file.seekg(0, std::ios::end);
-		read_count = static_cast<uint64_t>(file.tellg());
-		file.seekg(0, std::ios::beg);
+		LOG_ERROR("Failed to read file {}", path);
+		return false;
 	}
 
-	data.resize(static_cast<size_t>(read_count));
-	file.read(reinterpret_cast<char *>(data.data()), read_count);
-	file.close();
-
 	return true;
 }
 
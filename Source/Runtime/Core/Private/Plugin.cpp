@@ -1,12 +1,60 @@
 #include "Plugin.hpp"
 
+#include <mutex>
+
+#ifndef _WIN64
+#	include <dlfcn.h>
+#endif
+
 namespace Ilum
 {
 struct PluginManager::Impl
 {
-	std::unordered_map<std::string, HMODULE> modules;
+	struct Library
+	{
+		void *handle = nullptr;
+
+		std::unordered_map<std::string, void *> symbols;
+	};
+
+	std::unordered_map<std::string, Library> modules;
+
+	// Importers and job graph tasks may load plugins from worker threads
+	std::mutex mutex;
 };
 
+static void *LoadModule(const std::string &lib_path)
+{
+#ifdef _WIN64
+	return LoadLibraryA(lib_path.c_str());
+#else
+	std::string path = lib_path;
+	if (path.size() > 4 && path.compare(path.size() - 4, 4, ".dll") == 0)
+	{
+		path.replace(path.size() - 4, 4, ".so");
+	}
+	return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+}
+
+static void FreeModule(void *handle)
+{
+#ifdef _WIN64
+	FreeLibrary(static_cast<HMODULE>(handle));
+#else
+	dlclose(handle);
+#endif
+}
+
+static void *LoadSymbol(void *handle, const std::string &func_name)
+{
+#ifdef _WIN64
+	return reinterpret_cast<void *>(GetProcAddress(static_cast<HMODULE>(handle), func_name.c_str()));
+#else
+	return dlsym(handle, func_name.c_str());
+#endif
+}
+
 PluginManager::PluginManager()
 {
 	m_impl = new Impl;
@@ -14,9 +62,12 @@ PluginManager::PluginManager()
 
 PluginManager::~PluginManager()
 {
-	for (auto& [name, h_module] : m_impl->modules)
+	for (auto &[name, library] : m_impl->modules)
 	{
-		FreeLibrary(h_module);
+		if (library.handle)
+		{
+			FreeModule(library.handle);
+		}
 	}
 	delete m_impl;
 }
@@ -27,12 +78,28 @@ PluginManager &PluginManager::GetInstance()
 	return plugin_manager;
 }
 
-HMODULE PluginManager::GetLibrary(const std::string &lib_path)
+void *PluginManager::GetSymbol(const std::string &lib_path, const std::string &func_name)
 {
-	if (m_impl->modules.find(lib_path) == m_impl->modules.end())
+	std::lock_guard<std::mutex> lock(m_impl->mutex);
+
+	auto iter = m_impl->modules.find(lib_path);
+	if (iter == m_impl->modules.end())
+	{
+		iter = m_impl->modules.emplace(lib_path, Impl::Library{LoadModule(lib_path)}).first;
+	}
+
+	auto &library = iter->second;
+	if (!library.handle)
+	{
+		return nullptr;
+	}
+
+	auto symbol = library.symbols.find(func_name);
+	if (symbol == library.symbols.end())
 	{
-		m_impl->modules.emplace(lib_path, LoadLibraryA(lib_path.c_str()));
+		symbol = library.symbols.emplace(func_name, LoadSymbol(library.handle, func_name)).first;
 	}
-	return m_impl->modules.at(lib_path);
+
+	return symbol->second;
 }
 }        // namespace Ilum
\ No newline at end of file
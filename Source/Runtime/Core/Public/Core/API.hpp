@@ -1,4 +1,9 @@
 #pragma once
 
-#define EXPORT_API __declspec(dllexport)
-#define IMPORT_API __declspec(dllimport)
+#ifdef _WIN64
+#	define EXPORT_API __declspec(dllexport)
+#	define IMPORT_API __declspec(dllimport)
+#else
+#	define EXPORT_API __attribute__((visibility("default")))
+#	define IMPORT_API
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Container.hpp"
+#include "FileIO.hpp"
 #include "Hash.hpp"
 #include "Log.hpp"
 #include "Path.hpp"
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Precompile.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace Ilum
+{
+class IoRing;
+
+// Background file service
+// Requests run in priority order on an io_uring or on dedicated I/O threads, completion callbacks run on JobSystem workers
+class FileIO
+{
+  public:
+	enum class Backend : uint8_t
+	{
+		// A pool of I/O threads doing blocking reads and writes
+		Threads,
+		// One thread keeping up to IoRing::QueueDepth requests in an io_uring, Linux only
+		Ring
+	};
+
+	enum class Priority : uint8_t
+	{
+		High,
+		Normal,
+		Low
+	};
+
+	using ReadCallback  = std::function<void(bool, std::vector<uint8_t> &&)>;
+	using WriteCallback = std::function<void(bool)>;
+
+	// Files at least this large are memory-mapped instead of read through the CRT
+	static constexpr size_t MapThreshold = 64 << 10;
+
+  public:
+	// Falls back to Backend::Threads where io_uring is unavailable
+	explicit FileIO(Backend backend = Backend::Ring);
+
+	~FileIO();
+
+	static FileIO &GetInstance();
+
+	// Read [offset, offset + size) of a file, size 0 reads to the end of the file
+	static bool Read(const std::string &path, std::vector<uint8_t> &data, size_t offset = 0, size_t size = 0);
+
+	static bool Write(const std::string &path, const uint8_t *data, size_t size);
+
+	void ReadAsync(const std::string &path, ReadCallback &&callback, Priority priority = Priority::Normal);
+
+	void WriteAsync(const std::string &path, std::vector<uint8_t> &&data, WriteCallback &&callback = {}, Priority priority = Priority::Normal);
+
+	// Block until every submitted request and its callback have finished
+	void Wait();
+
+	Backend GetBackend() const;
+
+  private:
+	struct Request
+	{
+		bool                 write = false;
+		std::string          path;
+		std::vector<uint8_t> data;
+		ReadCallback         read_callback;
+		WriteCallback        write_callback;
+	};
+
+	void Submit(Priority priority, std::shared_ptr<Request> &&request);
+
+	void WorkerLoop();
+
+	void RingLoop();
+
+	void Complete(std::shared_ptr<Request> &&request, bool success);
+
+  private:
+	// Ordered by priority first, then by submission
+	std::map<std::pair<Priority, uint64_t>, std::shared_ptr<Request>> m_requests;
+
+	uint64_t m_sequence = 0;
+	// Requests submitted but not completed, including their callbacks
+	size_t m_in_flight = 0;
+	bool   m_stop      = false;
+
+	std::mutex              m_mutex;
+	std::condition_variable m_condition;
+	std::condition_variable m_idle;
+
+	std::unique_ptr<IoRing>  m_ring;
+	std::vector<std::thread> m_workers;
+};
+}        // namespace Ilum
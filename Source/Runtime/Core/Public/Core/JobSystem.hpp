@@ -67,6 +67,195 @@ class RingBuffer
 	SpinLock            m_lock;
 };
 
+// Fixed-size block pool for job bookkeeping, such as future states and dispatch contexts
+// Freed blocks are recycled through an intrusive free list, so steady-state submission never reaches the global heap
+// Requests larger than a block fall back to operator new
+class JobMemoryPool
+{
+  public:
+	static constexpr size_t BlockSize  = 128;
+	static constexpr size_t ChunkBlock = 64;
+
+  public:
+	static JobMemoryPool &GetInstance();
+
+	void *Allocate(size_t size);
+
+	void Free(void *ptr, size_t size);
+
+	// Blocks carved from chunks so far, blocks are never returned to the system
+	size_t GetBlockCount() const;
+
+  private:
+	JobMemoryPool() = default;
+
+	~JobMemoryPool() = default;
+
+  private:
+	struct Block
+	{
+		Block *next;
+	};
+
+	Block                                    *m_free = nullptr;
+	std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+	SpinLock                                  m_lock;
+};
+
+template <typename T>
+class JobAllocator
+{
+  public:
+	using value_type = T;
+
+	JobAllocator() = default;
+
+	template <typename U>
+	JobAllocator(const JobAllocator<U> &)
+	{
+	}
+
+	T *allocate(size_t n)
+	{
+		return static_cast<T *>(JobMemoryPool::GetInstance().Allocate(n * sizeof(T)));
+	}
+
+	void deallocate(T *ptr, size_t n)
+	{
+		JobMemoryPool::GetInstance().Free(ptr, n * sizeof(T));
+	}
+
+	template <typename U>
+	bool operator==(const JobAllocator<U> &) const
+	{
+		return true;
+	}
+
+	template <typename U>
+	bool operator!=(const JobAllocator<U> &) const
+	{
+		return false;
+	}
+};
+
+// Type-erased, move-only task with inline storage
+// Callables that fit in the inline storage never touch the heap, larger ones are placed in the job memory pool
+class Job
+{
+  public:
+	static constexpr size_t StorageSize = 64;
+
+	Job() = default;
+
+	template <typename Task, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Task>, Job>>>
+	Job(Task &&task, const void *tag = nullptr) :
+	    m_tag(tag)
+	{
+		using TaskType = std::decay_t<Task>;
+
+		static_assert(alignof(TaskType) <= alignof(std::max_align_t), "Job task is over-aligned");
+
+		if constexpr (sizeof(TaskType) <= StorageSize)
+		{
+			new (m_storage) TaskType(std::forward<Task>(task));
+
+			m_invoke = [](void *storage) {
+				(*static_cast<TaskType *>(storage))();
+			};
+
+			m_relocate = [](void *dst, void *src) {
+				if (dst)
+				{
+					new (dst) TaskType(std::move(*static_cast<TaskType *>(src)));
+				}
+				static_cast<TaskType *>(src)->~TaskType();
+			};
+		}
+		else
+		{
+			// The inline storage only keeps the pointer, moving the job never moves the task
+			new (m_storage) TaskType *(new (JobMemoryPool::GetInstance().Allocate(sizeof(TaskType))) TaskType(std::forward<Task>(task)));
+
+			m_invoke = [](void *storage) {
+				(**static_cast<TaskType **>(storage))();
+			};
+
+			m_relocate = [](void *dst, void *src) {
+				TaskType *task = *static_cast<TaskType **>(src);
+				if (dst)
+				{
+					new (dst) TaskType *(task);
+				}
+				else
+				{
+					task->~TaskType();
+					JobMemoryPool::GetInstance().Free(task, sizeof(TaskType));
+				}
+			};
+		}
+	}
+
+	~Job();
+
+	Job(const Job &)            = delete;
+	Job &operator=(const Job &) = delete;
+	Job(Job &&other) noexcept;
+	Job &operator=(Job &&other) noexcept;
+
+	explicit operator bool() const;
+
+	void operator()();
+
+	// Identifies the jobs a waiter is allowed to run, usually the handle they belong to
+	const void *GetTag() const;
+
+  private:
+	void Reset();
+
+  private:
+	alignas(std::max_align_t) std::byte m_storage[StorageSize];
+
+	void (*m_invoke)(void *)           = nullptr;
+	void (*m_relocate)(void *, void *) = nullptr;
+
+	const void *m_tag = nullptr;
+};
+
+// Bounded per-worker deque
+// The owner pushes and pops at the bottom (LIFO), other workers steal from the top (FIFO)
+class WorkStealingQueue
+{
+  public:
+	static constexpr size_t Capacity = 1024;
+
+	WorkStealingQueue()  = default;
+	~WorkStealingQueue() = default;
+
+	WorkStealingQueue(const WorkStealingQueue &)            = delete;
+	WorkStealingQueue &operator=(const WorkStealingQueue &) = delete;
+	WorkStealingQueue(WorkStealingQueue &&)                 = delete;
+	WorkStealingQueue &operator=(WorkStealingQueue &&)      = delete;
+
+	// Return false if the queue is full
+	bool Push(Job &&job);
+
+	bool Pop(Job &job);
+
+	bool Steal(Job &job);
+
+	// Steal the oldest job with the given tag, jobs in front of it keep their place
+	bool Steal(Job &job, const void *tag);
+
+	bool Empty() const;
+
+  private:
+	std::array<Job, Capacity> m_jobs;
+	size_t                    m_top    = 0;
+	size_t                    m_bottom = 0;
+	std::atomic<size_t>       m_size   = 0;
+	SpinLock                  m_lock;
+};
+
 class ThreadPool
 {
   public:
@@ -80,34 +269,73 @@ class ThreadPool
 
 	size_t GetThreadCount() const;
 
+	// The shared state of the future comes from the job memory pool
 	template <typename Task, typename... Args>
 	inline auto AddTask(Task &&task, Args &&...args)
 	    -> std::future<decltype(task(args...))>
 	{
 		using return_type = decltype(task(args...));
 
-		auto pack = std::make_shared<std::packaged_task<return_type()>>(
-		    std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
-		m_task_queue.Push([pack]() { (*pack)(); });
+		std::promise<return_type> promise(std::allocator_arg, JobAllocator<return_type>());
 
-		{
-			std::unique_lock<std::mutex> lock(m_mutex);
-			m_condition.notify_one();
-		}
+		auto future = promise.get_future();
+
+		Submit(Job([promise = std::move(promise), task = std::forward<Task>(task), args = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+			try
+			{
+				if constexpr (std::is_void_v<return_type>)
+				{
+					std::apply(task, args);
+					promise.set_value();
+				}
+				else
+				{
+					promise.set_value(std::apply(task, args));
+				}
+			}
+			catch (...)
+			{
+				promise.set_exception(std::current_exception());
+			}
+		}));
 
-		return pack->get_future();
+		return future;
 	}
 
+	// Allocation-free submission
+	// Jobs submitted from a worker go to its own queue, others are distributed round-robin
+	void Submit(Job &&job);
+
+	// Run one queued job on the calling thread, return false if there is nothing to do
+	// Threads outside the pool only run jobs with the given tag, so waiting never picks up unrelated long jobs
+	bool RunPendingJob(const void *tag = nullptr);
+
 	void WaitAll();
 
   private:
-	RingBuffer<std::function<void()>, 1024>           m_task_queue;
-	std::unordered_map<std::thread::id, const char *> m_thread_names;
+	void WorkerLoop(uint32_t index);
+
+	bool TryAcquire(uint32_t index, Job &job);
+
+	bool TryAcquire(const void *tag, Job &job);
 
-	std::vector<std::thread> m_workers;
-	std::mutex               m_mutex;
-	std::atomic<bool>        m_stop = false;
-	std::condition_variable  m_condition;
+	void Run(Job &job);
+
+  private:
+	std::vector<std::unique_ptr<WorkStealingQueue>> m_queues;
+	std::vector<std::thread>                        m_workers;
+
+	// Jobs waiting in queues
+	std::atomic<size_t> m_pending = 0;
+	// Jobs submitted but not finished yet
+	std::atomic<size_t> m_unfinished = 0;
+
+	std::atomic<uint32_t> m_next_queue = 0;
+	std::atomic<uint32_t> m_sleeping   = 0;
+
+	std::mutex              m_mutex;
+	std::atomic<bool>       m_stop = false;
+	std::condition_variable m_condition;
 };
 
 class JobNode
@@ -182,6 +410,8 @@ class JobSystem
   public:
 	JobSystem();
 
+	explicit JobSystem(uint32_t thread_count);
+
 	~JobSystem();
 
 	static JobSystem &GetInstance();
@@ -197,23 +427,48 @@ class JobSystem
 	inline auto ExecuteAsync(Task &&task, Args &&...args)
 	    -> std::future<decltype(task(args...))>
 	{
-		return m_thread_pool->AddTask([task, args...]() {
-			return task(std::forward<Args>(args)...);
-		});
+		return m_thread_pool->AddTask(std::forward<Task>(task), std::forward<Args>(args)...);
 	}
 
+	// Using dispatch method, task need group id as parameter
+	// Groups share one copy of the task, stored in a context from the job memory pool and released by the last group
 	template <typename Task>
-	inline auto ExecuteAsync(Task &&task)
-	    -> std::future<decltype(task())>
+	void Dispatch(JobHandle &handle, uint32_t job_count, uint32_t group_size, Task &&task)
 	{
-		return m_thread_pool->AddTask([task]() {
-			return task();
-		});
+		struct DispatchContext
+		{
+			std::decay_t<Task>    task;
+			std::atomic<uint32_t> remaining;
+		};
+
+		uint32_t group_count = (job_count + group_size - 1) / group_size;
+
+		if (group_count == 0)
+		{
+			return;
+		}
+
+		auto *context = new (JobMemoryPool::GetInstance().Allocate(sizeof(DispatchContext))) DispatchContext{std::forward<Task>(task), group_count};
+
+		handle.m_counter.fetch_add(group_count);
+
+		for (uint32_t group_id = 0; group_id < group_count; group_id++)
+		{
+			m_thread_pool->Submit(Job([context, &handle, group_id]() {
+				context->task(group_id);
+				if (context->remaining.fetch_sub(1) == 1)
+				{
+					context->~DispatchContext();
+					JobMemoryPool::GetInstance().Free(context, sizeof(DispatchContext));
+				}
+				handle.m_counter.fetch_sub(1);
+			}, &handle));
+		}
 	}
 
-	// Using dispatch method, task need group id as parameter
-	void Dispatch(JobHandle &handle, uint32_t job_count, uint32_t group_size, const std::function<void(uint32_t)> &task);
 	bool IsBusy(const JobHandle &handle);
+
+	// Workers help with any queued job while waiting, other threads only with jobs of this handle
 	void Wait(const JobHandle &handle);
 	void WaitAll();
 
@@ -6,6 +6,8 @@
 
 namespace Ilum
 {
+class AsyncSink;
+
 class  LogSystem final
 {
   public:
@@ -18,6 +20,19 @@ class  LogSystem final
 		Fatal
 	};
 
+	// What producers do when the log ring is full
+	enum class OverflowPolicy : uint8_t
+	{
+		Block,
+		Drop
+	};
+
+	struct LogMessage
+	{
+		LogLevel    level;
+		std::string msg;
+	};
+
   public:
 	LogSystem();
 
@@ -25,6 +40,21 @@ class  LogSystem final
 
 	static LogSystem &GetInstance();
 
+	void SetOverflowPolicy(OverflowPolicy policy);
+
+	// Mirror every message into a file, an empty path closes the file
+	void SetLogFile(const std::string &path);
+
+	// Wait until every message logged so far has reached the sinks
+	void Flush();
+
+	// Recent messages kept for the editor, thread safe
+	std::vector<LogMessage> CopyLogs() const;
+
+	void ClearLogs();
+
+	size_t GetDroppedCount() const;
+
 	template <typename... Args>
 	void Log(LogLevel level, Args &&...args)
 	{
@@ -52,6 +82,7 @@ class  LogSystem final
 	}
 
   private:
+	std::shared_ptr<AsyncSink>      m_sink;
 	std::shared_ptr<spdlog::logger> m_logger;
 };
 }        // namespace Ilum
\ No newline at end of file
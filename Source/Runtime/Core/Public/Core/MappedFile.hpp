@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Precompile.hpp"
+
+namespace Ilum
+{
+// Read-only memory mapping of a whole file
+class MappedFile
+{
+  public:
+	MappedFile() = default;
+
+	explicit MappedFile(const std::string &path);
+
+	~MappedFile();
+
+	MappedFile(const MappedFile &)            = delete;
+	MappedFile &operator=(const MappedFile &) = delete;
+	MappedFile(MappedFile &&other) noexcept;
+	MappedFile &operator=(MappedFile &&other) noexcept;
+
+	bool Open(const std::string &path);
+
+	void Close();
+
+	bool IsValid() const;
+
+	const uint8_t *GetData() const;
+
+	size_t GetSize() const;
+
+  private:
+	const uint8_t *m_data = nullptr;
+	size_t         m_size = 0;
+
+	void *m_file    = nullptr;
+	void *m_mapping = nullptr;
+};
+}        // namespace Ilum
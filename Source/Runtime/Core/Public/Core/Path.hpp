@@ -23,8 +23,10 @@ class  Path
 	const std::string GetFileExtension(const std::string &path);
 	const std::string GetRelativePath(const std::string &path);
 
-	bool Save(const std::string &path, const std::vector<uint8_t> &data, bool binary = false);
-	bool Read(const std::string &path, std::vector<uint8_t> &data, bool binary = false, uint32_t begin = 0, uint32_t end = 0);
+	// Files are always accessed in binary mode, reads of large files are memory-mapped
+	// Use FileIO for asynchronous access
+	bool Save(const std::string &path, const std::vector<uint8_t> &data);
+	bool Read(const std::string &path, std::vector<uint8_t> &data, uint32_t begin = 0, uint32_t end = 0);
 
 	std::string Toupper(const std::string &str);
 	std::string Replace(const std::string &str, char from, char to);
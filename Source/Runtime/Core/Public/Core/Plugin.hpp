@@ -7,12 +7,13 @@
 #ifdef _WIN64
 #	include <Windows.h>
 #	include <libloaderapi.h>
-#else
-#	error("Windows only for now")
 #endif
 
 namespace Ilum
 {
+template <typename Signature>
+class PluginFunction;
+
 class  PluginManager
 {
   public:
@@ -22,16 +23,52 @@ class  PluginManager
 
 	static PluginManager &GetInstance();
 
+	// Library paths use the Windows ".dll" name, other platforms load the matching ".so"
 	template <typename _Ty = void, typename... Args>
 	_Ty Call(const std::string &lib_path, const std::string &func_name, Args... args)
 	{
-		typedef _Ty(CALLBACK * FUNC)(Args...);
+		return PluginFunction<_Ty(Args...)>(GetSymbol(lib_path, func_name))(args...);
+	}
+
+	// Resolve a function once, calls through the handle skip the lookup entirely
+	template <typename Signature>
+	PluginFunction<Signature> GetFunction(const std::string &lib_path, const std::string &func_name)
+	{
+		return PluginFunction<Signature>(GetSymbol(lib_path, func_name));
+	}
+
+	// Cached per library, return nullptr if the library or the symbol is missing
+	void *GetSymbol(const std::string &lib_path, const std::string &func_name);
+
+  private:
+	struct Impl;
+	Impl *m_impl = nullptr;
+};
 
-		auto lib_handle = GetLibrary(lib_path);
+// Typed handle to a plugin function
+// Calling a missing function does nothing and returns a default value
+template <typename _Ty, typename... Args>
+class PluginFunction<_Ty(Args...)>
+{
+  public:
+	using FunctionType = _Ty (*)(Args...);
 
-		auto func = (FUNC) GetProcAddress(lib_handle, func_name.c_str());
+  public:
+	PluginFunction() = default;
 
-		if (!func)
+	explicit PluginFunction(void *symbol) :
+	    m_function(reinterpret_cast<FunctionType>(symbol))
+	{
+	}
+
+	explicit operator bool() const
+	{
+		return m_function != nullptr;
+	}
+
+	_Ty operator()(Args... args) const
+	{
+		if (!m_function)
 		{
 			if constexpr (std::is_same_v<_Ty, void>)
 			{
@@ -43,26 +80,10 @@ class  PluginManager
 			}
 		}
 
-		if constexpr (std::is_same_v<_Ty, void>)
-		{
-			func(args...);
-			return;
-		}
-		else if constexpr (sizeof...(Args) == 0)
-		{
-			return func();
-		}
-		else
-		{
-			return func(args...);
-		}
+		return m_function(args...);
 	}
 
   private:
-	HMODULE GetLibrary(const std::string &lib_path);
-
-  private:
-	struct Impl;
-	Impl *m_impl = nullptr;
+	FunctionType m_function = nullptr;
 };
 }        // namespace Ilum
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "Frustum.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	include <xmmintrin.h>
+#	define FRUSTUM_SIMD
+#endif
+
+namespace Ilum
+{
+Frustum::Frustum(const glm::mat4 &view_projection)
+{
+	glm::mat4 matrix = glm::transpose(view_projection);
+
+	planes[0] = matrix[3] + matrix[0];        // Left
+	planes[1] = matrix[3] - matrix[0];        // Right
+	planes[2] = matrix[3] - matrix[1];        // Top
+	planes[3] = matrix[3] + matrix[1];        // Bottom
+	planes[4] = matrix[3] + matrix[2];        // Near
+	planes[5] = matrix[3] - matrix[2];        // Far
+
+	for (auto &plane : planes)
+	{
+		plane /= glm::length(glm::vec3(plane));
+	}
+}
+
+bool Frustum::Intersect(const AABB &aabb) const
+{
+	for (auto &plane : planes)
+	{
+		// Corner furthest along the plane normal
+		glm::vec3 corner = glm::mix(aabb.min, aabb.max, glm::greaterThan(glm::vec3(plane), glm::vec3(0.f)));
+		if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void Frustum::Intersect(const AABB *aabbs, size_t count, size_t stride, uint8_t *visible) const
+{
+	const uint8_t *data = reinterpret_cast<const uint8_t *>(aabbs);
+
+#ifdef FRUSTUM_SIMD
+	// Planes as structure of arrays, padded to eight with a plane every box passes
+	alignas(16) float plane_data[4][8] = {};
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		glm::vec4 plane  = i < 6 ? planes[i] : glm::vec4(0.f, 0.f, 0.f, 1.f);
+		plane_data[0][i] = plane.x;
+		plane_data[1][i] = plane.y;
+		plane_data[2][i] = plane.z;
+		plane_data[3][i] = plane.w;
+	}
+
+	const __m128 sign_mask = _mm_set1_ps(-0.f);
+
+	__m128 nx[2], ny[2], nz[2], nw[2], ax[2], ay[2], az[2];
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		nx[i] = _mm_load_ps(&plane_data[0][i * 4]);
+		ny[i] = _mm_load_ps(&plane_data[1][i * 4]);
+		nz[i] = _mm_load_ps(&plane_data[2][i * 4]);
+		nw[i] = _mm_load_ps(&plane_data[3][i * 4]);
+		ax[i] = _mm_andnot_ps(sign_mask, nx[i]);
+		ay[i] = _mm_andnot_ps(sign_mask, ny[i]);
+		az[i] = _mm_andnot_ps(sign_mask, nz[i]);
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const AABB &aabb = *reinterpret_cast<const AABB *>(data + i * stride);
+
+		glm::vec3 center = (aabb.max + aabb.min) * 0.5f;
+		glm::vec3 extent = (aabb.max - aabb.min) * 0.5f;
+
+		__m128 cx = _mm_set1_ps(center.x);
+		__m128 cy = _mm_set1_ps(center.y);
+		__m128 cz = _mm_set1_ps(center.z);
+		__m128 ex = _mm_set1_ps(extent.x);
+		__m128 ey = _mm_set1_ps(extent.y);
+		__m128 ez = _mm_set1_ps(extent.z);
+
+		int outside = 0;
+		for (uint32_t j = 0; j < 2; j++)
+		{
+			// Signed distance of the center plus the extent projected on the normal, same as testing the furthest corner
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[j], cx), _mm_mul_ps(ny[j], cy)), _mm_add_ps(_mm_mul_ps(nz[j], cz), nw[j]));
+			__m128 radius   = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[j], ex), _mm_mul_ps(ay[j], ey)), _mm_mul_ps(az[j], ez));
+			outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+		}
+
+		visible[i] = outside == 0;
+	}
+#else
+	for (size_t i = 0; i < count; i++)
+	{
+		visible[i] = Intersect(*reinterpret_cast<const AABB *>(data + i * stride));
+	}
+#endif
+}
+}        // namespace Ilum
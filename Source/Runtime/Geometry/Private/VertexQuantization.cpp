@@ -0,0 +1,65 @@
+#include "VertexQuantization.hpp"
+
+#include <glm/gtc/packing.hpp>
+
+namespace Ilum
+{
+uint32_t EncodeOctahedral(const glm::vec3 &v)
+{
+	glm::vec3 n = v / (glm::abs(v.x) + glm::abs(v.y) + glm::abs(v.z) + 1e-12f);
+
+	glm::vec2 oct = glm::vec2(n.x, n.y);
+	if (n.z < 0.f)
+	{
+		oct = (1.f - glm::abs(glm::vec2(n.y, n.x))) * glm::vec2(n.x >= 0.f ? 1.f : -1.f, n.y >= 0.f ? 1.f : -1.f);
+	}
+
+	return glm::packSnorm2x16(oct);
+}
+
+glm::vec3 DecodeOctahedral(uint32_t packed)
+{
+	glm::vec2 oct = glm::unpackSnorm2x16(packed);
+	glm::vec3 n   = glm::vec3(oct.x, oct.y, 1.f - glm::abs(oct.x) - glm::abs(oct.y));
+	float     t   = glm::clamp(-n.z, 0.f, 1.f);
+
+	n.x += n.x >= 0.f ? -t : t;
+	n.y += n.y >= 0.f ? -t : t;
+
+	return glm::normalize(n);
+}
+
+uint32_t EncodeHalf2(const glm::vec2 &v)
+{
+	return glm::packHalf2x16(v);
+}
+
+glm::vec2 DecodeHalf2(uint32_t packed)
+{
+	return glm::unpackHalf2x16(packed);
+}
+
+void EncodePosition(const glm::vec3 &position, const glm::vec3 &offset, const glm::vec3 &scale, uint16_t *packed)
+{
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		float v   = scale[i] > 0.f ? (position[i] - offset[i]) / scale[i] : 0.f;
+		packed[i] = static_cast<uint16_t>(glm::round(glm::clamp(v, 0.f, 1.f) * 65535.f));
+	}
+}
+
+glm::vec3 DecodePosition(const uint16_t *packed, const glm::vec3 &offset, const glm::vec3 &scale)
+{
+	return offset + glm::vec3(packed[0], packed[1], packed[2]) / 65535.f * scale;
+}
+
+uint8_t EncodeUnorm8(float v)
+{
+	return static_cast<uint8_t>(glm::round(glm::clamp(v, 0.f, 1.f) * 255.f));
+}
+
+float DecodeUnorm8(uint8_t packed)
+{
+	return static_cast<float>(packed) / 255.f;
+}
+}        // namespace Ilum
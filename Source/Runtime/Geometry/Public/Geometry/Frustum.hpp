@@ -0,0 +1,27 @@
+#pragma once
+
+#include "AABB.hpp"
+
+#include <array>
+
+namespace Ilum
+{
+struct Frustum
+{
+  public:
+	// Left, right, top, bottom, near, far, normalized and facing inwards
+	std::array<glm::vec4, 6> planes = {};
+
+  public:
+	Frustum() = default;
+
+	explicit Frustum(const glm::mat4 &view_projection);
+
+	~Frustum() = default;
+
+	bool Intersect(const AABB &aabb) const;
+
+	// Batch test over boxes laid out stride bytes apart, visible receives one flag per box
+	void Intersect(const AABB *aabbs, size_t count, size_t stride, uint8_t *visible) const;
+};
+}        // namespace Ilum
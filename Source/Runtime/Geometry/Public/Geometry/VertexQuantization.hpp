@@ -0,0 +1,28 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Ilum
+{
+// Encoding helpers for compact vertex layouts
+// Shader side decoding lives in Source/Shaders/Common.hlsli and must stay in sync
+
+// Unit vector -> octahedral snorm16x2, x in the low half
+uint32_t EncodeOctahedral(const glm::vec3 &v);
+
+glm::vec3 DecodeOctahedral(uint32_t packed);
+
+// Two floats -> half2, x in the low half
+uint32_t EncodeHalf2(const glm::vec2 &v);
+
+glm::vec2 DecodeHalf2(uint32_t packed);
+
+// Position -> unorm16x3 relative to offset and scale, usually the mesh bounding box
+void EncodePosition(const glm::vec3 &position, const glm::vec3 &offset, const glm::vec3 &scale, uint16_t *packed);
+
+glm::vec3 DecodePosition(const uint16_t *packed, const glm::vec3 &offset, const glm::vec3 &scale);
+
+uint8_t EncodeUnorm8(float v);
+
+float DecodeUnorm8(uint8_t packed);
+}        // namespace Ilum
@@ -1,7 +1,6 @@
 #include "RHIAccelerationStructure.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -12,6 +11,6 @@ RHIAccelerationStructure::RHIAccelerationStructure(RHIDevice *device):
 
 std::unique_ptr<RHIAccelerationStructure> RHIAccelerationStructure::Create(RHIDevice *rhi_device)
 {
-	return std::unique_ptr<RHIAccelerationStructure>(std::move(PluginManager::GetInstance().Call<RHIAccelerationStructure *>(fmt::format("RHI.{}.dll", rhi_device->GetBackend()), "CreateAccelerationStructure", rhi_device)));
+	return std::unique_ptr<RHIAccelerationStructure>(rhi_device->GetPlugin().create_acceleration_structure(rhi_device));
 }
 }        // namespace Ilum
\ No newline at end of file
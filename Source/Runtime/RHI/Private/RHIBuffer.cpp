@@ -1,7 +1,6 @@
 #include "RHIBuffer.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -17,11 +16,16 @@ const std::string RHIBuffer::GetBackend() const
 
 std::unique_ptr<RHIBuffer> RHIBuffer::Create(RHIDevice *device, const BufferDesc &desc)
 {
-	return std::unique_ptr<RHIBuffer>(std::move(PluginManager::GetInstance().Call<RHIBuffer *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateBuffer", device, desc)));
+	return std::unique_ptr<RHIBuffer>(device->GetPlugin().create_buffer(device, desc));
 }
 
 const BufferDesc &RHIBuffer::GetDesc() const
 {
 	return m_desc;
 }
+
+std::unique_ptr<RHIBuffer> RHIBuffer::Alias(const BufferDesc &desc, size_t offset)
+{
+	return nullptr;
+}
 }        // namespace Ilum
\ No newline at end of file
@@ -1,7 +1,6 @@
 #include "RHICommand.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -33,7 +32,7 @@ void RHICommand::Init()
 
 std::unique_ptr<RHICommand> RHICommand::Create(RHIDevice *device, RHIQueueFamily family)
 {
-	return std::unique_ptr<RHICommand>(std::move(PluginManager::GetInstance().Call<RHICommand *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateCommand", device, family)));
+	return std::unique_ptr<RHICommand>(device->GetPlugin().create_command(device, family));
 }
 
 }        // namespace Ilum
\ No newline at end of file
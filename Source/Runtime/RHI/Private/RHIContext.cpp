@@ -18,7 +18,10 @@ RHIContext::RHIContext(Window *window, const std::string &backend, bool vsync) :
 
 	m_device = RHIDevice::Create(backend);
 
-	m_swapchain = RHISwapchain::Create(m_device.get(), p_window->GetNativeHandle(), p_window->GetWidth(), p_window->GetHeight(), m_vsync);
+	if (p_window)
+	{
+		m_swapchain = RHISwapchain::Create(m_device.get(), p_window->GetNativeHandle(), p_window->GetWidth(), p_window->GetHeight(), m_vsync);
+	}
 
 	m_queue = RHIQueue::Create(m_device.get());
 
@@ -27,7 +30,7 @@ RHIContext::RHIContext(Window *window, const std::string &backend, bool vsync) :
 		m_cuda_queue = RHIQueue::Create(m_cuda_device.get());
 	}
 
-	for (uint32_t i = 0; i < m_swapchain->GetTextureCount(); i++)
+	for (uint32_t i = 0; i < GetFrameCount(); i++)
 	{
 		m_frames.emplace_back(RHIFrame::Create(m_device.get()));
 
@@ -72,6 +75,11 @@ const std::string &RHIContext::GetDeviceName() const
 	return m_device->GetName();
 }
 
+RHIDevice *RHIContext::GetDevice() const
+{
+	return m_device.get();
+}
+
 const std::string RHIContext::GetBackend() const
 {
 	return m_device->GetBackend();
@@ -102,6 +110,11 @@ void RHIContext::WaitIdle() const
 	m_device->WaitIdle();
 }
 
+UploadStatistics RHIContext::GetUploadStatistics() const
+{
+	return m_device->GetUploadStatistics();
+}
+
 RHISwapchain *RHIContext::GetSwapchain() const
 {
 	return m_swapchain.get();
@@ -137,11 +150,21 @@ std::unique_ptr<RHITexture> RHIContext::CreateTexture2DArray(uint32_t width, uin
 	return RHITexture::Create2DArray(m_device.get(), width, height, layers, format, usage, mipmap, samples);
 }
 
+std::unique_ptr<RHITexture> RHIContext::CreateTextureHeap(size_t size, const std::vector<TextureDesc> &descs)
+{
+	return RHITexture::CreateHeap(m_device.get(), size, descs);
+}
+
+size_t RHIContext::GetTextureMemorySize(const TextureDesc &desc)
+{
+	return RHITexture::QueryMemorySize(m_device.get(), desc);
+}
+
 std::unique_ptr<RHITexture> RHIContext::MapToCUDATexture(RHITexture *texture)
 {
 	if (m_cuda_device)
 	{
-		HANDLE mem_handle = PluginManager::GetInstance().Call<HANDLE>(fmt::format("RHI.{}.dll", m_device->GetBackend()), "GetTextureMemHandle", m_device.get(), texture);
+		void *mem_handle = PluginManager::GetInstance().Call<void *>(fmt::format("RHI.{}.dll", m_device->GetBackend()), "GetTextureMemHandle", m_device.get(), texture);
 		return std::unique_ptr<RHITexture>(std::move(PluginManager::GetInstance().Call<RHITexture *>("RHI.CUDA.dll", fmt::format("MapTexture{}ToCUDA", m_device->GetBackend()), m_device.get(), texture->GetDesc(), mem_handle, texture->GetMemorySize())));
 	}
 	return nullptr;
@@ -166,7 +189,7 @@ std::unique_ptr<RHIBuffer> RHIContext::MapToCUDABuffer(RHIBuffer *buffer)
 {
 	if (m_cuda_device)
 	{
-		HANDLE mem_handle = PluginManager::GetInstance().Call<HANDLE>(fmt::format("RHI.{}.dll", m_device->GetBackend()), "GetBufferMemHandle", m_device.get(), buffer);
+		void *mem_handle = PluginManager::GetInstance().Call<void *>(fmt::format("RHI.{}.dll", m_device->GetBackend()), "GetBufferMemHandle", m_device.get(), buffer);
 		return std::unique_ptr<RHIBuffer>(std::move(PluginManager::GetInstance().Call<RHIBuffer *>("RHI.CUDA.dll", fmt::format("MapBuffer{}ToCUDA", m_device->GetBackend()), m_device.get(), buffer->GetDesc(), mem_handle)));
 	}
 	return nullptr;
@@ -234,7 +257,7 @@ std::unique_ptr<RHIRenderTarget> RHIContext::CreateRenderTarget(bool cuda)
 
 std::unique_ptr<RHIProfiler> RHIContext::CreateProfiler(bool cuda)
 {
-	return RHIProfiler::Create(cuda ? m_cuda_device.get() : m_device.get(), m_swapchain->GetTextureCount());
+	return RHIProfiler::Create(cuda ? m_cuda_device.get() : m_device.get(), GetFrameCount());
 }
 
 std::unique_ptr<RHIFence> RHIContext::CreateFence()
@@ -261,7 +284,7 @@ std::unique_ptr<RHISemaphore> RHIContext::MapToCUDASemaphore(RHISemaphore *semap
 {
 	if (m_cuda_device)
 	{
-		HANDLE mem_handle = PluginManager::GetInstance().Call<HANDLE>(fmt::format("RHI.{}.dll", m_device->GetBackend()), "GetSemaphoreHandle", m_device.get(), semaphore);
+		void *mem_handle = PluginManager::GetInstance().Call<void *>(fmt::format("RHI.{}.dll", m_device->GetBackend()), "GetSemaphoreHandle", m_device.get(), semaphore);
 		return std::unique_ptr<RHISemaphore>(std::move(PluginManager::GetInstance().Call<RHISemaphore *>("RHI.CUDA.dll", fmt::format("MapSemaphore{}ToCUDA", m_device->GetBackend()), m_device.get(), mem_handle)));
 	}
 	return nullptr;
@@ -291,6 +314,8 @@ void RHIContext::Execute(RHICommand *cmd_buffer)
 	}
 	else
 	{
+		// Immediate executions see everything uploaded so far
+		m_device->FlushUploads();
 		m_queue->Execute(cmd_buffer);
 	}
 }
@@ -310,6 +335,7 @@ void RHIContext::Execute(std::vector<RHICommand *> &&cmd_buffers, std::vector<RH
 	}
 	else
 	{
+		m_device->FlushUploads();
 		m_queue->Execute(submit_info.queue_family, {submit_info}, fence);
 	}
 }
@@ -321,20 +347,36 @@ void RHIContext::Reset()
 
 RHITexture *RHIContext::GetBackBuffer()
 {
-	return m_swapchain->GetCurrentTexture();
+	return m_swapchain ? m_swapchain->GetCurrentTexture() : nullptr;
+}
+
+uint32_t RHIContext::GetFrameCount() const
+{
+	return m_swapchain ? m_swapchain->GetTextureCount() : HeadlessFrameCount;
+}
+
+uint32_t RHIContext::GetCurrentFrame() const
+{
+	return m_swapchain ? m_swapchain->GetCurrentFrameIndex() : m_current_frame;
 }
 
 void RHIContext::BeginFrame()
 {
-	m_swapchain->AcquireNextTexture(m_present_complete[m_current_frame].get(), nullptr);
+	if (m_swapchain)
+	{
+		m_swapchain->AcquireNextTexture(m_present_complete[m_current_frame].get(), nullptr);
+	}
 	m_frames[m_current_frame]->Reset();
 }
 
 void RHIContext::EndFrame()
 {
+	// Uploads of the whole frame go out as one batch ahead of its submissions
+	m_device->FlushUploads();
+
 	if (!m_submit_infos.empty())
 	{
-		for (int32_t i = static_cast<int32_t>(m_submit_infos.size()) - 1; i >= 0; i--)
+		for (int32_t i = static_cast<int32_t>(m_submit_infos.size()) - 1; i >= 0 && m_swapchain; i--)
 		{
 			if (!m_submit_infos[i].is_cuda)
 			{
@@ -374,16 +416,16 @@ void RHIContext::EndFrame()
 		m_submit_infos.clear();
 	}
 
-	if (!m_swapchain->Present(m_render_complete[m_current_frame].get()) ||
+	if (m_swapchain && (!m_swapchain->Present(m_render_complete[m_current_frame].get()) ||
 	    p_window->GetWidth() != m_swapchain->GetWidth() ||
 	    p_window->GetHeight() != m_swapchain->GetHeight() ||
-	    m_vsync != m_swapchain->GetVsync())
+	    m_vsync != m_swapchain->GetVsync()))
 	{
 		m_swapchain->Resize(p_window->GetWidth(), p_window->GetHeight(), m_vsync);
 		LOG_INFO("Swapchain resize to {} x {}", p_window->GetWidth(), p_window->GetHeight());
 	}
 
-	m_current_frame = (m_current_frame + 1) % m_swapchain->GetTextureCount();
+	m_current_frame = (m_current_frame + 1) % GetFrameCount();
 }
 
 }        // namespace Ilum
\ No newline at end of file
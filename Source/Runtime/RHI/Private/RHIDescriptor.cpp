@@ -1,7 +1,6 @@
 #include "RHI/RHIDescriptor.hpp"
 #include "RHI/RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHI/RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -17,6 +16,6 @@ const ShaderMeta &RHIDescriptor::GetShaderMeta() const
 
 std::unique_ptr<RHIDescriptor> RHIDescriptor::Create(RHIDevice *device, const ShaderMeta &meta)
 {
-	return std::unique_ptr<RHIDescriptor>(std::move(PluginManager::GetInstance().Call<RHIDescriptor *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateDescriptor", device, meta)));
+	return std::unique_ptr<RHIDescriptor>(device->GetPlugin().create_descriptor(device, meta));
 }
 }        // namespace Ilum
\ No newline at end of file
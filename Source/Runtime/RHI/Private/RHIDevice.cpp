@@ -1,17 +1,16 @@
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
 RHIDevice::RHIDevice(const std::string &backend) :
-    m_backend(backend)
+    m_backend(backend), p_plugin(&RHIPlugin::Get(backend))
 {
 }
 
 std::unique_ptr<RHIDevice> RHIDevice::Create(const std::string &backend)
 {
-	return std::unique_ptr<RHIDevice>(std::move(PluginManager::GetInstance().Call<RHIDevice *>(fmt::format("shared/RHI/RHI.{}.dll", backend), "CreateDevice")));
+	return std::unique_ptr<RHIDevice>(RHIPlugin::Get(backend).create_device());
 }
 
 const std::string &RHIDevice::GetName() const
@@ -23,4 +22,18 @@ const std::string RHIDevice::GetBackend() const
 {
 	return m_backend;
 }
+
+const RHIPlugin &RHIDevice::GetPlugin() const
+{
+	return *p_plugin;
+}
+
+UploadStatistics RHIDevice::GetUploadStatistics() const
+{
+	return UploadStatistics{};
+}
+
+void RHIDevice::FlushUploads()
+{
+}
 }        // namespace Ilum
\ No newline at end of file
@@ -1,7 +1,6 @@
 #include "RHIFrame.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -12,6 +11,6 @@ RHIFrame::RHIFrame(RHIDevice *device) :
 
 std::unique_ptr<RHIFrame> RHIFrame::Create(RHIDevice *device)
 {
-	return std::unique_ptr<RHIFrame>(std::move(PluginManager::GetInstance().Call<RHIFrame *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateFrame", device)));
+	return std::unique_ptr<RHIFrame>(device->GetPlugin().create_frame(device));
 }
 }        // namespace Ilum
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "RHIPipelineState.hpp"
 #include "RHIDevice.hpp"
+#include "RHIPlugin.hpp"
 
 #include <Core/Hash.hpp>
-#include <Core/Plugin.hpp>
 
 namespace Ilum
 {
@@ -13,7 +13,7 @@ RHIPipelineState::RHIPipelineState(RHIDevice *device) :
 
 std::unique_ptr<RHIPipelineState> RHIPipelineState::Create(RHIDevice *device)
 {
-	return std::unique_ptr<RHIPipelineState>(std::move(PluginManager::GetInstance().Call<RHIPipelineState *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreatePipelineState", device)));
+	return std::unique_ptr<RHIPipelineState>(device->GetPlugin().create_pipeline_state(device));
 }
 
 RHIPipelineState &RHIPipelineState::SetShader(RHIShaderStage stage, RHIShader *shader)
@@ -0,0 +1,48 @@
+#include "RHIPlugin.hpp"
+
+#include <mutex>
+
+namespace Ilum
+{
+const RHIPlugin &RHIPlugin::Get(const std::string &backend)
+{
+	static std::mutex                                                  mutex;
+	static std::unordered_map<std::string, std::unique_ptr<RHIPlugin>> plugins;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto &plugin = plugins[backend];
+	if (!plugin)
+	{
+		std::string path = fmt::format("shared/RHI/RHI.{}.dll", backend);
+
+		// Each handle takes its signature from the member it is stored in
+		auto resolve = [&path](auto &function, const char *name) {
+			function = std::decay_t<decltype(function)>(PluginManager::GetInstance().GetSymbol(path, name));
+		};
+
+		plugin = std::make_unique<RHIPlugin>();
+
+		resolve(plugin->create_device, "CreateDevice");
+		resolve(plugin->create_frame, "CreateFrame");
+		resolve(plugin->create_swapchain, "CreateSwapchain");
+		resolve(plugin->create_queue, "CreateQueue");
+		resolve(plugin->create_command, "CreateCommand");
+		resolve(plugin->create_buffer, "CreateBuffer");
+		resolve(plugin->create_texture, "CreateTexture");
+		resolve(plugin->create_texture_heap, "CreateTextureHeap");
+		resolve(plugin->get_texture_memory_size, "GetTextureMemorySize");
+		resolve(plugin->create_sampler, "CreateSampler");
+		resolve(plugin->create_shader, "CreateShader");
+		resolve(plugin->create_render_target, "CreateRenderTarget");
+		resolve(plugin->create_fence, "CreateFence");
+		resolve(plugin->create_semaphore, "CreateSemaphore");
+		resolve(plugin->create_descriptor, "CreateDescriptor");
+		resolve(plugin->create_pipeline_state, "CreatePipelineState");
+		resolve(plugin->create_profiler, "CreateProfiler");
+		resolve(plugin->create_acceleration_structure, "CreateAccelerationStructure");
+	}
+
+	return *plugin;
+}
+}        // namespace Ilum
\ No newline at end of file
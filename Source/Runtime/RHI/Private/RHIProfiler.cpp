@@ -1,7 +1,6 @@
 #include "RHIProfiler.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -12,7 +11,7 @@ RHIProfiler::RHIProfiler(RHIDevice *device, uint32_t frame_count) :
 
 std::unique_ptr<RHIProfiler> RHIProfiler::Create(RHIDevice *device, uint32_t frame_count)
 {
-	return std::unique_ptr<RHIProfiler>(std::move(PluginManager::GetInstance().Call<RHIProfiler *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateProfiler", device, frame_count)));
+	return std::unique_ptr<RHIProfiler>(device->GetPlugin().create_profiler(device, frame_count));
 }
 
 const ProfileState &RHIProfiler::GetProfileState() const
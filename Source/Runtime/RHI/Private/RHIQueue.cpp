@@ -1,7 +1,6 @@
 #include "RHIQueue.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -11,6 +10,6 @@ RHIQueue::RHIQueue(RHIDevice *device)
 
 std::unique_ptr<RHIQueue> RHIQueue::Create(RHIDevice *device)
 {
-	return std::unique_ptr<RHIQueue>(std::move(PluginManager::GetInstance().Call<RHIQueue *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateQueue", device)));
+	return std::unique_ptr<RHIQueue>(device->GetPlugin().create_queue(device));
 }
 }        // namespace Ilum
\ No newline at end of file
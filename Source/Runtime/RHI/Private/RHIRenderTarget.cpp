@@ -1,7 +1,6 @@
 #include "RHIRenderTarget.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -12,7 +11,7 @@ RHIRenderTarget::RHIRenderTarget(RHIDevice *device) :
 
 std::unique_ptr<RHIRenderTarget> RHIRenderTarget::Create(RHIDevice *device)
 {
-	return std::unique_ptr<RHIRenderTarget>(std::move(PluginManager::GetInstance().Call<RHIRenderTarget *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateRenderTarget", device)));
+	return std::unique_ptr<RHIRenderTarget>(device->GetPlugin().create_render_target(device));
 }
 
 uint32_t RHIRenderTarget::GetWidth() const
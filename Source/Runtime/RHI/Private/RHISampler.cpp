@@ -1,7 +1,6 @@
 #include "RHISampler.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -56,6 +55,6 @@ RHISampler::RHISampler(RHIDevice *device, const SamplerDesc &desc) :
 
 std::unique_ptr<RHISampler> RHISampler::Create(RHIDevice *device, const SamplerDesc &desc)
 {
-	return std::unique_ptr<RHISampler>(std::move(PluginManager::GetInstance().Call<RHISampler *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateSampler", device, desc)));
+	return std::unique_ptr<RHISampler>(device->GetPlugin().create_sampler(device, desc));
 }
 }        // namespace Ilum
\ No newline at end of file
@@ -1,7 +1,6 @@
 #include "RHIShader.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -12,7 +11,7 @@ RHIShader::RHIShader(RHIDevice *device, const std::string &entry_point, const st
 
 std::unique_ptr<RHIShader> RHIShader::Create(RHIDevice *device, const std::string &entry_point, const std::vector<uint8_t> &source)
 {
-	return std::unique_ptr<RHIShader>(std::move(PluginManager::GetInstance().Call<RHIShader *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateShader", device, entry_point, source)));
+	return std::unique_ptr<RHIShader>(device->GetPlugin().create_shader(device, entry_point, source));
 }
 
 const std::string &RHIShader::GetEntryPoint() const
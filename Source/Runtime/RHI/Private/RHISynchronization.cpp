@@ -1,7 +1,6 @@
 #include "RHISynchronization.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -12,7 +11,7 @@ RHIFence::RHIFence(RHIDevice *device) :
 
 std::unique_ptr<RHIFence> RHIFence::Create(RHIDevice *device)
 {
-	return std::unique_ptr<RHIFence>(std::move(PluginManager::GetInstance().Call<RHIFence *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateFence", device)));
+	return std::unique_ptr<RHIFence>(device->GetPlugin().create_fence(device));
 }
 
 RHISemaphore::RHISemaphore(RHIDevice *device) :
@@ -22,6 +21,6 @@ RHISemaphore::RHISemaphore(RHIDevice *device) :
 
 std::unique_ptr<RHISemaphore> RHISemaphore::Create(RHIDevice *device)
 {
-	return std::unique_ptr<RHISemaphore>(std::move(PluginManager::GetInstance().Call<RHISemaphore *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateSemaphore", device)));
+	return std::unique_ptr<RHISemaphore>(device->GetPlugin().create_semaphore(device));
 }
 }        // namespace Ilum
\ No newline at end of file
@@ -1,7 +1,6 @@
 #include "RHITexture.hpp"
 #include "RHIDevice.hpp"
-
-#include <Core/Plugin.hpp>
+#include "RHIPlugin.hpp"
 
 namespace Ilum
 {
@@ -20,14 +19,19 @@ const std::string RHITexture::GetBackend() const
 	return p_device->GetBackend();
 }
 
-std::unique_ptr<RHITexture> RHITexture::Alias(const TextureDesc &desc)
+std::unique_ptr<RHITexture> RHITexture::Alias(const TextureDesc &desc, size_t offset)
 {
 	return nullptr;
 }
 
 std::unique_ptr<RHITexture> RHITexture::Create(RHIDevice *device, const TextureDesc &desc)
 {
-	return std::unique_ptr<RHITexture>(std::move(PluginManager::GetInstance().Call<RHITexture *>(fmt::format("shared/RHI/RHI.{}.dll", device->GetBackend()), "CreateTexture", device, desc)));
+	return std::unique_ptr<RHITexture>(device->GetPlugin().create_texture(device, desc));
+}
+
+std::unique_ptr<RHITexture> RHITexture::CreateHeap(RHIDevice *device, size_t size, const std::vector<TextureDesc> &descs)
+{
+	return std::unique_ptr<RHITexture>(device->GetPlugin().create_texture_heap(device, size, descs));
 }
 
 std::unique_ptr<RHITexture> RHITexture::Create2D(RHIDevice *device, uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, bool mipmap, uint32_t samples)
@@ -89,4 +93,9 @@ std::unique_ptr<RHITexture> RHITexture::Create2DArray(RHIDevice *device, uint32_
 
 	return Create(device, desc);
 }
+
+size_t RHITexture::QueryMemorySize(RHIDevice *device, const TextureDesc &desc)
+{
+	return device->GetPlugin().get_texture_memory_size(device, desc);
+}
 }        // namespace Ilum
\ No newline at end of file
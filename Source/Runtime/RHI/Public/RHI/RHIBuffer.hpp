@@ -39,6 +39,9 @@ class RHIBuffer
 
 	const BufferDesc &GetDesc() const;
 
+	// Create a buffer placed at offset inside this buffer's memory
+	virtual std::unique_ptr<RHIBuffer> Alias(const BufferDesc &desc, size_t offset = 0);
+
 	virtual void CopyToDevice(const void *data, size_t size, size_t offset = 0) = 0;
 
 	virtual void CopyToHost(void *data, size_t size, size_t offset = 0) = 0;
@@ -109,6 +109,7 @@ class RHICommand
 
 	virtual void GenerateMipmaps(RHITexture *texture, RHIResourceState initial_state, RHIFilter filter)                                                                                                                                                  = 0;
 	virtual void BlitTexture(RHITexture *src_texture, const TextureRange &src_range, const RHIResourceState &src_state, RHITexture *dst_texture, const TextureRange &dst_range, const RHIResourceState &dst_state, RHIFilter filter = RHIFilter::Linear) = 0;
+	virtual void CopyTexture(RHITexture *src_texture, const TextureRange &src_range, const RHIResourceState &src_state, RHITexture *dst_texture, const TextureRange &dst_range, const RHIResourceState &dst_state)                                       = 0;
 
 	// Resource Reset
 	virtual void FillBuffer(RHIBuffer *buffer, RHIResourceState state, size_t size, size_t offset = 0, uint32_t data = 0)    = 0;
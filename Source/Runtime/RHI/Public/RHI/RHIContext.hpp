@@ -25,12 +25,16 @@ namespace Ilum
 class RHIContext
 {
   public:
+	// Without a window the context is headless, it has no swapchain and never presents
 	RHIContext(Window *window, const std::string &backend = "Vulkan", bool vsync = false);
 
 	~RHIContext();
 
 	const std::string &GetDeviceName() const;
 
+	// Backend device, for queries the context does not wrap
+	RHIDevice *GetDevice() const;
+
 	const std::string GetBackend() const;
 
 	bool HasCUDA() const;
@@ -43,6 +47,8 @@ class RHIContext
 
 	void WaitIdle() const;
 
+	UploadStatistics GetUploadStatistics() const;
+
 	RHISwapchain *GetSwapchain() const;
 
 	std::unique_ptr<RHISwapchain> CreateSwapchain(void *window_handle, uint32_t width, uint32_t height, bool sync);
@@ -54,6 +60,10 @@ class RHIContext
 	std::unique_ptr<RHITexture> CreateTextureCube(uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, bool mipmap);
 	std::unique_ptr<RHITexture> CreateTexture2DArray(uint32_t width, uint32_t height, uint32_t layers, RHIFormat format, RHITextureUsage usage, bool mipmap, uint32_t samples = 1);
 
+	// Texture Memory Aliasing
+	std::unique_ptr<RHITexture> CreateTextureHeap(size_t size, const std::vector<TextureDesc> &descs);
+	size_t                      GetTextureMemorySize(const TextureDesc &desc);
+
 	// Texture Conversion
 	std::unique_ptr<RHITexture> MapToCUDATexture(RHITexture *texture);
 
@@ -134,11 +144,20 @@ class RHIContext
 	// Get Back Buffer
 	RHITexture *GetBackBuffer();
 
+	// Frames in flight
+	uint32_t GetFrameCount() const;
+
+	// Index of the frame being recorded, the back buffer index when presenting
+	uint32_t GetCurrentFrame() const;
+
 	// Frame
 	void BeginFrame();
 
 	void EndFrame();
 
+  private:
+	inline static constexpr uint32_t HeadlessFrameCount = 3;
+
   private:
 	uint32_t m_current_frame = 0;
 	bool     m_vsync         = false;
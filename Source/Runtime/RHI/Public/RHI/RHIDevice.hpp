@@ -4,6 +4,17 @@
 
 namespace Ilum
 {
+struct RHIPlugin;
+
+// Cumulative counters of host to device buffer uploads
+struct UploadStatistics
+{
+	uint64_t uploads = 0;        // CopyToDevice calls that went through staging memory
+	uint64_t bytes   = 0;
+	uint64_t batches = 0;        // Transfer submissions carrying the staged copies
+	uint64_t stalls  = 0;        // Times an upload had to wait for staging memory to be released
+};
+
 class RHIDevice
 {
   public:
@@ -17,12 +28,22 @@ class RHIDevice
 
 	const std::string GetBackend() const;
 
+	// Factory functions of this device's backend plugin
+	const RHIPlugin &GetPlugin() const;
+
 	virtual void WaitIdle() = 0;
 
 	virtual bool IsFeatureSupport(RHIFeature feature) = 0;
 
+	virtual UploadStatistics GetUploadStatistics() const;
+
+	// Submit buffer uploads staged since the last flush, the context calls this once per frame and before immediate executions
+	virtual void FlushUploads();
+
   protected:
 	const std::string m_backend;
 	std::string m_name;
+
+	const RHIPlugin *p_plugin = nullptr;
 };
 }        // namespace Ilum
\ No newline at end of file
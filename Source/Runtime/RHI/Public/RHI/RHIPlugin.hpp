@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Fwd.hpp"
+
+#include <Core/Plugin.hpp>
+
+namespace Ilum
+{
+struct BufferDesc;
+struct TextureDesc;
+struct SamplerDesc;
+
+// Factory entry points exported by an RHI backend plugin
+// Resolved once per backend, so creating a resource is an indirect call instead of a library and symbol lookup
+struct RHIPlugin
+{
+	PluginFunction<RHIDevice *()> create_device;
+
+	PluginFunction<RHIFrame *(RHIDevice *)>                                                     create_frame;
+	PluginFunction<RHISwapchain *(RHIDevice *, void *, uint32_t, uint32_t, bool)>               create_swapchain;
+	PluginFunction<RHIQueue *(RHIDevice *)>                                                     create_queue;
+	PluginFunction<RHICommand *(RHIDevice *, RHIQueueFamily)>                                   create_command;
+	PluginFunction<RHIBuffer *(RHIDevice *, const BufferDesc &)>                                create_buffer;
+	PluginFunction<RHITexture *(RHIDevice *, const TextureDesc &)>                              create_texture;
+	PluginFunction<RHITexture *(RHIDevice *, size_t, const std::vector<TextureDesc> &)>         create_texture_heap;
+	PluginFunction<size_t(RHIDevice *, const TextureDesc &)>                                    get_texture_memory_size;
+	PluginFunction<RHISampler *(RHIDevice *, const SamplerDesc &)>                              create_sampler;
+	PluginFunction<RHIShader *(RHIDevice *, const std::string &, const std::vector<uint8_t> &)> create_shader;
+	PluginFunction<RHIRenderTarget *(RHIDevice *)>                                              create_render_target;
+	PluginFunction<RHIFence *(RHIDevice *)>                                                     create_fence;
+	PluginFunction<RHISemaphore *(RHIDevice *)>                                                 create_semaphore;
+	PluginFunction<RHIDescriptor *(RHIDevice *, const ShaderMeta &)>                            create_descriptor;
+	PluginFunction<RHIPipelineState *(RHIDevice *)>                                             create_pipeline_state;
+	PluginFunction<RHIProfiler *(RHIDevice *, uint32_t)>                                        create_profiler;
+	PluginFunction<RHIAccelerationStructure *(RHIDevice *)>                                     create_acceleration_structure;
+
+	// Loads "shared/RHI/RHI.<backend>" on first use, missing functions stay empty and return nullptr
+	static const RHIPlugin &Get(const std::string &backend);
+};
+}        // namespace Ilum
\ No newline at end of file
@@ -63,16 +63,22 @@ class RHITexture
 
 	const std::string GetBackend() const;
 
-	virtual std::unique_ptr<RHITexture> Alias(const TextureDesc &desc);
+	// Create a texture placed at offset inside this texture's memory
+	virtual std::unique_ptr<RHITexture> Alias(const TextureDesc &desc, size_t offset = 0);
 
 	virtual size_t GetMemorySize() const = 0;
 
 	static std::unique_ptr<RHITexture> Create(RHIDevice *device, const TextureDesc &desc);
+	// Memory only texture that can back aliases of every desc in descs
+	static std::unique_ptr<RHITexture> CreateHeap(RHIDevice *device, size_t size, const std::vector<TextureDesc> &descs);
 	static std::unique_ptr<RHITexture> Create2D(RHIDevice *device, uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, bool mipmap, uint32_t samples = 1);
 	static std::unique_ptr<RHITexture> Create3D(RHIDevice *device, uint32_t width, uint32_t height, uint32_t depth, RHIFormat format, RHITextureUsage usage);
 	static std::unique_ptr<RHITexture> CreateCube(RHIDevice *device, uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, bool mipmap);
 	static std::unique_ptr<RHITexture> Create2DArray(RHIDevice *device, uint32_t width, uint32_t height, uint32_t layers, RHIFormat format, RHITextureUsage usage, bool mipmap, uint32_t samples = 1);
 
+	// Memory a texture created from desc would take, zero if unknown
+	static size_t QueryMemorySize(RHIDevice *device, const TextureDesc &desc);
+
   protected:
 	RHIDevice  *p_device = nullptr;
 	TextureDesc m_desc;
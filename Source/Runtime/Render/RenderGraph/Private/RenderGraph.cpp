@@ -153,6 +153,10 @@ struct RenderGraph::Impl
 
 	std::vector<RenderPassInfo> render_passes;
 
+	// Memory of aliased resources, released after the resources placed in it
+	std::vector<std::unique_ptr<RHITexture>> texture_heaps;
+	std::vector<std::unique_ptr<RHIBuffer>>  buffer_heaps;
+
 	std::vector<std::unique_ptr<RHITexture>> textures;
 	std::map<size_t, RHITexture *>           texture_lookup;
 	std::map<size_t, RHITexture *>           cuda_textures;
@@ -162,6 +166,14 @@ struct RenderGraph::Impl
 
 	std::map<RHISemaphore *, std::unique_ptr<RHISemaphore>> cuda_semaphore_map;
 
+	// Pass indices of each record group, in execution order
+	std::vector<std::vector<uint32_t>> record_groups;
+
+	// Passes may swap textures while others are being recorded
+	std::mutex resource_mutex;
+
+	bool parallel_recording = true;
+
 	bool init = false;
 };
 
@@ -181,6 +193,8 @@ RenderGraph::~RenderGraph()
 
 std::unique_ptr<RHITexture> RenderGraph::SetTexture(size_t handle, std::unique_ptr<RHITexture> &&texture)
 {
+	std::lock_guard<std::mutex> lock(m_impl->resource_mutex);
+
 	if (texture->GetBackend() == "CUDA")
 	{
 		if (m_impl->cuda_textures.find(handle) != m_impl->cuda_textures.end())
@@ -245,18 +259,21 @@ std::unique_ptr<RHITexture> RenderGraph::SetTexture(size_t handle, std::unique_p
 
 RHITexture *RenderGraph::GetTexture(size_t handle)
 {
+	std::lock_guard<std::mutex> lock(m_impl->resource_mutex);
 	auto iter = m_impl->texture_lookup.find(handle);
 	return iter == m_impl->texture_lookup.end() ? nullptr : iter->second;
 }
 
 RHIBuffer *RenderGraph::GetBuffer(size_t handle)
 {
+	std::lock_guard<std::mutex> lock(m_impl->resource_mutex);
 	auto iter = m_impl->buffer_lookup.find(handle);
 	return iter == m_impl->buffer_lookup.end() ? nullptr : iter->second;
 }
 
 RHITexture *RenderGraph::GetCUDATexture(size_t handle)
 {
+	std::lock_guard<std::mutex> lock(m_impl->resource_mutex);
 	if (m_impl->cuda_textures.find(handle) == m_impl->cuda_textures.end())
 	{
 		m_impl->textures.emplace_back(m_impl->rhi_context->MapToCUDATexture(m_impl->texture_lookup.at(handle)));
@@ -280,7 +297,10 @@ void RenderGraph::Execute(RenderGraphBlackboard &black_board)
 		compute_cmd_buffer->Begin();
 		graphics_cmd_buffer->BeginMarker("Initialize - Graphics Queue");
 		compute_cmd_buffer->BeginMarker("Initialize - Compute Queue");
-		m_impl->initialize_barrier(*this, graphics_cmd_buffer, compute_cmd_buffer);
+		if (m_impl->initialize_barrier)
+		{
+			m_impl->initialize_barrier(*this, graphics_cmd_buffer, compute_cmd_buffer);
+		}
 		m_impl->init = true;
 		graphics_cmd_buffer->EndMarker();
 		compute_cmd_buffer->EndMarker();
@@ -290,121 +310,53 @@ void RenderGraph::Execute(RenderGraphBlackboard &black_board)
 		m_impl->rhi_context->Execute({compute_cmd_buffer});
 	}
 
-	// Collect cmd buffers
-	/*std::vector<std::future<RHICommand *>> cmd_buffer_futures;
-	for (auto &pass : m_impl->render_passes)
-	{
-	    auto future = JobSystem::GetInstance().ExecuteAsync([&]() {
-	        if (pass.bind_point == BindPoint::CUDA)
-	        {
-	            auto *cmd_buffer = m_impl->rhi_context->CreateCommand(RHIQueueFamily::Compute, true);
-	            cmd_buffer->Begin();
-	            pass.profiler->Begin(cmd_buffer, m_impl->rhi_context->GetSwapchain()->GetCurrentFrameIndex());
-	            pass.execute(*this, cmd_buffer, pass.config, black_board);
-	            pass.profiler->End(cmd_buffer);
-	            cmd_buffer->End();
-	            return cmd_buffer;
-	        }
-	        else
-	        {
-	            RHIQueueFamily family = RHIQueueFamily::Graphics;
-	            if (pass.bind_point == BindPoint::Rasterization)
-	            {
-	                family = RHIQueueFamily::Graphics;
-	            }
-	            else
-	            {
-	                family = RHIQueueFamily::Compute;
-	            }
-
-	            auto *cmd_buffer = m_impl->rhi_context->CreateCommand(family);
-	            cmd_buffer->SetName(pass.name);
-	            cmd_buffer->Begin();
-	            cmd_buffer->BeginMarker(pass.name);
-	            pass.profiler->Begin(cmd_buffer, m_impl->rhi_context->GetSwapchain()->GetCurrentFrameIndex());
-	            pass.barrier(*this, cmd_buffer);
-	            pass.execute(*this, cmd_buffer, pass.config, black_board);
-	            pass.profiler->End(cmd_buffer);
-	            cmd_buffer->EndMarker();
-	            cmd_buffer->End();
-	            return cmd_buffer;
-	        }
-	    });
-	    cmd_buffer_futures.emplace_back(std::move(future));
-	}
+	// Record command buffers, each pass into its own command buffer
+	// Record groups run one after another, passes inside a group are recorded on job system workers
+	std::vector<RHICommand *> cmd_buffers(m_impl->render_passes.size(), nullptr);
 
-	if (!cmd_buffer_futures.empty())
+	if (m_impl->parallel_recording)
 	{
-	    std::vector<RHICommand *> cmd_buffers(cmd_buffer_futures.size());
-	    std::transform(cmd_buffer_futures.begin(), cmd_buffer_futures.end(), cmd_buffers.begin(), [](std::future<RHICommand *> &iter) { return iter.get(); });
-
-	    RHIQueueFamily            last_queue_family = cmd_buffers[0]->GetQueueFamily();
-	    std::string               last_backend      = cmd_buffers[0]->GetBackend();
-	    RHISemaphore             *last_semaphore    = nullptr;
-	    std::vector<RHICommand *> submit_cmd_buffers;
-	    for (auto &cmd_buffer : cmd_buffers)
-	    {
-	        if (last_queue_family != cmd_buffer->GetQueueFamily() ||
-	            cmd_buffer->GetBackend() != last_backend &&
-	                !submit_cmd_buffers.empty())
-	        {
-	            RHISemaphore *pass_semaphore   = m_impl->rhi_context->CreateFrameSemaphore();
-	            RHISemaphore *signal_semaphore = last_backend == "CUDA" ? MapToCUDASemaphore(pass_semaphore) : pass_semaphore;
-	            RHISemaphore *wait_semaphore   = last_semaphore ? last_backend == "CUDA" ? MapToCUDASemaphore(last_semaphore) : last_semaphore : nullptr;
-
-	            m_impl->rhi_context->Submit(std::move(submit_cmd_buffers), wait_semaphore ? std::vector<RHISemaphore *>{wait_semaphore} : std::vector<RHISemaphore *>{}, {signal_semaphore});
-	            submit_cmd_buffers.clear();
-	            last_semaphore    = pass_semaphore;
-	            last_queue_family = cmd_buffer->GetQueueFamily();
-	        }
-
-	        submit_cmd_buffers.push_back(cmd_buffer);
-	    }
-	    if (!submit_cmd_buffers.empty())
-	    {
-	        m_impl->rhi_context->Submit(std::move(submit_cmd_buffers), last_semaphore ? std::vector<RHISemaphore *>{last_semaphore} : std::vector<RHISemaphore *>{}, {});
-	    }
-	}*/
-
-	std::vector<RHICommand *> cmd_buffers;
-	for (auto &pass : m_impl->render_passes)
-	{
-		if (pass.bind_point == BindPoint::CUDA)
+		for (auto &group : m_impl->record_groups)
 		{
-			auto *cmd_buffer = m_impl->rhi_context->CreateCommand(RHIQueueFamily::Compute, true);
-			cmd_buffer->Begin();
-			pass.profiler->Begin(cmd_buffer, m_impl->rhi_context->GetSwapchain()->GetCurrentFrameIndex());
-			pass.execute(*this, cmd_buffer, pass.config, black_board);
-			pass.profiler->End(cmd_buffer);
-			cmd_buffer->End();
-			cmd_buffers.emplace_back(cmd_buffer);
-		}
-		else
-		{
-			RHIQueueFamily family = RHIQueueFamily::Graphics;
-			if (pass.bind_point == BindPoint::Rasterization)
+			// CUDA commands come from the CUDA frame, keep them on the calling thread
+			std::vector<uint32_t> worker_passes;
+			worker_passes.reserve(group.size());
+			for (auto &pass_index : group)
 			{
-				family = RHIQueueFamily::Graphics;
+				if (m_impl->render_passes[pass_index].bind_point == BindPoint::CUDA)
+				{
+					cmd_buffers[pass_index] = RecordPass(m_impl->render_passes[pass_index], black_board);
+				}
+				else
+				{
+					worker_passes.push_back(pass_index);
+				}
 			}
-			else
+
+			if (worker_passes.size() == 1)
 			{
-				family = RHIQueueFamily::Compute;
+				cmd_buffers[worker_passes[0]] = RecordPass(m_impl->render_passes[worker_passes[0]], black_board);
+			}
+			else if (worker_passes.size() > 1)
+			{
+				JobHandle handle;
+				JobSystem::GetInstance().Dispatch(handle, static_cast<uint32_t>(worker_passes.size()), 1, [&](uint32_t group_id) {
+					uint32_t pass_index     = worker_passes[group_id];
+					cmd_buffers[pass_index] = RecordPass(m_impl->render_passes[pass_index], black_board);
+				});
+				JobSystem::GetInstance().Wait(handle);
 			}
-
-			auto *cmd_buffer = m_impl->rhi_context->CreateCommand(family);
-			cmd_buffer->SetName(pass.name);
-			cmd_buffer->Begin();
-			cmd_buffer->BeginMarker(pass.name);
-			pass.profiler->Begin(cmd_buffer, m_impl->rhi_context->GetSwapchain()->GetCurrentFrameIndex());
-			pass.barrier(*this, cmd_buffer);
-			pass.execute(*this, cmd_buffer, pass.config, black_board);
-			pass.profiler->End(cmd_buffer);
-			cmd_buffer->EndMarker();
-			cmd_buffer->End();
-			cmd_buffers.emplace_back(cmd_buffer);
+		}
+	}
+	else
+	{
+		for (uint32_t i = 0; i < m_impl->render_passes.size(); i++)
+		{
+			cmd_buffers[i] = RecordPass(m_impl->render_passes[i], black_board);
 		}
 	}
 
+	// Submit in pass order, so barriers and queue ownership match the serial path
 	if (!cmd_buffers.empty())
 	{
 		RHIQueueFamily            last_queue_family = cmd_buffers[0]->GetQueueFamily();
@@ -441,14 +393,65 @@ const std::vector<RenderGraph::RenderPassInfo> &RenderGraph::GetRenderPasses() c
 	return m_impl->render_passes;
 }
 
+void RenderGraph::SetParallelRecording(bool enable)
+{
+	m_impl->parallel_recording = enable;
+}
+
+bool RenderGraph::IsParallelRecording() const
+{
+	return m_impl->parallel_recording;
+}
+
+RHICommand *RenderGraph::RecordPass(RenderPassInfo &pass, RenderGraphBlackboard &black_board)
+{
+	if (pass.bind_point == BindPoint::CUDA)
+	{
+		auto *cmd_buffer = m_impl->rhi_context->CreateCommand(RHIQueueFamily::Compute, true);
+		cmd_buffer->Begin();
+		pass.profiler->Begin(cmd_buffer, m_impl->rhi_context->GetCurrentFrame());
+		pass.execute(*this, cmd_buffer, pass.config, black_board);
+		pass.profiler->End(cmd_buffer);
+		cmd_buffer->End();
+		return cmd_buffer;
+	}
+
+	RHIQueueFamily family = pass.bind_point == BindPoint::Rasterization ? RHIQueueFamily::Graphics : RHIQueueFamily::Compute;
+
+	auto *cmd_buffer = m_impl->rhi_context->CreateCommand(family);
+	cmd_buffer->SetName(pass.name);
+	cmd_buffer->Begin();
+	cmd_buffer->BeginMarker(pass.name);
+	pass.profiler->Begin(cmd_buffer, m_impl->rhi_context->GetCurrentFrame());
+	pass.barrier(*this, cmd_buffer);
+	pass.execute(*this, cmd_buffer, pass.config, black_board);
+	pass.profiler->End(cmd_buffer);
+	cmd_buffer->EndMarker();
+	cmd_buffer->End();
+	return cmd_buffer;
+}
+
 RenderGraph &RenderGraph::AddPass(
     const std::string &name,
     const std::string &category,
     BindPoint          bind_point,
     const Variant     &config,
     RenderTask       &&task,
-    BarrierTask      &&barrier)
+    BarrierTask      &&barrier,
+    uint32_t           record_group)
 {
+	// Without dependency info, record after every pass added before
+	if (record_group == ~0u)
+	{
+		record_group = static_cast<uint32_t>(m_impl->record_groups.size());
+	}
+
+	if (m_impl->record_groups.size() <= record_group)
+	{
+		m_impl->record_groups.resize(record_group + 1);
+	}
+	m_impl->record_groups[record_group].push_back(static_cast<uint32_t>(m_impl->render_passes.size()));
+
 	m_impl->render_passes.emplace_back(RenderPassInfo{
 	    name,
 	    category,
@@ -456,7 +459,8 @@ RenderGraph &RenderGraph::AddPass(
 	    config,
 	    std::move(task),
 	    std::move(barrier),
-	    m_impl->rhi_context->CreateProfiler(bind_point == BindPoint::CUDA)});
+	    m_impl->rhi_context->CreateProfiler(bind_point == BindPoint::CUDA),
+	    record_group});
 	return *this;
 }
 
@@ -477,49 +481,33 @@ RenderGraph &RenderGraph::RegisterTexture(const TextureCreateInfo &create_info)
 	return *this;
 }
 
-RenderGraph &RenderGraph::RegisterTexture(const std::vector<TextureCreateInfo> &create_infos)
+RenderGraph &RenderGraph::RegisterTexture(const std::vector<TextureCreateInfo> &create_infos, size_t heap_size)
 {
 	if (create_infos.size() == 1)
 	{
 		return RegisterTexture(create_infos[0]);
 	}
 
-	TextureDesc pool_desc = {};
-	pool_desc.name        = "Pool Texture " + std::to_string(m_impl->textures.size());
-	pool_desc.width       = 0;
-	pool_desc.width       = 0;
-	pool_desc.height      = 0;
-	pool_desc.depth       = 0;
-	pool_desc.mips        = 0;
-	pool_desc.layers      = 0;
-	pool_desc.samples     = 0;
-	pool_desc.format      = (RHIFormat) 0;
-	pool_desc.usage       = RHITextureUsage::Transfer | RHITextureUsage::ShaderResource;
-
-	// Memory alias
+	std::vector<TextureDesc> descs;
+	descs.reserve(create_infos.size());
 	for (auto &info : create_infos)
 	{
-		pool_desc.width   = std::max(pool_desc.width, info.desc.width);
-		pool_desc.height  = std::max(pool_desc.height, info.desc.height);
-		pool_desc.depth   = std::max(pool_desc.depth, info.desc.depth);
-		pool_desc.mips    = std::max(pool_desc.mips, info.desc.mips);
-		pool_desc.layers  = std::max(pool_desc.layers, info.desc.layers);
-		pool_desc.samples = std::max(pool_desc.samples, info.desc.samples);
-		pool_desc.format  = (RHIFormat) std::max((uint64_t) pool_desc.format, (uint64_t) info.desc.format);
+		descs.push_back(info.desc);
 	}
 
-	//m_impl->textures.emplace_back(m_impl->rhi_context->CreateTexture(pool_desc));
-	//auto pool_texture = m_impl->textures.back().get();
+	auto *heap = m_impl->texture_heaps.emplace_back(m_impl->rhi_context->CreateTextureHeap(heap_size, descs)).get();
 
 	for (auto &info : create_infos)
 	{
-		TextureDesc desc = info.desc;
-		desc.usage |= RHITextureUsage::ShaderResource | RHITextureUsage::Transfer;
-		auto &texture = m_impl->textures.emplace_back(m_impl->rhi_context->CreateTexture(desc));
-		//auto &texture = m_impl->textures.emplace_back(pool_texture->Alias(desc));
+		std::unique_ptr<RHITexture> texture = heap ? heap->Alias(info.desc, info.offset) : nullptr;
+		if (!texture)
+		{
+			texture = m_impl->rhi_context->CreateTexture(info.desc);
+		}
+		auto *texture_ptr = m_impl->textures.emplace_back(std::move(texture)).get();
 		for (auto &handle : info.handles)
 		{
-			m_impl->texture_lookup.emplace(handle, texture.get());
+			m_impl->texture_lookup.emplace(handle, texture_ptr);
 		}
 	}
 
@@ -538,6 +526,46 @@ RenderGraph &RenderGraph::RegisterBuffer(const BufferCreateInfo &create_info)
 	return *this;
 }
 
+RenderGraph &RenderGraph::RegisterBuffer(const std::vector<BufferCreateInfo> &create_infos, size_t heap_size)
+{
+	if (create_infos.size() == 1)
+	{
+		return RegisterBuffer(create_infos[0]);
+	}
+
+	BufferDesc heap_desc = {};
+	heap_desc.name       = "Buffer Heap " + std::to_string(m_impl->buffer_heaps.size());
+	heap_desc.usage      = RHIBufferUsage::Transfer | RHIBufferUsage::ConstantBuffer;
+	heap_desc.memory     = RHIMemoryUsage::GPU_Only;
+	heap_desc.size       = heap_size;
+
+	for (auto &info : create_infos)
+	{
+		heap_desc.usage = heap_desc.usage | info.desc.usage;
+	}
+
+	auto *heap = m_impl->buffer_heaps.emplace_back(m_impl->rhi_context->CreateBuffer(heap_desc)).get();
+
+	for (auto &info : create_infos)
+	{
+		BufferDesc desc = info.desc;
+		desc.usage      = desc.usage | RHIBufferUsage::Transfer | RHIBufferUsage::ConstantBuffer;
+
+		std::unique_ptr<RHIBuffer> buffer = heap ? heap->Alias(desc, info.offset) : nullptr;
+		if (!buffer)
+		{
+			buffer = m_impl->rhi_context->CreateBuffer(desc);
+		}
+		auto *buffer_ptr = m_impl->buffers.emplace_back(std::move(buffer)).get();
+		for (auto &handle : info.handles)
+		{
+			m_impl->buffer_lookup.emplace(handle, buffer_ptr);
+		}
+	}
+
+	return *this;
+}
+
 RHISemaphore *RenderGraph::MapToCUDASemaphore(RHISemaphore *semaphore)
 {
 	if (m_impl->cuda_semaphore_map.find(semaphore) != m_impl->cuda_semaphore_map.end())
@@ -1,15 +1,25 @@
 #include "RenderGraph/RenderGraphBuilder.hpp"
+#include "RenderGraph/RenderGraphSchedule.hpp"
 
 namespace Ilum
 {
+// Conservative placement alignments, the backend falls back to a dedicated allocation if they are not enough
+static constexpr size_t TransientTextureAlignment = 64 * 1024;
+static constexpr size_t TransientBufferAlignment  = 256;
+
+static inline size_t Align(size_t x, size_t alignment)
+{
+	return (x + alignment - 1) & ~(alignment - 1);
+}
+
 RenderGraphBuilder::RenderGraphBuilder(RHIContext *rhi_context) :
     p_rhi_context(rhi_context)
 {
 }
 
-RenderGraphBuilder &RenderGraphBuilder::AddPass(RenderGraph &render_graph, const std::string &name, const std::string &category, BindPoint bind_point, const Variant &config, RenderGraph::RenderTask &&task, RenderGraph::BarrierTask &&barrier)
+RenderGraphBuilder &RenderGraphBuilder::AddPass(RenderGraph &render_graph, const std::string &name, const std::string &category, BindPoint bind_point, const Variant &config, RenderGraph::RenderTask &&task, RenderGraph::BarrierTask &&barrier, uint32_t record_group)
 {
-	render_graph.AddPass(name, category, bind_point, config, std::move(task), std::move(barrier));
+	render_graph.AddPass(name, category, bind_point, config, std::move(task), std::move(barrier), record_group);
 	return *this;
 }
 
@@ -72,215 +82,114 @@ std::unique_ptr<RenderGraph> RenderGraphBuilder::Compile(RenderGraphDesc &desc,
 	//	return nullptr;
 	// }
 
-	const std::unordered_map<BindPoint, RHIQueueFamily> queue_family_map = {
-	    {BindPoint::None, RHIQueueFamily::Graphics},
-	    {BindPoint::Rasterization, RHIQueueFamily::Graphics},
-	    {BindPoint::RayTracing, RHIQueueFamily::Compute},
-	    {BindPoint::Compute, RHIQueueFamily::Compute},
-	    {BindPoint::CUDA, RHIQueueFamily::Compute},
-	};
-
-	struct ResourceState
-	{
-		RHIResourceState rhi_state;
-		RHIQueueFamily   family;
-
-		bool operator==(const ResourceState &lhs)
-		{
-			return this->rhi_state == lhs.rhi_state && this->family == lhs.family;
-		}
-	};
-
-	// Sorting passes
-	std::vector<size_t> ordered_passes;
-	ordered_passes.reserve(desc.GetPasses().size());
-
-	std::vector<size_t> pass_handles;
-
-	std::map<size_t, std::map<uint32_t, ResourceState>> resource_lifetime;
-
-	std::map<size_t, ResourceState> last_resource_state;
-
-	for (auto &[pass_handle, pass] : desc.GetPasses())
-	{
-		pass_handles.push_back(pass_handle);
-		for (auto &[pin_handle, pin] : pass.GetPins())
-		{
-			if (pin.attribute == RenderPassPin::Attribute::Output)
-			{
-				last_resource_state[pin_handle] = ResourceState{RHIResourceState::Undefined, queue_family_map.at(pass.GetBindPoint())};
-			}
-		}
-	}
-
-	std::vector<std::map<size_t, std::pair<ResourceState, ResourceState>>> resource_states;
-
-	struct PassSemaphore
-	{
-		std::vector<RHISemaphore *> wait_semaphores;
-		std::vector<RHISemaphore *> signal_semaphores;
-	};
-
-	std::map<size_t, PassSemaphore> pass_semaphores;        // [signal - wait]
-
-	RenderGraphDesc tmp_desc = desc;
-
-	std::set<size_t> collected_passes;
+	RenderGraphSchedule schedule = RenderGraphSchedule::Build(desc);
 
 	// Create new render graph
 	std::unique_ptr<RenderGraph> render_graph = std::make_unique<RenderGraph>(p_rhi_context);
 
-	while (!pass_handles.empty())
-	{
-		uint32_t pass_idx = static_cast<uint32_t>(ordered_passes.size());
-
-		for (auto iter = pass_handles.begin(); iter != pass_handles.end();)
-		{
-			auto &pass = desc.GetPass(*iter);
-
-			if (!desc.HasLink(pass.GetHandle()) ||
-			    collected_passes.find(desc.LinkFrom(pass.GetHandle())) != collected_passes.end())
-			{
-				std::map<size_t, std::pair<ResourceState, ResourceState>> pass_resource_state;
-
-				for (auto &[pin_handle, pin] : pass.GetPins())
-				{
-					size_t resource_pin = (pin.attribute == RenderPassPin::Attribute::Output) ? pin_handle : (desc.HasLink(pin_handle) ? desc.LinkFrom(pin_handle) : ~0ull);
-					if (resource_pin == ~0ull)
-					{
-						continue;
-					}
-
-					ResourceState resource_state = ResourceState{pin.resource_state, queue_family_map.at(pass.GetBindPoint())};
-
-					// Record resource state
-					if (pass.GetBindPoint() != BindPoint::CUDA)
-					{
-						pass_resource_state[resource_pin]         = std::make_pair(last_resource_state[resource_pin], resource_state);
-						last_resource_state[resource_pin]         = resource_state;
-						resource_lifetime[resource_pin][pass_idx] = resource_state;
-					}
-					else
-					{
-						ResourceState state = last_resource_state.find(resource_pin) != last_resource_state.end() ? last_resource_state[resource_pin] : ResourceState{RHIResourceState::Undefined, RHIQueueFamily::Graphics};
-
-						resource_lifetime[resource_pin][pass_idx] = state;
-						pass_resource_state[resource_pin]         = std::make_pair(state, state);
-					}
-
-					// Set resource info
-					auto &resource = desc.GetPass(resource_pin).GetPin(resource_pin);
-					if (resource.type == RenderPassPin::Type::Texture)
-					{
-						resource.texture.usage |= ResourceStateToTextureUsage(resource_state.rhi_state) | RHITextureUsage::Transfer;
-					}
-					else
-					{
-						resource.buffer.usage |= ResourceStateToBufferUsage(resource_state.rhi_state) | RHIBufferUsage::Transfer;
-					}
-				}
-
-				// Add pass
-				resource_states.push_back(pass_resource_state);
-				ordered_passes.push_back(pass.GetHandle());
-				collected_passes.insert(pass.GetHandle());
-				pass_handles.erase(iter);
-				break;
-			}
-			else
-			{
-				iter++;
-			}
-		}
-	}
-
-	std::set<size_t> alias_textures;
+	std::set<size_t> aliased_resources;
 
 	// Register resource
 	{
-		// Collect texture alias info
-		struct TexturePool
-		{
-			std::vector<size_t> handles;
+		// Collect transient resources, which can share memory when their lifetimes do not overlap
+		std::vector<TransientResource> transient_textures;
+		std::vector<TransientResource> transient_buffers;
 
-			uint32_t start;
-			uint32_t end;
-		};
-
-		std::vector<TexturePool> texture_pools;
-
-		for (auto &[handle, resource_states] : resource_lifetime)
+		for (auto &[handle, resource_states] : schedule.lifetimes)
 		{
 			const auto &resource = desc.GetPass(handle).GetPin(handle);
+
+			auto lifetime = schedule.GetTransientLifetime(desc, handle);
+
 			if (resource.type == RenderPassPin::Type::Texture)
 			{
-				bool alias = false;
-				for (auto &pool : texture_pools)
+				size_t size = lifetime ? p_rhi_context->GetTextureMemorySize(resource.texture) : 0;
+				if (size > 0)
 				{
-					if (pool.start > (--resource_states.end())->first ||
-					    pool.end < resource_states.begin()->first)
-					{
-						pool.handles.push_back(handle);
-						pool.start = std::min(pool.start, (--resource_states.end())->first);
-						pool.end   = std::max(pool.end, resource_states.begin()->first);
-						alias      = true;
-						break;
-					}
+					transient_textures.push_back(TransientResource{handle, lifetime->first, lifetime->second, size});
 				}
-				if (!alias)
+				else
 				{
-					texture_pools.push_back(TexturePool{{handle}, resource_states.begin()->first, (--resource_states.end())->first});
+					std::set<size_t> handles = desc.LinkTo(handle);
+					handles.insert(handle);
+					render_graph->RegisterTexture(RenderGraph::TextureCreateInfo{resource.texture, handles});
 				}
 			}
 			else
 			{
-				std::set<size_t> handles = desc.LinkTo(handle);
-				handles.insert(handle);
-				render_graph->RegisterBuffer(RenderGraph::BufferCreateInfo{resource.buffer, handles});
+				size_t size = resource.buffer.size == 0 ? resource.buffer.stride * resource.buffer.count : resource.buffer.size;
+				if (lifetime && size > 0 && resource.buffer.memory == RHIMemoryUsage::GPU_Only)
+				{
+					transient_buffers.push_back(TransientResource{handle, lifetime->first, lifetime->second, Align(size, TransientBufferAlignment)});
+				}
+				else
+				{
+					std::set<size_t> handles = desc.LinkTo(handle);
+					handles.insert(handle);
+					render_graph->RegisterBuffer(RenderGraph::BufferCreateInfo{resource.buffer, handles});
+				}
 			}
 		}
 
-		for (auto &pool : texture_pools)
+		size_t texture_memory = 0;
+		size_t buffer_memory  = 0;
+		for (auto &texture : transient_textures)
+		{
+			texture_memory += texture.size;
+		}
+		for (auto &buffer : transient_buffers)
+		{
+			buffer_memory += buffer.size;
+		}
+
+		size_t texture_heap_size = PackTransientResources(transient_textures, TransientTextureAlignment);
+		size_t buffer_heap_size  = PackTransientResources(transient_buffers, TransientBufferAlignment);
+
+		if (!transient_textures.empty())
 		{
 			std::vector<RenderGraph::TextureCreateInfo> texture_create_infos;
-			texture_create_infos.reserve(pool.handles.size());
-			for (auto &handle : pool.handles)
+			texture_create_infos.reserve(transient_textures.size());
+			for (auto &texture : transient_textures)
 			{
-				const auto      &resource = desc.GetPass(handle).GetPin(handle);
-				std::set<size_t> handles  = desc.LinkTo(handle);
-				handles.insert(handle);
-				texture_create_infos.push_back(RenderGraph::TextureCreateInfo{resource.texture, handles});
-				if (pool.handles.size() > 1)
-				{
-					alias_textures.insert(handle);
-				}
+				std::set<size_t> handles = desc.LinkTo(texture.handle);
+				handles.insert(texture.handle);
+				texture_create_infos.push_back(RenderGraph::TextureCreateInfo{desc.GetPass(texture.handle).GetPin(texture.handle).texture, handles, texture.offset});
 			}
-			render_graph->RegisterTexture(texture_create_infos);
+			render_graph->RegisterTexture(texture_create_infos, texture_heap_size);
 		}
-	}
 
-	// Resource state tracking
-	for (auto &resource_state : resource_states)
-	{
-		for (auto &[resource_handle, state_transition] : resource_state)
+		if (!transient_buffers.empty())
 		{
-			auto &[src, dst] = state_transition;
-			if (src.rhi_state == RHIResourceState::Undefined)
+			std::vector<RenderGraph::BufferCreateInfo> buffer_create_infos;
+			buffer_create_infos.reserve(transient_buffers.size());
+			for (auto &buffer : transient_buffers)
 			{
-				if (alias_textures.find(resource_handle) == alias_textures.end())
-				{
-					src = (--resource_lifetime[resource_handle].end())->second;
-				}
+				std::set<size_t> handles = desc.LinkTo(buffer.handle);
+				handles.insert(buffer.handle);
+				buffer_create_infos.push_back(RenderGraph::BufferCreateInfo{desc.GetPass(buffer.handle).GetPin(buffer.handle).buffer, handles, buffer.offset});
 			}
+			render_graph->RegisterBuffer(buffer_create_infos, buffer_heap_size);
 		}
+
+		aliased_resources = GetAliasedResources(transient_textures, transient_buffers);
+
+		LOG_INFO("Render graph <{}> transient memory: textures {:.2f} MB -> {:.2f} MB, buffers {:.2f} MB -> {:.2f} MB",
+		         desc.GetName(),
+		         static_cast<float>(texture_memory) / 1024.f / 1024.f,
+		         static_cast<float>(texture_heap_size) / 1024.f / 1024.f,
+		         static_cast<float>(buffer_memory) / 1024.f / 1024.f,
+		         static_cast<float>(buffer_heap_size) / 1024.f / 1024.f);
 	}
 
+	// Resource state tracking
+	schedule.CarryOverStates(aliased_resources);
+
 	// Initialize Barrier
 	{
 		std::vector<BufferStateTransition>  buffer_state_transitions;
 		std::vector<TextureStateTransition> texture_state_transitions;
 
-		for (auto &[handle, resource_states] : resource_lifetime)
+		for (auto &[handle, resource_states] : schedule.lifetimes)
 		{
 			const auto &resource = desc.GetPass(handle).GetPin(handle);
 			if ((--resource_states.end())->second.rhi_state != RHIResourceState::Undefined)
@@ -344,14 +253,14 @@ std::unique_ptr<RenderGraph> RenderGraphBuilder::Compile(RenderGraphDesc &desc,
 		RHIResourceState dst_state;
 	};
 
-	for (uint32_t i = 0; i < ordered_passes.size(); i++)
+	for (uint32_t i = 0; i < schedule.passes.size(); i++)
 	{
-		const auto &pass = desc.GetPass(ordered_passes[i]);
+		const auto &pass = desc.GetPass(schedule.passes[i]);
 
 		std::vector<ResourceStateTransitionInfo> buffer_state_transition_infos;
 		std::vector<ResourceStateTransitionInfo> texture_state_transition_infos;
 
-		for (auto &[handle, resource_transition] : resource_states[i])
+		for (auto &[handle, resource_transition] : schedule.transitions[i])
 		{
 			const auto &resource = desc.GetPass(handle).GetPin(handle);
 
@@ -441,7 +350,8 @@ std::unique_ptr<RenderGraph> RenderGraphBuilder::Compile(RenderGraphDesc &desc,
 			        });
 
 			    cmd_buffer->ResourceStateTransition(texture_state_transitions, buffer_state_transitions);
-		    });
+		    },
+		    schedule.record_groups[i]);
 	}
 
 	return render_graph;
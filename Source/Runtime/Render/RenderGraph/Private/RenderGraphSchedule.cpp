@@ -0,0 +1,263 @@
+#include "RenderGraph/RenderGraphSchedule.hpp"
+
+namespace Ilum
+{
+static inline size_t Align(size_t x, size_t alignment)
+{
+	return (x + alignment - 1) & ~(alignment - 1);
+}
+
+size_t PackTransientResources(std::vector<TransientResource> &resources, size_t alignment)
+{
+	// Large resources first, smaller ones fill the gaps
+	std::sort(resources.begin(), resources.end(), [](const TransientResource &lhs, const TransientResource &rhs) {
+		return lhs.size == rhs.size ? lhs.first < rhs.first : lhs.size > rhs.size;
+	});
+
+	size_t heap_size = 0;
+
+	std::vector<std::pair<size_t, size_t>> occupied;
+	for (size_t i = 0; i < resources.size(); i++)
+	{
+		auto &resource = resources[i];
+
+		occupied.clear();
+		for (size_t j = 0; j < i; j++)
+		{
+			if (resources[j].first <= resource.last && resource.first <= resources[j].last)
+			{
+				occupied.emplace_back(resources[j].offset, resources[j].offset + resources[j].size);
+			}
+		}
+		std::sort(occupied.begin(), occupied.end());
+
+		// First fit
+		size_t offset = 0;
+		for (auto &[begin, end] : occupied)
+		{
+			if (offset + resource.size <= begin)
+			{
+				break;
+			}
+			offset = std::max(offset, Align(end, alignment));
+		}
+
+		resource.offset = offset;
+		heap_size       = std::max(heap_size, offset + resource.size);
+	}
+
+	return heap_size;
+}
+
+std::set<size_t> GetAliasedResources(const std::vector<TransientResource> &textures, const std::vector<TransientResource> &buffers)
+{
+	std::set<size_t> aliased_resources;
+	for (auto *resources : {&textures, &buffers})
+	{
+		if (resources->size() > 1)
+		{
+			for (auto &resource : *resources)
+			{
+				aliased_resources.insert(resource.handle);
+			}
+		}
+	}
+	return aliased_resources;
+}
+
+RenderGraphSchedule RenderGraphSchedule::Build(RenderGraphDesc &desc)
+{
+	const std::unordered_map<BindPoint, RHIQueueFamily> queue_family_map = {
+	    {BindPoint::None, RHIQueueFamily::Graphics},
+	    {BindPoint::Rasterization, RHIQueueFamily::Graphics},
+	    {BindPoint::RayTracing, RHIQueueFamily::Compute},
+	    {BindPoint::Compute, RHIQueueFamily::Compute},
+	    {BindPoint::CUDA, RHIQueueFamily::Compute},
+	};
+
+	RenderGraphSchedule schedule;
+	schedule.passes.reserve(desc.GetPasses().size());
+
+	std::vector<size_t> pass_handles;
+
+	std::map<size_t, ResourceState> last_resource_state;
+
+	for (auto &[pass_handle, pass] : desc.GetPasses())
+	{
+		pass_handles.push_back(pass_handle);
+		for (auto &[pin_handle, pin] : pass.GetPins())
+		{
+			if (pin.attribute == RenderPassPin::Attribute::Output)
+			{
+				last_resource_state[pin_handle] = ResourceState{RHIResourceState::Undefined, queue_family_map.at(pass.GetBindPoint())};
+			}
+		}
+	}
+
+	std::set<size_t> collected_passes;
+
+	// Sorting passes
+	while (!pass_handles.empty())
+	{
+		uint32_t pass_idx = static_cast<uint32_t>(schedule.passes.size());
+
+		bool found = false;
+		for (auto iter = pass_handles.begin(); iter != pass_handles.end();)
+		{
+			auto &pass = desc.GetPass(*iter);
+
+			if (!desc.HasLink(pass.GetHandle()) ||
+			    collected_passes.find(desc.LinkFrom(pass.GetHandle())) != collected_passes.end())
+			{
+				std::map<size_t, std::pair<ResourceState, ResourceState>> pass_resource_state;
+
+				for (auto &[pin_handle, pin] : pass.GetPins())
+				{
+					size_t resource_pin = (pin.attribute == RenderPassPin::Attribute::Output) ? pin_handle : (desc.HasLink(pin_handle) ? desc.LinkFrom(pin_handle) : ~0ull);
+					if (resource_pin == ~0ull)
+					{
+						continue;
+					}
+
+					ResourceState resource_state = ResourceState{pin.resource_state, queue_family_map.at(pass.GetBindPoint())};
+
+					// Record resource state
+					if (pass.GetBindPoint() != BindPoint::CUDA)
+					{
+						pass_resource_state[resource_pin]          = std::make_pair(last_resource_state[resource_pin], resource_state);
+						last_resource_state[resource_pin]          = resource_state;
+						schedule.lifetimes[resource_pin][pass_idx] = resource_state;
+					}
+					else
+					{
+						ResourceState state = last_resource_state.find(resource_pin) != last_resource_state.end() ? last_resource_state[resource_pin] : ResourceState{RHIResourceState::Undefined, RHIQueueFamily::Graphics};
+
+						schedule.lifetimes[resource_pin][pass_idx] = state;
+						pass_resource_state[resource_pin]          = std::make_pair(state, state);
+					}
+
+					// Set resource info
+					auto &resource = desc.GetPass(resource_pin).GetPin(resource_pin);
+					if (resource.type == RenderPassPin::Type::Texture)
+					{
+						resource.texture.usage |= ResourceStateToTextureUsage(resource_state.rhi_state) | RHITextureUsage::Transfer;
+					}
+					else
+					{
+						resource.buffer.usage |= ResourceStateToBufferUsage(resource_state.rhi_state) | RHIBufferUsage::Transfer;
+					}
+				}
+
+				// Add pass
+				schedule.transitions.push_back(pass_resource_state);
+				schedule.passes.push_back(pass.GetHandle());
+				collected_passes.insert(pass.GetHandle());
+				pass_handles.erase(iter);
+				found = true;
+				break;
+			}
+			else
+			{
+				iter++;
+			}
+		}
+
+		if (!found)
+		{
+			LOG_ERROR("Render graph <{}> has a cycle, {} passes are dropped", desc.GetName(), pass_handles.size());
+			break;
+		}
+	}
+
+	// Record groups
+	schedule.record_groups.resize(schedule.passes.size(), 0);
+	{
+		std::map<size_t, uint32_t> pass_groups;            // Pass handle - Record group
+		std::map<size_t, uint32_t> resource_groups;        // Resource handle - First group allowed to touch it
+
+		for (uint32_t i = 0; i < schedule.passes.size(); i++)
+		{
+			uint32_t group = 0;
+
+			if (desc.HasLink(schedule.passes[i]))
+			{
+				size_t source = desc.GetPass(desc.LinkFrom(schedule.passes[i])).GetHandle();
+				if (pass_groups.find(source) != pass_groups.end())
+				{
+					group = std::max(group, pass_groups.at(source) + 1);
+				}
+			}
+
+			for (auto &[resource_handle, state_transition] : schedule.transitions[i])
+			{
+				if (resource_groups.find(resource_handle) != resource_groups.end())
+				{
+					group = std::max(group, resource_groups.at(resource_handle));
+				}
+			}
+
+			for (auto &[resource_handle, state_transition] : schedule.transitions[i])
+			{
+				resource_groups[resource_handle] = group + 1;
+			}
+
+			pass_groups[schedule.passes[i]] = group;
+			schedule.record_groups[i]       = group;
+		}
+	}
+
+	return schedule;
+}
+
+std::optional<std::pair<uint32_t, uint32_t>> RenderGraphSchedule::GetTransientLifetime(RenderGraphDesc &desc, size_t handle) const
+{
+	// Aliased memory is undefined at the start of every frame, only resources opting in can share it
+	if (!desc.GetPass(handle).GetPin(handle).transient)
+	{
+		return std::nullopt;
+	}
+
+	const auto &states = lifetimes.at(handle);
+
+	// CUDA passes import the whole allocation of a resource
+	for (auto &[pass_idx, state] : states)
+	{
+		if (desc.GetPass(passes[pass_idx]).GetBindPoint() == BindPoint::CUDA)
+		{
+			return std::nullopt;
+		}
+	}
+
+	uint32_t first = states.begin()->first;
+	uint32_t last  = (--states.end())->first;
+
+	// Resources handed out of the graph by a pass without outputs must live until the frame ends
+	bool sink = true;
+	for (auto &[pin_handle, pin] : desc.GetPass(passes[last]).GetPins())
+	{
+		sink &= pin.attribute != RenderPassPin::Attribute::Output;
+	}
+	if (sink)
+	{
+		last = static_cast<uint32_t>(passes.size());
+	}
+
+	return std::make_pair(first, last);
+}
+
+void RenderGraphSchedule::CarryOverStates(const std::set<size_t> &aliased_resources)
+{
+	for (auto &pass_transitions : transitions)
+	{
+		for (auto &[resource_handle, state_transition] : pass_transitions)
+		{
+			auto &[src, dst] = state_transition;
+			if (src.rhi_state == RHIResourceState::Undefined &&
+			    aliased_resources.find(resource_handle) == aliased_resources.end())
+			{
+				src = (--lifetimes[resource_handle].end())->second;
+			}
+		}
+	}
+}
+}        // namespace Ilum
\ No newline at end of file
@@ -80,6 +80,12 @@ RenderPassDesc &RenderPassDesc::ReadBuffer(size_t handle, const std::string &nam
 	return *this;
 }
 
+RenderPassDesc &RenderPassDesc::SetTransient(const std::string &name, bool transient)
+{
+	m_pins.at(m_pin_indices.at(name)).transient = transient;
+	return *this;
+}
+
 const RenderPassPin &RenderPassDesc::GetPin(size_t handle) const
 {
 	return m_pins.at(handle);
@@ -82,6 +82,9 @@ class  RenderGraph
 		BarrierTask barrier;
 
 		std::unique_ptr<RHIProfiler> profiler = nullptr;
+
+		// Passes in the same record group share no resources and can be recorded concurrently
+		uint32_t record_group = 0;
 	};
 
   public:
@@ -102,17 +105,24 @@ class  RenderGraph
 
 	const std::vector<RenderPassInfo> &GetRenderPasses() const;
 
+	// Record independent passes on job system workers, enabled by default
+	void SetParallelRecording(bool enable);
+
+	bool IsParallelRecording() const;
+
   private:
 	struct TextureCreateInfo
 	{
 		TextureDesc      desc;
 		std::set<size_t> handles;
+		size_t           offset = 0;        // Placement inside the aliasing heap
 	};
 
 	struct BufferCreateInfo
 	{
 		BufferDesc       desc;
 		std::set<size_t> handles;
+		size_t           offset = 0;        // Placement inside the aliasing heap
 	};
 
 	RenderGraph &AddPass(
@@ -121,20 +131,27 @@ class  RenderGraph
 	    BindPoint          bind_point,
 	    const Variant     &config,
 	    RenderTask       &&execute,
-	    BarrierTask      &&barrier);
+	    BarrierTask      &&barrier,
+	    uint32_t           record_group = ~0u);
 
 	RenderGraph &AddInitializeBarrier(InitializeBarrierTask &&barrier);
 
 	// Without memory alias
 	RenderGraph &RegisterTexture(const TextureCreateInfo &create_infos);
 
-	// With memory alias
-	RenderGraph &RegisterTexture(const std::vector<TextureCreateInfo> &create_info);
+	// With memory alias, textures are placed at their offsets in one heap
+	RenderGraph &RegisterTexture(const std::vector<TextureCreateInfo> &create_info, size_t heap_size);
 
+	// Without memory alias
 	RenderGraph &RegisterBuffer(const BufferCreateInfo &create_info);
 
+	// With memory alias, buffers are placed at their offsets in one heap
+	RenderGraph &RegisterBuffer(const std::vector<BufferCreateInfo> &create_info, size_t heap_size);
+
 	RHISemaphore *MapToCUDASemaphore(RHISemaphore *semaphore);
 
+	RHICommand *RecordPass(RenderPassInfo &pass, RenderGraphBlackboard &black_board);
+
   private:
 	struct Impl;
 	Impl *m_impl = nullptr;
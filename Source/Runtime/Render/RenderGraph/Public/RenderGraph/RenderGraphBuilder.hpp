@@ -16,7 +16,7 @@ class  RenderGraphBuilder
 
 	~RenderGraphBuilder() = default;
 
-	RenderGraphBuilder &AddPass(RenderGraph &render_graph, const std::string &name, const std::string &category, BindPoint bind_point, const Variant &config, RenderGraph::RenderTask &&task, RenderGraph::BarrierTask &&barrier);
+	RenderGraphBuilder &AddPass(RenderGraph &render_graph, const std::string &name, const std::string &category, BindPoint bind_point, const Variant &config, RenderGraph::RenderTask &&task, RenderGraph::BarrierTask &&barrier, uint32_t record_group = ~0u);
 
 	bool Validate(RenderGraphDesc &desc);
 
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Precompile.hpp"
+
+#include "RenderGraph.hpp"
+
+namespace Ilum
+{
+// Resource sharing one heap with others whose lifetimes do not overlap
+struct TransientResource
+{
+	size_t   handle;
+	uint32_t first;        // First pass index using the resource
+	uint32_t last;         // Last pass index using the resource
+	size_t   size;
+	size_t   offset = 0;
+};
+
+// Place resources into one heap so that resources alive at the same time never share memory, return the heap size
+size_t PackTransientResources(std::vector<TransientResource> &resources, size_t alignment);
+
+// Handles of the transient textures and buffers placed in a shared heap, a heap of one resource is a dedicated allocation
+// Their memory holds another resource's contents when their first pass starts, so they never carry over a state
+std::set<size_t> GetAliasedResources(const std::vector<TransientResource> &textures, const std::vector<TransientResource> &buffers);
+
+// Device independent part of render graph compilation: pass order, state transitions and record groups
+struct RenderGraphSchedule
+{
+	struct ResourceState
+	{
+		RHIResourceState rhi_state;
+		RHIQueueFamily   family;
+
+		bool operator==(const ResourceState &rhs) const
+		{
+			return rhi_state == rhs.rhi_state && family == rhs.family;
+		}
+	};
+
+	// Pass handles in execution order
+	std::vector<size_t> passes;
+
+	// Per pass, resource handle - (state before the pass, state inside the pass)
+	std::vector<std::map<size_t, std::pair<ResourceState, ResourceState>>> transitions;
+
+	// Resource handle - pass index - state
+	std::map<size_t, std::map<uint32_t, ResourceState>> lifetimes;
+
+	// Per pass, a pass is recorded after every earlier pass it is linked to or shares a resource with
+	std::vector<uint32_t> record_groups;
+
+	// Also adds the usages every pass needs to the resource descs
+	static RenderGraphSchedule Build(RenderGraphDesc &desc);
+
+	// First and last pass index a resource may be aliased in, nullopt if it needs memory of its own
+	std::optional<std::pair<uint32_t, uint32_t>> GetTransientLifetime(RenderGraphDesc &desc, size_t handle) const;
+
+	// Resources keeping their memory across frames start in the state the previous frame left them in
+	void CarryOverStates(const std::set<size_t> &aliased_resources);
+};
+}        // namespace Ilum
\ No newline at end of file
@@ -44,10 +44,13 @@ struct RenderPassPin
 
 	RHIResourceState resource_state;
 
+	// Contents only live within one frame, transient resources may share memory with others
+	bool transient = false;
+
 	template <typename Archive>
 	void serialize(Archive &archive)
 	{
-		archive(type, attribute, name, handle, texture, buffer, resource_state);
+		archive(type, attribute, name, handle, texture, buffer, resource_state, transient);
 	}
 };
 
@@ -72,6 +75,8 @@ class RenderPassDesc
 
 	RenderPassDesc &ReadBuffer(size_t handle, const std::string &name, RHIResourceState resource_state);
 
+	RenderPassDesc &SetTransient(const std::string &name, bool transient = true);
+
 	const RenderPassPin &GetPin(size_t handle) const;
 
 	RenderPassPin &GetPin(size_t handle);
@@ -0,0 +1,87 @@
+#include "RenderData.hpp"
+
+namespace Ilum
+{
+static_assert(sizeof(GPUScene::AnimationBuffer::SkinningEntry) == 16, "Skinning entry must match the shader layout");
+
+uint64_t UploadInstances(RHIContext *rhi_context, std::unique_ptr<RHIBuffer> &buffer, const std::vector<GPUScene::Instance> &instances, const std::vector<uint32_t> *dirty)
+{
+	if (instances.empty())
+	{
+		return 0;
+	}
+
+	if (!dirty)
+	{
+		if (!buffer || buffer->GetDesc().size < instances.size() * sizeof(GPUScene::Instance))
+		{
+			buffer = rhi_context->CreateBuffer<GPUScene::Instance>(instances.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+		}
+		buffer->CopyToDevice(instances.data(), instances.size() * sizeof(GPUScene::Instance));
+		return instances.size() * sizeof(GPUScene::Instance);
+	}
+
+	uint64_t bytes = 0;
+	for (size_t begin = 0; begin < dirty->size();)
+	{
+		size_t end = begin + 1;
+		while (end < dirty->size() && (*dirty)[end] == (*dirty)[end - 1] + 1)
+		{
+			end++;
+		}
+
+		uint32_t first = (*dirty)[begin];
+		size_t   size  = ((*dirty)[end - 1] - first + 1) * sizeof(GPUScene::Instance);
+		buffer->CopyToDevice(instances.data() + first, size, first * sizeof(GPUScene::Instance));
+
+		bytes += size;
+		begin = end;
+	}
+
+	return bytes;
+}
+
+uint32_t BuildSkinningTable(const std::vector<uint32_t> &bone_counts, const std::vector<uint32_t> &frame_counts, std::vector<GPUScene::AnimationBuffer::SkinningEntry> &table)
+{
+	table.resize(bone_counts.size());
+
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < bone_counts.size(); i++)
+	{
+		auto &entry = table[i];
+
+		// Clips without baked frames keep their slot for animation_id but are not evaluated
+		entry.animation_id = i;
+		entry.bone_count   = frame_counts[i] > 0 ? bone_counts[i] : 0;
+		entry.offset       = offset;
+		entry.frame_count  = frame_counts[i];
+
+		offset += entry.bone_count;
+	}
+
+	return offset;
+}
+
+bool ValidateSkinningTable(const std::vector<GPUScene::AnimationBuffer::SkinningEntry> &table, uint32_t thread_count)
+{
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < table.size(); i++)
+	{
+		auto &entry = table[i];
+		if (entry.offset != offset || (entry.bone_count > 0 && entry.frame_count == 0) || entry.animation_id != i)
+		{
+			LOG_ERROR("Invalid skinning table entry {}: animation {}, bones {}, offset {} (expected {}), frames {}", i, entry.animation_id, entry.bone_count, entry.offset, offset, entry.frame_count);
+			return false;
+		}
+		offset += entry.bone_count;
+	}
+
+	if (offset != thread_count)
+	{
+		LOG_ERROR("Skinning table covers {} threads, dispatch expects {}", offset, thread_count);
+		return false;
+	}
+
+	return true;
+}
+}        // namespace Ilum
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "RenderData.hpp"
 
 #include <Core/Path.hpp>
+#include <Geometry/Frustum.hpp>
 #include <Material/MaterialCompiler.hpp>
 #include <Material/MaterialData.hpp>
 #include <RHI/RHIContext.hpp>
@@ -51,8 +52,86 @@ struct Renderer::Impl
 	bool  update_animation = false;
 
 	Cmpt::Camera *main_camera = nullptr;
+
+	// CPU mirror of the instance buffers, patched in place when only transforms move
+	struct InstanceCache
+	{
+		struct Entry
+		{
+			Cmpt::Transform *transform = nullptr;
+			uint64_t         version   = 0;
+			bool             opaque    = true;
+			uint32_t         index     = 0;
+			AABB             aabb;        // Object space
+		};
+
+		std::vector<Cmpt::Renderable *> components;
+		std::vector<Entry>              entries;
+
+		std::vector<GPUScene::Instance> opaque_instances;
+		std::vector<GPUScene::Instance> non_opaque_instances;
+
+		TLASDesc opaque_tlas_desc;
+		TLASDesc non_opaque_tlas_desc;
+
+		bool dirty    = true;
+		bool complete = true;
+
+		void Reset()
+		{
+			components.clear();
+			entries.clear();
+			opaque_instances.clear();
+			non_opaque_instances.clear();
+			opaque_tlas_desc.instances.clear();
+			non_opaque_tlas_desc.instances.clear();
+			dirty    = false;
+			complete = true;
+		}
+	};
+
+	InstanceCache mesh_cache;
+	InstanceCache skinned_mesh_cache;
 };
 
+static constexpr uint32_t SkinningGroupSize = 64;        // Must match numthreads in Source/Shaders/UpdateBoneMatrics.hlsl
+
+// Compacts the instances overlapping the frustum, everything is visible without a camera. Returns the culled count
+static uint32_t CullInstances(RHIContext *rhi_context, const Frustum *frustum, const std::vector<GPUScene::InstanceBound> &bounds, std::vector<uint32_t> &visible_instances, std::unique_ptr<RHIBuffer> &buffer)
+{
+	visible_instances.clear();
+
+	if (bounds.empty())
+	{
+		return 0;
+	}
+
+	std::vector<uint8_t> visible(bounds.size(), 1);
+	if (frustum)
+	{
+		frustum->Intersect(&bounds[0].aabb, bounds.size(), sizeof(GPUScene::InstanceBound), visible.data());
+	}
+
+	for (uint32_t i = 0; i < bounds.size(); i++)
+	{
+		if (visible[i])
+		{
+			visible_instances.push_back(i);
+		}
+	}
+
+	if (!visible_instances.empty())
+	{
+		if (!buffer || buffer->GetDesc().count < visible_instances.size())
+		{
+			buffer = rhi_context->CreateBuffer<uint32_t>(visible_instances.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+		}
+		buffer->CopyToDevice(visible_instances.data(), visible_instances.size() * sizeof(uint32_t));
+	}
+
+	return static_cast<uint32_t>(bounds.size() - visible_instances.size());
+}
+
 Renderer::Renderer(RHIContext *rhi_context, Scene *scene, ResourceManager *resource_manager)
 {
 	m_impl                        = new Impl;
@@ -81,7 +160,12 @@ Renderer::Renderer(RHIContext *rhi_context, Scene *scene, ResourceManager *resou
 		gpu_scene->opaque_tlas     = m_impl->rhi_context->CreateAcccelerationStructure();
 		gpu_scene->non_opaque_tlas = m_impl->rhi_context->CreateAcccelerationStructure();
 
-		gpu_scene->animation.update_info = m_impl->rhi_context->CreateBuffer<GPUScene::AnimationBuffer::UpdateInfo>(1, RHIBufferUsage::ConstantBuffer, RHIMemoryUsage::CPU_TO_GPU);
+		gpu_scene->animation.update_info       = m_impl->rhi_context->CreateBuffer<GPUScene::AnimationBuffer::UpdateInfo>(1, RHIBufferUsage::ConstantBuffer, RHIMemoryUsage::CPU_TO_GPU);
+		gpu_scene->animation.skinning_indirect = m_impl->rhi_context->CreateBuffer<RHIDispatchIndirectCommand>(1, RHIBufferUsage::Indirect, RHIMemoryUsage::CPU_TO_GPU);
+
+		// Skinned passes bind the palette and the table even before any animation is loaded
+		gpu_scene->animation.bone_matrics          = m_impl->rhi_context->CreateBuffer<glm::mat4>(1, RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::GPU_Only);
+		gpu_scene->animation.skinning_table_buffer = m_impl->rhi_context->CreateBuffer<GPUScene::AnimationBuffer::SkinningEntry>(1, RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
 	}
 
 	// Dummy Textures
@@ -170,6 +254,16 @@ void Renderer::Tick()
 {
 	m_impl->present_texture = nullptr;
 
+	// Renderable changes alter the instance layout, moved transforms are tracked by version
+	for (auto *mesh : m_impl->scene->GetComponents<Cmpt::MeshRenderer>())
+	{
+		m_impl->mesh_cache.dirty |= mesh->IsUpdate();
+	}
+	for (auto *skinned_mesh : m_impl->scene->GetComponents<Cmpt::SkinnedMeshRenderer>())
+	{
+		m_impl->skinned_mesh_cache.dirty |= skinned_mesh->IsUpdate();
+	}
+
 	m_impl->scene->Update();
 
 	UpdateGPUScene();
@@ -230,6 +324,11 @@ void Renderer::SetAnimationTime(float time)
 	m_impl->update_animation = true;
 }
 
+float Renderer::GetAnimationTime() const
+{
+	return m_impl->animation_time;
+}
+
 void Renderer::SetPresentTexture(RHITexture *present_texture)
 {
 	m_impl->present_texture = present_texture;
@@ -315,7 +414,7 @@ void Renderer::UpdateLight()
 		auto    *light_buffer = gpu_scene->light.BUFFER->Map();                                                                                   \
 		size_t   offset       = 0;                                                                                                                \
 		uint32_t shadow_id    = 0;                                                                                                                \
-		for (auto &light : DATA)                                                                                                                  \
+		for (auto *light : DATA)                                                                                                                  \
 		{                                                                                                                                         \
 			light->SetShadowID(shadow_id);                                                                                                        \
 			std::memcpy((uint8_t *) light_buffer + offset, light->GetData(m_impl->main_camera), light->GetDataSize());                            \
@@ -365,40 +464,30 @@ void Renderer::UpdateAnimation()
 {
 	auto *gpu_scene = m_impl->black_board.Get<GPUScene>();
 
-	// Update animation
-	if (gpu_scene->animation.max_bone_count > 0 && m_impl->update_animation)
+	// Update animation, every bone palette is evaluated by a single indirect dispatch over the skinning table
+	if (gpu_scene->animation.skinning_thread_count > 0 && m_impl->update_animation)
 	{
 		{
 			GPUScene::AnimationBuffer::UpdateInfo update_info = {};
 
-			update_info.count = static_cast<uint32_t>(gpu_scene->animation.bone_matrics.size());
+			update_info.count = static_cast<uint32_t>(gpu_scene->animation.skinning_table.size());
 			update_info.time  = m_impl->animation_time;
 			gpu_scene->animation.update_info->CopyToDevice(&update_info, sizeof(update_info));
 		}
 
-		std::vector<BufferStateTransition> begin_transitions(gpu_scene->animation.bone_matrics.size());
-		std::vector<BufferStateTransition> end_transitions(gpu_scene->animation.bone_matrics.size());
-
-		for (size_t i = 0; i < gpu_scene->animation.bone_matrics.size(); i++)
-		{
-			begin_transitions[i] = BufferStateTransition{gpu_scene->animation.bone_matrics[i], RHIResourceState::ShaderResource, RHIResourceState::UnorderedAccess};
-			end_transitions[i]   = BufferStateTransition{gpu_scene->animation.bone_matrics[i], RHIResourceState::UnorderedAccess, RHIResourceState::ShaderResource};
-		}
-
 		auto *descriptor = m_impl->rhi_context->CreateDescriptor(m_impl->gpu_skinning_shader_meta);
-		descriptor->BindBuffer("UpdateInfo", gpu_scene->animation.update_info.get());
+		descriptor->BindBuffer("UpdateInfo", gpu_scene->animation.update_info.get())
+		    .BindBuffer("SkinningTable", gpu_scene->animation.skinning_table_buffer.get())
+		    .BindBuffer("BoneMatrics", gpu_scene->animation.bone_matrics.get())
+		    .BindTexture("SkinnedMatrics", gpu_scene->animation.skinned_matrics, RHITextureDimension::Texture2D);
+
 		auto *cmd_buffer = m_impl->rhi_context->CreateCommand(RHIQueueFamily::Compute);
 		cmd_buffer->Begin();
-		cmd_buffer->ResourceStateTransition({}, begin_transitions);
-		for (size_t i = 0; i < gpu_scene->animation.bone_matrics.size(); i++)
-		{
-			descriptor->BindBuffer("BoneMatrics", gpu_scene->animation.bone_matrics[i])
-			    .BindTexture("SkinnedMatrics", gpu_scene->animation.skinned_matrics[i], RHITextureDimension::Texture2D);
-			cmd_buffer->BindDescriptor(descriptor);
-			cmd_buffer->BindPipelineState(m_impl->gpu_skinning_pipeline.get());
-			cmd_buffer->Dispatch(gpu_scene->animation.max_bone_count, 1, 1, 8, 1, 1);
-		}
-		cmd_buffer->ResourceStateTransition({}, end_transitions);
+		cmd_buffer->ResourceStateTransition({}, {BufferStateTransition{gpu_scene->animation.bone_matrics.get(), RHIResourceState::ShaderResource, RHIResourceState::UnorderedAccess}});
+		cmd_buffer->BindDescriptor(descriptor);
+		cmd_buffer->BindPipelineState(m_impl->gpu_skinning_pipeline.get());
+		cmd_buffer->DispatchIndirect(gpu_scene->animation.skinning_indirect.get(), 0);
+		cmd_buffer->ResourceStateTransition({}, {BufferStateTransition{gpu_scene->animation.bone_matrics.get(), RHIResourceState::UnorderedAccess, RHIResourceState::ShaderResource}});
 		cmd_buffer->End();
 		m_impl->rhi_context->Submit({cmd_buffer});
 		m_impl->update_animation = false;
@@ -409,133 +498,210 @@ void Renderer::UpdateAnimation()
 	{
 		m_impl->scene->Update(true);
 
-		gpu_scene->animation.bone_matrics.clear();
 		gpu_scene->animation.skinned_matrics.clear();
 
 		auto resources = m_impl->resource_manager->GetResources<ResourceType::Animation>();
 
+		std::vector<uint32_t> bone_counts;
+		std::vector<uint32_t> frame_counts;
+		bone_counts.reserve(resources.size());
+		frame_counts.reserve(resources.size());
+
 		gpu_scene->animation.max_bone_count  = 0;
 		gpu_scene->animation.max_frame_count = 0;
 		for (auto &resource : resources)
 		{
 			auto *animation = m_impl->resource_manager->Get<ResourceType::Animation>(resource);
 			gpu_scene->animation.skinned_matrics.push_back(animation->GetSkinnedMatrics());
-			gpu_scene->animation.bone_matrics.push_back(animation->GetBoneMatrics());
+			bone_counts.push_back(animation->GetBoneCount());
+			frame_counts.push_back(animation->GetFrameCount());
 			gpu_scene->animation.max_bone_count  = glm::max(gpu_scene->animation.max_bone_count, animation->GetBoneCount());
 			gpu_scene->animation.max_frame_count = glm::max(gpu_scene->animation.max_frame_count, animation->GetFrameCount());
 		}
+
+		gpu_scene->animation.skinning_thread_count = BuildSkinningTable(bone_counts, frame_counts, gpu_scene->animation.skinning_table);
+
+		if (!ValidateSkinningTable(gpu_scene->animation.skinning_table, gpu_scene->animation.skinning_thread_count))
+		{
+			gpu_scene->animation.skinning_table.clear();
+			gpu_scene->animation.skinning_thread_count = 0;
+		}
+
+		if (!gpu_scene->animation.skinning_table.empty())
+		{
+			auto &table = gpu_scene->animation.skinning_table;
+			if (gpu_scene->animation.skinning_table_buffer->GetDesc().size < table.size() * sizeof(GPUScene::AnimationBuffer::SkinningEntry))
+			{
+				gpu_scene->animation.skinning_table_buffer = m_impl->rhi_context->CreateBuffer<GPUScene::AnimationBuffer::SkinningEntry>(table.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+			}
+			gpu_scene->animation.skinning_table_buffer->CopyToDevice(table.data(), table.size() * sizeof(GPUScene::AnimationBuffer::SkinningEntry));
+
+			if (gpu_scene->animation.bone_matrics->GetDesc().size < gpu_scene->animation.skinning_thread_count * sizeof(glm::mat4))
+			{
+				gpu_scene->animation.bone_matrics = m_impl->rhi_context->CreateBuffer<glm::mat4>(gpu_scene->animation.skinning_thread_count, RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::GPU_Only);
+			}
+
+			RHIDispatchIndirectCommand command = {(gpu_scene->animation.skinning_thread_count + SkinningGroupSize - 1) / SkinningGroupSize, 1, 1};
+			gpu_scene->animation.skinning_indirect->CopyToDevice(&command, sizeof(command));
+		}
+
+		m_impl->update_animation = true;
 	}
 }
 
 void Renderer::UpdateMesh()
 {
 	auto *gpu_scene = m_impl->black_board.Get<GPUScene>();
+	auto &cache     = m_impl->mesh_cache;
 
 	auto meshes = m_impl->scene->GetComponents<Cmpt::MeshRenderer>();
 
-	TLASDesc opaque_tlas_desc     = {fmt::format("{} - Opaque", m_impl->scene->GetName())};
-	TLASDesc non_opaque_tlas_desc = {fmt::format("{} - Non Opaque", m_impl->scene->GetName())};
-
-	std::vector<GPUScene::Instance> opaque_instances;
-	std::vector<GPUScene::Instance> non_opaque_instances;
+	// Anything other than a moved transform changes the instance layout
+	bool rebuild = cache.dirty || !cache.complete ||
+	               m_impl->resource_manager->Update<ResourceType::Mesh>() ||
+	               m_impl->resource_manager->Update<ResourceType::Material>() ||
+	               !std::equal(meshes.begin(), meshes.end(), cache.components.begin(), cache.components.end());
 
-	gpu_scene->opaque_mesh.max_meshlet_count     = 0;
-	gpu_scene->non_opaque_mesh.max_meshlet_count = 0;
+	std::vector<uint32_t> opaque_dirty;
+	std::vector<uint32_t> non_opaque_dirty;
 
 	// Update mesh instances
+	if (rebuild)
 	{
-		for (auto &mesh : meshes)
+		cache.Reset();
+		cache.components.assign(meshes.begin(), meshes.end());
+
+		cache.opaque_tlas_desc     = {fmt::format("{} - Opaque", m_impl->scene->GetName())};
+		cache.non_opaque_tlas_desc = {fmt::format("{} - Non Opaque", m_impl->scene->GetName())};
+
+		gpu_scene->opaque_mesh.max_meshlet_count     = 0;
+		gpu_scene->non_opaque_mesh.max_meshlet_count = 0;
+		gpu_scene->opaque_mesh.bounds.clear();
+		gpu_scene->non_opaque_mesh.bounds.clear();
+
+		for (auto *mesh : meshes)
 		{
 			auto &submeshes = mesh->GetSubmeshes();
 			auto &materials = mesh->GetMaterials();
+			auto *transform = mesh->GetNode()->GetComponent<Cmpt::Transform>();
 			for (uint32_t i = 0; i < submeshes.size(); i++)
 			{
 				auto &submesh = submeshes[i];
 
-				auto *resource = m_impl->resource_manager->Get<ResourceType::Mesh>(submesh);
+				// Meshes are skipped until they are streamed in
+				auto *resource = m_impl->resource_manager->Request<ResourceType::Mesh>(submesh);
 
-				if (resource)
+				if (resource && resource->GetState() == ResourceState::Resident)
 				{
 					GPUScene::Instance instance = {};
-					instance.transform          = mesh->GetNode()->GetComponent<Cmpt::Transform>()->GetWorldTransform();
+					instance.transform          = transform->GetWorldTransform();
 					instance.mesh_id            = static_cast<uint32_t>(m_impl->resource_manager->Index<ResourceType::Mesh>(submesh));
 					instance.material_id        = 0;
 
+					bool opaque = true;
 					if (i < materials.size())
 					{
 						instance.material_id = static_cast<uint32_t>(m_impl->resource_manager->Index<ResourceType::Material>(materials[i])) + 1;
 						auto *material       = m_impl->resource_manager->Get<ResourceType::Material>(materials[i]);
-						if (material->GetMaterialData().blend_mode == BlendMode::Opaque)
-						{
-							opaque_instances.push_back(instance);
-							opaque_tlas_desc.instances.push_back(TLASDesc::InstanceInfo{instance.transform, instance.material_id, resource->GetBLAS()});
-							gpu_scene->opaque_mesh.max_meshlet_count = glm::max(gpu_scene->opaque_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
-						}
-						else
-						{
-							non_opaque_instances.push_back(instance);
-							non_opaque_tlas_desc.instances.push_back(TLASDesc::InstanceInfo{instance.transform, instance.material_id, resource->GetBLAS()});
-							gpu_scene->non_opaque_mesh.max_meshlet_count = glm::max(gpu_scene->non_opaque_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
-						}
+						opaque               = material->GetMaterialData().blend_mode == BlendMode::Opaque;
 					}
-					else
+
+					GPUScene::InstanceBound bound = {};
+					bound.aabb                    = resource->GetAABB().Transform(instance.transform);
+					bound.mesh_id                 = instance.mesh_id;
+					bound.meshlet_count           = static_cast<uint32_t>(resource->GetMeshletCount());
+
+					if (opaque)
 					{
-						opaque_instances.push_back(instance);
-						opaque_tlas_desc.instances.push_back(TLASDesc::InstanceInfo{instance.transform, instance.material_id, resource->GetBLAS()});
+						cache.entries.push_back({transform, transform->GetVersion(), true, static_cast<uint32_t>(cache.opaque_instances.size()), resource->GetAABB()});
+						cache.opaque_instances.push_back(instance);
+						gpu_scene->opaque_mesh.bounds.push_back(bound);
+						cache.opaque_tlas_desc.instances.push_back(TLASDesc::InstanceInfo{instance.transform, instance.material_id, resource->GetBLAS()});
 						gpu_scene->opaque_mesh.max_meshlet_count = glm::max(gpu_scene->opaque_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
 					}
+					else
+					{
+						cache.entries.push_back({transform, transform->GetVersion(), false, static_cast<uint32_t>(cache.non_opaque_instances.size()), resource->GetAABB()});
+						cache.non_opaque_instances.push_back(instance);
+						gpu_scene->non_opaque_mesh.bounds.push_back(bound);
+						cache.non_opaque_tlas_desc.instances.push_back(TLASDesc::InstanceInfo{instance.transform, instance.material_id, resource->GetBLAS()});
+						gpu_scene->non_opaque_mesh.max_meshlet_count = glm::max(gpu_scene->non_opaque_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
+					}
+				}
+				else if (resource)
+				{
+					// Rebuild again once the pending mesh becomes resident
+					cache.complete = false;
 				}
 			}
 		}
 
-		gpu_scene->opaque_mesh.instance_count     = static_cast<uint32_t>(opaque_instances.size());
-		gpu_scene->non_opaque_mesh.instance_count = static_cast<uint32_t>(non_opaque_instances.size());
+		gpu_scene->opaque_mesh.instance_count     = static_cast<uint32_t>(cache.opaque_instances.size());
+		gpu_scene->non_opaque_mesh.instance_count = static_cast<uint32_t>(cache.non_opaque_instances.size());
 	}
-
-	// Copy to device
+	else
 	{
-		if (!opaque_instances.empty())
+		// Only patch instances whose transform moved since the last upload
+		for (auto &entry : cache.entries)
 		{
-			if (!gpu_scene->opaque_mesh.instances ||
-			    gpu_scene->opaque_mesh.instances->GetDesc().size < opaque_instances.size() * sizeof(GPUScene::Instance))
+			if (entry.transform->GetVersion() == entry.version)
 			{
-				gpu_scene->opaque_mesh.instances = m_impl->rhi_context->CreateBuffer<GPUScene::Instance>(opaque_instances.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+				continue;
 			}
-			gpu_scene->opaque_mesh.instances->CopyToDevice(opaque_instances.data(), opaque_instances.size() * sizeof(GPUScene::Instance));
-		}
 
-		if (!non_opaque_instances.empty())
-		{
-			if (!gpu_scene->non_opaque_mesh.instances ||
-			    gpu_scene->non_opaque_mesh.instances->GetDesc().size < non_opaque_instances.size() * sizeof(GPUScene::Instance))
+			entry.version = entry.transform->GetVersion();
+
+			glm::mat4 transform = entry.transform->GetWorldTransform();
+			if (entry.opaque)
 			{
-				gpu_scene->non_opaque_mesh.instances = m_impl->rhi_context->CreateBuffer<GPUScene::Instance>(non_opaque_instances.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+				cache.opaque_instances[entry.index].transform                = transform;
+				cache.opaque_tlas_desc.instances[entry.index].transform      = transform;
+				gpu_scene->opaque_mesh.bounds[entry.index].aabb              = entry.aabb.Transform(transform);
+				opaque_dirty.push_back(entry.index);
+			}
+			else
+			{
+				cache.non_opaque_instances[entry.index].transform           = transform;
+				cache.non_opaque_tlas_desc.instances[entry.index].transform = transform;
+				gpu_scene->non_opaque_mesh.bounds[entry.index].aabb         = entry.aabb.Transform(transform);
+				non_opaque_dirty.push_back(entry.index);
 			}
-			gpu_scene->non_opaque_mesh.instances->CopyToDevice(non_opaque_instances.data(), non_opaque_instances.size() * sizeof(GPUScene::Instance));
 		}
+
+		gpu_scene->statistics.dirty_instances += static_cast<uint32_t>(opaque_dirty.size() + non_opaque_dirty.size());
 	}
 
-	// Update TLAS
+	// Copy to device
 	{
-		if (!opaque_tlas_desc.instances.empty())
+		gpu_scene->statistics.upload_bytes += UploadInstances(m_impl->rhi_context, gpu_scene->opaque_mesh.instances, cache.opaque_instances, rebuild ? nullptr : &opaque_dirty);
+		gpu_scene->statistics.upload_bytes += UploadInstances(m_impl->rhi_context, gpu_scene->non_opaque_mesh.instances, cache.non_opaque_instances, rebuild ? nullptr : &non_opaque_dirty);
+	}
+
+	// Update TLAS, the acceleration structure is refit when only transforms changed
+	{
+		if (!cache.opaque_tlas_desc.instances.empty() && (rebuild || !opaque_dirty.empty()))
 		{
 			auto *cmd_buffer = m_impl->rhi_context->CreateCommand(RHIQueueFamily::Compute);
 			cmd_buffer->Begin();
-			gpu_scene->opaque_tlas->Update(cmd_buffer, opaque_tlas_desc);
+			gpu_scene->opaque_tlas->Update(cmd_buffer, cache.opaque_tlas_desc);
 			cmd_buffer->End();
 			m_impl->rhi_context->Submit({cmd_buffer});
+			gpu_scene->statistics.tlas_updates++;
 		}
 
-		if (!non_opaque_tlas_desc.instances.empty())
+		if (!cache.non_opaque_tlas_desc.instances.empty() && (rebuild || !non_opaque_dirty.empty()))
 		{
 			auto *cmd_buffer = m_impl->rhi_context->CreateCommand(RHIQueueFamily::Compute);
 			cmd_buffer->Begin();
-			gpu_scene->non_opaque_tlas->Update(cmd_buffer, non_opaque_tlas_desc);
+			gpu_scene->non_opaque_tlas->Update(cmd_buffer, cache.non_opaque_tlas_desc);
 			cmd_buffer->End();
 			m_impl->rhi_context->Submit({cmd_buffer});
+			gpu_scene->statistics.tlas_updates++;
 		}
 	}
 
+	gpu_scene->statistics.rebuild |= rebuild;
+
 	// Update resource
 	if (m_impl->resource_manager->Update<ResourceType::Mesh>())
 	{
@@ -560,21 +726,36 @@ void Renderer::UpdateMesh()
 void Renderer::UpdateSkinnedMesh()
 {
 	auto *gpu_scene      = m_impl->black_board.Get<GPUScene>();
+	auto &cache          = m_impl->skinned_mesh_cache;
 	auto  skinned_meshes = m_impl->scene->GetComponents<Cmpt::SkinnedMeshRenderer>();
 
-	std::vector<GPUScene::Instance> opaque_instances;
-	std::vector<GPUScene::Instance> non_opaque_instances;
+	// Anything other than a moved transform changes the instance layout
+	bool rebuild = cache.dirty ||
+	               m_impl->resource_manager->Update<ResourceType::SkinnedMesh>() ||
+	               m_impl->resource_manager->Update<ResourceType::Animation>() ||
+	               m_impl->resource_manager->Update<ResourceType::Material>() ||
+	               !std::equal(skinned_meshes.begin(), skinned_meshes.end(), cache.components.begin(), cache.components.end());
 
-	gpu_scene->opaque_skinned_mesh.max_meshlet_count     = 0;
-	gpu_scene->non_opaque_skinned_mesh.max_meshlet_count = 0;
+	std::vector<uint32_t> opaque_dirty;
+	std::vector<uint32_t> non_opaque_dirty;
 
 	// Update skinned mesh instances
+	if (rebuild)
 	{
-		for (auto &skinned_mesh : skinned_meshes)
+		cache.Reset();
+		cache.components.assign(skinned_meshes.begin(), skinned_meshes.end());
+
+		gpu_scene->opaque_skinned_mesh.max_meshlet_count     = 0;
+		gpu_scene->non_opaque_skinned_mesh.max_meshlet_count = 0;
+		gpu_scene->opaque_skinned_mesh.bounds.clear();
+		gpu_scene->non_opaque_skinned_mesh.bounds.clear();
+
+		for (auto *skinned_mesh : skinned_meshes)
 		{
 			auto &submeshes  = skinned_mesh->GetSubmeshes();
 			auto &animations = skinned_mesh->GetAnimations();
 			auto &materials  = skinned_mesh->GetMaterials();
+			auto *transform  = skinned_mesh->GetNode()->GetComponent<Cmpt::Transform>();
 			for (uint32_t i = 0; i < submeshes.size(); i++)
 			{
 				auto *resource = m_impl->resource_manager->Get<ResourceType::SkinnedMesh>(submeshes[i]);
@@ -582,66 +763,94 @@ void Renderer::UpdateSkinnedMesh()
 				if (resource)
 				{
 					GPUScene::Instance instance = {};
-					instance.transform          = skinned_mesh->GetNode()->GetComponent<Cmpt::Transform>()->GetWorldTransform();
+					instance.transform          = transform->GetWorldTransform();
 					instance.mesh_id            = static_cast<uint32_t>(m_impl->resource_manager->Index<ResourceType::SkinnedMesh>(submeshes[i]));
 					instance.material_id        = 0;
+					instance.position_offset    = resource->GetPositionOffset();
+					instance.position_scale     = resource->GetPositionScale();
 
 					if (i < animations.size())
 					{
 						instance.animation_id = static_cast<uint32_t>(m_impl->resource_manager->Index<ResourceType::Animation>(animations[i]));
 					}
 
+					bool opaque = true;
 					if (i < materials.size())
 					{
 						instance.material_id = static_cast<uint32_t>(m_impl->resource_manager->Index<ResourceType::Material>(materials[i])) + 1;
 						auto *material       = m_impl->resource_manager->Get<ResourceType::Material>(materials[i]);
-						if (material->GetMaterialData().blend_mode == BlendMode::Opaque)
-						{
-							opaque_instances.push_back(instance);
-							gpu_scene->opaque_skinned_mesh.max_meshlet_count = glm::max(gpu_scene->opaque_skinned_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
-						}
-						else
-						{
-							non_opaque_instances.push_back(instance);
-							gpu_scene->non_opaque_skinned_mesh.max_meshlet_count = glm::max(gpu_scene->non_opaque_skinned_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
-						}
+						opaque               = material->GetMaterialData().blend_mode == BlendMode::Opaque;
 					}
-					else
+
+					// Bind pose bound inflated by half its extent to roughly cover the animated poses
+					glm::vec3 extent = resource->GetPositionScale() * 0.5f;
+					AABB      aabb   = AABB(resource->GetPositionOffset() - extent, resource->GetPositionOffset() + resource->GetPositionScale() + extent);
+
+					GPUScene::InstanceBound bound = {};
+					bound.aabb                    = aabb.Transform(instance.transform);
+					bound.mesh_id                 = instance.mesh_id;
+					bound.meshlet_count           = static_cast<uint32_t>(resource->GetMeshletCount());
+					bound.animated                = instance.animation_id != ~0U;
+
+					if (opaque)
 					{
-						opaque_instances.push_back(instance);
+						cache.entries.push_back({transform, transform->GetVersion(), true, static_cast<uint32_t>(cache.opaque_instances.size()), aabb});
+						cache.opaque_instances.push_back(instance);
+						gpu_scene->opaque_skinned_mesh.bounds.push_back(bound);
 						gpu_scene->opaque_skinned_mesh.max_meshlet_count = glm::max(gpu_scene->opaque_skinned_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
 					}
+					else
+					{
+						cache.entries.push_back({transform, transform->GetVersion(), false, static_cast<uint32_t>(cache.non_opaque_instances.size()), aabb});
+						cache.non_opaque_instances.push_back(instance);
+						gpu_scene->non_opaque_skinned_mesh.bounds.push_back(bound);
+						gpu_scene->non_opaque_skinned_mesh.max_meshlet_count = glm::max(gpu_scene->non_opaque_skinned_mesh.max_meshlet_count, static_cast<uint32_t>(resource->GetMeshletCount()));
+					}
 				}
 			}
 		}
 
-		gpu_scene->opaque_skinned_mesh.instance_count     = static_cast<uint32_t>(opaque_instances.size());
-		gpu_scene->non_opaque_skinned_mesh.instance_count = static_cast<uint32_t>(non_opaque_instances.size());
+		gpu_scene->opaque_skinned_mesh.instance_count     = static_cast<uint32_t>(cache.opaque_instances.size());
+		gpu_scene->non_opaque_skinned_mesh.instance_count = static_cast<uint32_t>(cache.non_opaque_instances.size());
 	}
-
-	// Copy to device
+	else
 	{
-		if (!opaque_instances.empty())
+		// Only patch instances whose transform moved since the last upload
+		for (auto &entry : cache.entries)
 		{
-			if (!gpu_scene->opaque_skinned_mesh.instances ||
-			    gpu_scene->opaque_skinned_mesh.instances->GetDesc().size < opaque_instances.size() * sizeof(GPUScene::Instance))
+			if (entry.transform->GetVersion() == entry.version)
 			{
-				gpu_scene->opaque_skinned_mesh.instances = m_impl->rhi_context->CreateBuffer<GPUScene::Instance>(opaque_instances.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+				continue;
 			}
-			gpu_scene->opaque_skinned_mesh.instances->CopyToDevice(opaque_instances.data(), opaque_instances.size() * sizeof(GPUScene::Instance));
-		}
 
-		if (!non_opaque_instances.empty())
-		{
-			if (!gpu_scene->non_opaque_skinned_mesh.instances ||
-			    gpu_scene->non_opaque_skinned_mesh.instances->GetDesc().size < non_opaque_instances.size() * sizeof(GPUScene::Instance))
+			entry.version = entry.transform->GetVersion();
+
+			glm::mat4 transform = entry.transform->GetWorldTransform();
+			if (entry.opaque)
 			{
-				gpu_scene->non_opaque_skinned_mesh.instances = m_impl->rhi_context->CreateBuffer<GPUScene::Instance>(non_opaque_instances.size(), RHIBufferUsage::UnorderedAccess, RHIMemoryUsage::CPU_TO_GPU);
+				cache.opaque_instances[entry.index].transform           = transform;
+				gpu_scene->opaque_skinned_mesh.bounds[entry.index].aabb = entry.aabb.Transform(transform);
+				opaque_dirty.push_back(entry.index);
+			}
+			else
+			{
+				cache.non_opaque_instances[entry.index].transform           = transform;
+				gpu_scene->non_opaque_skinned_mesh.bounds[entry.index].aabb = entry.aabb.Transform(transform);
+				non_opaque_dirty.push_back(entry.index);
 			}
-			gpu_scene->non_opaque_skinned_mesh.instances->CopyToDevice(non_opaque_instances.data(), non_opaque_instances.size() * sizeof(GPUScene::Instance));
 		}
+
+		gpu_scene->statistics.dirty_instances += static_cast<uint32_t>(opaque_dirty.size() + non_opaque_dirty.size());
+	}
+
+	// Copy to device
+	{
+		gpu_scene->statistics.upload_bytes += UploadInstances(m_impl->rhi_context, gpu_scene->opaque_skinned_mesh.instances, cache.opaque_instances, rebuild ? nullptr : &opaque_dirty);
+		gpu_scene->statistics.upload_bytes += UploadInstances(m_impl->rhi_context, gpu_scene->non_opaque_skinned_mesh.instances, cache.non_opaque_instances, rebuild ? nullptr : &non_opaque_dirty);
 	}
 
+	gpu_scene->statistics.rebuild |= rebuild;
+
 	// Update resource
 	if (m_impl->resource_manager->Update<ResourceType::SkinnedMesh>())
 	{
@@ -663,6 +872,18 @@ void Renderer::UpdateSkinnedMesh()
 	}
 }
 
+void Renderer::UpdateVisibility()
+{
+	auto *gpu_scene = m_impl->black_board.Get<GPUScene>();
+
+	const Frustum *frustum = m_impl->main_camera ? &m_impl->main_camera->GetFrustum() : nullptr;
+
+	gpu_scene->statistics.culled_instances += CullInstances(m_impl->rhi_context, frustum, gpu_scene->opaque_mesh.bounds, gpu_scene->opaque_mesh.visible_instances, gpu_scene->opaque_mesh.visible_instance_buffer);
+	gpu_scene->statistics.culled_instances += CullInstances(m_impl->rhi_context, frustum, gpu_scene->non_opaque_mesh.bounds, gpu_scene->non_opaque_mesh.visible_instances, gpu_scene->non_opaque_mesh.visible_instance_buffer);
+	gpu_scene->statistics.culled_instances += CullInstances(m_impl->rhi_context, frustum, gpu_scene->opaque_skinned_mesh.bounds, gpu_scene->opaque_skinned_mesh.visible_instances, gpu_scene->opaque_skinned_mesh.visible_instance_buffer);
+	gpu_scene->statistics.culled_instances += CullInstances(m_impl->rhi_context, frustum, gpu_scene->non_opaque_skinned_mesh.bounds, gpu_scene->non_opaque_skinned_mesh.visible_instances, gpu_scene->non_opaque_skinned_mesh.visible_instance_buffer);
+}
+
 void Renderer::UpdateMaterial()
 {
 	auto *gpu_scene = m_impl->black_board.Get<GPUScene>();
@@ -703,7 +924,7 @@ void Renderer::UpdateMaterial()
 				}
 				for (auto &[texture, texture_name] : material->GetCompilationContext().textures)
 				{
-					m_impl->resource_manager->Index<ResourceType::Texture2D>(texture_name);
+					m_impl->resource_manager->Request<ResourceType::Texture2D>(texture_name);
 				}
 			}
 		}
@@ -715,7 +936,7 @@ void Renderer::UpdateMaterial()
 			auto resources = m_impl->resource_manager->GetResources<ResourceType::Texture2D>();
 			for (auto &resource : resources)
 			{
-				auto *texture2d = m_impl->resource_manager->Get<ResourceType::Texture2D>(resource);
+				auto *texture2d = m_impl->resource_manager->GetOrPlaceholder<ResourceType::Texture2D>(resource);
 				gpu_scene->texture.texture_2d.push_back(texture2d->GetTexture());
 			}
 		}
@@ -797,16 +1018,17 @@ void Renderer::UpdateGPUScene()
 {
 	auto *gpu_scene = m_impl->black_board.Get<GPUScene>();
 
-	TLASDesc tlas_desc = {};
-	tlas_desc.name     = m_impl->scene->GetName();
+	auto start = std::chrono::high_resolution_clock::now();
 
-	auto meshes         = m_impl->scene->GetComponents<Cmpt::MeshRenderer>();
-	auto skinned_meshes = m_impl->scene->GetComponents<Cmpt::SkinnedMeshRenderer>();
+	gpu_scene->statistics = {};
 
 	UpdateLight();
 	UpdateMesh();
 	UpdateSkinnedMesh();
+	UpdateVisibility();
 	UpdateAnimation();
 	UpdateMaterial();
+
+	gpu_scene->statistics.cpu_time = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
 }
 }        // namespace Ilum
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "ShadowCache.hpp"
+
+#include <Core/Hash.hpp>
+
+namespace Ilum
+{
+const std::vector<uint8_t> &ShadowCasterHistory::Update(const std::vector<GPUScene::InstanceBound> &bounds)
+{
+	// Instance indices are only stable while the layout is, a rebuilt scene starts over with every caster static
+	bool rebuild = bounds.size() != m_bounds.size();
+	for (size_t i = 0; i < bounds.size() && !rebuild; i++)
+	{
+		rebuild = bounds[i].mesh_id != m_bounds[i].mesh_id;
+	}
+
+	if (rebuild)
+	{
+		m_still_frames.assign(bounds.size(), SettleFrames);
+	}
+	else
+	{
+		for (size_t i = 0; i < bounds.size(); i++)
+		{
+			bool moved        = bounds[i].aabb.min != m_bounds[i].aabb.min || bounds[i].aabb.max != m_bounds[i].aabb.max;
+			m_still_frames[i] = moved ? 0 : std::min(m_still_frames[i] + 1, SettleFrames);
+		}
+	}
+
+	m_dynamic.resize(bounds.size());
+	for (size_t i = 0; i < bounds.size(); i++)
+	{
+		m_dynamic[i] = bounds[i].animated || m_still_frames[i] < SettleFrames;
+	}
+
+	m_bounds = bounds;
+
+	return m_dynamic;
+}
+
+const std::vector<uint8_t> &ShadowCasterHistory::GetDynamic() const
+{
+	return m_dynamic;
+}
+
+void ShadowLayerCache::Reset(uint32_t layer_count)
+{
+	m_states.assign(layer_count, State{});
+}
+
+void ShadowLayerCache::Update(const std::vector<Layer> &layers, const std::vector<Casters> &casters, float animation_time, Plan &plan)
+{
+	plan.rebuild.clear();
+	plan.composite.clear();
+	plan.cached = 0;
+
+	for (uint32_t i = 0; i < layers.size(); i++)
+	{
+		auto &layer = layers[i];
+
+		size_t static_signature  = layer.signature;
+		size_t dynamic_signature = 0;
+		for (auto &caster : casters)
+		{
+			for (size_t j = 0; j < caster.bounds->size(); j++)
+			{
+				auto &bound = (*caster.bounds)[j];
+				if (!layer.frustum.Intersect(bound.aabb))
+				{
+					continue;
+				}
+
+				if ((*caster.dynamic)[j])
+				{
+					HashCombine(dynamic_signature, j, bound.mesh_id, bound.aabb.min.x, bound.aabb.min.y, bound.aabb.min.z, bound.aabb.max.x, bound.aabb.max.y, bound.aabb.max.z, bound.animated ? animation_time : 0.f);
+				}
+				else
+				{
+					HashCombine(static_signature, j, bound.mesh_id, bound.aabb.min.x, bound.aabb.min.y, bound.aabb.min.z, bound.aabb.max.x, bound.aabb.max.y, bound.aabb.max.z);
+				}
+			}
+		}
+
+		if (layer.layer >= m_states.size())
+		{
+			m_states.resize(layer.layer + 1);
+		}
+
+		auto &state = m_states[layer.layer];
+
+		// Dynamic casters of the last frame must be erased even if none are left, so any change of the dynamic set redraws the layer
+		if (!state.valid || state.static_signature != static_signature)
+		{
+			plan.rebuild.push_back(i);
+			plan.composite.push_back(i);
+		}
+		else if (state.dynamic_signature != dynamic_signature)
+		{
+			plan.composite.push_back(i);
+		}
+		else
+		{
+			plan.cached++;
+		}
+
+		state.static_signature  = static_signature;
+		state.dynamic_signature = dynamic_signature;
+		state.valid             = true;
+	}
+}
+}        // namespace Ilum
@@ -0,0 +1,71 @@
+#include "ShadowCulling.hpp"
+
+namespace Ilum
+{
+static_assert(sizeof(ShadowView) == 112, "ShadowView must match the HLSL layout");
+static_assert(sizeof(ShadowTask) == 16, "ShadowTask must match the HLSL layout");
+
+Frustum CubeFaceFrustum(const glm::vec3 &position, uint32_t face)
+{
+	const uint32_t axis[6] = {0, 0, 1, 1, 2, 2};
+	const float    sign[6] = {1.f, -1.f, 1.f, -1.f, -1.f, 1.f};
+
+	glm::vec3 forward = glm::vec3(0.f);
+	glm::vec3 right   = glm::vec3(0.f);
+	glm::vec3 up      = glm::vec3(0.f);
+
+	forward[axis[face]]         = sign[face];
+	right[(axis[face] + 1) % 3] = 1.f;
+	up[(axis[face] + 2) % 3]    = 1.f;
+
+	// The side planes make 45 degrees with the face axis
+	Frustum frustum;
+	frustum.planes = {
+	    glm::vec4(glm::normalize(forward + right), 0.f),
+	    glm::vec4(glm::normalize(forward - right), 0.f),
+	    glm::vec4(glm::normalize(forward + up), 0.f),
+	    glm::vec4(glm::normalize(forward - up), 0.f),
+	    glm::vec4(forward, -OmniShadowNear),
+	    glm::vec4(-forward, OmniShadowFar),
+	};
+
+	for (auto &plane : frustum.planes)
+	{
+		plane.w -= glm::dot(glm::vec3(plane), position);
+	}
+
+	return frustum;
+}
+
+void CullShadowTasks(const std::vector<ShadowView> &views, const std::vector<GPUScene::InstanceBound> &bounds, const std::vector<uint8_t> *dynamic, uint8_t select, std::vector<ShadowTask> &tasks)
+{
+	tasks.clear();
+
+	if (bounds.empty())
+	{
+		return;
+	}
+
+	std::vector<uint8_t> visible(bounds.size());
+	for (uint32_t view_id = 0; view_id < views.size(); view_id++)
+	{
+		Frustum frustum;
+		frustum.planes = views[view_id].frustum;
+		frustum.Intersect(&bounds[0].aabb, bounds.size(), sizeof(GPUScene::InstanceBound), visible.data());
+
+		for (uint32_t instance_id = 0; instance_id < bounds.size(); instance_id++)
+		{
+			auto &bound = bounds[instance_id];
+			if (!visible[instance_id] || (dynamic && (*dynamic)[instance_id] != select))
+			{
+				continue;
+			}
+
+			for (uint32_t offset = 0; offset < bound.meshlet_count; offset += ShadowTaskSize)
+			{
+				tasks.push_back(ShadowTask{view_id, instance_id, offset, glm::min(ShadowTaskSize, bound.meshlet_count - offset)});
+			}
+		}
+	}
+}
+}        // namespace Ilum
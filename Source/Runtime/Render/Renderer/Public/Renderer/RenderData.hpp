@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Geometry/AABB.hpp>
 #include <RHI/RHIContext.hpp>
 #include <Resource/Resource/Material.hpp>
 
@@ -46,12 +47,31 @@ struct GPUScene
 		uint32_t  material_id  = ~0U;
 		uint32_t  animation_id = ~0U;
 		uint32_t  visible      = 0U;
+
+		// Dequantization of skinned mesh positions
+		alignas(16) glm::vec3 position_offset = glm::vec3(0.f);
+		alignas(16) glm::vec3 position_scale  = glm::vec3(1.f);
+	};
+
+	// CPU copy of the instance bounds for culling, in instance buffer order
+	struct InstanceBound
+	{
+		AABB     aabb;        // World space
+		uint32_t mesh_id       = ~0U;
+		uint32_t meshlet_count = 0;
+		bool     animated      = false;
 	};
 
 	struct MeshInstance
 	{
 		std::unique_ptr<RHIBuffer> instances = nullptr;
 
+		std::vector<InstanceBound> bounds;
+
+		// Instances overlapping the main view, refreshed every frame
+		std::vector<uint32_t>      visible_instances;
+		std::unique_ptr<RHIBuffer> visible_instance_buffer = nullptr;
+
 		uint32_t max_meshlet_count = 0;
 		uint32_t instance_count    = 0;
 	};
@@ -68,6 +88,12 @@ struct GPUScene
 	{
 		std::unique_ptr<RHIBuffer> instances = nullptr;
 
+		std::vector<InstanceBound> bounds;
+
+		// Instances overlapping the main view, refreshed every frame
+		std::vector<uint32_t>      visible_instances;
+		std::unique_ptr<RHIBuffer> visible_instance_buffer = nullptr;
+
 		uint32_t max_meshlet_count = 0;
 		uint32_t instance_count    = 0;
 	};
@@ -88,10 +114,27 @@ struct GPUScene
 			float    time;
 		};
 
+		// One row per animation_id, see Source/Shaders/UpdateBoneMatrics.hlsl
+		struct SkinningEntry
+		{
+			uint32_t animation_id = 0;        // Index into skinned_matrics
+			uint32_t bone_count   = 0;        // Zero for clips that are not evaluated
+			uint32_t offset       = 0;        // First palette matrix, also the first thread of the batched dispatch
+			uint32_t frame_count  = 0;
+		};
+
 		std::vector<RHITexture *> skinned_matrics;
-		std::vector<RHIBuffer *>  bone_matrics;
 
-		std::unique_ptr<RHIBuffer> update_info = nullptr;
+		// Every clip's bones in one palette, skinned meshes read bone_matrics[skinning_table[animation_id].offset + bone]
+		std::unique_ptr<RHIBuffer> bone_matrics = nullptr;
+
+		std::vector<SkinningEntry> skinning_table;
+
+		std::unique_ptr<RHIBuffer> update_info           = nullptr;
+		std::unique_ptr<RHIBuffer> skinning_table_buffer = nullptr;
+		std::unique_ptr<RHIBuffer> skinning_indirect     = nullptr;
+
+		uint32_t skinning_thread_count = 0;
 
 		uint32_t max_frame_count = 0;
 		uint32_t max_bone_count  = 0;
@@ -129,8 +172,21 @@ struct GPUScene
 		std::unique_ptr<RHIBuffer> material_offset = nullptr;
 	};
 
+	// Cost of keeping the GPU scene in sync, measured every frame
+	struct UpdateStatistics
+	{
+		uint64_t upload_bytes     = 0;
+		uint32_t dirty_instances  = 0;
+		uint32_t tlas_updates     = 0;
+		uint32_t culled_instances = 0;        // Outside the main view
+		bool     rebuild          = false;
+		float    cpu_time         = 0.f;        // ms
+	};
+
 	std::vector<RHISampler *> samplers;
 
+	UpdateStatistics statistics;
+
 	MeshInstance      opaque_mesh;
 	MeshInstance      non_opaque_mesh;
 	MeshBuffer        mesh_buffer;
@@ -145,4 +201,13 @@ struct GPUScene
 	std::unique_ptr<RHIAccelerationStructure> opaque_tlas     = nullptr;
 	std::unique_ptr<RHIAccelerationStructure> non_opaque_tlas = nullptr;
 };
+
+// Upload the whole instance array, or only the dirty indices merged into contiguous ranges. Dirty indices must be sorted, returns the uploaded bytes
+uint64_t UploadInstances(RHIContext *rhi_context, std::unique_ptr<RHIBuffer> &buffer, const std::vector<GPUScene::Instance> &instances, const std::vector<uint32_t> *dirty);
+
+// Lay out one entry per animation in a shared palette, clips without bones or frames get an empty range. Returns the palette size in matrices
+uint32_t BuildSkinningTable(const std::vector<uint32_t> &bone_counts, const std::vector<uint32_t> &frame_counts, std::vector<GPUScene::AnimationBuffer::SkinningEntry> &table);
+
+// The shader binary searches the table by offset, so entries must be sorted, gapless and cover exactly the dispatched threads
+bool ValidateSkinningTable(const std::vector<GPUScene::AnimationBuffer::SkinningEntry> &table, uint32_t thread_count);
 }        // namespace Ilum
\ No newline at end of file
@@ -41,6 +41,8 @@ class EXPORT_API Renderer
 
 	void SetAnimationTime(float time);
 
+	float GetAnimationTime() const;
+
 	void SetPresentTexture(RHITexture *present_texture);
 
 	RHITexture *GetPresentTexture() const;
@@ -66,6 +68,7 @@ class EXPORT_API Renderer
 	void UpdateAnimation();
 	void UpdateMesh();
 	void UpdateSkinnedMesh();
+	void UpdateVisibility();
 	void UpdateMaterial();
 	void UpdateGPUScene();
 
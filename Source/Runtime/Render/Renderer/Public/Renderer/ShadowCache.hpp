@@ -0,0 +1,77 @@
+#pragma once
+
+#include "RenderData.hpp"
+
+#include <Geometry/Frustum.hpp>
+
+namespace Ilum
+{
+// Tracks which shadow casters moved recently, the others are static and only drawn into the cached layers
+class ShadowCasterHistory
+{
+  public:
+	// A caster keeps counting as dynamic for this many frames after its last move, so objects moving in bursts do not rebake the static layers every time they stop
+	static constexpr uint32_t SettleFrames = 30;
+
+  public:
+	ShadowCasterHistory() = default;
+
+	~ShadowCasterHistory() = default;
+
+	// Call once per frame, returns one dynamic flag per caster. Animated casters are always dynamic
+	const std::vector<uint8_t> &Update(const std::vector<GPUScene::InstanceBound> &bounds);
+
+	const std::vector<uint8_t> &GetDynamic() const;
+
+  private:
+	std::vector<GPUScene::InstanceBound> m_bounds;
+	std::vector<uint32_t>                m_still_frames;
+	std::vector<uint8_t>                 m_dynamic;
+};
+
+// Per layer state of a cached shadow map array. Static casters are drawn once into a cache layer,
+// dynamic casters are drawn on top of a copy of it whenever the dynamic casters overlapping the layer change
+class ShadowLayerCache
+{
+  public:
+	struct Layer
+	{
+		uint32_t layer;            // Layer of the shadow map array
+		size_t   signature;        // Light transform and depth bias
+		Frustum  frustum;
+	};
+
+	struct Casters
+	{
+		const std::vector<GPUScene::InstanceBound> *bounds;
+		const std::vector<uint8_t>                 *dynamic;
+	};
+
+	struct Plan
+	{
+		std::vector<uint32_t> rebuild;          // Indices into the layers whose static casters are redrawn into the cache
+		std::vector<uint32_t> composite;        // Indices into the layers copied from the cache and redrawn with their dynamic casters, includes every rebuilt layer
+		uint32_t              cached = 0;       // Layers left untouched
+	};
+
+  public:
+	ShadowLayerCache() = default;
+
+	~ShadowLayerCache() = default;
+
+	// Forget every layer, their contents are undefined
+	void Reset(uint32_t layer_count);
+
+	void Update(const std::vector<Layer> &layers, const std::vector<Casters> &casters, float animation_time, Plan &plan);
+
+  private:
+	struct State
+	{
+		size_t static_signature  = 0;
+		size_t dynamic_signature = 0;
+		bool   valid             = false;
+	};
+
+	std::vector<State> m_states;
+};
+}        // namespace Ilum
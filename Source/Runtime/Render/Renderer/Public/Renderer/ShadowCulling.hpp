@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RenderData.hpp"
+
+#include <Geometry/Frustum.hpp>
+
+namespace Ilum
+{
+// Must match Source/Shaders/Shadow/Shadow.hlsli
+struct ShadowView
+{
+	std::array<glm::vec4, 6> frustum;
+	uint32_t                 draw_index;
+	uint32_t                 padding[3];
+};
+
+struct ShadowTask
+{
+	uint32_t view_id;
+	uint32_t instance_id;
+	uint32_t meshlet_offset;
+	uint32_t meshlet_count;
+};
+
+// Meshlets covered by one task group
+inline constexpr uint32_t ShadowTaskSize = 32;
+
+// Projection range of OmniShadowMap.hlsl
+inline constexpr float OmniShadowNear = 0.2f;
+inline constexpr float OmniShadowFar  = 1000.f;
+
+// World space planes of a point light cube face, faces follow the view projections of OmniShadowMap.hlsl: +X, -X, +Y, -Y, -Z, +Z
+Frustum CubeFaceFrustum(const glm::vec3 &position, uint32_t face);
+
+// Compacts the (view, instance, meshlet range) work of every instance overlapping a view, the task shaders only cull meshlets.
+// With dynamic flags, only the instances flagged as select are kept
+void CullShadowTasks(const std::vector<ShadowView> &views, const std::vector<GPUScene::InstanceBound> &bounds, const std::vector<uint8_t> *dynamic, uint8_t select, std::vector<ShadowTask> &tasks);
+}        // namespace Ilum
@@ -3,16 +3,93 @@
 
 #include <RHI/RHIDefinitions.hpp>
 
+#include <regex>
+
 namespace Ilum
 {
+struct ShaderDependency
+{
+	std::string path;
+	size_t      last_write = 0;
+	size_t      hash       = 0;
+
+	template <typename Archive>
+	void serialize(Archive &archive)
+	{
+		archive(path, last_write, hash);
+	}
+};
+
 struct ShaderBuilder::Impl
 {
 	std::unordered_map<size_t, std::unique_ptr<RHIShader>> shader_cache;
 	std::unordered_map<RHIShader *, ShaderMeta>            shader_meta_cache;
 
+	// Replaced by a forced recompile, pipelines created before may still reference them
+	std::vector<std::unique_ptr<RHIShader>> retired_shaders;
+
 	std::mutex mutex;
 };
 
+inline size_t GetLastWriteTime(const std::string &path)
+{
+	std::error_code error;
+	auto            time = std::filesystem::last_write_time(path, error);
+	return error ? 0 : static_cast<size_t>(time.time_since_epoch().count());
+}
+
+// Search include directories in the same order as the shader compiler
+inline std::string ResolveInclude(const std::string &include, const std::string &directory)
+{
+	for (const auto &search_path : {directory, std::string("Source/Shaders"), std::string("Asset/Material"), std::string(".")})
+	{
+		std::filesystem::path path = std::filesystem::path(search_path) / include;
+		if (std::filesystem::exists(path))
+		{
+			return path.lexically_normal().generic_string();
+		}
+	}
+	return "";
+}
+
+// Record the content hash of a shader file and of every file it includes
+inline void CollectDependencies(const std::string &filename, std::vector<ShaderDependency> &dependencies)
+{
+	std::string path = std::filesystem::path(filename).lexically_normal().generic_string();
+
+	for (auto &dependency : dependencies)
+	{
+		if (dependency.path == path)
+		{
+			return;
+		}
+	}
+
+	std::vector<uint8_t> data;
+	Path::GetInstance().Read(path, data);
+	std::string source(data.begin(), data.end());
+
+	dependencies.push_back(ShaderDependency{path, GetLastWriteTime(path), Hash(source)});
+
+	static const std::regex include_regex(R"(^\s*#\s*include\s*[<"]([^>"]+)[>"])");
+
+	std::string        directory = std::filesystem::path(path).parent_path().generic_string();
+	std::istringstream stream(source);
+	std::string        line;
+	while (std::getline(stream, line))
+	{
+		std::smatch match;
+		if (std::regex_search(line, match, include_regex))
+		{
+			std::string include = ResolveInclude(match[1].str(), directory);
+			if (!include.empty())
+			{
+				CollectDependencies(include, dependencies);
+			}
+		}
+	}
+}
+
 ShaderBuilder::ShaderBuilder(RHIContext *context) :
     p_rhi_context(context)
 {
@@ -27,105 +104,335 @@ ShaderBuilder::~ShaderBuilder()
 
 RHIShader *ShaderBuilder::RequireShader(const std::string &filename, const std::string &entry_point, RHIShaderStage stage, std::vector<std::string> &&macros, std::vector<std::string> &&includes, bool cuda, bool force_recompile)
 {
-	size_t hash = Hash(filename, entry_point, stage, macros, includes, cuda);
+	ShaderPermutation permutation = {};
+	permutation.filename          = filename;
+	permutation.entry_point       = entry_point;
+	permutation.stage             = stage;
+	permutation.macros            = std::move(macros);
+	permutation.includes          = std::move(includes);
 
-	if (!Path::GetInstance().IsExist("./bin/Shaders"))
+	if (cuda)
 	{
-		Path::GetInstance().CreatePath("./bin/Shaders");
+		permutation.target = ShaderTarget::PTX;
 	}
-
-	if (m_impl->shader_cache.find(hash) != m_impl->shader_cache.end() && !force_recompile)
+	else if (p_rhi_context->GetBackend() == "Vulkan")
+	{
+		permutation.target = ShaderTarget::SPIRV;
+	}
+	else if (p_rhi_context->GetBackend() == "DX12")
 	{
-		return m_impl->shader_cache.at(hash).get();
+		permutation.target = ShaderTarget::DXIL;
 	}
 
-	std::string cache_path = "./bin/Shaders/" + std::to_string(hash) + ".shader";
+	size_t hash = permutation.Hash();
+
+	{
+		std::lock_guard<std::mutex> lock(m_impl->mutex);
+		if (m_impl->shader_cache.find(hash) != m_impl->shader_cache.end() && !force_recompile)
+		{
+			return m_impl->shader_cache.at(hash).get();
+		}
+	}
 
-	std::vector<uint8_t> shader_bin;
 	ShaderMeta           meta;
+	std::vector<uint8_t> shader_bin = CompileShader(permutation, meta, force_recompile);
 
-	if (Path::GetInstance().IsExist(cache_path) && !force_recompile)
+	if (shader_bin.empty())
 	{
-		// Read from cache
-		size_t last_write = 0;
+		return nullptr;
+	}
 
-		DESERIALIZE(
-		    cache_path,
-		    last_write,
-		    shader_bin,
-		    meta);
+	std::unique_ptr<RHIShader> shader = p_rhi_context->CreateShader(entry_point, shader_bin, cuda);
 
-		if (last_write == std::filesystem::last_write_time(filename).time_since_epoch().count() && !shader_bin.empty())
+	std::lock_guard<std::mutex> lock(m_impl->mutex);
+	auto &cached = m_impl->shader_cache[hash];
+	if (cached)
+	{
+		if (!force_recompile)
 		{
-			std::unique_ptr<RHIShader> shader = p_rhi_context->CreateShader(entry_point, shader_bin, cuda);
-			m_impl->shader_meta_cache.emplace(shader.get(), std::move(meta));
-			m_impl->shader_cache.emplace(hash, std::move(shader));
-			return m_impl->shader_cache.at(hash).get();
+			// Another thread compiled the same permutation meanwhile
+			return cached.get();
 		}
+		m_impl->retired_shaders.emplace_back(std::move(cached));
 	}
+	m_impl->shader_meta_cache.emplace(shader.get(), std::move(meta));
+	cached = std::move(shader);
+	return cached.get();
+}
+
+std::vector<uint8_t> ShaderBuilder::CompileShader(const ShaderPermutation &permutation, ShaderMeta &meta, bool force_recompile)
+{
+	size_t hash = permutation.Hash();
 
+	if (!Path::GetInstance().IsExist("./bin/Shaders"))
 	{
-		std::vector<uint8_t> shader_code;
-		Path::GetInstance().Read(filename, shader_code);
+		Path::GetInstance().CreatePath("./bin/Shaders");
+	}
+
+	// Cache entries are addressed by shader content, the dependency manifest avoids rehashing untouched files
+	std::string manifest_path = "./bin/Shaders/" + std::to_string(hash) + ".deps";
+
+	const std::string &compiler_version = ShaderCompiler::GetInstance().GetVersion();
 
-		ShaderDesc desc = {};
-		desc.path       = filename;
-		desc.code.resize(shader_code.size());
-		std::memcpy(desc.code.data(), shader_code.data(), shader_code.size());
-		for (auto &include : includes)
+	ShaderPermutation             manifest_permutation;
+	std::vector<ShaderDependency> dependencies;
+	std::string                   manifest_compiler_version;
+	size_t                        key = 0;
+
+	if (Path::GetInstance().IsExist(manifest_path) && !force_recompile)
+	{
+		try
 		{
-			desc.code = fmt::format("#include \"{}\"\n", include) + desc.code;
+			DESERIALIZE(
+			    manifest_path,
+			    manifest_permutation,
+			    key,
+			    dependencies,
+			    manifest_compiler_version);
+		}
+		catch (...)
+		{
+			key = 0;
 		}
 
-		desc.source      = Path::GetInstance().GetFileExtension(filename) == ".hlsl" ? ShaderSource::HLSL : ShaderSource::GLSL;
-		desc.stage       = stage;
-		desc.entry_point = entry_point;
-		desc.macros      = macros;
-
-		if (cuda)
+		// Keys of another compiler address binaries it produced
+		if (manifest_compiler_version != compiler_version)
 		{
-			desc.target = ShaderTarget::PTX;
+			key = 0;
 		}
-		else
+
+		for (auto &dependency : dependencies)
 		{
-			if (p_rhi_context->GetBackend() == "Vulkan")
+			if (GetLastWriteTime(dependency.path) != dependency.last_write)
 			{
-				desc.target = ShaderTarget::SPIRV;
+				key = 0;
+				break;
 			}
-			else if (p_rhi_context->GetBackend() == "DX12")
+		}
+
+		if (key == 0)
+		{
+			dependencies.clear();
+		}
+	}
+
+	if (key == 0)
+	{
+		CollectDependencies(permutation.filename, dependencies);
+		for (auto &include : permutation.includes)
+		{
+			std::string path = ResolveInclude(include, Path::GetInstance().GetFileDirectory(permutation.filename));
+			if (!path.empty())
 			{
-				desc.target = ShaderTarget::DXIL;
+				CollectDependencies(path, dependencies);
 			}
 		}
 
-		shader_bin = ShaderCompiler::GetInstance().Compile(desc, meta);
+		key = Hash(permutation.entry_point, permutation.stage, permutation.macros, permutation.includes, permutation.target, compiler_version);
+		for (auto &dependency : dependencies)
+		{
+			HashCombine(key, dependency.hash);
+		}
 
-		if (shader_bin.empty())
+		SERIALIZE(
+		    manifest_path,
+		    permutation,
+		    key,
+		    dependencies,
+		    compiler_version);
+	}
+
+	std::string cache_path = "./bin/Shaders/" + std::to_string(key) + ".shader";
+
+	std::vector<uint8_t> shader_bin;
+
+	if (Path::GetInstance().IsExist(cache_path) && !force_recompile)
+	{
+		// Read from cache
+		try
+		{
+			DESERIALIZE(
+			    cache_path,
+			    shader_bin,
+			    meta);
+		}
+		catch (...)
 		{
-			return nullptr;
+			shader_bin.clear();
 		}
 
+		if (!shader_bin.empty())
+		{
+			return shader_bin;
+		}
+	}
+
+	std::vector<uint8_t> shader_code;
+	Path::GetInstance().Read(permutation.filename, shader_code);
+
+	ShaderDesc desc = {};
+	desc.path       = permutation.filename;
+	desc.code.resize(shader_code.size());
+	std::memcpy(desc.code.data(), shader_code.data(), shader_code.size());
+	for (auto &include : permutation.includes)
+	{
+		desc.code = fmt::format("#include \"{}\"\n", include) + desc.code;
+	}
+
+	desc.source      = Path::GetInstance().GetFileExtension(permutation.filename) == ".hlsl" ? ShaderSource::HLSL : ShaderSource::GLSL;
+	desc.stage       = permutation.stage;
+	desc.entry_point = permutation.entry_point;
+	desc.macros      = permutation.macros;
+	desc.target      = permutation.target;
+
+	shader_bin = ShaderCompiler::GetInstance().Compile(desc, meta);
+
+	if (!shader_bin.empty())
+	{
 		SERIALIZE(
 		    cache_path,
-		    (size_t) std::filesystem::last_write_time(filename).time_since_epoch().count(),
 		    shader_bin,
 		    meta);
+	}
+
+	return shader_bin;
+}
+
+std::vector<ShaderPermutation> ShaderBuilder::GetCachedPermutations()
+{
+	std::vector<ShaderPermutation> permutations;
+
+	if (!Path::GetInstance().IsExist("./bin/Shaders"))
+	{
+		return permutations;
+	}
+
+	for (const auto &entry : std::filesystem::directory_iterator("./bin/Shaders"))
+	{
+		if (entry.path().extension() != ".deps")
+		{
+			continue;
+		}
+
+		ShaderPermutation permutation;
+		try
+		{
+			DESERIALIZE(
+			    entry.path().string(),
+			    permutation);
+		}
+		catch (...)
+		{
+			LOG_WARN("Skip invalid shader manifest {}", entry.path().string());
+			continue;
+		}
+
+		permutations.emplace_back(std::move(permutation));
+	}
+
+	return permutations;
+}
+
+std::vector<ShaderPermutation> ShaderBuilder::EnumeratePermutations(const ShaderVariants &variants, const std::vector<MaterialShader> &materials)
+{
+	std::vector<ShaderPermutation> permutations = {variants.permutation};
+
+	for (auto &axis : variants.macro_axes)
+	{
+		std::vector<ShaderPermutation> expanded;
+		expanded.reserve(permutations.size() * axis.size());
+		for (auto &permutation : permutations)
+		{
+			for (auto &macro : axis)
+			{
+				expanded.push_back(permutation);
+				expanded.back().macros.push_back(macro);
+			}
+		}
+		permutations = std::move(expanded);
+	}
+
+	if (variants.per_material)
+	{
+		std::vector<ShaderPermutation> expanded;
+		expanded.reserve(permutations.size() * materials.size());
+		for (auto &permutation : permutations)
+		{
+			for (auto &material : materials)
+			{
+				expanded.push_back(permutation);
+				expanded.back().macros.push_back(material.signature);
+				expanded.back().includes.push_back(material.shader);
+			}
+		}
+		permutations = std::move(expanded);
+	}
+
+	return permutations;
+}
+
+std::vector<MaterialShader> ShaderBuilder::GetMaterialShaders(const std::string &directory)
+{
+	std::vector<MaterialShader> materials;
+
+	if (!Path::GetInstance().IsExist(directory))
+	{
+		return materials;
+	}
 
-		std::unique_ptr<RHIShader> shader = p_rhi_context->CreateShader(entry_point, shader_bin, cuda);
+	static const std::string extension = ".material.hlsli";
 
+	for (const auto &entry : std::filesystem::directory_iterator(directory))
+	{
+		std::string filename = entry.path().filename().string();
+		if (filename.size() <= extension.size() ||
+		    filename.compare(filename.size() - extension.size(), extension.size(), extension) != 0)
 		{
-			std::lock_guard<std::mutex> lock(m_impl->mutex);
-			m_impl->shader_meta_cache.emplace(shader.get(), std::move(meta));
-			m_impl->shader_cache.emplace(hash, std::move(shader));
+			continue;
 		}
-		return m_impl->shader_cache.at(hash).get();
+
+		std::vector<uint8_t> data;
+		Path::GetInstance().Read(entry.path().generic_string(), data);
+		std::string shader(data.begin(), data.end());
+
+		materials.push_back(MaterialShader{fmt::format("Signature_{}", Hash(shader)), filename});
+	}
+
+	// Directory order is unspecified
+	std::sort(materials.begin(), materials.end(), [](const MaterialShader &lhs, const MaterialShader &rhs) { return lhs.shader < rhs.shader; });
+
+	return materials;
+}
+
+std::vector<ShaderCompileTiming> ShaderBuilder::SummarizeCompileResults(const std::vector<ShaderCompileResult> &results)
+{
+	std::map<std::string, ShaderCompileTiming> timings;
+	for (auto &result : results)
+	{
+		std::string name   = fmt::format("{}.{}", result.permutation.filename, result.permutation.entry_point);
+		auto       &timing = timings[name];
+		timing.name        = name;
+		timing.permutations++;
+		timing.failed += result.success ? 0 : 1;
+		timing.total_time += result.time;
+		timing.max_time = std::max(timing.max_time, result.time);
 	}
 
-	return nullptr;
+	std::vector<ShaderCompileTiming> summary;
+	summary.reserve(timings.size());
+	for (auto &[name, timing] : timings)
+	{
+		summary.push_back(timing);
+	}
+
+	std::stable_sort(summary.begin(), summary.end(), [](const ShaderCompileTiming &lhs, const ShaderCompileTiming &rhs) { return lhs.total_time > rhs.total_time; });
+
+	return summary;
 }
 
 ShaderMeta ShaderBuilder::RequireShaderMeta(RHIShader *shader) const
 {
+	std::lock_guard<std::mutex> lock(m_impl->mutex);
 	return m_impl->shader_meta_cache.at(shader);
 }
-}        // namespace Ilum
\ No newline at end of file
+}        // namespace Ilum
@@ -136,12 +136,37 @@ const TBuiltInResource DefaultTBuiltInResource = {
 
 namespace Ilum
 {
-struct ShaderCompiler::Impl
+struct DXCContext
 {
 	ComPtr<IDxcCompiler3>      DXCCompiler           = nullptr;
 	ComPtr<IDxcUtils>          DXCUtils              = nullptr;
 	ComPtr<IDxcIncludeHandler> DefaultIncludeHandler = nullptr;
-	SlangSession              *Session               = nullptr;
+};
+
+struct ShaderCompiler::Impl
+{
+	// DXC objects are not thread safe, each compiling thread gets its own
+	std::unordered_map<std::thread::id, DXCContext> DXCContexts;
+
+	SlangSession *Session = nullptr;
+
+	std::mutex mutex;
+
+	std::string version;
+
+	DXCContext *GetDXCContext()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto &context = DXCContexts[std::this_thread::get_id()];
+		if (!context.DXCCompiler)
+		{
+			PluginManager::GetInstance().Call("Source/External/dxc/bin/x64/dxcompiler.dll", "DxcCreateInstance", CLSID_DxcUtils, IID_PPV_ARGS(&context.DXCUtils));
+			PluginManager::GetInstance().Call("Source/External/dxc/bin/x64/dxcompiler.dll", "DxcCreateInstance", CLSID_DxcCompiler, IID_PPV_ARGS(&context.DXCCompiler));
+			context.DXCUtils->CreateDefaultIncludeHandler(&context.DefaultIncludeHandler);
+		}
+		return &context;
+	}
 };
 
 std::wstring to_wstring(const std::string &str)
@@ -309,13 +334,15 @@ std::vector<uint8_t> CompileShader<ShaderSource::GLSL, ShaderTarget::SPIRV>(Shad
 template <>
 std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::SPIRV>(ShaderCompiler::Impl *impl, const ShaderDesc &desc)
 {
+	DXCContext *dxc = impl->GetDXCContext();
+
 	DxcBuffer                dxc_buffer    = {};
 	ComPtr<IDxcBlobEncoding> blob_encoding = nullptr;
 
 	std::string shader_code = std::string(desc.code.c_str());
 
 	{
-		if (FAILED(impl->DXCUtils->CreateBlobFromPinned(shader_code.data(), static_cast<uint32_t>(shader_code.size()), CP_UTF8, &blob_encoding)))
+		if (FAILED(dxc->DXCUtils->CreateBlobFromPinned(shader_code.data(), static_cast<uint32_t>(shader_code.size()), CP_UTF8, &blob_encoding)))
 		{
 			LOG_ERROR("Failed to load shader source.");
 			return {};
@@ -369,11 +396,11 @@ std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::SPIRV>(Shad
 
 	// Compile
 	IDxcResult *dxc_result = nullptr;
-	impl->DXCCompiler->Compile(
+	dxc->DXCCompiler->Compile(
 	    &dxc_buffer,
 	    arguments_lpcwstr.data(),
 	    static_cast<uint32_t>(arguments_lpcwstr.size()),
-	    impl->DefaultIncludeHandler.Get(),
+	    dxc->DefaultIncludeHandler.Get(),
 	    IID_PPV_ARGS(&dxc_result));
 
 	// Get error buffer
@@ -443,13 +470,15 @@ std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::SPIRV>(Shad
 template <>
 std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::DXIL>(ShaderCompiler::Impl *impl, const ShaderDesc &desc)
 {
+	DXCContext *dxc = impl->GetDXCContext();
+
 	DxcBuffer                dxc_buffer    = {};
 	ComPtr<IDxcBlobEncoding> blob_encoding = nullptr;
 
 	std::string shader_code = std::string(desc.code.c_str());
 
 	{
-		if (FAILED(impl->DXCUtils->CreateBlobFromPinned(shader_code.c_str(), static_cast<uint32_t>(shader_code.size()), CP_UTF8, &blob_encoding)))
+		if (FAILED(dxc->DXCUtils->CreateBlobFromPinned(shader_code.c_str(), static_cast<uint32_t>(shader_code.size()), CP_UTF8, &blob_encoding)))
 		{
 			LOG_ERROR("Failed to load shader source.");
 			return {};
@@ -485,11 +514,11 @@ std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::DXIL>(Shade
 
 	// Compile
 	IDxcResult *dxc_result = nullptr;
-	impl->DXCCompiler->Compile(
+	dxc->DXCCompiler->Compile(
 	    &dxc_buffer,
 	    arguments_lpcwstr.data(),
 	    static_cast<uint32_t>(arguments_lpcwstr.size()),
-	    impl->DefaultIncludeHandler.Get(),
+	    dxc->DefaultIncludeHandler.Get(),
 	    IID_PPV_ARGS(&dxc_result));
 
 	// Get error buffer
@@ -559,6 +588,9 @@ std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::DXIL>(Shade
 template <>
 std::vector<uint8_t> CompileShader<ShaderSource::HLSL, ShaderTarget::PTX>(ShaderCompiler::Impl *impl, const ShaderDesc &desc)
 {
+	// Slang sessions are not thread safe
+	std::lock_guard<std::mutex> lock(impl->mutex);
+
 	SlangCompileRequest *request = spCreateCompileRequest(impl->Session);
 
 	spSetCodeGenTarget(request, SLANG_PTX);
@@ -611,15 +643,23 @@ ShaderCompiler::ShaderCompiler()
 	glslang::InitializeProcess();
 
 	// Init dxc
-	PluginManager::GetInstance().Call("Source/External/dxc/bin/x64/dxcompiler.dll", "DxcCreateInstance", CLSID_DxcUtils, IID_PPV_ARGS(&m_impl->DXCUtils));
-	PluginManager::GetInstance().Call("Source/External/dxc/bin/x64/dxcompiler.dll", "DxcCreateInstance", CLSID_DxcCompiler, IID_PPV_ARGS(&m_impl->DXCCompiler));
-	// DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&m_impl->DXCUtils));
-	// DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&m_impl->DXCCompiler));
-
-	m_impl->DXCUtils->CreateDefaultIncludeHandler(&m_impl->DefaultIncludeHandler);
+	DXCContext *dxc = m_impl->GetDXCContext();
 
 	// Init slang
 	m_impl->Session = spCreateSession(NULL);
+
+	// Compiler version
+	{
+		uint32_t major = 0, minor = 0;
+
+		ComPtr<IDxcVersionInfo> version_info = nullptr;
+		if (SUCCEEDED(dxc->DXCCompiler.As(&version_info)))
+		{
+			version_info->GetVersion(&major, &minor);
+		}
+
+		m_impl->version = fmt::format("dxc {}.{}, slang {}", major, minor, spGetBuildTagString());
+	}
 }
 
 ShaderCompiler::~ShaderCompiler()
@@ -627,9 +667,12 @@ ShaderCompiler::~ShaderCompiler()
 	glslang::FinalizeProcess();
 
 	// It's weird
-	m_impl->DXCUtils.Detach();
-	m_impl->DXCCompiler.Detach();
-	m_impl->DefaultIncludeHandler.Detach();
+	for (auto &[thread_id, context] : m_impl->DXCContexts)
+	{
+		context.DXCUtils.Detach();
+		context.DXCCompiler.Detach();
+		context.DefaultIncludeHandler.Detach();
+	}
 
 	spDestroySession(m_impl->Session);
 	m_impl->Session = nullptr;
@@ -644,6 +687,11 @@ ShaderCompiler &ShaderCompiler::GetInstance()
 	return shader_compiler;
 }
 
+const std::string &ShaderCompiler::GetVersion() const
+{
+	return m_impl->version;
+}
+
 std::vector<uint8_t> ShaderCompiler::Compile(const ShaderDesc &desc, ShaderMeta &meta)
 {
 	// Compile to SPIRV
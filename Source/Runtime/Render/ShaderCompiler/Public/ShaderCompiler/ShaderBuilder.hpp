@@ -1,11 +1,68 @@
 #pragma once
 
 #include "Precompile.hpp"
+#include "ShaderCompiler.hpp"
 
 #include <RHI/RHIContext.hpp>
 
 namespace Ilum
 {
+struct ShaderPermutation
+{
+	std::string              filename;
+	std::string              entry_point;
+	RHIShaderStage           stage;
+	std::vector<std::string> macros   = {};
+	std::vector<std::string> includes = {};
+	ShaderTarget             target   = ShaderTarget::SPIRV;
+
+	size_t Hash() const
+	{
+		size_t hash = 0;
+		HashCombine(hash, filename, entry_point, stage, macros, includes, target);
+		return hash;
+	}
+
+	template <typename Archive>
+	void serialize(Archive &archive)
+	{
+		archive(filename, entry_point, stage, macros, includes, target);
+	}
+};
+
+// Shaders a render pass may require, every permutation takes one macro of each axis after the shared macros
+// Material shaders are also compiled for every material graph output, with its signature macro and shader include appended
+struct ShaderVariants
+{
+	ShaderPermutation                     permutation;
+	std::vector<std::vector<std::string>> macro_axes   = {};
+	bool                                  per_material = false;
+};
+
+// Shader generated from a material graph
+struct MaterialShader
+{
+	std::string signature;
+	std::string shader;
+};
+
+struct ShaderCompileResult
+{
+	ShaderPermutation permutation;
+	float             time    = 0.f;        // ms
+	bool              success = false;
+};
+
+// Compile times of every permutation of one entry point
+struct ShaderCompileTiming
+{
+	std::string name;
+	uint32_t    permutations = 0;
+	uint32_t    failed       = 0;
+	float       total_time   = 0.f;
+	float       max_time     = 0.f;
+};
+
 class  ShaderBuilder
 {
   public:
@@ -17,6 +74,21 @@ class  ShaderBuilder
 
 	ShaderMeta RequireShaderMeta(RHIShader *shader) const;
 
+	// Compile through the on-disk cache only, safe to call from multiple threads
+	static std::vector<uint8_t> CompileShader(const ShaderPermutation &permutation, ShaderMeta &meta, bool force_recompile = false);
+
+	// Every permutation that has been compiled into the on-disk cache
+	static std::vector<ShaderPermutation> GetCachedPermutations();
+
+	// Every permutation of the variants, in the macro order RequireShader is called with
+	static std::vector<ShaderPermutation> EnumeratePermutations(const ShaderVariants &variants, const std::vector<MaterialShader> &materials = {});
+
+	// Material graph outputs written to the directory, signatures are the ones material compilation assigns
+	static std::vector<MaterialShader> GetMaterialShaders(const std::string &directory = "Asset/Material");
+
+	// Group results by entry point, slowest first
+	static std::vector<ShaderCompileTiming> SummarizeCompileResults(const std::vector<ShaderCompileResult> &results);
+
   private:
 	RHIContext *p_rhi_context = nullptr;
 
@@ -24,4 +96,4 @@ class  ShaderBuilder
 
 	Impl *m_impl = nullptr;
 };
-}        // namespace Ilum
\ No newline at end of file
+}        // namespace Ilum
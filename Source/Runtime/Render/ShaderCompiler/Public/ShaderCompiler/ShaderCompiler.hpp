@@ -43,6 +43,9 @@ class ShaderCompiler
 
 	std::vector<uint8_t> Compile(const ShaderDesc &desc, ShaderMeta &meta);
 
+	// Versions of the bundled compilers, part of the shader cache key
+	const std::string &GetVersion() const;
+
   private:
 	struct Impl;
 	Impl *m_impl = nullptr;
@@ -0,0 +1,193 @@
+#include "BinaryAsset.hpp"
+#include "Resource/Mesh.hpp"
+
+#include <RHI/RHITexture.hpp>
+
+namespace Ilum
+{
+inline size_t AlignUp(size_t value, size_t alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+std::string BinaryAsset::GetPath(const std::string &name, ResourceType type)
+{
+	return fmt::format("Asset/Meta/{}.{}.bin", name, (uint32_t) type);
+}
+
+void BinaryAsset::AddChunk(BinaryChunk id, const void *data, size_t size, uint32_t stride)
+{
+	ChunkInfo info = {};
+	info.id        = id;
+	info.stride    = stride;
+	info.size      = size;
+
+	m_chunks.push_back(info);
+	m_chunk_data.push_back(static_cast<const uint8_t *>(data));
+}
+
+bool BinaryAsset::Save(const std::string &path, ResourceType type) const
+{
+	Header header      = {};
+	header.type        = static_cast<uint32_t>(type);
+	header.chunk_count = static_cast<uint32_t>(m_chunks.size());
+
+	std::vector<ChunkInfo> chunks = m_chunks;
+
+	size_t offset = AlignUp(sizeof(Header) + sizeof(ChunkInfo) * chunks.size(), Alignment);
+	for (auto &chunk : chunks)
+	{
+		chunk.offset = offset;
+		offset       = AlignUp(offset + chunk.size, Alignment);
+	}
+
+	std::ofstream os(path, std::ios::binary);
+	if (!os.is_open())
+	{
+		LOG_ERROR("Failed to write binary asset {}", path);
+		return false;
+	}
+
+	os.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+	os.write(reinterpret_cast<const char *>(chunks.data()), sizeof(ChunkInfo) * chunks.size());
+
+	const char padding[Alignment] = {};
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		os.write(padding, chunks[i].offset - static_cast<size_t>(os.tellp()));
+		os.write(reinterpret_cast<const char *>(m_chunk_data[i]), chunks[i].size);
+	}
+
+	return os.good();
+}
+
+bool BinaryAsset::Convert(const std::string &name, ResourceType type)
+{
+	std::string asset_path  = fmt::format("Asset/Meta/{}.{}.asset", name, (uint32_t) type);
+	std::string binary_path = GetPath(name, type);
+
+	BinaryAsset binary;
+
+	if (type == ResourceType::Mesh)
+	{
+		std::vector<uint8_t>                             thumbnail_data;
+		std::vector<Resource<ResourceType::Mesh>::Vertex> vertices;
+		std::vector<uint32_t>                            indices;
+		std::vector<Meshlet>                             meshlets;
+		std::vector<uint32_t>                            meshlet_data;
+
+		DESERIALIZE(asset_path, thumbnail_data, vertices, indices, meshlets, meshlet_data);
+
+		binary.AddChunk(BinaryChunk::Vertex, vertices);
+		binary.AddChunk(BinaryChunk::Index, indices);
+		binary.AddChunk(BinaryChunk::Meshlet, meshlets);
+		binary.AddChunk(BinaryChunk::MeshletData, meshlet_data);
+
+		return binary.Save(binary_path, type);
+	}
+	else if (type == ResourceType::Texture2D)
+	{
+		std::vector<uint8_t> thumbnail_data, data;
+		TextureDesc          desc;
+
+		DESERIALIZE(asset_path, thumbnail_data, desc, data);
+
+		std::vector<uint8_t> desc_data = Pack(desc);
+		binary.AddChunk(BinaryChunk::Desc, desc_data);
+		binary.AddChunk(BinaryChunk::Pixel, data);
+
+		return binary.Save(binary_path, type);
+	}
+
+	return false;
+}
+
+bool BinaryAsset::Open(const std::string &path, ResourceType type)
+{
+	Close();
+
+	if (!m_file.Open(path))
+	{
+		return false;
+	}
+
+	const uint8_t *data = m_file.GetData();
+	size_t         size = m_file.GetSize();
+
+	Header header = {};
+	if (size < sizeof(Header))
+	{
+		Close();
+		return false;
+	}
+
+	std::memcpy(&header, data, sizeof(Header));
+	if (header.magic != Magic ||
+	    header.version != Version ||
+	    header.type != static_cast<uint32_t>(type) ||
+	    header.chunk_count > (size - sizeof(Header)) / sizeof(ChunkInfo))
+	{
+		LOG_WARN("Binary asset {} is outdated or corrupted", path);
+		Close();
+		return false;
+	}
+
+	m_chunks.resize(header.chunk_count);
+	std::memcpy(m_chunks.data(), data + sizeof(Header), sizeof(ChunkInfo) * header.chunk_count);
+
+	for (auto &chunk : m_chunks)
+	{
+		// Written so that a forged offset or size cannot wrap around
+		if (chunk.offset % Alignment != 0 || chunk.size > size || chunk.offset > size - chunk.size)
+		{
+			LOG_WARN("Binary asset {} is outdated or corrupted", path);
+			Close();
+			return false;
+		}
+		m_chunk_data.push_back(data + chunk.offset);
+	}
+
+	return true;
+}
+
+void BinaryAsset::Close()
+{
+	m_chunks.clear();
+	m_chunk_data.clear();
+	m_file.Close();
+}
+
+bool BinaryAsset::IsValid() const
+{
+	return m_file.IsValid();
+}
+
+bool BinaryAsset::HasChunk(BinaryChunk id) const
+{
+	return FindChunk(id) != nullptr;
+}
+
+const uint8_t *BinaryAsset::GetChunkData(BinaryChunk id) const
+{
+	const ChunkInfo *chunk = FindChunk(id);
+	return chunk ? m_chunk_data[chunk - m_chunks.data()] : nullptr;
+}
+
+size_t BinaryAsset::GetChunkSize(BinaryChunk id) const
+{
+	const ChunkInfo *chunk = FindChunk(id);
+	return chunk ? static_cast<size_t>(chunk->size) : 0;
+}
+
+const BinaryAsset::ChunkInfo *BinaryAsset::FindChunk(BinaryChunk id) const
+{
+	for (auto &chunk : m_chunks)
+	{
+		if (chunk.id == id)
+		{
+			return &chunk;
+		}
+	}
+	return nullptr;
+}
+}        // namespace Ilum
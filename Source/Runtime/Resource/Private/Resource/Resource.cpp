@@ -36,6 +36,16 @@ const std::string &IResource::GetName() const
 	return m_name;
 }
 
+ResourceState IResource::GetState() const
+{
+	return m_state.load(std::memory_order_acquire);
+}
+
+void IResource::SetState(ResourceState state)
+{
+	m_state.store(state, std::memory_order_release);
+}
+
 size_t IResource::GetUUID() const
 {
 	return Hash(m_name);
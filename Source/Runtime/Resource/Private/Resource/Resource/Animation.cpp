@@ -1,5 +1,6 @@
 #include "Resource/Animation.hpp"
 
+#include <Geometry/VertexQuantization.hpp>
 #include <RHI/RHIContext.hpp>
 
 namespace Ilum
@@ -20,6 +21,174 @@ struct Resource<ResourceType::Animation>::Impl
 	uint32_t frame_count = 0;
 };
 
+static constexpr float  CompressionTolerance = 1e-3f;        // Joint position error relative to the skeleton size
+static constexpr float  MinReachRatio        = 0.1f;         // Lower bound of a bone's reach relative to the skeleton size
+static constexpr size_t MaxKeySpan           = 128;          // Bounds the reduction cost of long smooth runs
+
+// Unit quaternion -> smallest three
+inline void EncodeRotation(const glm::quat &rotation, uint16_t *packed)
+{
+	glm::quat q    = glm::normalize(rotation);
+	float     c[4] = {q.x, q.y, q.z, q.w};
+
+	uint32_t largest = 0;
+	for (uint32_t i = 1; i < 4; i++)
+	{
+		if (glm::abs(c[i]) > glm::abs(c[largest]))
+		{
+			largest = i;
+		}
+	}
+
+	// q and -q are the same rotation, flip so the dropped component is positive
+	float sign = c[largest] < 0.f ? -1.f : 1.f;
+
+	for (uint32_t i = 0, j = 0; i < 4; i++)
+	{
+		if (i != largest)
+		{
+			float v     = glm::clamp(c[i] * sign * glm::root_two<float>(), -1.f, 1.f);
+			packed[j++] = static_cast<uint16_t>(glm::round((v * 0.5f + 0.5f) * 32767.f));
+		}
+	}
+
+	packed[0] |= static_cast<uint16_t>((largest & 1) << 15);
+	packed[1] |= static_cast<uint16_t>((largest >> 1) << 15);
+}
+
+inline glm::quat DecodeRotation(const uint16_t *packed)
+{
+	uint32_t largest = (packed[0] >> 15) | ((packed[1] >> 15) << 1);
+
+	float c[4] = {};
+	float sum  = 0.f;
+	for (uint32_t i = 0, j = 0; i < 4; i++)
+	{
+		if (i != largest)
+		{
+			c[i] = (static_cast<float>(packed[j++] & 0x7fff) / 32767.f * 2.f - 1.f) / glm::root_two<float>();
+			sum += c[i] * c[i];
+		}
+	}
+	c[largest] = glm::sqrt(glm::max(1.f - sum, 0.f));
+
+	return glm::quat(c[3], c[0], c[1], c[2]);
+}
+
+// Greedily drop keys: a key goes if interpolating the last kept key and its successor reproduces every skipped key within tolerance
+template <typename Key, typename T, typename Interpolate, typename Error>
+inline std::vector<Key> ReduceKeys(const std::vector<Key> &keys, const std::vector<T> &values, Interpolate &&interpolate, Error &&error, float tolerance)
+{
+	if (keys.size() <= 2)
+	{
+		return keys;
+	}
+
+	std::vector<Key> result = {keys.front()};
+
+	size_t anchor = 0;
+	for (size_t i = 1; i + 1 < keys.size(); i++)
+	{
+		bool removable = i - anchor < MaxKeySpan;
+
+		float duration = keys[i + 1].time_stamp - keys[anchor].time_stamp;
+		for (size_t j = anchor + 1; j <= i && removable; j++)
+		{
+			float t   = duration > 0.f ? (keys[j].time_stamp - keys[anchor].time_stamp) / duration : 0.f;
+			removable = error(interpolate(values[anchor], values[i + 1], t), values[j]) <= tolerance;
+		}
+
+		if (!removable)
+		{
+			result.push_back(keys[i]);
+			anchor = i;
+		}
+	}
+
+	result.push_back(keys.back());
+
+	// Constant channel
+	if (result.size() == 2 && error(values.front(), values.back()) <= tolerance)
+	{
+		result.pop_back();
+	}
+
+	return result;
+}
+
+// Joint positions in skeleton space, indexed like bones, nodes above the first bone are ignored as in Bake
+inline void SampleJointPositions(const std::vector<Bone> &bones, const std::unordered_map<std::string, size_t> &bone_indices, const HierarchyNode &node, float time, glm::mat4 parent, bool outside, std::vector<glm::vec3> &positions)
+{
+	auto iter = bone_indices.find(node.name);
+
+	glm::mat4 global_transformation = outside ? glm::mat4(1.f) : parent * node.transform;
+
+	if (iter != bone_indices.end())
+	{
+		global_transformation   = parent * bones[iter->second].GetLocalTransform(time);
+		positions[iter->second] = glm::vec3(global_transformation[3]);
+
+		outside = false;
+	}
+
+	for (auto &child : node.children)
+	{
+		SampleJointPositions(bones, bone_indices, child, time, global_transformation, outside, positions);
+	}
+}
+
+// Index of the keyframe interval containing time, clamped to [0, size - 2]
+// The cursor and its successor are tried before falling back to a binary search
+template <typename Key>
+inline size_t FindKeyIndex(const std::vector<Key> &keys, float time, size_t *cursor)
+{
+	size_t last = keys.size() - 2;
+
+	auto contains = [&](size_t index) {
+		return (index == 0 || keys[index].time_stamp <= time) &&
+		       (index == last || time < keys[index + 1].time_stamp);
+	};
+
+	if (cursor)
+	{
+		size_t index = std::min(*cursor, last);
+		if (contains(index))
+		{
+			*cursor = index;
+			return index;
+		}
+		if (index < last && contains(index + 1))
+		{
+			*cursor = index + 1;
+			return index + 1;
+		}
+	}
+
+	auto iter = std::upper_bound(keys.begin() + 1, keys.end() - 1, time, [](float time, const Key &key) {
+		return time < key.time_stamp;
+	});
+
+	size_t index = static_cast<size_t>(iter - keys.begin()) - 1;
+
+	if (cursor)
+	{
+		*cursor = index;
+	}
+
+	return index;
+}
+
+glm::mat4 Bone::TRS::GetMatrix() const
+{
+	// Equivalent to translate * rotate * scale without the matrix products
+	glm::mat4 matrix = glm::toMat4(rotation);
+	matrix[0] *= scale.x;
+	matrix[1] *= scale.y;
+	matrix[2] *= scale.z;
+	matrix[3] = glm::vec4(translation, 1.f);
+	return matrix;
+}
+
 Bone::Bone(
     const std::string         &name,
     uint32_t                   id,
@@ -31,33 +200,70 @@ Bone::Bone(
 	m_name            = name;
 	m_id              = id;
 	m_offset          = offset;
-	m_positions       = std::move(positions);
-	m_rotations       = std::move(rotations);
-	m_scales          = std::move(scales);
 	m_local_transfrom = glm::mat4(1.f);
 
-	if (!m_positions.empty())
+	if (!positions.empty())
 	{
-		m_max_timestamp = glm::max(m_max_timestamp, m_positions.back().time_stamp);
+		m_max_timestamp = glm::max(m_max_timestamp, positions.back().time_stamp);
+
+		glm::vec3 min_bound = positions[0].position;
+		glm::vec3 max_bound = positions[0].position;
+		for (auto &key : positions)
+		{
+			min_bound = glm::min(min_bound, key.position);
+			max_bound = glm::max(max_bound, key.position);
+		}
+
+		m_position_offset = min_bound;
+		m_position_scale  = max_bound - min_bound;
+
+		m_positions.resize(positions.size());
+		for (size_t i = 0; i < positions.size(); i++)
+		{
+			m_positions[i].time_stamp = positions[i].time_stamp;
+			EncodePosition(positions[i].position, m_position_offset, m_position_scale, m_positions[i].value);
+		}
 	}
 
-	if (!m_rotations.empty())
+	if (!rotations.empty())
 	{
-		m_max_timestamp = glm::max(m_max_timestamp, m_rotations.back().time_stamp);
+		m_max_timestamp = glm::max(m_max_timestamp, rotations.back().time_stamp);
+
+		m_rotations.resize(rotations.size());
+		for (size_t i = 0; i < rotations.size(); i++)
+		{
+			m_rotations[i].time_stamp = rotations[i].time_stamp;
+			EncodeRotation(rotations[i].orientation, m_rotations[i].value);
+		}
 	}
 
-	if (!m_scales.empty())
+	if (!scales.empty())
 	{
-		m_max_timestamp = glm::max(m_max_timestamp, m_scales.back().time_stamp);
+		m_max_timestamp = glm::max(m_max_timestamp, scales.back().time_stamp);
+
+		glm::vec3 min_bound = scales[0].scale;
+		glm::vec3 max_bound = scales[0].scale;
+		for (auto &key : scales)
+		{
+			min_bound = glm::min(min_bound, key.scale);
+			max_bound = glm::max(max_bound, key.scale);
+		}
+
+		m_scale_offset = min_bound;
+		m_scale_scale  = max_bound - min_bound;
+
+		m_scales.resize(scales.size());
+		for (size_t i = 0; i < scales.size(); i++)
+		{
+			m_scales[i].time_stamp = scales[i].time_stamp;
+			EncodePosition(scales[i].scale, m_scale_offset, m_scale_scale, m_scales[i].value);
+		}
 	}
 }
 
 void Bone::Update(float time)
 {
-	m_local_transfrom =
-	    InterpolatePosition(time) *
-	    InterpolateRotation(time) *
-	    InterpolateScaling(time);
+	m_local_transfrom = Sample(time).GetMatrix();
 }
 
 glm::mat4 Bone::GetLocalTransform() const
@@ -80,48 +286,33 @@ glm::mat4 Bone::GetBoneOffset() const
 	return m_offset;
 }
 
-size_t Bone::GetPositionIndex(float time) const
+size_t Bone::GetPositionIndex(float time, size_t *cursor) const
 {
-	for (size_t index = 0; index < m_positions.size() - 1; index++)
-	{
-		if (time < m_positions[index + 1].time_stamp)
-		{
-			return index;
-		}
-	}
-	return m_positions.size() - 2;
+	return FindKeyIndex(m_positions, time, cursor);
 }
 
-size_t Bone::GetRotationIndex(float time) const
+size_t Bone::GetRotationIndex(float time, size_t *cursor) const
 {
-	for (size_t index = 0; index < m_rotations.size() - 1; index++)
-	{
-		if (time < m_rotations[index + 1].time_stamp)
-		{
-			return index;
-		}
-	}
-	return m_rotations.size() - 2;
+	return FindKeyIndex(m_rotations, time, cursor);
 }
 
-size_t Bone::GetScaleIndex(float time) const
+size_t Bone::GetScaleIndex(float time, size_t *cursor) const
 {
-	for (size_t index = 0; index < m_scales.size() - 1; index++)
-	{
-		if (time < m_scales[index + 1].time_stamp)
-		{
-			return index;
-		}
-	}
-	return m_scales.size() - 2;
+	return FindKeyIndex(m_scales, time, cursor);
 }
 
-glm::mat4 Bone::GetLocalTransform(float time) const
+Bone::TRS Bone::Sample(float time, Cursor *cursor) const
 {
-	glm::mat4 translation = InterpolatePosition(time);
-	glm::mat4 rotation    = InterpolateRotation(time);
-	glm::mat4 scale       = InterpolateScaling(time);
-	return translation * rotation * scale;
+	TRS trs         = {};
+	trs.translation = InterpolatePosition(time, cursor ? &cursor->position : nullptr);
+	trs.rotation    = InterpolateRotation(time, cursor ? &cursor->rotation : nullptr);
+	trs.scale       = InterpolateScaling(time, cursor ? &cursor->scale : nullptr);
+	return trs;
+}
+
+glm::mat4 Bone::GetLocalTransform(float time, Cursor *cursor) const
+{
+	return Sample(time, cursor).GetMatrix();
 }
 
 glm::mat4 Bone::GetTransformedOffset(float time) const
@@ -134,71 +325,124 @@ float Bone::GetMaxTimeStamp() const
 	return m_max_timestamp;
 }
 
+void Bone::Compress(float tolerance, float reach)
+{
+	// Errors are measured on decoded keys, so quantization error counts against the tolerance
+	{
+		std::vector<glm::vec3> values(m_positions.size());
+		for (size_t i = 0; i < m_positions.size(); i++)
+		{
+			values[i] = DecodePosition(m_positions[i].value, m_position_offset, m_position_scale);
+		}
+
+		m_positions = ReduceKeys(
+		    m_positions, values,
+		    [](const glm::vec3 &a, const glm::vec3 &b, float t) { return glm::mix(a, b, t); },
+		    [](const glm::vec3 &a, const glm::vec3 &b) { return glm::length(a - b); },
+		    tolerance);
+	}
+
+	{
+		std::vector<glm::quat> values(m_rotations.size());
+		for (size_t i = 0; i < m_rotations.size(); i++)
+		{
+			values[i] = DecodeRotation(m_rotations[i].value);
+		}
+
+		// A rotation error of theta moves the farthest descendant joint by about theta * reach
+		m_rotations = ReduceKeys(
+		    m_rotations, values,
+		    [](const glm::quat &a, const glm::quat &b, float t) { return glm::normalize(glm::slerp(a, b, t)); },
+		    [reach](const glm::quat &a, const glm::quat &b) { return 2.f * glm::acos(glm::clamp(glm::abs(glm::dot(a, b)), 0.f, 1.f)) * reach; },
+		    tolerance);
+	}
+
+	{
+		std::vector<glm::vec3> values(m_scales.size());
+		for (size_t i = 0; i < m_scales.size(); i++)
+		{
+			values[i] = DecodePosition(m_scales[i].value, m_scale_offset, m_scale_scale);
+		}
+
+		m_scales = ReduceKeys(
+		    m_scales, values,
+		    [](const glm::vec3 &a, const glm::vec3 &b, float t) { return glm::mix(a, b, t); },
+		    [reach](const glm::vec3 &a, const glm::vec3 &b) { return glm::length(a - b) * reach; },
+		    tolerance);
+	}
+}
+
+size_t Bone::GetKeyCount() const
+{
+	return m_positions.size() + m_rotations.size() + m_scales.size();
+}
+
 float Bone::GetScaleFactor(float last, float next, float time) const
 {
 	return (time - last) / (next - last);
 }
 
-glm::mat4 Bone::InterpolatePosition(float time) const
+glm::vec3 Bone::InterpolatePosition(float time, size_t *cursor) const
 {
 	if (m_positions.empty())
 	{
-		return glm::mat4(1.f);
+		return glm::vec3(0.f);
 	}
 
 	if (m_positions.size() == 1)
 	{
-		return glm::translate(glm::mat4(1.f), m_positions[0].position);
+		return DecodePosition(m_positions[0].value, m_position_offset, m_position_scale);
 	}
 
-	size_t    p0             = GetPositionIndex(time);
-	size_t    p1             = p0 + 1;
-	float     scale_factor   = GetScaleFactor(m_positions[p0].time_stamp, m_positions[p1].time_stamp, glm::clamp(time, 0.f, m_positions.back().time_stamp));
-	glm::vec3 final_position = glm::mix(m_positions[p0].position, m_positions[p1].position, scale_factor);
+	size_t p0           = GetPositionIndex(time, cursor);
+	size_t p1           = p0 + 1;
+	float  scale_factor = GetScaleFactor(m_positions[p0].time_stamp, m_positions[p1].time_stamp, glm::clamp(time, 0.f, m_positions.back().time_stamp));
 
-	return glm::translate(glm::mat4(1.f), final_position);
+	return glm::mix(
+	    DecodePosition(m_positions[p0].value, m_position_offset, m_position_scale),
+	    DecodePosition(m_positions[p1].value, m_position_offset, m_position_scale),
+	    scale_factor);
 }
 
-glm::mat4 Bone::InterpolateRotation(float time) const
+glm::quat Bone::InterpolateRotation(float time, size_t *cursor) const
 {
 	if (m_rotations.empty())
 	{
-		return glm::mat4(1.f);
+		return glm::quat(1.f, 0.f, 0.f, 0.f);
 	}
 
 	if (m_rotations.size() == 1)
 	{
-		auto rotation = glm::normalize(m_rotations[0].orientation);
-		return glm::toMat4(rotation);
+		return DecodeRotation(m_rotations[0].value);
 	}
 
-	size_t    p0             = GetRotationIndex(time);
-	size_t    p1             = p0 + 1;
-	float     scale_factor   = GetScaleFactor(m_rotations[p0].time_stamp, m_rotations[p1].time_stamp, glm::clamp(time, 0.f, m_rotations.back().time_stamp));
-	glm::quat final_rotation = glm::slerp(m_rotations[p0].orientation, m_rotations[p1].orientation, scale_factor);
-	final_rotation           = glm::normalize(final_rotation);
+	size_t p0           = GetRotationIndex(time, cursor);
+	size_t p1           = p0 + 1;
+	float  scale_factor = GetScaleFactor(m_rotations[p0].time_stamp, m_rotations[p1].time_stamp, glm::clamp(time, 0.f, m_rotations.back().time_stamp));
 
-	return glm::toMat4(final_rotation);
+	return glm::normalize(glm::slerp(DecodeRotation(m_rotations[p0].value), DecodeRotation(m_rotations[p1].value), scale_factor));
 }
 
-glm::mat4 Bone::InterpolateScaling(float time) const
+glm::vec3 Bone::InterpolateScaling(float time, size_t *cursor) const
 {
 	if (m_scales.empty())
 	{
-		return glm::mat4(1.f);
+		return glm::vec3(1.f);
 	}
 
 	if (m_scales.size() == 1)
 	{
-		return glm::scale(glm::mat4(1.f), m_scales[0].scale);
+		return DecodePosition(m_scales[0].value, m_scale_offset, m_scale_scale);
 	}
 
-	size_t    p0           = GetScaleIndex(time);
-	size_t    p1           = p0 + 1;
-	float     scale_factor = GetScaleFactor(m_scales[p0].time_stamp, m_scales[p1].time_stamp, glm::clamp(time, 0.f, m_scales.back().time_stamp));
-	glm::vec3 final_scale  = glm::mix(m_scales[p0].scale, m_scales[p1].scale, scale_factor);
+	size_t p0           = GetScaleIndex(time, cursor);
+	size_t p1           = p0 + 1;
+	float  scale_factor = GetScaleFactor(m_scales[p0].time_stamp, m_scales[p1].time_stamp, glm::clamp(time, 0.f, m_scales.back().time_stamp));
 
-	return glm::scale(glm::mat4(1.f), final_scale);
+	return glm::mix(
+	    DecodePosition(m_scales[p0].value, m_scale_offset, m_scale_scale),
+	    DecodePosition(m_scales[p1].value, m_scale_offset, m_scale_scale),
+	    scale_factor);
 }
 
 Resource<ResourceType::Animation>::Resource(RHIContext *rhi_context, const std::string &name) :
@@ -219,6 +463,8 @@ Resource<ResourceType::Animation>::Resource(RHIContext *rhi_context, const std::
 		m_impl->m_max_timestamp = glm::max(m_impl->m_max_timestamp, bone.GetMaxTimeStamp());
 	}
 
+	Compress();
+
 	std::vector<uint8_t> thumbnail_data;
 	DESERIALIZE("Asset/BuildIn/animation.icon.asset", thumbnail_data);
 	UpdateThumbnail(rhi_context, thumbnail_data);
@@ -268,16 +514,113 @@ const HierarchyNode &Resource<ResourceType::Animation>::GetHierarchyNode() const
 	return m_impl->hierarchy;
 }
 
+void Resource<ResourceType::Animation>::Compress()
+{
+	std::unordered_map<std::string, size_t> bone_indices;
+	for (size_t i = 0; i < m_impl->bones.size(); i++)
+	{
+		bone_indices.emplace(m_impl->bones[i].GetBoneName(), i);
+	}
+
+	// Reach: distance to the farthest descendant joint, height: joints on the longest chain below and including the node
+	std::unordered_map<std::string, std::pair<float, uint32_t>> extents;
+
+	std::function<std::pair<float, uint32_t>(const HierarchyNode &)> measure = [&](const HierarchyNode &node) {
+		float    reach  = 0.f;
+		uint32_t height = 0;
+		for (auto &child : node.children)
+		{
+			auto [child_reach, child_height] = measure(child);
+
+			reach  = glm::max(reach, glm::length(glm::vec3(child.transform[3])) + child_reach);
+			height = glm::max(height, child_height);
+		}
+		extents[node.name] = {reach, height + 1};
+		return extents[node.name];
+	};
+
+	float skeleton_size = measure(m_impl->hierarchy).first;
+	if (skeleton_size <= 0.f)
+	{
+		skeleton_size = 1.f;
+	}
+
+	// Errors of every bone on a chain add up at its end effector, so the tolerance is split along the longest chain through each bone
+	float tolerance = CompressionTolerance * skeleton_size;
+
+	std::vector<Bone> reference = m_impl->bones;
+
+	size_t key_count = 0;
+	for (auto &bone : m_impl->bones)
+	{
+		key_count += bone.GetKeyCount();
+	}
+
+	std::function<void(const HierarchyNode &, uint32_t)> compress = [&](const HierarchyNode &node, uint32_t depth) {
+		auto bone = bone_indices.find(node.name);
+		if (bone != bone_indices.end())
+		{
+			auto &[reach, height] = extents[node.name];
+			m_impl->bones[bone->second].Compress(tolerance / static_cast<float>(depth + height), glm::max(reach, MinReachRatio * skeleton_size));
+		}
+
+		for (auto &child : node.children)
+		{
+			compress(child, depth + 1);
+		}
+	};
+	compress(m_impl->hierarchy, 0);
+
+	size_t compressed_key_count = 0;
+	for (auto &bone : m_impl->bones)
+	{
+		compressed_key_count += bone.GetKeyCount();
+	}
+
+	// Measure joint position error against the uncompressed clip
+	float max_error = 0.f;
+	{
+		std::vector<glm::vec3> reference_positions(m_impl->bones.size());
+		std::vector<glm::vec3> compressed_positions(m_impl->bones.size());
+
+		size_t frame_count = static_cast<size_t>(m_impl->m_max_timestamp * 30.f);
+		for (size_t i = 0; i <= frame_count; i++)
+		{
+			float time = glm::min(static_cast<float>(i) / 30.f, m_impl->m_max_timestamp);
+
+			SampleJointPositions(reference, bone_indices, m_impl->hierarchy, time, glm::mat4(1.f), true, reference_positions);
+			SampleJointPositions(m_impl->bones, bone_indices, m_impl->hierarchy, time, glm::mat4(1.f), true, compressed_positions);
+
+			for (size_t j = 0; j < m_impl->bones.size(); j++)
+			{
+				max_error = glm::max(max_error, glm::length(reference_positions[j] - compressed_positions[j]));
+			}
+		}
+	}
+
+	LOG_INFO("Animation {} compressed: {} -> {} keys ({:.1f}x), max joint error {:.3g} ({:.3g} of skeleton size)",
+	         m_name, key_count, compressed_key_count, static_cast<float>(key_count) / static_cast<float>(std::max<size_t>(compressed_key_count, 1)), max_error, max_error / skeleton_size);
+}
+
 void Resource<ResourceType::Animation>::Bake(RHIContext *rhi_context)
 {
+	// Frames are baked in order, so every bone keeps a cursor into its keyframes
+	std::unordered_map<std::string, size_t> bone_indices;
+	std::vector<Bone::Cursor>               cursors(m_impl->bones.size());
+	for (size_t i = 0; i < m_impl->bones.size(); i++)
+	{
+		bone_indices.emplace(m_impl->bones[i].GetBoneName(), i);
+	}
+
 	std::function<void(const HierarchyNode &, float time, std::vector<glm::mat4> &, glm::mat4, bool)> calculate_bone_transform = [&](const HierarchyNode &node, float time, std::vector<glm::mat4> &skinned_matrics, glm::mat4 parent, bool outside) {
-		Bone *bone = GetBone(node.name);
+		auto  iter = bone_indices.find(node.name);
+		Bone *bone = iter == bone_indices.end() ? nullptr : &m_impl->bones[iter->second];
 
 		glm::mat4 global_transformation = outside ? glm::mat4(1.f) : parent * node.transform;
 
 		if (bone)
 		{
-			global_transformation    = parent * bone->GetLocalTransform(time);
+			global_transformation    = parent * bone->GetLocalTransform(time, &cursors[iter->second]);
 			uint32_t  bone_id        = bone->GetBoneID();
 			glm::mat4 offset         = bone->GetBoneOffset();
 			skinned_matrics[bone_id] = global_transformation * offset;
@@ -309,11 +652,13 @@ void Resource<ResourceType::Animation>::Bake(RHIContext *rhi_context)
 
 	std::vector<float> skinned_matrics(frame_count * 4ull * 3ull * m_impl->m_bone_count);
 
+	std::vector<glm::mat4> frame_skinned_matrics(m_impl->m_bone_count);
+
 	for (size_t i = 0; i < frame_count; i++)
 	{
 		float time = static_cast<float>(i) / 30.f;
 
-		std::vector<glm::mat4> frame_skinned_matrics(m_impl->m_bone_count);
+		std::fill(frame_skinned_matrics.begin(), frame_skinned_matrics.end(), glm::mat4(1.f));
 		calculate_bone_transform(m_impl->hierarchy, time, frame_skinned_matrics, glm::mat4(1.f), true);
 
 		if (i == 0)
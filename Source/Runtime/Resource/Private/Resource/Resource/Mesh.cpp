@@ -1,4 +1,5 @@
 #include "Resource/Mesh.hpp"
+#include "BinaryAsset.hpp"
 
 #include <RHI/RHIContext.hpp>
 #include <ShaderCompiler/ShaderCompiler.hpp>
@@ -11,17 +12,43 @@ struct Resource<ResourceType::Mesh>::Impl
 	size_t index_count   = 0;
 	size_t meshlet_count = 0;
 
+	AABB aabb;
+
 	std::unique_ptr<RHIBuffer> vertex_buffer       = nullptr;
 	std::unique_ptr<RHIBuffer> index_buffer        = nullptr;
 	std::unique_ptr<RHIBuffer> meshlet_data_buffer = nullptr;
 	std::unique_ptr<RHIBuffer> meshlet_buffer      = nullptr;
 
 	std::unique_ptr<RHIAccelerationStructure> blas = nullptr;
+
+	// Decoded data waiting for upload, either mapped from the binary asset or deserialized from a legacy one
+	BinaryAsset           binary;
+	std::vector<Vertex>   vertices;
+	std::vector<uint32_t> indices;
+	std::vector<Meshlet>  meshlets;
+	std::vector<uint32_t> meshlet_data;
 };
 
+inline void StageBuffer(RHIContext *rhi_context, RHICommand *cmd_buffer, std::vector<std::unique_ptr<RHIBuffer>> &staging_buffers, RHIBuffer *buffer, const void *data, size_t size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	auto staging_buffer = rhi_context->CreateBuffer(size, RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU);
+	std::memcpy(staging_buffer->Map(), data, size);
+	staging_buffer->Unmap();
+
+	cmd_buffer->CopyBufferToBuffer(staging_buffer.get(), buffer, size);
+
+	staging_buffers.emplace_back(std::move(staging_buffer));
+}
+
 Resource<ResourceType::Mesh>::Resource(RHIContext *rhi_context, const std::string &name) :
     IResource(rhi_context, name, ResourceType::Mesh)
 {
+	m_impl = new Impl;
 }
 
 Resource<ResourceType::Mesh>::Resource(RHIContext *rhi_context, const std::string &name, std::vector<Vertex> &&vertices, std::vector<uint32_t> &&indices, std::vector<Meshlet> &&meshlets, std::vector<uint32_t> &&meshlet_data) :
@@ -38,22 +65,108 @@ Resource<ResourceType::Mesh>::~Resource()
 
 bool Resource<ResourceType::Mesh>::Validate() const
 {
-	return m_impl != nullptr;
+	return m_impl->vertex_buffer != nullptr;
 }
 
 void Resource<ResourceType::Mesh>::Load(RHIContext *rhi_context)
 {
-	m_impl = new Impl;
+	Decode();
 
-	std::vector<uint8_t>  thumbnail_data;
-	std::vector<Vertex>   vertices;
-	std::vector<uint32_t> indices;
-	std::vector<Meshlet>  meshlets;
-	std::vector<uint32_t> meshlet_data;
+	std::vector<std::unique_ptr<RHIBuffer>> staging_buffers;
 
-	DESERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Mesh), thumbnail_data, vertices, indices, meshlets, meshlet_data);
+	auto *cmd_buffer = rhi_context->CreateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+	Upload(rhi_context, cmd_buffer, staging_buffers);
+	cmd_buffer->End();
 
-	Update(rhi_context, std::move(vertices), std::move(indices), std::move(meshlets), std::move(meshlet_data));
+	rhi_context->Execute(cmd_buffer);
+}
+
+void Resource<ResourceType::Mesh>::Decode()
+{
+	if (m_impl->binary.Open(BinaryAsset::GetPath(m_name, ResourceType::Mesh), ResourceType::Mesh))
+	{
+		return;
+	}
+
+	std::vector<uint8_t> thumbnail_data;
+
+	DESERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Mesh), thumbnail_data, m_impl->vertices, m_impl->indices, m_impl->meshlets, m_impl->meshlet_data);
+}
+
+void Resource<ResourceType::Mesh>::Upload(RHIContext *rhi_context, RHICommand *cmd_buffer, std::vector<std::unique_ptr<RHIBuffer>> &staging_buffers)
+{
+	const BinaryAsset &binary = m_impl->binary;
+
+	const void *vertices     = m_impl->vertices.data();
+	const void *indices      = m_impl->indices.data();
+	const void *meshlets     = m_impl->meshlets.data();
+	const void *meshlet_data = m_impl->meshlet_data.data();
+
+	size_t meshlet_data_count = m_impl->meshlet_data.size();
+
+	if (binary.IsValid())
+	{
+		// Mapped payloads go straight into staging buffers
+		vertices     = binary.GetChunkData(BinaryChunk::Vertex);
+		indices      = binary.GetChunkData(BinaryChunk::Index);
+		meshlets     = binary.GetChunkData(BinaryChunk::Meshlet);
+		meshlet_data = binary.GetChunkData(BinaryChunk::MeshletData);
+
+		m_impl->vertex_count  = binary.GetChunkCount<Vertex>(BinaryChunk::Vertex);
+		m_impl->index_count   = binary.GetChunkCount<uint32_t>(BinaryChunk::Index);
+		m_impl->meshlet_count = binary.GetChunkCount<Meshlet>(BinaryChunk::Meshlet);
+		meshlet_data_count    = binary.GetChunkCount<uint32_t>(BinaryChunk::MeshletData);
+	}
+	else
+	{
+		m_impl->vertex_count  = m_impl->vertices.size();
+		m_impl->index_count   = m_impl->indices.size();
+		m_impl->meshlet_count = m_impl->meshlets.size();
+	}
+
+	m_impl->vertex_buffer       = rhi_context->CreateBuffer<Vertex>(m_impl->vertex_count, RHIBufferUsage::Vertex | RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+	m_impl->index_buffer        = rhi_context->CreateBuffer<uint32_t>(m_impl->index_count, RHIBufferUsage::Index | RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+	m_impl->meshlet_data_buffer = rhi_context->CreateBuffer<uint32_t>(meshlet_data_count, RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+	m_impl->meshlet_buffer      = rhi_context->CreateBuffer<Meshlet>(m_impl->meshlet_count, RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+
+	// Bounds from the meshlet spheres, the vertices may live in mapped memory only
+	m_impl->aabb = AABB();
+	for (size_t i = 0; i < m_impl->meshlet_count; i++)
+	{
+		const Meshlet &meshlet = static_cast<const Meshlet *>(meshlets)[i];
+		m_impl->aabb.Merge(AABB(meshlet.center - glm::vec3(meshlet.radius), meshlet.center + glm::vec3(meshlet.radius)));
+	}
+
+	StageBuffer(rhi_context, cmd_buffer, staging_buffers, m_impl->vertex_buffer.get(), vertices, m_impl->vertex_count * sizeof(Vertex));
+	StageBuffer(rhi_context, cmd_buffer, staging_buffers, m_impl->index_buffer.get(), indices, m_impl->index_count * sizeof(uint32_t));
+	StageBuffer(rhi_context, cmd_buffer, staging_buffers, m_impl->meshlet_data_buffer.get(), meshlet_data, meshlet_data_count * sizeof(uint32_t));
+	StageBuffer(rhi_context, cmd_buffer, staging_buffers, m_impl->meshlet_buffer.get(), meshlets, m_impl->meshlet_count * sizeof(Meshlet));
+
+	// BLAS build reads the uploaded geometry in the same batch
+	cmd_buffer->ResourceStateTransition(
+	    {},
+	    {BufferStateTransition{m_impl->vertex_buffer.get(), RHIResourceState::TransferDest, RHIResourceState::AccelerationStructure},
+	     BufferStateTransition{m_impl->index_buffer.get(), RHIResourceState::TransferDest, RHIResourceState::AccelerationStructure}});
+
+	m_impl->blas = rhi_context->CreateAcccelerationStructure();
+
+	BLASDesc desc        = {};
+	desc.name            = m_name;
+	desc.vertex_buffer   = m_impl->vertex_buffer.get();
+	desc.index_buffer    = m_impl->index_buffer.get();
+	desc.vertices_count  = static_cast<uint32_t>(m_impl->vertex_count);
+	desc.vertices_offset = 0;
+	desc.indices_count   = static_cast<uint32_t>(m_impl->index_count);
+	desc.indices_offset  = 0;
+
+	m_impl->blas->Update(cmd_buffer, desc);
+
+	m_impl->binary.Close();
+	m_impl->vertices     = {};
+	m_impl->indices      = {};
+	m_impl->meshlets     = {};
+	m_impl->meshlet_data = {};
 }
 
 RHIBuffer *Resource<ResourceType::Mesh>::GetVertexBuffer() const
@@ -96,6 +209,11 @@ size_t Resource<ResourceType::Mesh>::GetMeshletCount() const
 	return m_impl->meshlet_count;
 }
 
+const AABB &Resource<ResourceType::Mesh>::GetAABB() const
+{
+	return m_impl->aabb;
+}
+
 void Resource<ResourceType::Mesh>::Update(RHIContext *rhi_context, std::vector<Vertex> &&vertices, std::vector<uint32_t> &&indices, std::vector<Meshlet> &&meshlets, std::vector<uint32_t> &&meshlet_data)
 {
 	m_impl->vertex_count  = vertices.size();
@@ -137,11 +255,20 @@ void Resource<ResourceType::Mesh>::Update(RHIContext *rhi_context, std::vector<V
 		max_bound = glm::max(max_bound, v.position);
 	}
 
+	m_impl->aabb = AABB(min_bound, max_bound);
+
 	glm::vec3 center = (max_bound + min_bound) * 0.5f;
 	float     radius = glm::length(max_bound - min_bound);
 
 	std::vector<uint8_t> thumbnail_data = RenderPreview(rhi_context, center, radius);
-	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Mesh), thumbnail_data, vertices, indices, meshlets, meshlet_data);
+	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Mesh), thumbnail_data);
+
+	BinaryAsset binary;
+	binary.AddChunk(BinaryChunk::Vertex, vertices);
+	binary.AddChunk(BinaryChunk::Index, indices);
+	binary.AddChunk(BinaryChunk::Meshlet, meshlets);
+	binary.AddChunk(BinaryChunk::MeshletData, meshlet_data);
+	binary.Save(BinaryAsset::GetPath(m_name, ResourceType::Mesh), ResourceType::Mesh);
 }
 
 std::vector<uint8_t> Resource<ResourceType::Mesh>::RenderPreview(RHIContext *rhi_context, const glm::vec3 &center, float radius)
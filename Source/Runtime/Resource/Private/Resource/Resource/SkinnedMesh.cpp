@@ -1,5 +1,6 @@
 #include "Resource/SkinnedMesh.hpp"
 
+#include <Geometry/VertexQuantization.hpp>
 #include <RHI/RHIContext.hpp>
 
 namespace Ilum
@@ -11,12 +12,23 @@ struct Resource<ResourceType::SkinnedMesh>::Impl
 	size_t meshlet_count = 0;
 	size_t bone_count    = 0;
 
+	glm::vec3 position_offset = glm::vec3(0.f);
+	glm::vec3 position_scale  = glm::vec3(1.f);
+
 	std::unique_ptr<RHIBuffer> vertex_buffer       = nullptr;
 	std::unique_ptr<RHIBuffer> index_buffer        = nullptr;
 	std::unique_ptr<RHIBuffer> meshlet_buffer      = nullptr;
 	std::unique_ptr<RHIBuffer> meshlet_data_buffer = nullptr;
 };
 
+static_assert(sizeof(Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex) == 48, "Quantized skinned vertex must match the shader layout");
+
+// Reconstruction error bounds checked at import time
+static constexpr float PositionErrorBound = 1.f / 65535.f;        // Relative to the bound diagonal
+static constexpr float NormalErrorBound   = 1e-3f;
+static constexpr float TexcoordErrorBound = 1.f / 1024.f;        // Relative to max(|uv|, 1)
+static constexpr float WeightErrorBound   = 0.5f / 255.f + 1e-6f;
+
 Resource<ResourceType::SkinnedMesh>::Resource(RHIContext *rhi_context, const std::string &name) :
     IResource(rhi_context, name, ResourceType::SkinnedMesh)
 {
@@ -43,15 +55,15 @@ void Resource<ResourceType::SkinnedMesh>::Load(RHIContext *rhi_context)
 {
 	m_impl = new Impl;
 
-	std::vector<uint8_t>       thumbnail_data;
-	std::vector<SkinnedVertex> vertices;
-	std::vector<uint32_t>      indices;
-	std::vector<Meshlet>       meshlets;
-	std::vector<uint32_t>      meshlet_data;
+	std::vector<uint8_t>                thumbnail_data;
+	std::vector<QuantizedSkinnedVertex> vertices;
+	std::vector<uint32_t>               indices;
+	std::vector<Meshlet>                meshlets;
+	std::vector<uint32_t>               meshlet_data;
 
-	DESERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::SkinnedMesh), thumbnail_data, vertices, indices, meshlets, meshlet_data);
+	DESERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::SkinnedMesh), thumbnail_data, vertices, indices, meshlets, meshlet_data, m_impl->bone_count, m_impl->position_offset, m_impl->position_scale);
 
-	Update(rhi_context, std::move(vertices), std::move(indices), std::move(meshlets), std::move(meshlet_data));
+	UpdateBuffers(rhi_context, vertices, indices, meshlets, meshlet_data);
 }
 
 RHIBuffer *Resource<ResourceType::SkinnedMesh>::GetVertexBuffer() const
@@ -94,12 +106,18 @@ size_t Resource<ResourceType::SkinnedMesh>::GetBoneCount() const
 	return m_impl->bone_count;
 }
 
-void Resource<ResourceType::SkinnedMesh>::Update(RHIContext *rhi_context, std::vector<Resource<ResourceType::SkinnedMesh>::SkinnedVertex> &&vertices, std::vector<uint32_t> &&indices, std::vector<Meshlet> &&meshlets, std::vector<uint32_t> &&meshletdata)
+const glm::vec3 &Resource<ResourceType::SkinnedMesh>::GetPositionOffset() const
 {
-	m_impl->vertex_count  = vertices.size();
-	m_impl->index_count   = indices.size();
-	m_impl->meshlet_count = meshlets.size();
+	return m_impl->position_offset;
+}
 
+const glm::vec3 &Resource<ResourceType::SkinnedMesh>::GetPositionScale() const
+{
+	return m_impl->position_scale;
+}
+
+void Resource<ResourceType::SkinnedMesh>::Update(RHIContext *rhi_context, std::vector<Resource<ResourceType::SkinnedMesh>::SkinnedVertex> &&vertices, std::vector<uint32_t> &&indices, std::vector<Meshlet> &&meshlets, std::vector<uint32_t> &&meshletdata)
+{
 	std::unordered_set<int32_t> bone_set;
 	for (auto &v : vertices)
 	{
@@ -113,16 +131,6 @@ void Resource<ResourceType::SkinnedMesh>::Update(RHIContext *rhi_context, std::v
 	}
 	m_impl->bone_count = bone_set.size();
 
-	m_impl->vertex_buffer       = rhi_context->CreateBuffer<SkinnedVertex>(vertices.size(), RHIBufferUsage::Vertex | RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
-	m_impl->index_buffer        = rhi_context->CreateBuffer<uint32_t>(indices.size(), RHIBufferUsage::Index | RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
-	m_impl->meshlet_data_buffer = rhi_context->CreateBuffer<uint32_t>(meshletdata.size(), RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
-	m_impl->meshlet_buffer      = rhi_context->CreateBuffer<Meshlet>(meshlets.size(), RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
-
-	m_impl->vertex_buffer->CopyToDevice(vertices.data(), vertices.size() * sizeof(SkinnedVertex));
-	m_impl->index_buffer->CopyToDevice(indices.data(), indices.size() * sizeof(uint32_t));
-	m_impl->meshlet_data_buffer->CopyToDevice(meshletdata.data(), meshletdata.size() * sizeof(uint32_t));
-	m_impl->meshlet_buffer->CopyToDevice(meshlets.data(), meshlets.size() * sizeof(Meshlet));
-
 	glm::vec3 min_bound = glm::vec3(std::numeric_limits<float>::max());
 	glm::vec3 max_bound = glm::vec3(-std::numeric_limits<float>::max());
 	for (const auto &v : vertices)
@@ -131,14 +139,97 @@ void Resource<ResourceType::SkinnedMesh>::Update(RHIContext *rhi_context, std::v
 		max_bound = glm::max(max_bound, v.position);
 	}
 
+	m_impl->position_offset = vertices.empty() ? glm::vec3(0.f) : min_bound;
+	m_impl->position_scale  = vertices.empty() ? glm::vec3(1.f) : max_bound - min_bound;
+
+	// Encode
+	std::vector<QuantizedSkinnedVertex> quantized_vertices(vertices.size());
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		const SkinnedVertex    &v = vertices[i];
+		QuantizedSkinnedVertex &q = quantized_vertices[i];
+
+		EncodePosition(v.position, m_impl->position_offset, m_impl->position_scale, q.position);
+		q.normal    = EncodeOctahedral(v.normal);
+		q.tangent   = EncodeOctahedral(v.tangent);
+		q.texcoord0 = EncodeHalf2(v.texcoord0);
+		q.texcoord1 = EncodeHalf2(v.texcoord1);
+
+		for (uint32_t j = 0; j < MAX_BONE_INFLUENCE; j++)
+		{
+			q.bones[j]   = v.bones[j] < 0 ? 0xffff : static_cast<uint16_t>(glm::min(v.bones[j], 0xfffe));
+			q.weights[j] = EncodeUnorm8(v.weights[j]);
+		}
+	}
+
+	// Measure reconstruction error
+	{
+		float position_error = 0.f;
+		float normal_error   = 0.f;
+		float texcoord_error = 0.f;
+		float weight_error   = 0.f;
+
+		float diagonal = glm::max(glm::length(m_impl->position_scale), std::numeric_limits<float>::epsilon());
+
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			const SkinnedVertex          &v = vertices[i];
+			const QuantizedSkinnedVertex &q = quantized_vertices[i];
+
+			position_error = glm::max(position_error, glm::length(DecodePosition(q.position, m_impl->position_offset, m_impl->position_scale) - v.position) / diagonal);
+
+			if (glm::dot(v.normal, v.normal) > 0.f)
+			{
+				normal_error = glm::max(normal_error, glm::length(DecodeOctahedral(q.normal) - glm::normalize(v.normal)));
+			}
+
+			glm::vec2 texcoord0_error = glm::abs(DecodeHalf2(q.texcoord0) - v.texcoord0) / glm::max(glm::abs(v.texcoord0), glm::vec2(1.f));
+			glm::vec2 texcoord1_error = glm::abs(DecodeHalf2(q.texcoord1) - v.texcoord1) / glm::max(glm::abs(v.texcoord1), glm::vec2(1.f));
+			texcoord_error            = glm::max(texcoord_error, glm::max(glm::max(texcoord0_error.x, texcoord0_error.y), glm::max(texcoord1_error.x, texcoord1_error.y)));
+
+			for (uint32_t j = 0; j < MAX_BONE_INFLUENCE; j++)
+			{
+				weight_error = glm::max(weight_error, glm::abs(DecodeUnorm8(q.weights[j]) - glm::clamp(v.weights[j], 0.f, 1.f)));
+			}
+		}
+
+		if (position_error > PositionErrorBound || normal_error > NormalErrorBound || texcoord_error > TexcoordErrorBound || weight_error > WeightErrorBound)
+		{
+			LOG_WARN("Skinned mesh {} quantization error exceeds bound: position {}, normal {}, texcoord {}, weight {}", m_name, position_error, normal_error, texcoord_error, weight_error);
+		}
+	}
+
+	UpdateBuffers(rhi_context, quantized_vertices, indices, meshlets, meshletdata);
+
 	glm::vec3 center = (max_bound + min_bound) * 0.5f;
 	float     radius = glm::length(max_bound - min_bound);
 
-	std::vector<uint8_t> thumbnail_data = RenderPreview(rhi_context, center, radius);
-	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::SkinnedMesh), thumbnail_data, vertices, indices, meshlets, meshletdata);
+	// Preview is rendered from the full precision vertices
+	auto preview_vertex_buffer = rhi_context->CreateBuffer<SkinnedVertex>(vertices.size(), RHIBufferUsage::Vertex | RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU);
+	preview_vertex_buffer->CopyToDevice(vertices.data(), vertices.size() * sizeof(SkinnedVertex));
+
+	std::vector<uint8_t> thumbnail_data = RenderPreview(rhi_context, preview_vertex_buffer.get(), center, radius);
+	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::SkinnedMesh), thumbnail_data, quantized_vertices, indices, meshlets, meshletdata, m_impl->bone_count, m_impl->position_offset, m_impl->position_scale);
+}
+
+void Resource<ResourceType::SkinnedMesh>::UpdateBuffers(RHIContext *rhi_context, const std::vector<QuantizedSkinnedVertex> &vertices, const std::vector<uint32_t> &indices, const std::vector<Meshlet> &meshlets, const std::vector<uint32_t> &meshletdata)
+{
+	m_impl->vertex_count  = vertices.size();
+	m_impl->index_count   = indices.size();
+	m_impl->meshlet_count = meshlets.size();
+
+	m_impl->vertex_buffer       = rhi_context->CreateBuffer<QuantizedSkinnedVertex>(vertices.size(), RHIBufferUsage::Vertex | RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+	m_impl->index_buffer        = rhi_context->CreateBuffer<uint32_t>(indices.size(), RHIBufferUsage::Index | RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+	m_impl->meshlet_data_buffer = rhi_context->CreateBuffer<uint32_t>(meshletdata.size(), RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+	m_impl->meshlet_buffer      = rhi_context->CreateBuffer<Meshlet>(meshlets.size(), RHIBufferUsage::UnorderedAccess | RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+
+	m_impl->vertex_buffer->CopyToDevice(vertices.data(), vertices.size() * sizeof(QuantizedSkinnedVertex));
+	m_impl->index_buffer->CopyToDevice(indices.data(), indices.size() * sizeof(uint32_t));
+	m_impl->meshlet_data_buffer->CopyToDevice(meshletdata.data(), meshletdata.size() * sizeof(uint32_t));
+	m_impl->meshlet_buffer->CopyToDevice(meshlets.data(), meshlets.size() * sizeof(Meshlet));
 }
 
-std::vector<uint8_t> Resource<ResourceType::SkinnedMesh>::RenderPreview(RHIContext *rhi_context, const glm::vec3 &center, float radius)
+std::vector<uint8_t> Resource<ResourceType::SkinnedMesh>::RenderPreview(RHIContext *rhi_context, RHIBuffer *vertex_buffer, const glm::vec3 &center, float radius)
 {
 	/*{
 	    std::vector<uint8_t> raw_shader;
@@ -244,7 +335,7 @@ std::vector<uint8_t> Resource<ResourceType::SkinnedMesh>::RenderPreview(RHIConte
 	cmd_buffer->SetScissor(128, 128);
 	cmd_buffer->BindDescriptor(descriptor);
 	cmd_buffer->BindPipelineState(pipeline_state.get());
-	cmd_buffer->BindVertexBuffer(0, m_impl->vertex_buffer.get());
+	cmd_buffer->BindVertexBuffer(0, vertex_buffer);
 	cmd_buffer->BindIndexBuffer(m_impl->index_buffer.get());
 	cmd_buffer->DrawIndexed(static_cast<uint32_t>(m_impl->index_count));
 	cmd_buffer->EndRenderPass();
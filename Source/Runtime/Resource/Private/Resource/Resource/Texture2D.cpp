@@ -1,4 +1,5 @@
 #include "Resource/Texture2D.hpp"
+#include "BinaryAsset.hpp"
 
 #include <RHI/RHIContext.hpp>
 
@@ -9,11 +10,17 @@ namespace Ilum
 struct Resource<ResourceType::Texture2D>::Impl
 {
 	std::unique_ptr<RHITexture> texture = nullptr;
+
+	// Decoded data waiting for upload, either mapped from the binary asset or deserialized from a legacy one
+	TextureDesc          desc;
+	BinaryAsset          binary;
+	std::vector<uint8_t> data;
 };
 
 Resource<ResourceType::Texture2D>::Resource(RHIContext *rhi_context, const std::string &name) :
     IResource(rhi_context, name, ResourceType::Texture2D)
 {
+	m_impl = std::make_unique<Impl>();
 }
 
 Resource<ResourceType::Texture2D>::Resource(RHIContext *rhi_context, std::vector<uint8_t> &&data, const TextureDesc &desc) :
@@ -72,7 +79,14 @@ Resource<ResourceType::Texture2D>::Resource(RHIContext *rhi_context, std::vector
 	std::memcpy(thumbnail_data.data(), staging_buffer->Map(), thumbnail_data.size());
 	staging_buffer->Unmap();
 
-	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Texture2D), thumbnail_data, desc, data);
+	SERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Texture2D), thumbnail_data);
+
+	std::vector<uint8_t> desc_data = BinaryAsset::Pack(desc);
+
+	BinaryAsset binary;
+	binary.AddChunk(BinaryChunk::Desc, desc_data);
+	binary.AddChunk(BinaryChunk::Pixel, data);
+	binary.Save(BinaryAsset::GetPath(m_name, ResourceType::Texture2D), ResourceType::Texture2D);
 }
 
 Resource<ResourceType::Texture2D>::~Resource()
@@ -82,31 +96,53 @@ Resource<ResourceType::Texture2D>::~Resource()
 
 bool Resource<ResourceType::Texture2D>::Validate() const
 {
-	return m_impl != nullptr;
+	return m_impl->texture != nullptr;
 }
 
 void Resource<ResourceType::Texture2D>::Load(RHIContext *rhi_context)
 {
-	std::vector<uint8_t> thumbnail_data, data;
-	TextureDesc          desc;
+	Decode();
 
-	DESERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Texture2D), thumbnail_data, desc, data);
+	std::vector<std::unique_ptr<RHIBuffer>> staging_buffers;
 
-	m_impl = std::make_unique<Impl>();
+	auto *cmd_buffer = rhi_context->CreateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+	Upload(rhi_context, cmd_buffer, staging_buffers);
+	cmd_buffer->End();
 
-	m_impl->texture = rhi_context->CreateTexture(desc);
+	rhi_context->Execute(cmd_buffer);
+}
+
+void Resource<ResourceType::Texture2D>::Decode()
+{
+	if (m_impl->binary.Open(BinaryAsset::GetPath(m_name, ResourceType::Texture2D), ResourceType::Texture2D) &&
+	    m_impl->binary.Unpack(BinaryChunk::Desc, m_impl->desc))
+	{
+		return;
+	}
+
+	m_impl->binary.Close();
+
+	std::vector<uint8_t> thumbnail_data;
+
+	DESERIALIZE(fmt::format("Asset/Meta/{}.{}.asset", m_name, (uint32_t) ResourceType::Texture2D), thumbnail_data, m_impl->desc, m_impl->data);
+}
+
+void Resource<ResourceType::Texture2D>::Upload(RHIContext *rhi_context, RHICommand *cmd_buffer, std::vector<std::unique_ptr<RHIBuffer>> &staging_buffers)
+{
+	m_impl->texture = rhi_context->CreateTexture(m_impl->desc);
+
+	const uint8_t *data = m_impl->binary.IsValid() ? m_impl->binary.GetChunkData(BinaryChunk::Pixel) : m_impl->data.data();
 
 	BufferDesc buffer_desc = {};
-	buffer_desc.size       = data.size();
+	buffer_desc.size       = m_impl->binary.IsValid() ? m_impl->binary.GetChunkSize(BinaryChunk::Pixel) : m_impl->data.size();
 	buffer_desc.usage      = RHIBufferUsage::Transfer;
 	buffer_desc.memory     = RHIMemoryUsage::CPU_TO_GPU;
 
 	auto staging_buffer = rhi_context->CreateBuffer(buffer_desc);
-	std::memcpy(staging_buffer->Map(), data.data(), buffer_desc.size);
+	std::memcpy(staging_buffer->Map(), data, buffer_desc.size);
 	staging_buffer->Unmap();
 
-	auto *cmd_buffer = rhi_context->CreateCommand(RHIQueueFamily::Graphics);
-	cmd_buffer->Begin();
 	cmd_buffer->ResourceStateTransition(
 	    {TextureStateTransition{
 	        m_impl->texture.get(),
@@ -123,13 +159,21 @@ void Resource<ResourceType::Texture2D>::Load(RHIContext *rhi_context)
 	        RHIResourceState::ShaderResource,
 	        TextureRange{RHITextureDimension::Texture2D, 0, m_impl->texture.get()->GetDesc().mips, 0, 1}}},
 	    {});
-	cmd_buffer->End();
 
-	rhi_context->Execute(cmd_buffer);
+	staging_buffers.emplace_back(std::move(staging_buffer));
+
+	m_impl->binary.Close();
+	m_impl->data.clear();
+	m_impl->data.shrink_to_fit();
+}
+
+bool Resource<ResourceType::Texture2D>::HasPlaceholder() const
+{
+	return m_thumbnail != nullptr;
 }
 
 RHITexture *Resource<ResourceType::Texture2D>::GetTexture() const
 {
-	return m_impl->texture.get();
+	return m_impl->texture ? m_impl->texture.get() : m_thumbnail.get();
 }
 }        // namespace Ilum
\ No newline at end of file
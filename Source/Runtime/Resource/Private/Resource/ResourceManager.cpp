@@ -1,4 +1,5 @@
 #include "ResourceManager.hpp"
+#include "BinaryAsset.hpp"
 #include "Importer.hpp"
 #include "Resource.hpp"
 #include "Resource/Animation.hpp"
@@ -11,8 +12,12 @@
 #include "Resource/Texture2D.hpp"
 #include "Resource/TextureCube.hpp"
 
+#include <Core/JobSystem.hpp>
 #include <RHI/RHIContext.hpp>
 
+#include <cassert>
+#include <thread>
+
 namespace Ilum
 {
 struct IResourceManager
@@ -28,6 +33,10 @@ struct IResourceManager
 
 	virtual IResource *Get(size_t uuid) = 0;
 
+	virtual IResource *Request(size_t uuid) = 0;
+
+	virtual IResource *GetOrPlaceholder(size_t uuid) = 0;
+
 	virtual size_t GetValidResourceCount() = 0;
 
 	virtual const std::string GetName(size_t uuid) = 0;
@@ -55,6 +64,9 @@ struct IResourceManager
 	RHIContext *rhi_context = nullptr;
 };
 
+// Upper bound of staging memory uploaded per tick
+inline static constexpr size_t StreamingBudget = 64ull << 20;
+
 template <ResourceType _Ty>
 struct TResourceManager : public IResourceManager
 {
@@ -63,31 +75,186 @@ struct TResourceManager : public IResourceManager
 	{
 	}
 
-	virtual ~TResourceManager() = default;
+	virtual ~TResourceManager()
+	{
+		for (auto &[uuid, task] : streaming)
+		{
+			task.wait();
+		}
+	}
 
 	virtual void Tick() override
 	{
 		deprecates.clear();
 		update = false;
+
+		Stream();
 	}
 
 	virtual Resource<_Ty> *Get(size_t uuid) override
 	{
-		if (valid_lookup.find(uuid) != valid_lookup.end())
+		if (resource_lookup.find(uuid) == resource_lookup.end())
+		{
+			return nullptr;
+		}
+
+		auto *resource = resources[resource_lookup[uuid]].get();
+		if (resource->GetState() == ResourceState::Resident)
 		{
-			auto *resource = valid_resources.at(valid_lookup.at(uuid));
 			return resource;
 		}
-		else if (resource_lookup.find(uuid) != resource_lookup.end())
+
+		if (streaming.find(uuid) != streaming.end())
+		{
+			// Finish the in-flight decoding and upload it right now
+			stats.stall_count++;
+			streaming.at(uuid).get();
+			streaming.erase(uuid);
+			resource->SetState(ResourceState::Loaded);
+			Upload({resource}, true);
+		}
+		else
 		{
-			auto &resource = resources[resource_lookup[uuid]];
 			resource->Load(rhi_context);
+			MakeResident(resource);
+		}
+
+		return resource;
+	}
+
+	virtual Resource<_Ty> *GetOrPlaceholder(size_t uuid) override
+	{
+		auto *resource = Request(uuid);
+		if (resource && valid_lookup.find(uuid) == valid_lookup.end())
+		{
+			// Nothing to bind in the meantime
+			return Get(uuid);
+		}
+		return resource;
+	}
+
+	virtual Resource<_Ty> *Request(size_t uuid) override
+	{
+		if (resource_lookup.find(uuid) == resource_lookup.end())
+		{
+			return nullptr;
+		}
+
+		auto *resource = resources[resource_lookup[uuid]].get();
+		if (resource->GetState() != ResourceState::Unloaded)
+		{
+			return resource;
+		}
+
+		resource->SetState(ResourceState::Pending);
+		streaming.emplace(uuid, JobSystem::GetInstance().ExecuteAsync([resource]() {
+			resource->Decode();
+		}));
+		request_time.emplace(uuid, std::chrono::high_resolution_clock::now());
+
+		if (resource->HasPlaceholder())
+		{
+			// Placeholder keeps a stable index until the resource gets resident
 			valid_lookup.emplace(uuid, valid_resources.size());
-			valid_resources.push_back(resource.get());
+			valid_resources.push_back(resource);
 			update = true;
-			return resource.get();
 		}
-		return nullptr;
+
+		return resource;
+	}
+
+	void Stream()
+	{
+		std::vector<Resource<_Ty> *> loaded;
+		for (auto iter = streaming.begin(); iter != streaming.end();)
+		{
+			if (iter->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+			{
+				iter->second.get();
+				auto *resource = resources[resource_lookup[iter->first]].get();
+				resource->SetState(ResourceState::Loaded);
+				loaded.push_back(resource);
+				iter = streaming.erase(iter);
+			}
+			else
+			{
+				iter++;
+			}
+		}
+
+		if (!loaded.empty())
+		{
+			Upload(loaded);
+		}
+	}
+
+	// Batch GPU uploads of decoded resources into a single submission, a forced upload ignores the budget
+	void Upload(const std::vector<Resource<_Ty> *> &loaded, bool force = false)
+	{
+		std::vector<std::unique_ptr<RHIBuffer>> staging_buffers;
+
+		size_t   staging_size   = 0;
+		uint32_t resident_count = 0;
+
+		auto *cmd_buffer = rhi_context->CreateCommand(RHIQueueFamily::Graphics);
+		cmd_buffer->Begin();
+		for (auto *resource : loaded)
+		{
+			if (staging_size >= StreamingBudget && !force)
+			{
+				// Defer to the next tick
+				std::promise<void> ready;
+				ready.set_value();
+				streaming.emplace(resource->GetUUID(), ready.get_future());
+				continue;
+			}
+
+			size_t staging_count = staging_buffers.size();
+			resource->Upload(rhi_context, cmd_buffer, staging_buffers);
+			for (size_t i = staging_count; i < staging_buffers.size(); i++)
+			{
+				staging_size += staging_buffers[i]->GetDesc().size;
+			}
+			resident_count++;
+		}
+		cmd_buffer->End();
+
+		rhi_context->Execute(cmd_buffer);
+
+		auto now = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < resident_count; i++)
+		{
+			auto *resource = loaded[i];
+			MakeResident(resource);
+
+			if (request_time.find(resource->GetUUID()) != request_time.end())
+			{
+				stats.latency += std::chrono::duration<float, std::milli>(now - request_time.at(resource->GetUUID())).count();
+				stats.count++;
+				request_time.erase(resource->GetUUID());
+			}
+		}
+
+		stats.bytes += staging_size;
+
+		if (streaming.empty() && stats.count > 0)
+		{
+			LOG_INFO("Streamed {} resources ({:.2f} MB), average latency {:.2f} ms, {} blocking gets", stats.count, static_cast<float>(stats.bytes) / 1024.f / 1024.f, stats.latency / static_cast<float>(stats.count), stats.stall_count);
+			stats = {};
+		}
+	}
+
+	void MakeResident(Resource<_Ty> *resource)
+	{
+		resource->SetState(ResourceState::Resident);
+
+		size_t uuid = resource->GetUUID();
+		if (valid_lookup.find(uuid) == valid_lookup.end())
+		{
+			valid_lookup.emplace(uuid, valid_resources.size());
+			valid_resources.push_back(resource);
+		}
+		update = true;
 	}
 
 	virtual size_t GetValidResourceCount() override
@@ -122,6 +289,13 @@ struct TResourceManager : public IResourceManager
 
 	virtual void Erase(size_t uuid) override
 	{
+		if (streaming.find(uuid) != streaming.end())
+		{
+			streaming.at(uuid).wait();
+			streaming.erase(uuid);
+			request_time.erase(uuid);
+		}
+
 		if (valid_lookup.find(uuid) != valid_lookup.end())
 		{
 			size_t last_uuid = ~0U;
@@ -184,6 +358,7 @@ struct TResourceManager : public IResourceManager
 
 			if (resources.back()->Validate())
 			{
+				resources.back()->SetState(ResourceState::Resident);
 				valid_lookup.emplace(uuid, valid_resources.size());
 				valid_resources.push_back(resources.back().get());
 			}
@@ -231,14 +406,31 @@ struct TResourceManager : public IResourceManager
 
 	std::vector<std::unique_ptr<Resource<_Ty>>> deprecates;
 
+	// Streaming
+	std::unordered_map<size_t, std::future<void>>                                   streaming;
+	std::unordered_map<size_t, std::chrono::high_resolution_clock::time_point> request_time;
+
+	struct
+	{
+		uint32_t count       = 0;
+		uint32_t stall_count = 0;        // Gets that had to finish a stream on the calling thread
+		size_t   bytes       = 0;
+		float    latency     = 0.f;
+	} stats;
+
 	bool update = false;
 };
 
 struct ResourceManager::Impl
 {
 	std::map<ResourceType, std::unique_ptr<IResourceManager>> managers;
+
+	// Lookups and streaming bookkeeping are unsynchronized, only the thread that created the manager may touch them
+	std::thread::id thread_id = std::this_thread::get_id();
 };
 
+#define CHECK_RESOURCE_THREAD() assert(std::this_thread::get_id() == m_impl->thread_id && "ResourceManager is only accessible from the render thread")
+
 ResourceManager::ResourceManager(RHIContext *rhi_context)
 {
 	m_impl = new Impl;
@@ -296,6 +488,7 @@ ResourceManager::~ResourceManager()
 
 void ResourceManager::Tick()
 {
+	CHECK_RESOURCE_THREAD();
 	for (auto &[type, manager] : m_impl->managers)
 	{
 		manager->Tick();
@@ -304,67 +497,96 @@ void ResourceManager::Tick()
 
 IResource *ResourceManager::Get(ResourceType type, size_t uuid)
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->Get(uuid);
 }
 
+IResource *ResourceManager::Request(ResourceType type, size_t uuid)
+{
+	CHECK_RESOURCE_THREAD();
+	return m_impl->managers.at(type)->Request(uuid);
+}
+
+IResource *ResourceManager::GetOrPlaceholder(ResourceType type, size_t uuid)
+{
+	CHECK_RESOURCE_THREAD();
+	return m_impl->managers.at(type)->GetOrPlaceholder(uuid);
+}
+
 size_t ResourceManager::GetValidResourceCount(ResourceType type) const
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->GetValidResourceCount();
 }
 
 RHITexture *ResourceManager::GetThumbnail(ResourceType type, size_t uuid)
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->GetThumbnail(uuid);
 }
 
 bool ResourceManager::Valid(ResourceType type, size_t uuid)
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->Valid(uuid);
 }
 
 bool ResourceManager::Has(ResourceType type, size_t uuid)
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->Has(uuid);
 }
 
 size_t ResourceManager::Index(ResourceType type, size_t uuid)
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->Index(uuid);
 }
 
 void ResourceManager::Import(ResourceType type, const std::string &path)
 {
+	CHECK_RESOURCE_THREAD();
 	m_impl->managers.at(type)->Import(this, path);
 }
 
 void ResourceManager::Erase(ResourceType type, size_t uuid)
 {
+	CHECK_RESOURCE_THREAD();
 	std::string asset_path = fmt::format("Asset/Meta/{}.{}.asset", m_impl->managers.at(type)->GetName(uuid), (uint32_t) type);
 	if (Path::GetInstance().IsExist(asset_path))
 	{
 		Path::GetInstance().DeletePath(asset_path);
 	}
+	std::string binary_path = BinaryAsset::GetPath(m_impl->managers.at(type)->GetName(uuid), type);
+	if (Path::GetInstance().IsExist(binary_path))
+	{
+		Path::GetInstance().DeletePath(binary_path);
+	}
 	m_impl->managers.at(type)->Erase(uuid);
 }
 
 void ResourceManager::Add(ResourceType type, std::unique_ptr<IResource> &&resource)
 {
+	CHECK_RESOURCE_THREAD();
 	size_t uuid = resource->GetUUID();
 	m_impl->managers.at(type)->Add(std::move(resource), uuid);
 }
 
 const std::vector<std::string> ResourceManager::GetResources(ResourceType type, bool only_valid) const
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->GetResources(only_valid);
 }
 
 bool ResourceManager::Update(ResourceType type) const
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->Update();
 }
 
 void ResourceManager::SetDirty(ResourceType type)
 {
+	CHECK_RESOURCE_THREAD();
 	return m_impl->managers.at(type)->SetDirty();
 }
 }        // namespace Ilum
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Resource.hpp"
+
+#include <Core/MappedFile.hpp>
+
+namespace Ilum
+{
+enum class BinaryChunk : uint32_t
+{
+	Desc,
+	Vertex,
+	Index,
+	Meshlet,
+	MeshletData,
+	Pixel,
+};
+
+// Versioned container for bulk asset payloads
+// Layout: Header | Chunk table | Chunk payloads, every payload is aligned so it can be used in place once mapped
+class BinaryAsset
+{
+  public:
+	static constexpr uint32_t Magic     = 0x41424C49;        // "ILBA"
+	static constexpr uint32_t Version   = 1;
+	static constexpr size_t   Alignment = 256;
+
+	struct Header
+	{
+		uint32_t magic       = Magic;
+		uint32_t version     = Version;
+		uint32_t type        = 0;
+		uint32_t chunk_count = 0;
+	};
+
+	struct ChunkInfo
+	{
+		BinaryChunk id     = BinaryChunk::Desc;
+		uint32_t    stride = 1;
+		uint64_t    offset = 0;
+		uint64_t    size   = 0;
+	};
+
+  public:
+	BinaryAsset() = default;
+
+	~BinaryAsset() = default;
+
+	static std::string GetPath(const std::string &name, ResourceType type);
+
+	// Writing, chunk data is referenced until Save returns
+	void AddChunk(BinaryChunk id, const void *data, size_t size, uint32_t stride = 1);
+
+	template <typename T>
+	void AddChunk(BinaryChunk id, const std::vector<T> &data)
+	{
+		AddChunk(id, data.data(), data.size() * sizeof(T), sizeof(T));
+	}
+
+	bool Save(const std::string &path, ResourceType type) const;
+
+	// Small metadata is kept as a cereal blob chunk
+	template <typename T>
+	static std::vector<uint8_t> Pack(const T &value)
+	{
+		std::ostringstream os(std::ios::binary);
+		{
+			OutputArchive archive(os);
+			archive(value);
+		}
+		std::string data = os.str();
+		return std::vector<uint8_t>(data.begin(), data.end());
+	}
+
+	template <typename T>
+	bool Unpack(BinaryChunk id, T &value) const
+	{
+		if (!HasChunk(id))
+		{
+			return false;
+		}
+
+		std::istringstream is(std::string(reinterpret_cast<const char *>(GetChunkData(id)), GetChunkSize(id)), std::ios::binary);
+		InputArchive       archive(is);
+		archive(value);
+		return true;
+	}
+
+	// Write the payload of a cereal asset into a binary asset next to it, the .asset is left untouched
+	static bool Convert(const std::string &name, ResourceType type);
+
+	// Reading, the file stays mapped until Close or destruction
+	bool Open(const std::string &path, ResourceType type);
+
+	void Close();
+
+	bool IsValid() const;
+
+	bool HasChunk(BinaryChunk id) const;
+
+	const uint8_t *GetChunkData(BinaryChunk id) const;
+
+	size_t GetChunkSize(BinaryChunk id) const;
+
+	template <typename T>
+	size_t GetChunkCount(BinaryChunk id) const
+	{
+		return GetChunkSize(id) / sizeof(T);
+	}
+
+  private:
+	const ChunkInfo *FindChunk(BinaryChunk id) const;
+
+  private:
+	std::vector<ChunkInfo>      m_chunks;
+	std::vector<const uint8_t *> m_chunk_data;
+
+	MappedFile m_file;
+};
+}        // namespace Ilum
@@ -5,6 +5,8 @@
 namespace Ilum
 {
 class RHITexture;
+class RHIBuffer;
+class RHICommand;
 class RHIContext;
 
 enum class ResourceType
@@ -21,6 +23,14 @@ enum class ResourceType
 	TextureCube,
 };
 
+enum class ResourceState
+{
+	Unloaded,
+	Pending,         // Queued for decoding on a worker thread
+	Loaded,          // Decoded on CPU, waiting for GPU upload
+	Resident,        // GPU resources are ready
+};
+
 class IResource
 {
   public:
@@ -41,6 +51,27 @@ class IResource
 	{
 	}
 
+	// Streaming, decode runs on JobSystem workers and must not touch RHI
+	virtual void Decode()
+	{
+	}
+
+	// Streaming, record uploads of decoded data, staging buffers are released after the batch is executed
+	virtual void Upload(RHIContext *rhi_context, RHICommand *cmd_buffer, std::vector<std::unique_ptr<RHIBuffer>> &staging_buffers)
+	{
+		Load(rhi_context);
+	}
+
+	// Resource can be bound before it becomes resident
+	virtual bool HasPlaceholder() const
+	{
+		return false;
+	}
+
+	ResourceState GetState() const;
+
+	void SetState(ResourceState state);
+
 	size_t GetUUID() const;
 
 	RHITexture *GetThumbnail() const;
@@ -52,6 +83,8 @@ class IResource
 	std::string m_name;
 
 	std::unique_ptr<RHITexture> m_thumbnail = nullptr;
+
+	std::atomic<ResourceState> m_state = ResourceState::Unloaded;
 };
 
 template <ResourceType Type>
@@ -51,6 +51,24 @@ class Bone
 		}
 	};
 
+	// Translation, rotation and scale sampled at one point in time
+	struct TRS
+	{
+		glm::vec3 translation = glm::vec3(0.f);
+		glm::quat rotation    = glm::quat(1.f, 0.f, 0.f, 0.f);
+		glm::vec3 scale       = glm::vec3(1.f);
+
+		glm::mat4 GetMatrix() const;
+	};
+
+	// Keyframe indices of the last sample, makes monotonic playback amortized O(1)
+	struct Cursor
+	{
+		size_t position = 0;
+		size_t rotation = 0;
+		size_t scale    = 0;
+	};
+
 	struct BoneMatrix
 	{
 		float     frame;
@@ -86,41 +104,69 @@ class Bone
 
 	glm::mat4 GetBoneOffset() const;
 
-	size_t GetPositionIndex(float time) const;
+	size_t GetPositionIndex(float time, size_t *cursor = nullptr) const;
+
+	size_t GetRotationIndex(float time, size_t *cursor = nullptr) const;
 
-	size_t GetRotationIndex(float time) const;
+	size_t GetScaleIndex(float time, size_t *cursor = nullptr) const;
 
-	size_t GetScaleIndex(float time) const;
+	TRS Sample(float time, Cursor *cursor = nullptr) const;
 
-	glm::mat4 GetLocalTransform(float time) const;
+	glm::mat4 GetLocalTransform(float time, Cursor *cursor = nullptr) const;
 
 	glm::mat4 GetTransformedOffset(float time) const;
 
 	float GetMaxTimeStamp() const;
 
+	// Drop keyframes that linear interpolation reproduces within tolerance
+	// Rotation and scale errors are measured at reach, the distance to the farthest descendant joint
+	void Compress(float tolerance, float reach);
+
+	size_t GetKeyCount() const;
+
 	template <typename Archive>
 	void serialize(Archive &archive)
 	{
-		archive(m_name, m_id, m_offset, m_positions, m_rotations, m_scales, m_max_timestamp, m_local_transfrom);
+		archive(m_name, m_id, m_offset, m_positions, m_rotations, m_scales, m_position_offset, m_position_scale, m_scale_offset, m_scale_scale, m_max_timestamp, m_local_transfrom);
 	}
 
+  private:
+	// Positions and scales are unorm16x3 relative to the bone's key range
+	// Rotations are smallest three, 15 bits per component, the dropped component index lives in the top bits of value[0] and value[1]
+	struct PackedKey
+	{
+		float    time_stamp;
+		uint16_t value[3];
+
+		template <typename Archive>
+		void serialize(Archive &archive)
+		{
+			archive(time_stamp, value[0], value[1], value[2]);
+		}
+	};
+
   private:
 	float GetScaleFactor(float last, float next, float time) const;
 
-	glm::mat4 InterpolatePosition(float time) const;
+	glm::vec3 InterpolatePosition(float time, size_t *cursor) const;
 
-	glm::mat4 InterpolateRotation(float time) const;
+	glm::quat InterpolateRotation(float time, size_t *cursor) const;
 
-	glm::mat4 InterpolateScaling(float time) const;
+	glm::vec3 InterpolateScaling(float time, size_t *cursor) const;
 
   private:
 	std::string m_name;
 	uint32_t    m_id;
 	glm::mat4   m_offset;
 
-	std::vector<KeyPosition> m_positions;
-	std::vector<KeyRotation> m_rotations;
-	std::vector<KeyScale>    m_scales;
+	std::vector<PackedKey> m_positions;
+	std::vector<PackedKey> m_rotations;
+	std::vector<PackedKey> m_scales;
+
+	glm::vec3 m_position_offset = glm::vec3(0.f);
+	glm::vec3 m_position_scale  = glm::vec3(0.f);
+	glm::vec3 m_scale_offset    = glm::vec3(0.f);
+	glm::vec3 m_scale_scale     = glm::vec3(0.f);
 
 	float m_max_timestamp = 0.f;
 
@@ -175,6 +221,10 @@ class Resource<ResourceType::Animation> final : public IResource
 
 	RHIBuffer *GetBoneMatrics() const;
 
+  private:
+	// Import-time keyframe reduction, bounded by joint position error relative to the skeleton size
+	void Compress();
+
   private:
 	struct Impl;
 	Impl *m_impl = nullptr;
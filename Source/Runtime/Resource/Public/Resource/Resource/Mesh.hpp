@@ -2,6 +2,7 @@
 
 #include "../Resource.hpp"
 
+#include <Geometry/AABB.hpp>
 #include <Geometry/Meshlet.hpp>
 
 namespace Ilum
@@ -41,6 +42,10 @@ class Resource<ResourceType::Mesh> final : public IResource
 
 	virtual void Load(RHIContext *rhi_context) override;
 
+	virtual void Decode() override;
+
+	virtual void Upload(RHIContext *rhi_context, RHICommand *cmd_buffer, std::vector<std::unique_ptr<RHIBuffer>> &staging_buffers) override;
+
 	RHIBuffer *GetVertexBuffer() const;
 
 	RHIBuffer *GetIndexBuffer() const;
@@ -57,6 +62,9 @@ class Resource<ResourceType::Mesh> final : public IResource
 
 	size_t GetMeshletCount() const;
 
+	// Object space bounds
+	const AABB &GetAABB() const;
+
 	void Update(RHIContext *rhi_context, std::vector<Vertex> &&vertices, std::vector<uint32_t> &&indices, std::vector<Meshlet> &&meshlets, std::vector<uint32_t> &&meshlet_data);
 
   private:
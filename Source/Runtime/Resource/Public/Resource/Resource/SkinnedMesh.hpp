@@ -35,6 +35,26 @@ class Resource<ResourceType::SkinnedMesh> final : public IResource
 		}
 	};
 
+	// GPU layout of SkinnedVertex, 48 bytes instead of 128
+	// Position is quantized against the mesh bound, see GetPositionOffset/GetPositionScale
+	struct QuantizedSkinnedVertex
+	{
+		uint16_t position[4] = {0, 0, 0, 0};        // unorm16x3
+		uint32_t normal      = 0;                   // octahedral snorm16x2
+		uint32_t tangent     = 0;                   // octahedral snorm16x2
+		uint32_t texcoord0   = 0;                   // half2
+		uint32_t texcoord1   = 0;                   // half2
+
+		uint16_t bones[8]   = {0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff};
+		uint8_t  weights[8] = {0, 0, 0, 0, 0, 0, 0, 0};        // unorm8
+
+		template <typename Archive>
+		void serialize(Archive &archive)
+		{
+			archive(position, normal, tangent, texcoord0, texcoord1, bones, weights);
+		}
+	};
+
   public:
 	Resource(RHIContext *rhi_context, const std::string &name);
 
@@ -62,10 +82,16 @@ class Resource<ResourceType::SkinnedMesh> final : public IResource
 
 	size_t GetBoneCount() const;
 
+	const glm::vec3 &GetPositionOffset() const;
+
+	const glm::vec3 &GetPositionScale() const;
+
 	void Update(RHIContext *rhi_context, std::vector<SkinnedVertex> &&vertices, std::vector<uint32_t> &&indices, std::vector<Meshlet> &&meshlets, std::vector<uint32_t> &&meshletdata);
 
   private:
-	std::vector<uint8_t> RenderPreview(RHIContext *rhi_context, const glm::vec3 &center, float radius);
+	void UpdateBuffers(RHIContext *rhi_context, const std::vector<QuantizedSkinnedVertex> &vertices, const std::vector<uint32_t> &indices, const std::vector<Meshlet> &meshlets, const std::vector<uint32_t> &meshletdata);
+
+	std::vector<uint8_t> RenderPreview(RHIContext *rhi_context, RHIBuffer *vertex_buffer, const glm::vec3 &center, float radius);
 
   private:
 	struct Impl;
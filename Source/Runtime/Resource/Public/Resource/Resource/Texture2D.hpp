@@ -20,6 +20,13 @@ class Resource<ResourceType::Texture2D> final : public IResource
 
 	virtual void Load(RHIContext *rhi_context) override;
 
+	virtual void Decode() override;
+
+	virtual void Upload(RHIContext *rhi_context, RHICommand *cmd_buffer, std::vector<std::unique_ptr<RHIBuffer>> &staging_buffers) override;
+
+	virtual bool HasPlaceholder() const override;
+
+	// Fallback to thumbnail before the texture is resident
 	RHITexture *GetTexture() const;
 
   private:
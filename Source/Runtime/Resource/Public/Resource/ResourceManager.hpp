@@ -6,6 +6,7 @@
 
 namespace Ilum
 {
+// Not thread safe, only the render thread that created it may call it, render pass recording on JobSystem workers reads GPUScene instead
 class ResourceManager
 {
   public:
@@ -15,12 +16,27 @@ class ResourceManager
 
 	void Tick();
 
+	// Blocking, the resource is resident on return
 	template <ResourceType Type>
 	Resource<Type> *Get(const std::string &name)
 	{
 		return static_cast<Resource<Type> *>(Get(Type, Hash(name)));
 	}
 
+	// Non-blocking, the resource streams in on JobSystem workers, check GetState() before using it
+	template <ResourceType Type>
+	Resource<Type> *Request(const std::string &name)
+	{
+		return static_cast<Resource<Type> *>(Request(Type, Hash(name)));
+	}
+
+	// Requests the resource and returns it right away if it has a placeholder to bind meanwhile, blocks like Get otherwise
+	template <ResourceType Type>
+	Resource<Type> *GetOrPlaceholder(const std::string &name)
+	{
+		return static_cast<Resource<Type> *>(GetOrPlaceholder(Type, Hash(name)));
+	}
+
 	template <ResourceType Type>
 	size_t GetValidResourceCount() const
 	{
@@ -90,6 +106,10 @@ class ResourceManager
   private:
 	IResource *Get(ResourceType type, size_t uuid);
 
+	IResource *Request(ResourceType type, size_t uuid);
+
+	IResource *GetOrPlaceholder(ResourceType type, size_t uuid);
+
 	size_t GetValidResourceCount(ResourceType type) const;
 
 	RHITexture* GetThumbnail(ResourceType type, size_t uuid);
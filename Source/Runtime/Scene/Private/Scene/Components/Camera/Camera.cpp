@@ -59,7 +59,8 @@ glm::mat4 Camera::GetProjectionMatrix()
 
 glm::mat4 Camera::GetViewProjectionMatrix()
 {
-	return GetProjectionMatrix() * GetViewMatrix();
+	UpdateViewProjection();
+	return m_view_projection;
 }
 
 glm::mat4 Camera::GetInvViewMatrix()
@@ -76,56 +77,19 @@ glm::mat4 Camera::GetInvProjectionMatrix()
 
 glm::mat4 Camera::GetInvViewProjectionMatrix()
 {
-	return GetInvViewMatrix() * GetInvProjectionMatrix();
+	UpdateViewProjection();
+	return m_inv_view_projection;
 }
 
-const std::array<glm::vec4, 6> &Camera::GetFrustumPlanes()
+const Frustum &Camera::GetFrustum()
 {
-	glm::mat4 view_projection = GetViewProjectionMatrix();
-
-	// Left
-	m_frustum_planes[0].x = view_projection[0].w + view_projection[0].x;
-	m_frustum_planes[0].y = view_projection[1].w + view_projection[1].x;
-	m_frustum_planes[0].z = view_projection[2].w + view_projection[2].x;
-	m_frustum_planes[0].w = view_projection[3].w + view_projection[3].x;
-
-	// Right
-	m_frustum_planes[1].x = view_projection[0].w - view_projection[0].x;
-	m_frustum_planes[1].y = view_projection[1].w - view_projection[1].x;
-	m_frustum_planes[1].z = view_projection[2].w - view_projection[2].x;
-	m_frustum_planes[1].w = view_projection[3].w - view_projection[3].x;
-
-	// Top
-	m_frustum_planes[2].x = view_projection[0].w - view_projection[0].y;
-	m_frustum_planes[2].y = view_projection[1].w - view_projection[1].y;
-	m_frustum_planes[2].z = view_projection[2].w - view_projection[2].y;
-	m_frustum_planes[2].w = view_projection[3].w - view_projection[3].y;
-
-	// Bottom
-	m_frustum_planes[3].x = view_projection[0].w + view_projection[0].y;
-	m_frustum_planes[3].y = view_projection[1].w + view_projection[1].y;
-	m_frustum_planes[3].z = view_projection[2].w + view_projection[2].y;
-	m_frustum_planes[3].w = view_projection[3].w + view_projection[3].y;
-
-	// Near
-	m_frustum_planes[4].x = view_projection[0].w + view_projection[0].z;
-	m_frustum_planes[4].y = view_projection[1].w + view_projection[1].z;
-	m_frustum_planes[4].z = view_projection[2].w + view_projection[2].z;
-	m_frustum_planes[4].w = view_projection[3].w + view_projection[3].z;
-
-	// Far
-	m_frustum_planes[5].x = view_projection[0].w - view_projection[0].z;
-	m_frustum_planes[5].y = view_projection[1].w - view_projection[1].z;
-	m_frustum_planes[5].z = view_projection[2].w - view_projection[2].z;
-	m_frustum_planes[5].w = view_projection[3].w - view_projection[3].z;
-
-	for (auto &plane : m_frustum_planes)
-	{
-		float length = glm::length(glm::vec3(plane.x, plane.y, plane.z));
-		plane /= length;
-	}
+	UpdateViewProjection();
+	return m_frustum;
+}
 
-	return m_frustum_planes;
+const std::array<glm::vec4, 6> &Camera::GetFrustumPlanes()
+{
+	return GetFrustum().planes;
 }
 
 void Camera::UpdateView()
@@ -134,6 +98,24 @@ void Camera::UpdateView()
 	{
 		m_inv_view = p_node->GetComponent<Cmpt::Transform>()->GetWorldTransform();
 		m_view     = glm::inverse(m_inv_view);
+
+		m_dirty_view_projection = true;
+	}
+}
+
+void Camera::UpdateViewProjection()
+{
+	glm::mat4 projection = m_projection;
+
+	UpdateView();
+	UpdateProjection();
+
+	if (m_dirty_view_projection || projection != m_projection)
+	{
+		m_view_projection       = m_projection * m_view;
+		m_inv_view_projection   = m_inv_view * m_inv_projection;
+		m_frustum               = Frustum(m_view_projection);
+		m_dirty_view_projection = false;
 	}
 }
 }        // namespace Cmpt
@@ -53,6 +53,16 @@ void DirectionalLight::SetShadowID(uint32_t &shadow_id)
 	m_data.shadow_id = m_data.cast_shadow ? shadow_id++ : ~0u;
 }
 
+uint32_t DirectionalLight::GetShadowID() const
+{
+	return m_data.shadow_id;
+}
+
+const glm::mat4 &DirectionalLight::GetViewProjection(uint32_t cascade) const
+{
+	return m_data.view_projection[cascade];
+}
+
 size_t DirectionalLight::GetDataSize() const
 {
 	return sizeof(m_data);
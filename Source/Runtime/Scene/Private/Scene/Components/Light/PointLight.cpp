@@ -52,6 +52,16 @@ void PointLight::SetShadowID(uint32_t &shadow_id)
 	m_data.shadow_id = m_data.cast_shadow ? shadow_id++ : ~0u;
 }
 
+uint32_t PointLight::GetShadowID() const
+{
+	return m_data.shadow_id;
+}
+
+const glm::vec3 &PointLight::GetPosition() const
+{
+	return m_data.position;
+}
+
 size_t PointLight::GetDataSize() const
 {
 	return sizeof(m_data);
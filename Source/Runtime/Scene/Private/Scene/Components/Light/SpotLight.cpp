@@ -60,6 +60,16 @@ void SpotLight::SetShadowID(uint32_t &shadow_id)
 	m_data.shadow_id = m_data.cast_shadow ? shadow_id++ : ~0u;
 }
 
+uint32_t SpotLight::GetShadowID() const
+{
+	return m_data.shadow_id;
+}
+
+const glm::mat4 &SpotLight::GetViewProjection() const
+{
+	return m_data.view_projection;
+}
+
 size_t SpotLight::GetDataSize() const
 {
 	return sizeof(m_data);
@@ -173,22 +173,37 @@ void Transform::SetScale(const glm::vec3 &scale)
 
 void Transform::SetDirty()
 {
+	// Children are not visited here, they pick up the change through the parent version
 	m_update = true;
-	if (!m_dirty)
+	m_dirty  = true;
+	m_version++;
+}
+
+uint64_t Transform::GetVersion() const
+{
+	return m_version;
+}
+
+void Transform::Update()
+{
+	auto *parent = GetNode()->GetParent();
+
+	Transform *parent_transform = parent ? parent->GetComponent<Transform>() : nullptr;
+
+	if (parent_transform)
 	{
-		m_dirty = true;
-		for (auto *child : p_node->GetChildren())
+		parent_transform->Update();
+		if (parent_transform->m_version != m_parent_version)
 		{
-			if (child->HasComponent<Transform>())
+			m_parent_version = parent_transform->m_version;
+			if (!m_dirty)
 			{
-				child->GetComponent<Transform>()->SetDirty();
+				m_dirty = true;
+				m_version++;
 			}
 		}
 	}
-}
 
-void Transform::Update()
-{
 	if (!m_dirty)
 	{
 		return;
@@ -196,12 +211,9 @@ void Transform::Update()
 
 	glm::mat4 local_matrix = GetLocalTransform();
 
-	auto parent = GetNode()->GetParent();
-
-	if (parent)
+	if (parent_transform)
 	{
-		auto *transform   = parent->GetComponent<Transform>();
-		m_world_transform = transform->GetWorldTransform() * local_matrix;
+		m_world_transform = parent_transform->m_world_transform * local_matrix;
 	}
 	else
 	{
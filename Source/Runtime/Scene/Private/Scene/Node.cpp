@@ -1,5 +1,6 @@
 #include "Node.hpp"
 #include "Component.hpp"
+#include "Components/Transform.hpp"
 #include "Scene.hpp"
 
 namespace Ilum
@@ -17,6 +18,8 @@ struct Node::Impl
 
 	size_t id = ~0U;
 
+	NodeHandle handle;
+
 	std::string name;
 
 	Node *parent = nullptr;
@@ -35,6 +38,8 @@ Node::Node(size_t id, Scene &scene, const std::string &name)
 
 Node::~Node()
 {
+	m_impl->scene.SetHierarchyDirty();
+
 	for (auto &child : m_impl->children)
 	{
 		child->SetParent(nullptr);
@@ -47,15 +52,7 @@ Node::~Node()
 
 	for (auto &[type, cmpt] : m_impl->components)
 	{
-		auto &scene_components = m_impl->scene.GetComponents()[type];
-		for (auto iter = scene_components.begin(); iter != scene_components.end(); iter++)
-		{
-			if (iter->get() == cmpt)
-			{
-				scene_components.erase(iter);
-				break;
-			}
-		}
+		m_impl->scene.EraseComponent_(cmpt);
 	}
 
 	delete m_impl;
@@ -66,6 +63,11 @@ size_t Node::GetID() const
 	return m_impl->id;
 }
 
+NodeHandle Node::GetHandle() const
+{
+	return m_impl->handle;
+}
+
 void Node::SetName(const std::string &name)
 {
 	m_impl->name = name;
@@ -99,6 +101,13 @@ void Node::SetParent(Node *node)
 	{
 		m_impl->parent->AddChild(this);
 	}
+
+	m_impl->scene.SetHierarchyDirty();
+
+	if (auto *transform = GetComponent<Cmpt::Transform>())
+	{
+		transform->SetDirty();
+	}
 }
 
 const std::vector<Node *> &Node::GetChildren() const
@@ -121,12 +130,24 @@ void Node::Load(InputArchive &archive)
 	archive(m_impl->id, m_impl->name);
 }
 
+void Node::SetHandle(NodeHandle handle)
+{
+	m_impl->handle = handle;
+}
+
+void Node::DetachHierarchy()
+{
+	m_impl->parent = nullptr;
+	m_impl->children.clear();
+}
+
 void Node::EraseChild(Node *node)
 {
-	auto iter = std::find(m_impl->children.begin(), m_impl->children.end(), node);
-	if (iter != m_impl->children.end())
+	// Children are usually removed in reverse creation order, search from the back
+	auto iter = std::find(m_impl->children.rbegin(), m_impl->children.rend(), node);
+	if (iter != m_impl->children.rend())
 	{
-		m_impl->children.erase(iter);
+		m_impl->children.erase(std::next(iter).base());
 	}
 }
 
@@ -147,14 +168,16 @@ Component *Node::GetComponent_(std::type_index index)
 
 Component *Node::AddComponent_(std::unique_ptr<Component> &&component)
 {
-	auto &ptr = m_impl->scene.GetComponents()[component->GetType()].emplace_back(std::move(component));
-	m_impl->components.emplace(ptr->GetType(), ptr.get());
-	return ptr.get();
+	auto *ptr = m_impl->scene.AddComponent_(std::move(component));
+	m_impl->components.emplace(ptr->GetType(), ptr);
+	m_impl->scene.SetHierarchyDirty();
+	return ptr;
 }
 
 void Node::AddComponent_(Component *component)
 {
 	m_impl->components.emplace(component->GetType(), component);
+	m_impl->scene.SetHierarchyDirty();
 }
 
 void Node::EraseComponent(std::type_index index)
@@ -166,17 +189,10 @@ void Node::EraseComponent(std::type_index index)
 		return;
 	}
 
-	auto &cmpt_list = m_impl->scene.GetComponents()[index];
-
-	for (auto iter = cmpt_list.begin(); iter != cmpt_list.end(); iter++)
-	{
-		if (iter->get() == cmpt_iter->second)
-		{
-			cmpt_list.erase(iter);
-			break;
-		}
-	}
+	Component *component = cmpt_iter->second;
 
 	m_impl->components.erase(cmpt_iter);
+	m_impl->scene.EraseComponent_(component);
+	m_impl->scene.SetHierarchyDirty();
 }
 }        // namespace Ilum
\ No newline at end of file
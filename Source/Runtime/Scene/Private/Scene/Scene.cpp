@@ -2,6 +2,7 @@
 #include "Component.hpp"
 #include "Components/AllComponents.hpp"
 #include "Node.hpp"
+#include "TransformHierarchy.hpp"
 
 namespace Ilum
 {
@@ -17,11 +18,57 @@ struct Scene::Impl
 
 	std::string name;
 
+	// Node storage in creation order, erased nodes leave a tombstone until the next compaction
 	std::vector<std::unique_ptr<Node>> nodes;
 
+	size_t tombstones = 0;
+
+	// Handle index -> dense index, the generation invalidates handles of erased nodes
+	struct Slot
+	{
+		uint32_t dense      = ~0U;
+		uint32_t generation = 0;
+	};
+
+	std::vector<Slot>     slots;
+	std::vector<uint32_t> free_slots;
+
+	size_t next_id = 0;
+
+	// Dense per-type arrays of component pointers, walked by ComponentView
+	// Components themselves stay individually allocated, the renderer and the transform hierarchy keep raw pointers to them
 	std::unordered_map<std::type_index, std::vector<std::unique_ptr<Component>>> components;
 
+	TransformHierarchy hierarchy;
+
 	bool update = false;
+
+	// Drop tombstones while keeping the order of the remaining nodes
+	void Compact()
+	{
+		if (tombstones == 0)
+		{
+			return;
+		}
+
+		size_t count = 0;
+		for (size_t i = 0; i < nodes.size(); i++)
+		{
+			if (!nodes[i])
+			{
+				continue;
+			}
+			if (count != i)
+			{
+				nodes[count] = std::move(nodes[i]);
+			}
+			slots[nodes[count]->GetHandle().index].dense = static_cast<uint32_t>(count);
+			count++;
+		}
+		nodes.resize(count);
+
+		tombstones = 0;
+	}
 };
 
 Scene::Scene(const std::string &name)
@@ -55,6 +102,7 @@ const std::string &Scene::GetName() const
 
 const std::vector<std::unique_ptr<Node>> &Scene::GetNodes() const
 {
+	m_impl->Compact();
 	return m_impl->nodes;
 }
 
@@ -64,7 +112,7 @@ const std::vector<Node *> Scene::GetRoots() const
 	roots.reserve(m_impl->nodes.size());
 	for (auto &node : m_impl->nodes)
 	{
-		if (node->GetParent() == nullptr)
+		if (node && node->GetParent() == nullptr)
 		{
 			roots.emplace_back(node.get());
 		}
@@ -74,45 +122,124 @@ const std::vector<Node *> Scene::GetRoots() const
 
 Node *Scene::CreateNode(const std::string &name)
 {
-	return m_impl->nodes.emplace_back(std::make_unique<Node>(m_impl->nodes.empty() ? 0 : m_impl->nodes.back()->GetID() + 1, *this, name)).get();
+	return InsertNode(std::make_unique<Node>(m_impl->next_id++, *this, name));
+}
+
+Node *Scene::GetNode(const NodeHandle &handle) const
+{
+	if (handle.index >= m_impl->slots.size())
+	{
+		return nullptr;
+	}
+
+	const auto &slot = m_impl->slots[handle.index];
+	return slot.generation == handle.generation && slot.dense != ~0U ? m_impl->nodes[slot.dense].get() : nullptr;
 }
 
 void Scene::EraseNode(Node *node)
 {
-	std::function<void(Node *, std::vector<Node *> &)> gather_nodes = [&](Node *node, std::vector<Node *> &nodes) {
-		nodes.push_back(node);
-		for (auto &child : node->GetChildren())
-		{
-			gather_nodes(child, nodes);
-		}
-	};
+	if (!node)
+	{
+		return;
+	}
+
+	node->SetParent(nullptr);
 
-	std::vector<Node *> remove_nodes;
-	gather_nodes(node, remove_nodes);
-	std::reverse(remove_nodes.begin(), remove_nodes.end());
+	std::vector<Node *> remove_nodes = {node};
+	for (size_t i = 0; i < remove_nodes.size(); i++)
+	{
+		auto &children = remove_nodes[i]->GetChildren();
+		remove_nodes.insert(remove_nodes.end(), children.begin(), children.end());
+	}
 
+	// The whole subtree goes away, so links between its nodes need no bookkeeping
 	for (auto *remove_node : remove_nodes)
 	{
-		for (auto iter = m_impl->nodes.begin(); iter != m_impl->nodes.end(); iter++)
-		{
-			if (iter->get() == remove_node)
-			{
-				m_impl->nodes.erase(iter);
-				break;
-			}
-		}
+		remove_node->DetachHierarchy();
+	}
+
+	for (auto *remove_node : remove_nodes)
+	{
+		NodeHandle handle = remove_node->GetHandle();
+
+		m_impl->nodes[m_impl->slots[handle.index].dense].reset();
+		m_impl->tombstones++;
+
+		m_impl->slots[handle.index].dense = ~0U;
+		m_impl->slots[handle.index].generation++;
+		m_impl->free_slots.push_back(handle.index);
+	}
+
+	// Compacting once half the storage is tombstones keeps removal amortized constant time
+	if (m_impl->tombstones * 2 > m_impl->nodes.size())
+	{
+		m_impl->Compact();
 	}
 }
 
+void Scene::EraseNode(const NodeHandle &handle)
+{
+	EraseNode(GetNode(handle));
+}
+
+Node *Scene::InsertNode(std::unique_ptr<Node> &&node)
+{
+	uint32_t index = 0;
+	if (!m_impl->free_slots.empty())
+	{
+		index = m_impl->free_slots.back();
+		m_impl->free_slots.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(m_impl->slots.size());
+		m_impl->slots.emplace_back();
+	}
+
+	m_impl->slots[index].dense = static_cast<uint32_t>(m_impl->nodes.size());
+	node->SetHandle(NodeHandle{index, m_impl->slots[index].generation});
+
+	m_impl->hierarchy.SetDirty();
+
+	return m_impl->nodes.emplace_back(std::move(node)).get();
+}
+
+Component *Scene::AddComponent_(std::unique_ptr<Component> &&component)
+{
+	auto &components   = m_impl->components[component->GetType()];
+	component->m_index = components.size();
+	return components.emplace_back(std::move(component)).get();
+}
+
+void Scene::EraseComponent_(Component *component)
+{
+	auto  &components = m_impl->components[component->GetType()];
+	size_t index      = component->m_index;
+
+	if (index + 1 != components.size())
+	{
+		std::swap(components[index], components.back());
+		components[index]->m_index = index;
+	}
+	components.pop_back();
+}
+
 std::unordered_map<std::type_index, std::vector<std::unique_ptr<Component>>> &Scene::GetComponents()
 {
 	return m_impl->components;
 }
 
+void Scene::SetHierarchyDirty()
+{
+	m_impl->hierarchy.SetDirty();
+}
+
 void Scene::Save(OutputArchive &archive)
 {
 	archive(m_impl->name);
 
+	m_impl->Compact();
+
 	// Nodes
 	{
 		archive(m_impl->nodes.size());
@@ -149,15 +276,15 @@ void Scene::Load(InputArchive &archive)
 	std::unordered_map<size_t, Node *> node_map;
 	// Nodes
 	{
-		m_impl->nodes.clear();
+		Clear();
 		size_t node_count = 0;
 		archive(node_count);
 		for (size_t i = 0; i < node_count; i++)
 		{
 			std::unique_ptr<Node> node = std::make_unique<Node>(0, *this);
 			node->Load(archive);
-			m_impl->nodes.emplace_back(std::move(node));
-			node_map[m_impl->nodes.back()->GetID()] = m_impl->nodes.back().get();
+			m_impl->next_id         = std::max(m_impl->next_id, node->GetID() + 1);
+			node_map[node->GetID()] = InsertNode(std::move(node));
 		}
 		for (auto &node : m_impl->nodes)
 		{
@@ -231,6 +358,9 @@ void Scene::Update(bool update)
 	}
 	else
 	{
+		// Resolve world matrices first, so moved children are flagged as updated as well
+		m_impl->hierarchy.Update(*this);
+
 		for (auto &[type, cmpts] : m_impl->components)
 		{
 			for (auto &cmpt : cmpts)
@@ -0,0 +1,154 @@
+#include "TransformHierarchy.hpp"
+#include "Components/Transform.hpp"
+#include "Node.hpp"
+#include "Scene.hpp"
+
+#include <Core/JobSystem.hpp>
+
+namespace Ilum
+{
+// Levels narrower than this are not worth the dispatch overhead
+static constexpr size_t ParallelThreshold = 1024;
+
+void TransformHierarchy::SetDirty()
+{
+	m_dirty = true;
+}
+
+void TransformHierarchy::Update(Scene &scene)
+{
+	if (m_dirty)
+	{
+		Build(scene);
+	}
+
+	auto &job_system = JobSystem::GetInstance();
+
+	for (size_t level = 0; level + 1 < m_levels.size(); level++)
+	{
+		size_t begin = m_levels[level];
+		size_t count = m_levels[level + 1] - begin;
+
+		if (count < ParallelThreshold)
+		{
+			for (size_t i = begin; i < begin + count; i++)
+			{
+				UpdateNode(i);
+			}
+			continue;
+		}
+
+		uint32_t group_size = static_cast<uint32_t>(std::max<size_t>(ParallelThreshold / 4, count / (std::max<size_t>(job_system.GetThreadCount(), 1) * 4)));
+
+		JobHandle handle;
+		job_system.Dispatch(handle, static_cast<uint32_t>(count), group_size, [&](uint32_t group_id) {
+			size_t group_begin = begin + static_cast<size_t>(group_id) * group_size;
+			size_t group_end   = std::min(group_begin + group_size, begin + count);
+			for (size_t i = group_begin; i < group_end; i++)
+			{
+				UpdateNode(i);
+			}
+		});
+		job_system.Wait(handle);
+	}
+
+	m_rebuild = false;
+}
+
+size_t TransformHierarchy::GetSize() const
+{
+	return m_transforms.size();
+}
+
+size_t TransformHierarchy::GetDepth() const
+{
+	return m_levels.empty() ? 0 : m_levels.size() - 1;
+}
+
+void TransformHierarchy::Build(Scene &scene)
+{
+	m_transforms.clear();
+	m_parents.clear();
+	m_levels.clear();
+
+	// Breadth-first walk, nodes without transform pass their parent index on to their children
+	std::vector<std::pair<Node *, int32_t>> current;
+	std::vector<std::pair<Node *, int32_t>> next;
+
+	for (auto *root : scene.GetRoots())
+	{
+		current.emplace_back(root, -1);
+	}
+
+	while (!current.empty())
+	{
+		m_levels.push_back(m_transforms.size());
+
+		next.clear();
+		for (auto &[node, parent] : current)
+		{
+			int32_t index = parent;
+			if (auto *transform = node->GetComponent<Cmpt::Transform>())
+			{
+				index = static_cast<int32_t>(m_transforms.size());
+				m_transforms.push_back(transform);
+				m_parents.push_back(parent);
+			}
+			for (auto *child : node->GetChildren())
+			{
+				next.emplace_back(child, index);
+			}
+		}
+		std::swap(current, next);
+	}
+
+	m_levels.push_back(m_transforms.size());
+
+	m_versions.assign(m_transforms.size(), 0);
+	m_local.resize(m_transforms.size());
+	m_world.resize(m_transforms.size());
+	m_changed.assign(m_transforms.size(), 0);
+
+	m_dirty   = false;
+	m_rebuild = true;
+}
+
+void TransformHierarchy::UpdateNode(size_t index)
+{
+	auto   *transform = m_transforms[index];
+	int32_t parent    = m_parents[index];
+
+	bool local_dirty    = m_rebuild || transform->m_version != m_versions[index];
+	bool parent_changed = parent >= 0 && m_changed[parent];
+
+	m_changed[index] = local_dirty || parent_changed;
+
+	if (!m_changed[index])
+	{
+		return;
+	}
+
+	if (local_dirty)
+	{
+		m_local[index] = transform->GetLocalTransform();
+	}
+
+	m_world[index] = parent >= 0 ? m_world[parent] * m_local[index] : m_local[index];
+
+	// Transforms already resolved through GetWorldTransform keep their version
+	if (transform->m_dirty || transform->m_world_transform != m_world[index])
+	{
+		if (!transform->m_dirty)
+		{
+			transform->m_version++;
+		}
+		transform->m_world_transform = m_world[index];
+		transform->m_dirty           = false;
+		transform->m_update          = true;
+	}
+
+	transform->m_parent_version = parent >= 0 ? m_transforms[parent]->m_version : 0;
+
+	m_versions[index] = transform->m_version;
+}
+}        // namespace Ilum
@@ -40,5 +40,11 @@ class EXPORT_API Component
 	bool m_update = false;
 
 	Node *p_node = nullptr;
+
+  private:
+	friend class Scene;
+
+	// Slot in the scene's per-type component array, kept in sync on swap-and-pop removal
+	size_t m_index = ~0ull;
 };
 }        // namespace Ilum
\ No newline at end of file
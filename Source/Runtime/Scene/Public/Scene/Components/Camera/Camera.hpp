@@ -2,6 +2,8 @@
 
 #include <Scene/Component.hpp>
 
+#include <Geometry/Frustum.hpp>
+
 #include <glm/glm.hpp>
 
 namespace Ilum
@@ -47,6 +49,9 @@ class Camera : public Component
 
 	glm::mat4 GetInvViewProjectionMatrix();
 
+	// Cached, only rebuilt when the view or the projection changes
+	const Frustum &GetFrustum();
+
 	const std::array<glm::vec4, 6> &GetFrustumPlanes();
 
   protected:
@@ -54,12 +59,16 @@ class Camera : public Component
 
 	void UpdateView();
 
+	void UpdateViewProjection();
+
   protected:
 	float m_aspect = 1.f;
 	float m_near   = 0.1f;
 	float m_far    = 500.f;
 
-	std::array<glm::vec4, 6> m_frustum_planes;
+	Frustum m_frustum;
+
+	bool m_dirty_view_projection = true;
 
 	glm::mat4 m_view                = glm::mat4(1.f);
 	glm::mat4 m_inv_view            = glm::mat4(1.f);
@@ -27,6 +27,11 @@ class DirectionalLight : public Light
 
 	void SetShadowID(uint32_t &shadow_id);
 
+	uint32_t GetShadowID() const;
+
+	// Cascade view projections, valid after GetData
+	const glm::mat4 &GetViewProjection(uint32_t cascade) const;
+
 	virtual size_t GetDataSize() const override;
 
 	virtual void *GetData(Camera *camera = nullptr) override;
@@ -27,6 +27,8 @@ class Light : public Component
 
 	virtual void SetShadowID(uint32_t &shadow_id);
 
+	virtual uint32_t GetShadowID() const;
+
 	// GPU data size
 	virtual size_t GetDataSize() const = 0;
 
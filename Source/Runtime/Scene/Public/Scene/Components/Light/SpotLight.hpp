@@ -27,6 +27,11 @@ class SpotLight : public Light
 
 	void SetShadowID(uint32_t &shadow_id);
 
+	uint32_t GetShadowID() const;
+
+	// Valid after GetData
+	const glm::mat4 &GetViewProjection() const;
+
 	virtual size_t GetDataSize() const override;
 
 	virtual void *GetData(Camera *camera = nullptr) override;
@@ -7,11 +7,14 @@
 namespace Ilum
 {
 class Node;
+class TransformHierarchy;
 
 namespace Cmpt
 {
 class Transform : public Component
 {
+	friend class Ilum::TransformHierarchy;
+
   public:
 	Transform(Node *node);
 
@@ -43,6 +46,10 @@ class Transform : public Component
 
 	void SetDirty();
 
+	// Bumped whenever the world matrix changes, lets consumers detect moved nodes without polling matrices
+	// Moves inherited from a parent are only counted once Scene::Update propagated them
+	uint64_t GetVersion() const;
+
   private:
 	void Update();
 
@@ -54,6 +61,9 @@ class Transform : public Component
 	glm::mat4 m_world_transform = glm::mat4(1.f);
 
 	bool m_dirty = false;
+
+	uint64_t m_version        = 0;
+	uint64_t m_parent_version = 0;
 };
 }        // namespace Cmpt
 }        // namespace Ilum
\ No newline at end of file
@@ -12,8 +12,27 @@ namespace Ilum
 class Component;
 class Scene;
 
+// Generational handle, lookups through a handle of an erased node return nullptr
+struct NodeHandle
+{
+	uint32_t index      = ~0U;
+	uint32_t generation = 0;
+
+	bool operator==(const NodeHandle &rhs) const
+	{
+		return index == rhs.index && generation == rhs.generation;
+	}
+
+	bool operator!=(const NodeHandle &rhs) const
+	{
+		return !(*this == rhs);
+	}
+};
+
 class Node
 {
+	friend class Scene;
+
   public:
 	Node(size_t id, Scene &scene, const std::string &name = "untitled node");
 
@@ -21,6 +40,8 @@ class Node
 
 	size_t GetID() const;
 
+	NodeHandle GetHandle() const;
+
 	void SetName(const std::string &name);
 
 	const std::string &GetName() const;
@@ -66,6 +87,11 @@ class Node
 	void Load(InputArchive &archive);
 
   private:
+	void SetHandle(NodeHandle handle);
+
+	// Drop parent and children links without touching the other side, used when a whole subtree is erased
+	void DetachHierarchy();
+
 	void EraseChild(Node *node);
 
 	void AddChild(Node *node);
@@ -14,6 +14,110 @@ namespace Ilum
 class Node;
 class Component;
 class RHIContext;
+struct NodeHandle;
+
+// Non-owning view over all components of one type, walking it never allocates
+// It is invalidated once components of that type are added or removed
+template <typename _Ty>
+class ComponentView
+{
+	using Container = std::vector<std::unique_ptr<Component>>;
+
+  public:
+	class Iterator
+	{
+	  public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type        = _Ty *;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = _Ty **;
+		using reference         = _Ty *;
+
+		Iterator() = default;
+
+		explicit Iterator(typename Container::const_iterator iter) :
+		    m_iter(iter)
+		{
+		}
+
+		_Ty *operator*() const
+		{
+			return static_cast<_Ty *>(m_iter->get());
+		}
+
+		Iterator &operator++()
+		{
+			++m_iter;
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator iter = *this;
+			++m_iter;
+			return iter;
+		}
+
+		bool operator==(const Iterator &rhs) const
+		{
+			return m_iter == rhs.m_iter;
+		}
+
+		bool operator!=(const Iterator &rhs) const
+		{
+			return m_iter != rhs.m_iter;
+		}
+
+	  private:
+		typename Container::const_iterator m_iter;
+	};
+
+	ComponentView() = default;
+
+	ComponentView(typename Container::const_iterator begin, typename Container::const_iterator end) :
+	    m_begin(begin), m_end(end)
+	{
+	}
+
+	Iterator begin() const
+	{
+		return Iterator(m_begin);
+	}
+
+	Iterator end() const
+	{
+		return Iterator(m_end);
+	}
+
+	size_t size() const
+	{
+		return static_cast<size_t>(m_end - m_begin);
+	}
+
+	bool empty() const
+	{
+		return m_begin == m_end;
+	}
+
+	_Ty *operator[](size_t index) const
+	{
+		return static_cast<_Ty *>(m_begin[index].get());
+	}
+
+	_Ty *front() const
+	{
+		return (*this)[0];
+	}
+
+	_Ty *back() const
+	{
+		return (*this)[size() - 1];
+	}
+
+  private:
+	typename Container::const_iterator m_begin = {};
+	typename Container::const_iterator m_end   = {};
+};
 
 class Scene
 {
@@ -28,26 +132,23 @@ class Scene
 
 	const std::string &GetName() const;
 
+	// Creation order, erasing nodes never reorders the others
 	const std::vector<std::unique_ptr<Node>> &GetNodes() const;
 
 	const std::vector<Node *> GetRoots() const;
 
 	template <typename _Ty>
-	std::vector<_Ty *> GetComponents()
+	ComponentView<_Ty> GetComponents()
 	{
-		std::vector<_Ty *> result;
+		auto &scene_components = GetComponents();
 
-		if (HasComponent<_Ty>())
+		auto iter = scene_components.find(typeid(_Ty));
+		if (iter == scene_components.end())
 		{
-			auto &scene_components = GetComponents().at(typeid(_Ty));
-
-			std::transform(scene_components.begin(), scene_components.end(), std::back_inserter(result),
-			               [](const std::unique_ptr<Component> &component) -> _Ty * {
-				               return static_cast<_Ty *>(component.get());
-			               });
+			return {};
 		}
 
-		return result;
+		return ComponentView<_Ty>(iter->second.begin(), iter->second.end());
 	}
 
 	template <typename _Ty>
@@ -58,8 +159,14 @@ class Scene
 
 	Node *CreateNode(const std::string &name = "untitled node");
 
+	// Return nullptr if the node has been erased
+	Node *GetNode(const NodeHandle &handle) const;
+
+	// Erasing is linear in the size of the subtree
 	void EraseNode(Node *node);
 
+	void EraseNode(const NodeHandle &handle);
+
 	void Save(OutputArchive &archive);
 
 	void Load(InputArchive &archive);
@@ -75,6 +182,14 @@ class Scene
   private:
 	std::unordered_map<std::type_index, std::vector<std::unique_ptr<Component>>> &GetComponents();
 
+	void SetHierarchyDirty();
+
+	Node *InsertNode(std::unique_ptr<Node> &&node);
+
+	Component *AddComponent_(std::unique_ptr<Component> &&component);
+
+	void EraseComponent_(Component *component);
+
   private:
 	struct Impl;
 	Impl *m_impl = nullptr;
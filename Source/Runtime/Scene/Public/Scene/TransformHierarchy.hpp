@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Core/Core.hpp>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace Ilum
+{
+class Scene;
+
+namespace Cmpt
+{
+class Transform;
+}
+
+// Flat, depth sorted structure-of-arrays mirror of the scene transforms
+// Nodes of the same depth are stored contiguously, so world matrices can be
+// propagated level by level with every level split across JobSystem workers
+class TransformHierarchy
+{
+  public:
+	TransformHierarchy() = default;
+
+	~TransformHierarchy() = default;
+
+	// Node creation, removal or reparenting invalidates the flattened layout
+	void SetDirty();
+
+	// Propagate local to world matrices and write the results back to the components
+	void Update(Scene &scene);
+
+	size_t GetSize() const;
+
+	size_t GetDepth() const;
+
+  private:
+	void Build(Scene &scene);
+
+	void UpdateNode(size_t index);
+
+  private:
+	std::vector<Cmpt::Transform *> m_transforms;
+	std::vector<int32_t>           m_parents;        // -1 for roots
+	std::vector<uint64_t>          m_versions;
+	std::vector<glm::mat4>         m_local;
+	std::vector<glm::mat4>         m_world;
+	std::vector<uint8_t>           m_changed;
+
+	// Offset of every depth level, the last one is the total count
+	std::vector<size_t> m_levels;
+
+	bool m_dirty   = true;
+	bool m_rebuild = true;
+};
+}        // namespace Ilum
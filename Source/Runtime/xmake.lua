@@ -30,7 +30,7 @@ add_runtime_moulde(
     "Scene", 
     "Runtime",
     false, 
-    {"Core", "ImGui-Tools"},
+    {"Core", "Geometry", "ImGui-Tools"},
     {"imgui"}
 )
 
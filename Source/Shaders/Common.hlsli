@@ -61,6 +61,53 @@ struct SkinnedVertex
     float weights[8];
 };
 
+// GPU layout of skinned vertices, see Resource<ResourceType::SkinnedMesh>::QuantizedSkinnedVertex
+struct QuantizedSkinnedVertex
+{
+    uint2 position; // unorm16x3 against the mesh bound
+    uint normal; // octahedral snorm16x2
+    uint tangent; // octahedral snorm16x2
+    uint texcoord0; // half2
+    uint texcoord1; // half2
+    uint4 bones; // uint16x8, 0xffff for none
+    uint2 weights; // unorm8x8
+};
+
+float3 DecodeOctahedral(uint packed)
+{
+    float2 oct = max(float2(asint(packed << 16) >> 16, asint(packed) >> 16) / 32767.f, -1.f);
+    float3 n = float3(oct, 1.f - abs(oct.x) - abs(oct.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.f ? -t : t;
+    n.y += n.y >= 0.f ? -t : t;
+    return normalize(n);
+}
+
+float2 DecodeHalf2(uint packed)
+{
+    return float2(f16tof32(packed & 0xffff), f16tof32(packed >> 16));
+}
+
+SkinnedVertex DecodeSkinnedVertex(QuantizedSkinnedVertex vertex, float3 position_offset, float3 position_scale)
+{
+    SkinnedVertex result;
+    
+    result.position = position_offset + float3(vertex.position.x & 0xffff, vertex.position.x >> 16, vertex.position.y & 0xffff) / 65535.f * position_scale;
+    result.normal = DecodeOctahedral(vertex.normal);
+    result.tangent = DecodeOctahedral(vertex.tangent);
+    result.texcoord0 = DecodeHalf2(vertex.texcoord0);
+    result.texcoord1 = DecodeHalf2(vertex.texcoord1);
+    
+    for (uint i = 0; i < MAX_BONE_INFLUENCE; i++)
+    {
+        uint bone = (vertex.bones[i >> 1] >> ((i & 1) * 16)) & 0xffff;
+        result.bones[i] = bone == 0xffff ? -1 : int(bone);
+        result.weights[i] = float((vertex.weights[i >> 2] >> ((i & 3) * 8)) & 0xff) / 255.f;
+    }
+    
+    return result;
+}
+
 struct Meshlet
 {
     float3 center;
@@ -86,6 +133,19 @@ struct Instance
     uint material_id;
     uint animation_id;
     uint visible;
+    
+    // Dequantization of skinned mesh positions
+    float3 position_offset;
+    float3 position_scale;
+};
+
+// Must match GPUScene::AnimationBuffer::SkinningEntry
+struct SkinningEntry
+{
+    uint animation_id;
+    uint bone_count;
+    uint offset;
+    uint frame_count;
 };
 
 struct RayDiff
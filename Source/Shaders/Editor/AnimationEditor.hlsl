@@ -1,12 +1,10 @@
-#define MAX_BONE_INFLUENCE 8
+#include "../Common.hlsli"
 
 struct VSInput
 {
-    float3 Position : POSITIONT0;
-    int4 BoneID0 : BLENDINDICES0;
-    int4 BoneID1 : BLENDINDICES1;
-    float4 BoneWeight0 : BLENDWEIGHT0;
-    float4 BoneWeight1 : BLENDWEIGHT1;
+    uint2 Position : POSITIONT0;
+    uint4 Bones : BLENDINDICES0;
+    uint2 Weights : BLENDWEIGHT0;
 };
 
 struct UniformBlock
@@ -14,8 +12,15 @@ struct UniformBlock
     float4x4 transform;
 };
 
+struct QuantizationConstant
+{
+    float3 position_offset;
+    float3 position_scale;
+};
+
 ConstantBuffer<UniformBlock> UniformBuffer;
 StructuredBuffer<float4x4> BoneMatrices;
+[[vk::push_constant]] QuantizationConstant Quantization;
 
 struct VSOutput
 {
@@ -23,17 +28,6 @@ struct VSOutput
     float4 Color : COLOR0;
 };
 
-uint Hash(uint a)
-{
-    a = (a + 0x7ed55d16) + (a << 12);
-    a = (a ^ 0xc761c23c) ^ (a >> 19);
-    a = (a + 0x165667b1) + (a << 5);
-    a = (a + 0xd3a2646c) ^ (a << 9);
-    a = (a + 0xfd7046c5) + (a << 3);
-    a = (a ^ 0xb55a4f09) ^ (a >> 16);
-    return a;
-}
-
 float4 GenerateColor(uint a)
 {
     uint hash = Hash(a);
@@ -44,6 +38,13 @@ VSOutput VSmain(VSInput input)
 {
     VSOutput output = (VSOutput) 0;
     
+    QuantizedSkinnedVertex quantized_vertex = (QuantizedSkinnedVertex) 0;
+    quantized_vertex.position = input.Position;
+    quantized_vertex.bones = input.Bones;
+    quantized_vertex.weights = input.Weights;
+    
+    SkinnedVertex vertex = DecodeSkinnedVertex(quantized_vertex, Quantization.position_offset, Quantization.position_scale);
+    
     uint bone_count = 0;
     uint bone_stride = 0;
     BoneMatrices.GetDimensions(bone_count, bone_stride);
@@ -51,19 +52,8 @@ VSOutput VSmain(VSInput input)
     float4 total_position = 0.f;
     for (uint i = 0; i < MAX_BONE_INFLUENCE; i++)
     {
-        int bone = -1;
-        float weight = 0.f;
-        
-        if (i < 4)
-        {
-            bone = input.BoneID0[i];
-            weight = input.BoneWeight0[i];
-        }
-        else
-        {
-            bone = input.BoneID1[i - 4];
-            weight = input.BoneWeight1[i - 4];
-        }
+        int bone = vertex.bones[i];
+        float weight = vertex.weights[i];
         
         if (bone == -1)
         {
@@ -72,16 +62,16 @@ VSOutput VSmain(VSInput input)
         
         if (bone >= bone_count)
         {
-            total_position = float4(input.Position, 1.0f);
+            total_position = float4(vertex.position, 1.0f);
             break;
         }
         
-        float4 local_position = mul(BoneMatrices[bone], float4(input.Position, 1.0f));
+        float4 local_position = mul(BoneMatrices[bone], float4(vertex.position, 1.0f));
         total_position += local_position * weight;
     }
         
     output.Position = mul(UniformBuffer.transform, total_position);
-    output.Color = GenerateColor(input.BoneID0[0]);
+    output.Color = GenerateColor(vertex.bones[0]);
     return output;
 }
 
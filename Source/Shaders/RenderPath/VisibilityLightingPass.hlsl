@@ -231,9 +231,10 @@ StructuredBuffer<uint> MeshIndexBuffer[];
 #endif
 
 #ifdef HAS_SKINNED_MESH
-StructuredBuffer<SkinnedVertex> SkinnedMeshVertexBuffer[];
+StructuredBuffer<QuantizedSkinnedVertex> SkinnedMeshVertexBuffer[];
 StructuredBuffer<uint> SkinnedMeshIndexBuffer[];
-StructuredBuffer<float4x4> BoneMatrices[];
+StructuredBuffer<float4x4> BoneMatrices;
+StructuredBuffer<SkinningEntry> SkinningTable;
 #endif
 
 #ifdef HAS_ENV_LIGHT
@@ -701,9 +702,9 @@ void DispatchIndirect(CSParam param)
         
         SkinnedVertex v[3];
         
-        v[0] = SkinnedMeshVertexBuffer[mesh_id][SkinnedMeshIndexBuffer[mesh_id][primitive_id * 3]];
-        v[1] = SkinnedMeshVertexBuffer[mesh_id][SkinnedMeshIndexBuffer[mesh_id][primitive_id * 3 + 1]];
-        v[2] = SkinnedMeshVertexBuffer[mesh_id][SkinnedMeshIndexBuffer[mesh_id][primitive_id * 3 + 2]];
+        v[0] = DecodeSkinnedVertex(SkinnedMeshVertexBuffer[mesh_id][SkinnedMeshIndexBuffer[mesh_id][primitive_id * 3]], instance.position_offset, instance.position_scale);
+        v[1] = DecodeSkinnedVertex(SkinnedMeshVertexBuffer[mesh_id][SkinnedMeshIndexBuffer[mesh_id][primitive_id * 3 + 1]], instance.position_offset, instance.position_scale);
+        v[2] = DecodeSkinnedVertex(SkinnedMeshVertexBuffer[mesh_id][SkinnedMeshIndexBuffer[mesh_id][primitive_id * 3 + 2]], instance.position_offset, instance.position_scale);
         
         float3 position[3];
         float3 normal[3];
@@ -711,9 +712,8 @@ void DispatchIndirect(CSParam param)
         
         if (instance.animation_id != ~0U)
         {
-            uint bone_count = 0;
-            uint bone_stride = 0;
-            BoneMatrices[instance.animation_id].GetDimensions(bone_count, bone_stride);
+            SkinningEntry skinning = SkinningTable[instance.animation_id];
+            uint bone_count = skinning.bone_count;
             
             for (uint v_idx = 0; v_idx < 3; v_idx++)
             {
@@ -739,9 +739,9 @@ void DispatchIndirect(CSParam param)
                         break;
                     }
 
-                    position[v_idx] += mul(BoneMatrices[instance.animation_id][bone], float4(v[v_idx].position, 1.0f)).xyz * weight;
-                    normal[v_idx] += mul((float3x3) BoneMatrices[instance.animation_id][bone], v[v_idx].normal) * weight;
-                    tangent[v_idx] += mul((float3x3) BoneMatrices[instance.animation_id][bone], v[v_idx].tangent) * weight;
+                    position[v_idx] += mul(BoneMatrices[skinning.offset + bone], float4(v[v_idx].position, 1.0f)).xyz * weight;
+                    normal[v_idx] += mul((float3x3) BoneMatrices[skinning.offset + bone], v[v_idx].normal) * weight;
+                    tangent[v_idx] += mul((float3x3) BoneMatrices[skinning.offset + bone], v[v_idx].tangent) * weight;
                 }
             }
         }
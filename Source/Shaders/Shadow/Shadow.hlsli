@@ -0,0 +1,21 @@
+#ifndef SHADOW_HLSLI
+#define SHADOW_HLSLI
+
+// Must match ShadowView in Source/Runtime/Render/Renderer/Public/Renderer/ShadowCulling.hpp
+struct ShadowView
+{
+    float4 frustum[6];
+    uint draw_index;
+    uint3 padding;
+};
+
+// Must match ShadowTask, one task group covers up to 32 meshlets of an instance in a view
+struct ShadowTask
+{
+    uint view_id;
+    uint instance_id;
+    uint meshlet_offset;
+    uint meshlet_count;
+};
+
+#endif
@@ -1,30 +1,44 @@
 #include "../Common.hlsli"
 #include "../Light.hlsli"
+#include "Shadow.hlsli"
 
 StructuredBuffer<Instance> InstanceBuffer;
 StructuredBuffer<Meshlet> MeshletBuffer[];
 StructuredBuffer<uint> MeshletDataBuffer[];
 StructuredBuffer<uint> IndexBuffer[];
 StructuredBuffer<SpotLight> SpotLightBuffer;
-ConstantBuffer<LightInfo> LightInfoBuffer;
+StructuredBuffer<ShadowView> ShadowViews;
+StructuredBuffer<ShadowTask> ShadowTasks;
 
 #ifdef HAS_SKINNED
-StructuredBuffer<SkinnedVertex> VertexBuffer[];
-StructuredBuffer<float4x4> BoneMatrices[];
+StructuredBuffer<QuantizedSkinnedVertex> VertexBuffer[];
+StructuredBuffer<float4x4> BoneMatrices;
+StructuredBuffer<SkinningEntry> SkinningTable;
 
 struct VertexIn
 {
-    float3 Position : POSITION0;
-    float3 Normal : NORMAL0;
-    float3 Tangent : TANGENT0;
-    float2 Texcoord0 : TEXCOORD0;
-    float2 Texcoord1 : TEXCOORD1;
-    int4 Bones0 : BLENDINDICES0;
-    int4 Bones1 : BLENDINDICES1;
-    float4 Weights0 : BLENDWEIGHT0;
-    float4 Weights1 : BLENDWEIGHT1;
+    uint2 Position : POSITION0;
+    uint Normal : NORMAL0;
+    uint Tangent : TANGENT0;
+    uint Texcoord0 : TEXCOORD0;
+    uint Texcoord1 : TEXCOORD1;
+    uint4 Bones : BLENDINDICES0;
+    uint2 Weights : BLENDWEIGHT0;
     uint InstanceID : SV_InstanceID;
 };
+
+SkinnedVertex DecodeVertexIn(VertexIn vert_in, Instance instance)
+{
+    QuantizedSkinnedVertex vertex;
+    vertex.position = vert_in.Position;
+    vertex.normal = vert_in.Normal;
+    vertex.tangent = vert_in.Tangent;
+    vertex.texcoord0 = vert_in.Texcoord0;
+    vertex.texcoord1 = vert_in.Texcoord1;
+    vertex.bones = vert_in.Bones;
+    vertex.weights = vert_in.Weights;
+    return DecodeSkinnedVertex(vertex, instance.position_offset, instance.position_scale);
+}
 #else
 StructuredBuffer<Vertex> VertexBuffer[];
 
@@ -64,46 +78,24 @@ void ASmain(CSParam param)
 {
     bool visible = false;
     
-    uint meshlet_id = param.DispatchThreadID.x;
-    uint instance_id = param.DispatchThreadID.y;
-    uint light_id = param.DispatchThreadID.z;
+    ShadowTask task = ShadowTasks[param.GroupID.x];
+    ShadowView view = ShadowViews[task.view_id];
     
-    if (light_id >= LightInfoBuffer.spot_light_count)
-    {
-        return;
-    }
+    uint meshlet_id = task.meshlet_offset + param.GroupThreadID.x;
+    uint instance_id = task.instance_id;
+    uint light_id = view.draw_index;
     
     SpotLight light = SpotLightBuffer[light_id];
     
-    if(!light.cast_shadow)
-    {
-        return;
-    }
-    
-    uint instance_count = 0;
-    uint instance_stride = 0;
-    InstanceBuffer.GetDimensions(instance_count, instance_stride);
-    
-    if (instance_id < instance_count)
+    if (param.GroupThreadID.x < task.meshlet_count)
     {
-        Instance instance = InstanceBuffer[instance_id];
-        
-        uint meshlet_count = 0;
-        uint meshlet_stride = 0;
-        MeshletBuffer[instance.mesh_id].GetDimensions(meshlet_count, meshlet_stride);
-        
-        if (meshlet_id < meshlet_count)
-        {
 #ifdef HAS_SKINNED
-            visible = true;
+        visible = true;
 #else
-            Meshlet meshlet = MeshletBuffer[instance.mesh_id][meshlet_id];
-            float4 frustum[6];
-            CalculateFrustum(light.view_projection, frustum);
-            visible = IsInsideFrustum(meshlet, instance.transform, frustum, light.position);
-           // visible = true;
+        Instance instance = InstanceBuffer[instance_id];
+        Meshlet meshlet = MeshletBuffer[instance.mesh_id][meshlet_id];
+        visible = IsInsideFrustum(meshlet, instance.transform, view.frustum, light.position);
 #endif
-        }
     }
 
     if (visible)
@@ -141,13 +133,12 @@ void MSmain(CSParam param, in payload PayLoad pay_load, out vertices VertexOut v
         uint vertex_id = MeshletDataBuffer[instance.mesh_id][meshlet.data_offset + i];
         
 #ifdef HAS_SKINNED
-        SkinnedVertex vertex = VertexBuffer[instance.mesh_id][vertex_id];
+        SkinnedVertex vertex = DecodeSkinnedVertex(VertexBuffer[instance.mesh_id][vertex_id], instance.position_offset, instance.position_scale);
         
         if (instance.animation_id != ~0U)
         {
-            uint bone_count = 0;
-            uint bone_stride = 0;
-            BoneMatrices[instance.animation_id].GetDimensions(bone_count, bone_stride);
+            SkinningEntry skinning = SkinningTable[instance.animation_id];
+            uint bone_count = skinning.bone_count;
             
             float4 total_position = 0.f;
             for (uint i = 0; i < MAX_BONE_INFLUENCE; i++)
@@ -161,7 +152,7 @@ void MSmain(CSParam param, in payload PayLoad pay_load, out vertices VertexOut v
                     total_position = float4(vertex.position, 1.0f);
                     break;
                 }
-                float4 local_position = mul(BoneMatrices[instance.animation_id][vertex.bones[i]], float4(vertex.position, 1.0f));
+                float4 local_position = mul(BoneMatrices[skinning.offset + vertex.bones[i]], float4(vertex.position, 1.0f));
                 total_position += local_position * vertex.weights[i];
             }
             verts[i].Position = mul(light.view_projection, mul(instance.transform, float4(total_position.xyz, 1.0)));
@@ -196,28 +187,18 @@ void VSmain(in VertexIn vert_in, out VertexOut vert_out)
     Instance instance = InstanceBuffer[vert_in.InstanceID];
     
 #ifdef HAS_SKINNED
+    SkinnedVertex vertex = DecodeVertexIn(vert_in, instance);
+    
     if (instance.animation_id != ~0U)
     {
-        uint bone_count = 0;
-        uint bone_stride = 0;
-        BoneMatrices[instance.animation_id].GetDimensions(bone_count, bone_stride);
+        SkinningEntry skinning = SkinningTable[instance.animation_id];
+        uint bone_count = skinning.bone_count;
             
         float4 total_position = 0.f;
         for (uint i = 0; i < MAX_BONE_INFLUENCE; i++)
         {
-            int bone = -1;
-            float weight = 0.f;
-            
-            if (i < 4)
-            {
-                bone = vert_in.Bones0[i];
-                weight = vert_in.Weights0[i];
-            }
-            else
-            {
-                bone = vert_in.Bones1[i - 4];
-                weight = vert_in.Weights1[i - 4];
-            }
+            int bone = vertex.bones[i];
+            float weight = vertex.weights[i];
             
             if (bone == -1)
             {
@@ -225,18 +206,18 @@ void VSmain(in VertexIn vert_in, out VertexOut vert_out)
             }
             if (bone >= bone_count)
             {
-                total_position = float4(vert_in.Position, 1.0f);
+                total_position = float4(vertex.position, 1.0f);
                 break;
             }
 
-            float4 local_position = mul(BoneMatrices[instance.animation_id][bone], float4(vert_in.Position, 1.0f));
+            float4 local_position = mul(BoneMatrices[skinning.offset + bone], float4(vertex.position, 1.0f));
             total_position += local_position * weight;
         }
         //vert_out.Position = mul(ViewBuffer.view_projection, mul(instance.transform, float4(total_position.xyz, 1.0)));
     }
     else
     {
-       // vert_out.Position = mul(ViewBuffer.view_projection, mul(instance.transform, float4(vert_in.Position.xyz, 1.0)));
+       // vert_out.Position = mul(ViewBuffer.view_projection, mul(instance.transform, float4(vertex.position.xyz, 1.0)));
     }
 #else
     //vert_out.Position = mul(ViewBuffer.view_projection_matrix, mul(instance.transform, float4(vert_in.Position.xyz, 1.0)));
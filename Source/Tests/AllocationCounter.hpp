@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Ilum::Test
+{
+// Number of global operator new calls made by the test process so far
+size_t GetAllocationCount();
+}        // namespace Ilum::Test
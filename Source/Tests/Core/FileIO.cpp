@@ -0,0 +1,136 @@
+#include <Core/FileIO.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <numeric>
+
+using namespace Ilum;
+
+namespace
+{
+std::string GetTempPath(const std::string &name)
+{
+	return (std::filesystem::temp_directory_path() / ("IlumTestFileIO" + name + ".bin")).string();
+}
+
+std::vector<uint8_t> MakeData(size_t size, uint8_t seed)
+{
+	std::vector<uint8_t> data(size);
+	std::iota(data.begin(), data.end(), seed);
+	return data;
+}
+
+const FileIO::Backend Backends[] = {FileIO::Backend::Threads, FileIO::Backend::Ring};
+}        // namespace
+
+TEST(FileIO, ThreadsBackendIsAlwaysAvailable)
+{
+	FileIO file_io(FileIO::Backend::Threads);
+	EXPECT_EQ(file_io.GetBackend(), FileIO::Backend::Threads);
+}
+
+TEST(FileIO, AsyncWritesAndReadsRoundTrip)
+{
+	// Empty, small, and above the mapping threshold
+	const size_t sizes[] = {0, 1000, FileIO::MapThreshold * 3 + 7};
+
+	for (auto backend : Backends)
+	{
+		FileIO file_io(backend);
+
+		std::vector<std::string>          paths;
+		std::vector<std::vector<uint8_t>> expected;
+		std::atomic<uint32_t>             writes = 0;
+
+		for (size_t i = 0; i < std::size(sizes); i++)
+		{
+			paths.push_back(GetTempPath("RoundTrip" + std::to_string(i)));
+			expected.push_back(MakeData(sizes[i], static_cast<uint8_t>(i)));
+
+			auto data = expected.back();
+			file_io.WriteAsync(paths.back(), std::move(data), [&writes](bool success) {
+				EXPECT_TRUE(success);
+				writes.fetch_add(1);
+			});
+		}
+		file_io.Wait();
+		EXPECT_EQ(writes.load(), std::size(sizes));
+
+		std::vector<std::vector<uint8_t>> results(std::size(sizes));
+		for (size_t i = 0; i < std::size(sizes); i++)
+		{
+			file_io.ReadAsync(paths[i], [&results, i](bool success, std::vector<uint8_t> &&data) {
+				EXPECT_TRUE(success);
+				results[i] = std::move(data);
+			});
+		}
+		file_io.Wait();
+
+		for (size_t i = 0; i < std::size(sizes); i++)
+		{
+			EXPECT_EQ(results[i], expected[i]);
+
+			// The synchronous path sees the same bytes
+			std::vector<uint8_t> data;
+			EXPECT_TRUE(FileIO::Read(paths[i], data));
+			EXPECT_EQ(data, expected[i]);
+
+			std::filesystem::remove(paths[i]);
+		}
+	}
+}
+
+TEST(FileIO, MissingFilesFail)
+{
+	for (auto backend : Backends)
+	{
+		FileIO file_io(backend);
+
+		bool called = false;
+		file_io.ReadAsync(GetTempPath("Missing"), [&called](bool success, std::vector<uint8_t> &&data) {
+			EXPECT_FALSE(success);
+			EXPECT_TRUE(data.empty());
+			called = true;
+		});
+		file_io.Wait();
+
+		EXPECT_TRUE(called);
+	}
+}
+
+TEST(FileIO, MoreRequestsThanTheQueueDepth)
+{
+	for (auto backend : Backends)
+	{
+		FileIO file_io(backend);
+
+		constexpr uint32_t FileCount = 200;
+
+		std::vector<std::string> paths;
+		for (uint32_t i = 0; i < FileCount; i++)
+		{
+			paths.push_back(GetTempPath("Depth" + std::to_string(i)));
+			ASSERT_TRUE(FileIO::Write(paths.back(), MakeData(4096, static_cast<uint8_t>(i)).data(), 4096));
+		}
+
+		std::atomic<uint32_t> matches = 0;
+		for (uint32_t i = 0; i < FileCount; i++)
+		{
+			file_io.ReadAsync(paths[i], [&matches, i](bool success, std::vector<uint8_t> &&data) {
+				if (success && data == MakeData(4096, static_cast<uint8_t>(i)))
+				{
+					matches.fetch_add(1);
+				}
+			}, i % 2 ? FileIO::Priority::Low : FileIO::Priority::High);
+		}
+		file_io.Wait();
+
+		EXPECT_EQ(matches.load(), FileCount);
+
+		for (auto &path : paths)
+		{
+			std::filesystem::remove(path);
+		}
+	}
+}
@@ -0,0 +1,145 @@
+#include "AllocationCounter.hpp"
+
+#include <Core/JobSystem.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace Ilum;
+
+TEST(JobSystem, DispatchRunsEveryGroupOnce)
+{
+	JobSystem job_system(4);
+
+	std::vector<std::atomic<uint32_t>> hits(1000);
+
+	JobHandle handle;
+	job_system.Dispatch(handle, 1000, 7, [&](uint32_t group_id) {
+		for (uint32_t i = group_id * 7; i < std::min(1000u, group_id * 7 + 7); i++)
+		{
+			hits[i].fetch_add(1);
+		}
+	});
+	job_system.Wait(handle);
+
+	for (auto &hit : hits)
+	{
+		EXPECT_EQ(hit.load(), 1u);
+	}
+}
+
+TEST(JobSystem, ExecuteAsyncReturnsValuesAndExceptions)
+{
+	JobSystem job_system(2);
+
+	auto value = job_system.ExecuteAsync([](int a, int b) { return a + b; }, 2, 3);
+	EXPECT_EQ(value.get(), 5);
+
+	bool ran  = false;
+	auto done = job_system.ExecuteAsync([&]() { ran = true; });
+	done.get();
+	EXPECT_TRUE(ran);
+
+	auto error = job_system.ExecuteAsync([]() -> int { throw std::runtime_error("job failed"); });
+	EXPECT_THROW(error.get(), std::runtime_error);
+}
+
+TEST(JobSystem, WaitFromWorkerDoesNotDeadlock)
+{
+	JobSystem job_system(1);
+
+	std::atomic<uint32_t> count = 0;
+
+	JobHandle outer;
+	job_system.Dispatch(outer, 4, 1, [&](uint32_t) {
+		JobHandle inner;
+		job_system.Dispatch(inner, 16, 1, [&](uint32_t) { count.fetch_add(1); });
+		job_system.Wait(inner);
+	});
+	job_system.Wait(outer);
+
+	EXPECT_EQ(count.load(), 64u);
+}
+
+TEST(JobSystem, SteadyStateSubmissionDoesNotAllocate)
+{
+	JobSystem job_system(4);
+
+	std::atomic<uint32_t> sum = 0;
+
+	auto round = [&]() {
+		JobHandle handle;
+		job_system.Dispatch(handle, 256, 1, [&sum](uint32_t group_id) { sum.fetch_add(group_id); });
+		job_system.Wait(handle);
+
+		auto future = job_system.ExecuteAsync([&sum]() { return sum.load(); });
+		future.get();
+	};
+
+	// Warm up the job memory pool
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		round();
+	}
+
+	size_t allocations = Ilum::Test::GetAllocationCount();
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		round();
+	}
+
+	EXPECT_EQ(Ilum::Test::GetAllocationCount(), allocations);
+}
+
+TEST(JobSystem, ExecuteAsyncAcceptsLargeCallables)
+{
+	JobSystem job_system(2);
+
+	std::array<uint32_t, 64> values = {};
+	std::iota(values.begin(), values.end(), 0u);
+
+	auto sum = job_system.ExecuteAsync([values](const std::array<uint32_t, 64> &more) {
+		return std::accumulate(values.begin(), values.end(), 0u) + std::accumulate(more.begin(), more.end(), 0u);
+	}, values);
+	EXPECT_EQ(sum.get(), 2 * 2016u);
+}
+
+TEST(JobSystem, ExternalWaitOnlyRunsJobsOfItsHandle)
+{
+	JobSystem job_system(1);
+
+	// Keep the only worker busy until the dispatch below has completed
+	std::atomic<bool> started = false;
+	std::atomic<bool> release = false;
+
+	auto blocker = job_system.ExecuteAsync([&]() {
+		started = true;
+		while (!release)
+		{
+			std::this_thread::yield();
+		}
+	});
+	while (!started)
+	{
+		std::this_thread::yield();
+	}
+
+	// Queued ahead of the dispatch, the waiting thread must leave it to the worker
+	std::thread::id unrelated_thread;
+	auto            unrelated = job_system.ExecuteAsync([&]() { unrelated_thread = std::this_thread::get_id(); });
+
+	std::atomic<uint32_t> count = 0;
+
+	JobHandle handle;
+	job_system.Dispatch(handle, 8, 1, [&](uint32_t) { count.fetch_add(1); });
+	job_system.Wait(handle);
+
+	EXPECT_EQ(count.load(), 8u);
+	EXPECT_EQ(unrelated.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+	release = true;
+	blocker.get();
+	unrelated.get();
+	EXPECT_NE(unrelated_thread, std::this_thread::get_id());
+}
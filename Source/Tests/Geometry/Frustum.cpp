@@ -0,0 +1,108 @@
+#include <Geometry/Frustum.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+// Boxes interleaved with other data, as in GPUScene::InstanceBound
+struct Bound
+{
+	AABB     aabb;
+	uint32_t mesh_id;
+	uint32_t meshlet_count;
+	bool     animated;
+};
+
+Frustum CreateFrustum(std::mt19937 &rng)
+{
+	std::uniform_real_distribution<float> position(-50.f, 50.f);
+	std::uniform_real_distribution<float> fov(20.f, 120.f);
+
+	glm::vec3 eye    = glm::vec3(position(rng), position(rng), position(rng));
+	glm::vec3 target = glm::vec3(position(rng), position(rng), position(rng));
+	return Frustum(glm::perspective(glm::radians(fov(rng)), 16.f / 9.f, 0.1f, 100.f) * glm::lookAt(eye, target, glm::vec3(0.f, 1.f, 0.f)));
+}
+
+std::vector<Bound> CreateBounds(size_t count, std::mt19937 &rng)
+{
+	std::uniform_real_distribution<float> position(-100.f, 100.f);
+	std::uniform_real_distribution<float> extent(0.01f, 20.f);
+
+	std::vector<Bound> bounds(count);
+	for (auto &bound : bounds)
+	{
+		glm::vec3 min = glm::vec3(position(rng), position(rng), position(rng));
+		bound.aabb    = AABB(min, min + glm::vec3(extent(rng), extent(rng), extent(rng)));
+	}
+	return bounds;
+}
+}        // namespace
+
+TEST(Frustum, PlanesAreNormalizedAndFaceInwards)
+{
+	Frustum frustum(glm::perspective(glm::radians(60.f), 1.f, 1.f, 100.f) * glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f)));
+
+	for (auto &plane : frustum.planes)
+	{
+		EXPECT_NEAR(glm::length(glm::vec3(plane)), 1.f, 1e-5f);
+	}
+
+	// In front, behind, past the far plane and off to the side
+	EXPECT_TRUE(frustum.Intersect(AABB(glm::vec3(-1.f, -1.f, -11.f), glm::vec3(1.f, 1.f, -9.f))));
+	EXPECT_FALSE(frustum.Intersect(AABB(glm::vec3(-1.f, -1.f, 9.f), glm::vec3(1.f, 1.f, 11.f))));
+	EXPECT_FALSE(frustum.Intersect(AABB(glm::vec3(-1.f, -1.f, -120.f), glm::vec3(1.f, 1.f, -110.f))));
+	EXPECT_FALSE(frustum.Intersect(AABB(glm::vec3(50.f, -1.f, -11.f), glm::vec3(52.f, 1.f, -9.f))));
+
+	// Straddling a side plane still counts
+	EXPECT_TRUE(frustum.Intersect(AABB(glm::vec3(0.f, -1.f, -11.f), glm::vec3(50.f, 1.f, -9.f))));
+}
+
+TEST(Frustum, BatchMatchesScalarReference)
+{
+	std::mt19937 rng(29);
+
+	// Counts around the vector width exercise the tail handling
+	for (size_t count : {1, 2, 3, 4, 5, 7, 8, 9, 37, 1000})
+	{
+		auto    bounds  = CreateBounds(count, rng);
+		Frustum frustum = CreateFrustum(rng);
+
+		std::vector<uint8_t> visible(count, 2);
+		frustum.Intersect(&bounds[0].aabb, count, sizeof(Bound), visible.data());
+
+		for (size_t i = 0; i < count; i++)
+		{
+			EXPECT_EQ(visible[i] != 0, frustum.Intersect(bounds[i].aabb)) << "box " << i << " of " << count;
+		}
+	}
+}
+
+TEST(Frustum, BatchOverManyFrustums)
+{
+	std::mt19937 rng(31);
+
+	auto bounds = CreateBounds(256, rng);
+
+	size_t               inside = 0;
+	std::vector<uint8_t> visible(bounds.size());
+	for (uint32_t i = 0; i < 200; i++)
+	{
+		Frustum frustum = CreateFrustum(rng);
+		frustum.Intersect(&bounds[0].aabb, bounds.size(), sizeof(Bound), visible.data());
+
+		for (size_t j = 0; j < bounds.size(); j++)
+		{
+			ASSERT_EQ(visible[j] != 0, frustum.Intersect(bounds[j].aabb));
+			inside += visible[j];
+		}
+	}
+
+	// Both outcomes must actually occur for the comparison to mean anything
+	EXPECT_GT(inside, 0);
+	EXPECT_LT(inside, bounds.size() * 200);
+}
@@ -0,0 +1,136 @@
+#include <Geometry/VertexQuantization.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+std::vector<glm::vec3> CreateDirections(size_t count)
+{
+	std::mt19937                    rng(7);
+	std::normal_distribution<float> dist(0.f, 1.f);
+
+	// Poles and the folded corners of the lower hemisphere first
+	std::vector<glm::vec3> directions = {
+	    glm::vec3(1.f, 0.f, 0.f),
+	    glm::vec3(-1.f, 0.f, 0.f),
+	    glm::vec3(0.f, 1.f, 0.f),
+	    glm::vec3(0.f, -1.f, 0.f),
+	    glm::vec3(0.f, 0.f, 1.f),
+	    glm::vec3(0.f, 0.f, -1.f),
+	    glm::normalize(glm::vec3(1.f, 1.f, -1.f)),
+	    glm::normalize(glm::vec3(-1.f, -1.f, -1.f)),
+	};
+
+	while (directions.size() < count)
+	{
+		glm::vec3 v = glm::vec3(dist(rng), dist(rng), dist(rng));
+		if (glm::length(v) > 1e-3f)
+		{
+			directions.push_back(glm::normalize(v));
+		}
+	}
+
+	return directions;
+}
+}        // namespace
+
+TEST(VertexQuantization, OctahedralRoundTrip)
+{
+	// snorm16 octahedral keeps unit vectors within a few snorm steps on both hemispheres
+	float max_error = 0.f;
+	for (auto &v : CreateDirections(100000))
+	{
+		glm::vec3 decoded = DecodeOctahedral(EncodeOctahedral(v));
+		EXPECT_NEAR(glm::length(decoded), 1.f, 1e-5f);
+		max_error = std::max(max_error, glm::length(decoded - v));
+	}
+	EXPECT_LT(max_error, 2e-4f);
+}
+
+TEST(VertexQuantization, OctahedralIgnoresLength)
+{
+	glm::vec3 v = glm::normalize(glm::vec3(0.3f, -0.5f, -0.8f));
+	EXPECT_EQ(EncodeOctahedral(v), EncodeOctahedral(v * 10.f));
+}
+
+TEST(VertexQuantization, Half2RoundTrip)
+{
+	// Texture coordinates keep 11 significant bits
+	for (float x = -4.f; x <= 4.f; x += 0.0137f)
+	{
+		glm::vec2 v       = glm::vec2(x, 1.f - x);
+		glm::vec2 decoded = DecodeHalf2(EncodeHalf2(v));
+		EXPECT_LE(glm::abs(decoded.x - v.x), glm::max(glm::abs(v.x), 1.f) / 1024.f);
+		EXPECT_LE(glm::abs(decoded.y - v.y), glm::max(glm::abs(v.y), 1.f) / 1024.f);
+	}
+
+	// Low half is x
+	EXPECT_EQ(EncodeHalf2(glm::vec2(1.f, 0.f)), 0x3c00u);
+}
+
+TEST(VertexQuantization, PositionRoundTrip)
+{
+	glm::vec3 offset = glm::vec3(-10.f, 0.f, 5.f);
+	glm::vec3 scale  = glm::vec3(20.f, 3.f, 0.5f);
+
+	std::mt19937                          rng(7);
+	std::uniform_real_distribution<float> dist(0.f, 1.f);
+
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		glm::vec3 position = offset + glm::vec3(dist(rng), dist(rng), dist(rng)) * scale;
+
+		uint16_t packed[3];
+		EncodePosition(position, offset, scale, packed);
+		glm::vec3 decoded = DecodePosition(packed, offset, scale);
+
+		// Half a step of 16 bits per axis, plus float slack
+		for (uint32_t j = 0; j < 3; j++)
+		{
+			EXPECT_LE(glm::abs(decoded[j] - position[j]), scale[j] / 65535.f * 0.5f + 1e-5f * glm::abs(offset[j] + scale[j]));
+		}
+	}
+}
+
+TEST(VertexQuantization, PositionBoundsAndClamping)
+{
+	glm::vec3 offset = glm::vec3(-1.f, -2.f, -3.f);
+	glm::vec3 scale  = glm::vec3(2.f, 4.f, 0.f);
+
+	uint16_t packed[3];
+
+	EncodePosition(offset, offset, scale, packed);
+	EXPECT_EQ(packed[0], 0u);
+	EXPECT_EQ(packed[1], 0u);
+
+	EncodePosition(offset + scale, offset, scale, packed);
+	EXPECT_EQ(packed[0], 65535u);
+	EXPECT_EQ(packed[1], 65535u);
+
+	// Outside the bounds clamps, a flat axis decodes to the offset
+	EncodePosition(glm::vec3(-5.f, 100.f, 7.f), offset, scale, packed);
+	EXPECT_EQ(packed[0], 0u);
+	EXPECT_EQ(packed[1], 65535u);
+	EXPECT_EQ(packed[2], 0u);
+	EXPECT_EQ(DecodePosition(packed, offset, scale).z, offset.z);
+}
+
+TEST(VertexQuantization, Unorm8)
+{
+	for (uint32_t i = 0; i < 256; i++)
+	{
+		EXPECT_EQ(EncodeUnorm8(DecodeUnorm8(static_cast<uint8_t>(i))), i);
+	}
+
+	for (float v = 0.f; v <= 1.f; v += 0.001f)
+	{
+		EXPECT_LE(glm::abs(DecodeUnorm8(EncodeUnorm8(v)) - v), 0.5f / 255.f + 1e-6f);
+	}
+
+	EXPECT_EQ(EncodeUnorm8(-1.f), 0u);
+	EXPECT_EQ(EncodeUnorm8(2.f), 255u);
+}
@@ -0,0 +1,101 @@
+#include <Core/Core.hpp>
+#include <Core/Plugin.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace Ilum;
+
+namespace
+{
+size_t ProcessModel(const std::string &path, bool parallel)
+{
+	return PluginManager::GetInstance().Call<size_t>("shared/Importer/Importer.Assimp.dll", "ProcessModel", path, parallel);
+}
+
+// 24 bit bitmap filled with one color
+void WriteBitmap(const std::filesystem::path &path, uint32_t size, uint8_t color)
+{
+	uint32_t row   = (size * 3 + 3) & ~3u;
+	uint32_t bytes = 54 + row * size;
+
+	uint8_t header[54] = {'B', 'M'};
+	std::memcpy(header + 2, &bytes, 4);
+	header[10] = 54;
+	header[14] = 40;
+	std::memcpy(header + 18, &size, 4);
+	std::memcpy(header + 22, &size, 4);
+	header[26] = 1;
+	header[28] = 24;
+
+	std::ofstream os(path, std::ios::binary);
+	os.write(reinterpret_cast<const char *>(header), sizeof(header));
+	std::vector<char> pixels(row * size, static_cast<char>(color));
+	os.write(pixels.data(), pixels.size());
+}
+
+// Objects of grid x grid quads, every object uses one of four textured materials
+std::string WriteModel(const std::string &name, uint32_t objects, uint32_t grid)
+{
+	auto directory = std::filesystem::temp_directory_path() / name;
+	std::filesystem::create_directories(directory);
+
+	std::ofstream mtl(directory / "model.mtl");
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		WriteBitmap(directory / fmt::format("texture{}.bmp", i), 16, static_cast<uint8_t>(i * 60));
+		mtl << fmt::format("newmtl material{}\nmap_Kd texture{}.bmp\n", i, i);
+	}
+
+	std::ofstream obj(directory / "model.obj");
+	obj << "mtllib model.mtl\n";
+
+	uint32_t base = 1;
+	for (uint32_t o = 0; o < objects; o++)
+	{
+		obj << fmt::format("o object{}\nusemtl material{}\n", o, o % 4);
+		for (uint32_t y = 0; y <= grid; y++)
+		{
+			for (uint32_t x = 0; x <= grid; x++)
+			{
+				obj << fmt::format("v {} {} {}\nvt {} {}\n", x, y, o, float(x) / grid, float(y) / grid);
+			}
+		}
+		for (uint32_t y = 0; y < grid; y++)
+		{
+			for (uint32_t x = 0; x < grid; x++)
+			{
+				uint32_t i = base + y * (grid + 1) + x;
+				obj << fmt::format("f {0}/{0} {1}/{1} {2}/{2} {3}/{3}\n", i, i + 1, i + grid + 2, i + grid + 1);
+			}
+		}
+		base += (grid + 1) * (grid + 1);
+	}
+
+	return (directory / "model.obj").string();
+}
+}        // namespace
+
+TEST(AssimpImporter, ParallelProcessingMatchesSerial)
+{
+	std::string path = WriteModel("IlumTestAssimp", 24, 16);
+
+	size_t serial = ProcessModel(path, false);
+	ASSERT_NE(serial, 0u);
+
+	// Scheduling changes between runs, results must not
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(ProcessModel(path, true), serial);
+	}
+
+	std::filesystem::remove_all(std::filesystem::path(path).parent_path());
+}
+
+TEST(AssimpImporter, MissingModelIsRejected)
+{
+	EXPECT_EQ(ProcessModel((std::filesystem::temp_directory_path() / "IlumTestMissing.obj").string(), true), 0u);
+}
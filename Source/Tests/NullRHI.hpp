@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Core/Plugin.hpp>
+#include <RHI/RHIDevice.hpp>
+
+#include <Null/Device.hpp>
+
+namespace Ilum::Test
+{
+// Headless device backed by the RHI.Null plugin
+inline std::unique_ptr<RHIDevice> CreateNullDevice()
+{
+	return RHIDevice::Create("Null");
+}
+
+inline Null::Device::Statistics &GetNullStatistics(RHIDevice *device)
+{
+	return *PluginManager::GetInstance().Call<Null::Device::Statistics *>("shared/RHI/RHI.Null.dll", "GetStatistics", device);
+}
+}        // namespace Ilum::Test
@@ -0,0 +1,185 @@
+#include "NullRHI.hpp"
+
+#include <RHI/RHIBuffer.hpp>
+#include <RHI/RHICommand.hpp>
+#include <RHI/RHIFrame.hpp>
+#include <RHI/RHIQueue.hpp>
+#include <RHI/RHISwapchain.hpp>
+#include <RHI/RHITexture.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace Ilum;
+
+namespace
+{
+BufferDesc GetBufferDesc(size_t size)
+{
+	return BufferDesc{"Buffer", RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU, size, 0, 0};
+}
+
+TextureDesc GetTextureDesc(uint32_t size, uint32_t mips)
+{
+	TextureDesc desc = {};
+	desc.name        = "Texture";
+	desc.width       = size;
+	desc.height      = size;
+	desc.mips        = mips;
+	desc.format      = RHIFormat::R8G8B8A8_UNORM;
+	desc.usage       = RHITextureUsage::Transfer | RHITextureUsage::ShaderResource;
+	return desc;
+}
+}        // namespace
+
+TEST(NullDevice, TracksAllocations)
+{
+	auto  device     = Ilum::Test::CreateNullDevice();
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+
+	{
+		auto buffer = RHIBuffer::Create(device.get(), GetBufferDesc(1024));
+		EXPECT_EQ(statistics.buffer_count.load(), 1u);
+		EXPECT_EQ(statistics.allocated_memory.load(), 1024u);
+
+		// 4x4 + 2x2 + 1x1 texels of 4 bytes
+		auto texture = RHITexture::Create(device.get(), GetTextureDesc(4, 3));
+		EXPECT_EQ(texture->GetMemorySize(), 84u);
+		EXPECT_EQ(RHITexture::QueryMemorySize(device.get(), GetTextureDesc(4, 3)), 84u);
+		EXPECT_EQ(statistics.texture_count.load(), 1u);
+		EXPECT_EQ(statistics.allocated_memory.load(), 1108u);
+
+		// Aliases share their parent's memory
+		auto buffer_alias  = buffer->Alias(GetBufferDesc(512), 512);
+		auto texture_alias = texture->Alias(GetTextureDesc(2, 1), 0);
+		ASSERT_NE(buffer_alias, nullptr);
+		ASSERT_NE(texture_alias, nullptr);
+		EXPECT_EQ(statistics.buffer_count.load(), 1u);
+		EXPECT_EQ(statistics.texture_count.load(), 1u);
+		EXPECT_EQ(statistics.allocated_memory.load(), 1108u);
+
+		EXPECT_EQ(buffer->Alias(GetBufferDesc(1024), 512), nullptr);
+	}
+
+	EXPECT_EQ(statistics.buffer_count.load(), 0u);
+	EXPECT_EQ(statistics.texture_count.load(), 0u);
+	EXPECT_EQ(statistics.allocated_memory.load(), 0u);
+	EXPECT_EQ(statistics.peak_memory.load(), 1108u);
+}
+
+TEST(NullDevice, BuffersKeepTheirContents)
+{
+	auto  device     = Ilum::Test::CreateNullDevice();
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+
+	std::vector<uint8_t> data(256);
+	std::iota(data.begin(), data.end(), static_cast<uint8_t>(0));
+
+	auto src = RHIBuffer::Create(device.get(), GetBufferDesc(256));
+	auto dst = RHIBuffer::Create(device.get(), GetBufferDesc(256));
+
+	src->CopyToDevice(data.data(), data.size());
+
+	std::vector<uint8_t> result(256);
+	src->CopyToHost(result.data(), result.size());
+	EXPECT_EQ(result, data);
+
+	// An alias sees the parent's bytes at its offset
+	auto alias = src->Alias(GetBufferDesc(128), 128);
+	EXPECT_EQ(static_cast<uint8_t *>(alias->Map())[0], 128);
+
+	auto frame = RHIFrame::Create(device.get());
+	auto queue = RHIQueue::Create(device.get());
+
+	auto *cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Transfer);
+	cmd_buffer->Begin();
+	cmd_buffer->CopyBufferToBuffer(src.get(), dst.get(), 128, 128, 0);
+	cmd_buffer->End();
+	queue->Execute(cmd_buffer);
+
+	dst->CopyToHost(result.data(), 128);
+	EXPECT_TRUE(std::equal(result.begin(), result.begin() + 128, data.begin() + 128));
+	EXPECT_EQ(statistics.copies.load(), 1u);
+	EXPECT_EQ(statistics.submitted_commands.load(), 1u);
+}
+
+TEST(NullDevice, ValidatesBarriersAtSubmission)
+{
+	auto  device     = Ilum::Test::CreateNullDevice();
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+
+	auto texture = RHITexture::Create(device.get(), GetTextureDesc(64, 2));
+	auto buffer  = RHIBuffer::Create(device.get(), GetBufferDesc(64));
+
+	auto frame = RHIFrame::Create(device.get());
+	auto queue = RHIQueue::Create(device.get());
+
+	auto *cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+	cmd_buffer->ResourceStateTransition(
+	    {TextureStateTransition{texture.get(), RHIResourceState::Undefined, RHIResourceState::TransferDest, TextureRange{RHITextureDimension::Texture2D, 0, 2, 0, 1}}},
+	    {BufferStateTransition{buffer.get(), RHIResourceState::Undefined, RHIResourceState::TransferSource}});
+	cmd_buffer->CopyBufferToTexture(buffer.get(), texture.get(), 0, 0, 1);
+	cmd_buffer->ResourceStateTransition(
+	    {TextureStateTransition{texture.get(), RHIResourceState::TransferDest, RHIResourceState::ShaderResource, TextureRange{RHITextureDimension::Texture2D, 0, 2, 0, 1}}},
+	    {});
+	cmd_buffer->Draw(3, 1, 0, 0);
+	cmd_buffer->Dispatch(64, 1, 1, 8, 1, 1);
+	cmd_buffer->End();
+	queue->Execute(cmd_buffer);
+
+	EXPECT_EQ(statistics.barrier_errors.load(), 0u);
+	EXPECT_EQ(statistics.barriers.load(), 3u);
+	EXPECT_EQ(statistics.copies.load(), 1u);
+	EXPECT_EQ(statistics.draw_calls.load(), 1u);
+	EXPECT_EQ(statistics.dispatches.load(), 1u);
+
+	// Mip 1 is a shader resource and the buffer a transfer source, neither matches the expected state
+	frame->Reset();
+	cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+	cmd_buffer->ResourceStateTransition(
+	    {TextureStateTransition{texture.get(), RHIResourceState::RenderTarget, RHIResourceState::ShaderResource, TextureRange{RHITextureDimension::Texture2D, 1, 1, 0, 1}}},
+	    {BufferStateTransition{buffer.get(), RHIResourceState::UnorderedAccess, RHIResourceState::ShaderResource}});
+	cmd_buffer->End();
+
+	// Nothing is validated until the command is submitted
+	EXPECT_EQ(statistics.barrier_errors.load(), 0u);
+	queue->Execute(RHIQueueFamily::Graphics, {SubmitInfo{RHIQueueFamily::Graphics, false, {cmd_buffer}, {}, {}}});
+
+	EXPECT_EQ(statistics.barrier_errors.load(), 2u);
+	EXPECT_EQ(statistics.barriers.load(), 5u);
+	EXPECT_EQ(statistics.submitted_commands.load(), 2u);
+}
+
+TEST(NullDevice, PresentRequiresPresentState)
+{
+	auto  device     = Ilum::Test::CreateNullDevice();
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+
+	auto swapchain = RHISwapchain::Create(device.get(), nullptr, 64, 64, false);
+	ASSERT_NE(swapchain, nullptr);
+	EXPECT_GT(swapchain->GetTextureCount(), 1u);
+
+	swapchain->AcquireNextTexture(nullptr, nullptr);
+	EXPECT_TRUE(swapchain->Present(nullptr));
+	EXPECT_EQ(statistics.barrier_errors.load(), 0u);
+
+	auto frame = RHIFrame::Create(device.get());
+	auto queue = RHIQueue::Create(device.get());
+
+	// Rendering into the back buffer without transitioning it back is caught at present
+	swapchain->AcquireNextTexture(nullptr, nullptr);
+	auto *cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+	cmd_buffer->ResourceStateTransition(
+	    {TextureStateTransition{swapchain->GetCurrentTexture(), RHIResourceState::Present, RHIResourceState::RenderTarget}},
+	    {});
+	cmd_buffer->End();
+	queue->Execute(cmd_buffer);
+
+	EXPECT_EQ(statistics.barrier_errors.load(), 0u);
+	swapchain->Present(nullptr);
+	EXPECT_EQ(statistics.barrier_errors.load(), 1u);
+}
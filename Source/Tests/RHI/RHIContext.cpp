@@ -0,0 +1,30 @@
+#include <RHI/RHIContext.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+TEST(RHIContext, HeadlessContextCyclesFrames)
+{
+	RHIContext rhi_context(nullptr, "Null");
+
+	EXPECT_EQ(rhi_context.GetSwapchain(), nullptr);
+	EXPECT_EQ(rhi_context.GetBackBuffer(), nullptr);
+	EXPECT_GT(rhi_context.GetFrameCount(), 0u);
+
+	auto src = rhi_context.CreateBuffer(256, RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU);
+	auto dst = rhi_context.CreateBuffer(256, RHIBufferUsage::Transfer, RHIMemoryUsage::GPU_Only);
+
+	for (uint32_t i = 0; i < rhi_context.GetFrameCount() * 2; i++)
+	{
+		rhi_context.BeginFrame();
+
+		auto *cmd_buffer = rhi_context.CreateCommand(RHIQueueFamily::Graphics);
+		cmd_buffer->Begin();
+		cmd_buffer->CopyBufferToBuffer(src.get(), dst.get(), 256);
+		cmd_buffer->End();
+		rhi_context.Submit({cmd_buffer});
+
+		rhi_context.EndFrame();
+	}
+}
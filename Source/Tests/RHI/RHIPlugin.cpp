@@ -0,0 +1,48 @@
+#include "NullRHI.hpp"
+
+#include <RHI/RHIBuffer.hpp>
+#include <RHI/RHIPlugin.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+TEST(RHIPlugin, NullBackendResolvesEveryFactory)
+{
+	auto device = Ilum::Test::CreateNullDevice();
+	ASSERT_NE(device, nullptr);
+
+	const RHIPlugin &plugin = device->GetPlugin();
+	EXPECT_EQ(&plugin, &RHIPlugin::Get("Null"));
+
+	EXPECT_TRUE(plugin.create_device);
+	EXPECT_TRUE(plugin.create_frame);
+	EXPECT_TRUE(plugin.create_swapchain);
+	EXPECT_TRUE(plugin.create_queue);
+	EXPECT_TRUE(plugin.create_buffer);
+	EXPECT_TRUE(plugin.create_texture);
+	EXPECT_TRUE(plugin.create_texture_heap);
+	EXPECT_TRUE(plugin.get_texture_memory_size);
+	EXPECT_TRUE(plugin.create_sampler);
+	EXPECT_TRUE(plugin.create_shader);
+	EXPECT_TRUE(plugin.create_render_target);
+	EXPECT_TRUE(plugin.create_fence);
+	EXPECT_TRUE(plugin.create_semaphore);
+	EXPECT_TRUE(plugin.create_descriptor);
+	EXPECT_TRUE(plugin.create_pipeline_state);
+	EXPECT_TRUE(plugin.create_profiler);
+	EXPECT_TRUE(plugin.create_acceleration_structure);
+
+	auto buffer = RHIBuffer::Create(device.get(), BufferDesc{"Buffer", RHIBufferUsage::Transfer, RHIMemoryUsage::CPU_TO_GPU, 64, 0, 0});
+	ASSERT_NE(buffer, nullptr);
+	EXPECT_EQ(buffer->GetDesc().size, 64u);
+}
+
+TEST(RHIPlugin, MissingBackendCreatesNothing)
+{
+	const RHIPlugin &plugin = RHIPlugin::Get("Missing");
+
+	EXPECT_FALSE(plugin.create_device);
+	EXPECT_FALSE(plugin.create_buffer);
+	EXPECT_EQ(RHIDevice::Create("Missing"), nullptr);
+}
@@ -0,0 +1,132 @@
+#include "NullRHI.hpp"
+
+#include <RenderGraph/RenderGraph.hpp>
+#include <RenderGraph/RenderGraphBlackboard.hpp>
+#include <RenderGraph/RenderGraphBuilder.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+namespace
+{
+struct PassSetup
+{
+	std::string name;
+	BindPoint   bind_point;
+	uint32_t    record_group;
+
+	// Texture index, source and destination state
+	std::vector<std::tuple<uint32_t, RHIResourceState, RHIResourceState>> transitions;
+};
+
+// G-buffer, then bloom and shadow recorded together on workers, then a composite reading both
+const std::vector<PassSetup> Passes = {
+    {"GBuffer", BindPoint::Rasterization, 0, {{0, RHIResourceState::Undefined, RHIResourceState::RenderTarget}}},
+    {"Bloom", BindPoint::Compute, 1, {{0, RHIResourceState::RenderTarget, RHIResourceState::ShaderResource}, {1, RHIResourceState::Undefined, RHIResourceState::UnorderedAccess}}},
+    {"Shadow", BindPoint::Rasterization, 1, {{2, RHIResourceState::Undefined, RHIResourceState::DepthWrite}}},
+    {"Composite", BindPoint::Rasterization, 2, {{1, RHIResourceState::UnorderedAccess, RHIResourceState::ShaderResource}, {2, RHIResourceState::DepthWrite, RHIResourceState::ShaderResource}, {3, RHIResourceState::Undefined, RHIResourceState::RenderTarget}}},
+};
+
+// Execute one frame of the graph and return what reached the queue
+std::vector<Null::Device::Submission> ExecuteFrame(bool parallel_recording)
+{
+	RHIContext rhi_context(nullptr, "Null");
+
+	auto &statistics = Ilum::Test::GetNullStatistics(rhi_context.GetDevice());
+
+	statistics.record_submissions = true;
+
+	std::vector<std::unique_ptr<RHITexture>> textures;
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		TextureDesc desc = {};
+		desc.name        = "Texture " + std::to_string(i);
+		desc.width       = 64;
+		desc.height      = 64;
+		desc.format      = i == 2 ? RHIFormat::D32_FLOAT : RHIFormat::R8G8B8A8_UNORM;
+		desc.usage       = RHITextureUsage::RenderTarget | RHITextureUsage::ShaderResource | RHITextureUsage::UnorderedAccess;
+		textures.emplace_back(rhi_context.CreateTexture(desc));
+	}
+
+	RenderGraph        render_graph(&rhi_context);
+	RenderGraphBuilder builder(&rhi_context);
+
+	for (auto &pass : Passes)
+	{
+		builder.AddPass(
+		    render_graph,
+		    pass.name,
+		    "Test",
+		    pass.bind_point,
+		    Variant(),
+		    [bind_point = pass.bind_point](RenderGraph &, RHICommand *cmd_buffer, Variant &, RenderGraphBlackboard &) {
+			    if (bind_point == BindPoint::Compute)
+			    {
+				    cmd_buffer->Dispatch(64, 64, 1, 8, 8, 1);
+			    }
+			    else
+			    {
+				    cmd_buffer->Draw(3, 1, 0, 0);
+			    }
+		    },
+		    [&textures, transitions = pass.transitions](RenderGraph &, RHICommand *cmd_buffer) {
+			    std::vector<TextureStateTransition> texture_transitions;
+			    for (auto &[index, src, dst] : transitions)
+			    {
+				    texture_transitions.push_back(TextureStateTransition{textures[index].get(), src, dst, TextureRange{RHITextureDimension::Texture2D, 0, 1, 0, 1}});
+			    }
+			    cmd_buffer->ResourceStateTransition(texture_transitions, {});
+		    },
+		    pass.record_group);
+	}
+
+	render_graph.SetParallelRecording(parallel_recording);
+
+	RenderGraphBlackboard black_board;
+
+	rhi_context.BeginFrame();
+	render_graph.Execute(black_board);
+	rhi_context.EndFrame();
+
+	EXPECT_EQ(statistics.barrier_errors.load(), 0u);
+
+	std::lock_guard<std::mutex> lock(statistics.submission_mutex);
+	return statistics.submissions;
+}
+}        // namespace
+
+TEST(RenderGraphExecute, ParallelRecordingMatchesSerialRecording)
+{
+	auto serial   = ExecuteFrame(false);
+	auto parallel = ExecuteFrame(true);
+
+	// Two initialize commands, then one command per pass
+	ASSERT_EQ(serial.size(), Passes.size() + 2);
+	ASSERT_EQ(parallel.size(), serial.size());
+
+	for (size_t i = 0; i < serial.size(); i++)
+	{
+		SCOPED_TRACE(serial[i].name);
+
+		EXPECT_EQ(parallel[i].name, serial[i].name);
+		EXPECT_EQ(parallel[i].family, serial[i].family);
+		EXPECT_EQ(parallel[i].draw_calls, serial[i].draw_calls);
+		EXPECT_EQ(parallel[i].dispatches, serial[i].dispatches);
+
+		ASSERT_EQ(parallel[i].transitions.size(), serial[i].transitions.size());
+		for (size_t j = 0; j < serial[i].transitions.size(); j++)
+		{
+			EXPECT_EQ(parallel[i].transitions[j].resource, serial[i].transitions[j].resource);
+			EXPECT_EQ(parallel[i].transitions[j].src, serial[i].transitions[j].src);
+			EXPECT_EQ(parallel[i].transitions[j].dst, serial[i].transitions[j].dst);
+		}
+	}
+
+	// Passes reach the queue in declaration order, on the queue of their bind point
+	for (size_t i = 0; i < Passes.size(); i++)
+	{
+		EXPECT_EQ(parallel[i + 2].name, Passes[i].name);
+		EXPECT_EQ(parallel[i + 2].family, Passes[i].bind_point == BindPoint::Compute ? RHIQueueFamily::Compute : RHIQueueFamily::Graphics);
+	}
+}
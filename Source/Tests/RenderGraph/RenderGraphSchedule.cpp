@@ -0,0 +1,185 @@
+#include "NullRHI.hpp"
+
+#include <RHI/RHIFrame.hpp>
+#include <RHI/RHIQueue.hpp>
+#include <RHI/RHITexture.hpp>
+#include <RenderGraph/RenderGraphSchedule.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+namespace
+{
+// A and B write independent textures, C reads both and writes the output, passes are linked A -> B -> C
+//   A (1) : X (10) -> C (3) : X (31), Y (32) -> Z (33)
+//   B (2) : Y (20) ---^
+RenderGraphDesc CreateGraph()
+{
+	RenderPassDesc a, b, c;
+	a.SetName("A")
+	    .SetBindPoint(BindPoint::Compute)
+	    .WriteTexture2D(10, "X", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64);
+	b.SetName("B")
+	    .SetBindPoint(BindPoint::Compute)
+	    .WriteTexture2D(20, "Y", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64);
+	c.SetName("C")
+	    .SetBindPoint(BindPoint::Rasterization)
+	    .ReadTexture2D(31, "X", RHIResourceState::ShaderResource)
+	    .ReadTexture2D(32, "Y", RHIResourceState::ShaderResource)
+	    .WriteTexture2D(33, "Z", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::RenderTarget, 64, 64);
+
+	// Added out of order, the schedule must only depend on the links
+	RenderGraphDesc desc;
+	desc.SetName("Test")
+	    .AddPass(3, std::move(c))
+	    .AddPass(2, std::move(b))
+	    .AddPass(1, std::move(a));
+
+	desc.Link(1, 2)
+	    .Link(2, 3)
+	    .Link(10, 31)
+	    .Link(20, 32);
+
+	return desc;
+}
+
+TextureRange GetFullRange(RHITexture *texture)
+{
+	const auto &desc = texture->GetDesc();
+	return TextureRange{GetTextureDimension(desc.width, desc.height, desc.depth, desc.layers), 0, desc.mips, 0, desc.layers};
+}
+}        // namespace
+
+TEST(RenderGraphSchedule, PassesFollowLinks)
+{
+	RenderGraphDesc desc     = CreateGraph();
+	auto            schedule = RenderGraphSchedule::Build(desc);
+
+	ASSERT_EQ(schedule.passes.size(), 3u);
+	EXPECT_EQ(schedule.passes[0], 1u);
+	EXPECT_EQ(schedule.passes[1], 2u);
+	EXPECT_EQ(schedule.passes[2], 3u);
+}
+
+TEST(RenderGraphSchedule, IndependentPassesShareRecordGroup)
+{
+	RenderPassDesc a, b, c;
+	a.SetName("A").SetBindPoint(BindPoint::Compute).WriteTexture2D(10, "X", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64);
+	b.SetName("B").SetBindPoint(BindPoint::Compute).WriteTexture2D(20, "Y", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64);
+	c.SetName("C").SetBindPoint(BindPoint::Compute).ReadTexture2D(30, "X", RHIResourceState::ShaderResource);
+
+	RenderGraphDesc desc;
+	desc.AddPass(1, std::move(a))
+	    .AddPass(2, std::move(b))
+	    .AddPass(3, std::move(c))
+	    .Link(10, 30);
+
+	auto schedule = RenderGraphSchedule::Build(desc);
+
+	ASSERT_EQ(schedule.passes.size(), 3u);
+	EXPECT_EQ(schedule.record_groups[0], 0u);
+	EXPECT_EQ(schedule.record_groups[1], 0u);
+	// C reads what A writes, so it is never recorded alongside A
+	EXPECT_EQ(schedule.record_groups[2], 1u);
+}
+
+TEST(RenderGraphSchedule, LinkedPassesAreRecordedLater)
+{
+	RenderGraphDesc desc     = CreateGraph();
+	auto            schedule = RenderGraphSchedule::Build(desc);
+
+	ASSERT_EQ(schedule.passes.size(), 3u);
+	EXPECT_LT(schedule.record_groups[0], schedule.record_groups[1]);
+	EXPECT_LT(schedule.record_groups[1], schedule.record_groups[2]);
+}
+
+TEST(RenderGraphSchedule, TransitionsFollowPassStates)
+{
+	RenderGraphDesc desc     = CreateGraph();
+	auto            schedule = RenderGraphSchedule::Build(desc);
+
+	auto &[src, dst] = schedule.transitions[2].at(10);
+	EXPECT_EQ(src.rhi_state, RHIResourceState::UnorderedAccess);
+	EXPECT_EQ(src.family, RHIQueueFamily::Compute);
+	EXPECT_EQ(dst.rhi_state, RHIResourceState::ShaderResource);
+	EXPECT_EQ(dst.family, RHIQueueFamily::Graphics);
+
+	// Usages are derived from every state a resource is used in
+	const auto &texture = desc.GetPass(10).GetPin(10).texture;
+	EXPECT_TRUE(texture.usage & RHITextureUsage::UnorderedAccess);
+	EXPECT_TRUE(texture.usage & RHITextureUsage::ShaderResource);
+
+	// First use of a frame starts from the previous frame once states carry over
+	EXPECT_EQ(schedule.transitions[0].at(10).first.rhi_state, RHIResourceState::Undefined);
+	schedule.CarryOverStates({});
+	EXPECT_EQ(schedule.transitions[0].at(10).first.rhi_state, RHIResourceState::ShaderResource);
+}
+
+TEST(RenderGraphSchedule, BarriersValidateOnNullDevice)
+{
+	auto device = Ilum::Test::CreateNullDevice();
+	ASSERT_NE(device, nullptr);
+
+	auto frame = RHIFrame::Create(device.get());
+	auto queue = RHIQueue::Create(device.get());
+
+	RenderGraphDesc desc     = CreateGraph();
+	auto            schedule = RenderGraphSchedule::Build(desc);
+	schedule.CarryOverStates({});
+
+	std::map<size_t, std::unique_ptr<RHITexture>> textures;
+	for (auto &[handle, lifetime] : schedule.lifetimes)
+	{
+		textures[handle] = RHITexture::Create(device.get(), desc.GetPass(handle).GetPin(handle).texture);
+	}
+
+	auto *cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+
+	// Initialize barrier, every resource starts in the state the last pass leaves it in
+	{
+		std::vector<TextureStateTransition> transitions;
+		for (auto &[handle, lifetime] : schedule.lifetimes)
+		{
+			auto *texture = textures.at(handle).get();
+			transitions.push_back(TextureStateTransition{texture, RHIResourceState::Undefined, (--lifetime.end())->second.rhi_state, GetFullRange(texture)});
+		}
+		cmd_buffer->ResourceStateTransition(transitions, {});
+	}
+
+	// Two frames, the second starts from what the first one left behind
+	for (uint32_t frame_index = 0; frame_index < 2; frame_index++)
+	{
+		for (uint32_t i = 0; i < schedule.passes.size(); i++)
+		{
+			std::vector<TextureStateTransition> transitions;
+			for (auto &[handle, transition] : schedule.transitions[i])
+			{
+				if (transition.first == transition.second)
+				{
+					continue;
+				}
+				auto *texture = textures.at(handle).get();
+				transitions.push_back(TextureStateTransition{texture, transition.first.rhi_state, transition.second.rhi_state, GetFullRange(texture)});
+			}
+			cmd_buffer->ResourceStateTransition(transitions, {});
+		}
+	}
+
+	cmd_buffer->End();
+	queue->Execute(cmd_buffer);
+
+	auto &statistics = Ilum::Test::GetNullStatistics(device.get());
+	EXPECT_GT(statistics.barriers.load(), 0u);
+	EXPECT_EQ(statistics.barrier_errors.load(), 0u);
+
+	// A stale source state is reported
+	cmd_buffer = frame->AllocateCommand(RHIQueueFamily::Graphics);
+	cmd_buffer->Begin();
+	cmd_buffer->ResourceStateTransition({TextureStateTransition{textures.at(10).get(), RHIResourceState::RenderTarget, RHIResourceState::ShaderResource, GetFullRange(textures.at(10).get())}}, {});
+	cmd_buffer->End();
+	queue->Execute(cmd_buffer);
+
+	EXPECT_EQ(statistics.barrier_errors.load(), 1u);
+}
@@ -0,0 +1,237 @@
+#include <RenderGraph/RenderGraphSchedule.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+size_t Align(size_t x, size_t alignment)
+{
+	return (x + alignment - 1) & ~(alignment - 1);
+}
+
+bool LifetimesOverlap(const TransientResource &lhs, const TransientResource &rhs)
+{
+	return lhs.first <= rhs.last && rhs.first <= lhs.last;
+}
+
+bool MemoryOverlaps(const TransientResource &lhs, const TransientResource &rhs)
+{
+	return lhs.offset < rhs.offset + rhs.size && rhs.offset < lhs.offset + lhs.size;
+}
+}        // namespace
+
+TEST(TransientResources, DisjointLifetimesShareMemory)
+{
+	std::vector<TransientResource> resources = {
+	    TransientResource{0, 0, 1, 1000},
+	    TransientResource{1, 2, 3, 1000},
+	    TransientResource{2, 1, 2, 500},
+	};
+
+	size_t heap_size = PackTransientResources(resources, 256);
+
+	std::map<size_t, TransientResource> lookup;
+	for (auto &resource : resources)
+	{
+		lookup.emplace(resource.handle, resource);
+	}
+
+	EXPECT_EQ(lookup.at(0).offset, lookup.at(1).offset);
+	EXPECT_EQ(lookup.at(2).offset, Align(1000, 256));
+	EXPECT_EQ(heap_size, Align(1000, 256) + 500);
+}
+
+TEST(TransientResources, OverlappingLifetimesNeverShareMemory)
+{
+	std::mt19937                            rng(7);
+	std::uniform_int_distribution<uint32_t> pass_dist(0, 31);
+	std::uniform_int_distribution<size_t>   size_dist(1, 1 << 20);
+
+	constexpr size_t Alignment = 64 * 1024;
+
+	std::vector<TransientResource> resources;
+	size_t                         total_size = 0;
+	for (size_t i = 0; i < 256; i++)
+	{
+		uint32_t a = pass_dist(rng);
+		uint32_t b = pass_dist(rng);
+		resources.push_back(TransientResource{i, std::min(a, b), std::max(a, b), size_dist(rng)});
+		total_size += Align(resources.back().size, Alignment);
+	}
+
+	size_t heap_size = PackTransientResources(resources, Alignment);
+
+	size_t end = 0;
+	for (size_t i = 0; i < resources.size(); i++)
+	{
+		EXPECT_EQ(resources[i].offset % Alignment, 0u);
+		end = std::max(end, resources[i].offset + resources[i].size);
+
+		for (size_t j = i + 1; j < resources.size(); j++)
+		{
+			if (LifetimesOverlap(resources[i], resources[j]))
+			{
+				EXPECT_FALSE(MemoryOverlaps(resources[i], resources[j])) << "resources " << resources[i].handle << " and " << resources[j].handle;
+			}
+		}
+	}
+
+	EXPECT_EQ(heap_size, end);
+	EXPECT_LE(heap_size, total_size);
+}
+
+TEST(TransientResources, OnlyOptedInResourcesAlias)
+{
+	// A writes X and History, B reads X and writes Output, nothing reads Output
+	RenderPassDesc a, b;
+	a.SetName("A")
+	    .SetBindPoint(BindPoint::Compute)
+	    .WriteTexture2D(10, "X", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64)
+	    .WriteTexture2D(11, "History", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64)
+	    .SetTransient("X");
+	b.SetName("B")
+	    .SetBindPoint(BindPoint::Compute)
+	    .ReadTexture2D(20, "X", RHIResourceState::ShaderResource)
+	    .WriteTexture2D(21, "Output", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64)
+	    .SetTransient("Output");
+
+	RenderGraphDesc desc;
+	desc.AddPass(1, std::move(a))
+	    .AddPass(2, std::move(b))
+	    .Link(1, 2)
+	    .Link(10, 20);
+
+	auto schedule = RenderGraphSchedule::Build(desc);
+
+	auto x = schedule.GetTransientLifetime(desc, 10);
+	ASSERT_TRUE(x.has_value());
+	EXPECT_EQ(x->first, 0u);
+	EXPECT_EQ(x->second, 1u);
+
+	// Contents kept across frames must never be aliased
+	EXPECT_FALSE(schedule.GetTransientLifetime(desc, 11).has_value());
+
+	// B has an output, so Output is not a sink and ends with B
+	auto output = schedule.GetTransientLifetime(desc, 21);
+	ASSERT_TRUE(output.has_value());
+	EXPECT_EQ(output->second, 1u);
+}
+
+TEST(TransientResources, SinkResourcesLiveUntilTheFrameEnds)
+{
+	// B reads X and has no outputs, so X is handed out of the graph
+	RenderPassDesc a, b;
+	a.SetName("A")
+	    .SetBindPoint(BindPoint::Compute)
+	    .WriteTexture2D(10, "X", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64)
+	    .SetTransient("X");
+	b.SetName("B")
+	    .SetBindPoint(BindPoint::Rasterization)
+	    .ReadTexture2D(20, "X", RHIResourceState::ShaderResource);
+
+	RenderGraphDesc desc;
+	desc.AddPass(1, std::move(a))
+	    .AddPass(2, std::move(b))
+	    .Link(1, 2)
+	    .Link(10, 20);
+
+	auto schedule = RenderGraphSchedule::Build(desc);
+
+	auto x = schedule.GetTransientLifetime(desc, 10);
+	ASSERT_TRUE(x.has_value());
+	EXPECT_EQ(x->second, static_cast<uint32_t>(schedule.passes.size()));
+}
+
+TEST(TransientResources, AliasedTexturesAndBuffersStartUndefined)
+{
+	// A writes X, Y and History, B reads X and Y and writes Z and W, C reads Z and W
+	RenderPassDesc a, b, c;
+	a.SetName("A")
+	    .SetBindPoint(BindPoint::Compute)
+	    .WriteTexture2D(10, "X", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64)
+	    .WriteBuffer(11, "Y", 1024, RHIResourceState::UnorderedAccess)
+	    .WriteBuffer(12, "History", 1024, RHIResourceState::UnorderedAccess)
+	    .SetTransient("X")
+	    .SetTransient("Y");
+	b.SetName("B")
+	    .SetBindPoint(BindPoint::Compute)
+	    .ReadTexture2D(20, "X", RHIResourceState::ShaderResource)
+	    .ReadBuffer(21, "Y", RHIResourceState::ShaderResource)
+	    .WriteTexture2D(22, "Z", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64)
+	    .WriteBuffer(23, "W", 1024, RHIResourceState::UnorderedAccess)
+	    .SetTransient("Z")
+	    .SetTransient("W");
+	c.SetName("C")
+	    .SetBindPoint(BindPoint::Compute)
+	    .ReadTexture2D(30, "Z", RHIResourceState::ShaderResource)
+	    .ReadBuffer(31, "W", RHIResourceState::ShaderResource)
+	    .WriteTexture2D(32, "Output", RHIFormat::R8G8B8A8_UNORM, RHIResourceState::UnorderedAccess, 64, 64);
+
+	RenderGraphDesc desc;
+	desc.AddPass(1, std::move(a))
+	    .AddPass(2, std::move(b))
+	    .AddPass(3, std::move(c))
+	    .Link(1, 2)
+	    .Link(2, 3)
+	    .Link(10, 20)
+	    .Link(11, 21)
+	    .Link(22, 30)
+	    .Link(23, 31);
+
+	auto schedule = RenderGraphSchedule::Build(desc);
+
+	// Collected the way the builder does, with a made up texture size
+	std::vector<TransientResource> textures, buffers;
+	for (auto &[handle, states] : schedule.lifetimes)
+	{
+		auto lifetime = schedule.GetTransientLifetime(desc, handle);
+		if (!lifetime)
+		{
+			continue;
+		}
+		const auto &pin = desc.GetPass(handle).GetPin(handle);
+		if (pin.type == RenderPassPin::Type::Texture)
+		{
+			textures.push_back(TransientResource{handle, lifetime->first, lifetime->second, 64 * 64 * 4});
+		}
+		else
+		{
+			buffers.push_back(TransientResource{handle, lifetime->first, lifetime->second, pin.buffer.size});
+		}
+	}
+	ASSERT_EQ(textures.size(), 2u);
+	ASSERT_EQ(buffers.size(), 2u);
+
+	PackTransientResources(textures, 64 * 1024);
+	PackTransientResources(buffers, 256);
+
+	auto aliased_resources = GetAliasedResources(textures, buffers);
+	EXPECT_EQ(aliased_resources, (std::set<size_t>{10, 11, 22, 23}));
+
+	schedule.CarryOverStates(aliased_resources);
+
+	// Each aliased resource is first used by the pass writing it, and starts there without a valid state
+	const std::map<size_t, uint32_t> first_pass = {{10, 0}, {11, 0}, {22, 1}, {23, 1}};
+	for (auto &[handle, pass_index] : first_pass)
+	{
+		const auto &[src, dst] = schedule.transitions[pass_index].at(handle);
+		EXPECT_EQ(src.rhi_state, RHIResourceState::Undefined) << "resource " << handle;
+		EXPECT_EQ(dst.rhi_state, RHIResourceState::UnorderedAccess) << "resource " << handle;
+	}
+
+	// History keeps its memory, so it starts in the state the previous frame left it in
+	EXPECT_EQ(schedule.transitions[0].at(12).first.rhi_state, RHIResourceState::UnorderedAccess);
+}
+
+TEST(TransientResources, ResourcesAloneInTheirHeapAreNotAliased)
+{
+	std::vector<TransientResource> textures = {TransientResource{10, 0, 1, 1024}};
+	std::vector<TransientResource> buffers  = {TransientResource{11, 0, 1, 1024}, TransientResource{12, 1, 2, 1024}};
+
+	EXPECT_EQ(GetAliasedResources(textures, buffers), (std::set<size_t>{11, 12}));
+	EXPECT_TRUE(GetAliasedResources(textures, {}).empty());
+}
@@ -0,0 +1,95 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/RenderData.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace Ilum;
+
+namespace
+{
+std::vector<GPUScene::Instance> CreateInstances(uint32_t count)
+{
+	std::vector<GPUScene::Instance> instances(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		instances[i].transform = glm::mat4(static_cast<float>(i));
+		instances[i].mesh_id   = i;
+	}
+	return instances;
+}
+
+std::vector<GPUScene::Instance> ReadBack(RHIBuffer *buffer, size_t count)
+{
+	std::vector<GPUScene::Instance> instances(count);
+	buffer->CopyToHost(instances.data(), count * sizeof(GPUScene::Instance));
+	return instances;
+}
+}        // namespace
+
+TEST(GPUScene, RebuildUploadsEverything)
+{
+	RHIContext rhi_context(nullptr, "Null");
+
+	auto instances = CreateInstances(100);
+
+	std::unique_ptr<RHIBuffer> buffer;
+	EXPECT_EQ(UploadInstances(&rhi_context, buffer, instances, nullptr), instances.size() * sizeof(GPUScene::Instance));
+	ASSERT_NE(buffer, nullptr);
+
+	auto uploaded = ReadBack(buffer.get(), instances.size());
+	for (uint32_t i = 0; i < instances.size(); i++)
+	{
+		EXPECT_EQ(uploaded[i].mesh_id, i);
+	}
+
+	// Growing the scene reallocates, shrinking keeps the buffer
+	instances = CreateInstances(200);
+	UploadInstances(&rhi_context, buffer, instances, nullptr);
+	auto *grown = buffer.get();
+	EXPECT_GE(grown->GetDesc().size, 200 * sizeof(GPUScene::Instance));
+
+	instances.resize(50);
+	UploadInstances(&rhi_context, buffer, instances, nullptr);
+	EXPECT_EQ(buffer.get(), grown);
+}
+
+TEST(GPUScene, StaticSceneUploadsNothing)
+{
+	RHIContext rhi_context(nullptr, "Null");
+
+	auto instances = CreateInstances(100);
+
+	std::unique_ptr<RHIBuffer> buffer;
+	UploadInstances(&rhi_context, buffer, instances, nullptr);
+
+	std::vector<uint32_t> dirty;
+	EXPECT_EQ(UploadInstances(&rhi_context, buffer, instances, &dirty), 0u);
+}
+
+TEST(GPUScene, DirtyInstancesUploadMergedRanges)
+{
+	RHIContext rhi_context(nullptr, "Null");
+
+	auto instances = CreateInstances(100);
+
+	std::unique_ptr<RHIBuffer> buffer;
+	UploadInstances(&rhi_context, buffer, instances, nullptr);
+
+	// Move a run of three and two single instances
+	std::vector<uint32_t> dirty = {3, 4, 5, 42, 99};
+	for (auto &instance : instances)
+	{
+		instance.mesh_id += 1000;
+	}
+
+	EXPECT_EQ(UploadInstances(&rhi_context, buffer, instances, &dirty), dirty.size() * sizeof(GPUScene::Instance));
+
+	auto uploaded = ReadBack(buffer.get(), instances.size());
+	for (uint32_t i = 0; i < instances.size(); i++)
+	{
+		bool moved = std::find(dirty.begin(), dirty.end(), i) != dirty.end();
+		EXPECT_EQ(uploaded[i].mesh_id, moved ? i + 1000 : i) << "instance " << i;
+	}
+}
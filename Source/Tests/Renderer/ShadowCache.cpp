@@ -0,0 +1,209 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/ShadowCache.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+namespace
+{
+// Axis aligned box as a frustum, planes facing inwards
+Frustum BoxFrustum(const glm::vec3 &min, const glm::vec3 &max)
+{
+	Frustum frustum;
+	frustum.planes = {
+	    glm::vec4(1.f, 0.f, 0.f, -min.x),
+	    glm::vec4(-1.f, 0.f, 0.f, max.x),
+	    glm::vec4(0.f, 1.f, 0.f, -min.y),
+	    glm::vec4(0.f, -1.f, 0.f, max.y),
+	    glm::vec4(0.f, 0.f, 1.f, -min.z),
+	    glm::vec4(0.f, 0.f, -1.f, max.z),
+	};
+	return frustum;
+}
+
+GPUScene::InstanceBound CreateCaster(float x, uint32_t mesh_id, bool animated = false)
+{
+	GPUScene::InstanceBound bound;
+	bound.aabb     = AABB(glm::vec3(x, 0.f, 0.f), glm::vec3(x + 1.f, 1.f, 1.f));
+	bound.mesh_id  = mesh_id;
+	bound.animated = animated;
+	return bound;
+}
+
+// Four layers side by side along x, ten units wide each
+std::vector<ShadowLayerCache::Layer> CreateLayers()
+{
+	std::vector<ShadowLayerCache::Layer> layers;
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		float x = static_cast<float>(i) * 10.f;
+		layers.push_back(ShadowLayerCache::Layer{i, i, BoxFrustum(glm::vec3(x, -1.f, -1.f), glm::vec3(x + 10.f, 2.f, 2.f))});
+	}
+	return layers;
+}
+
+struct Frame
+{
+	std::vector<GPUScene::InstanceBound> bounds;
+
+	ShadowCasterHistory    history;
+	ShadowLayerCache       cache;
+	ShadowLayerCache::Plan plan;
+
+	void Update(const std::vector<ShadowLayerCache::Layer> &layers, float animation_time = 0.f)
+	{
+		history.Update(bounds);
+		cache.Update(layers, {ShadowLayerCache::Casters{&bounds, &history.GetDynamic()}}, animation_time, plan);
+	}
+};
+}        // namespace
+
+TEST(ShadowCache, StaticSceneIsOnlyDrawnOnce)
+{
+	auto layers = CreateLayers();
+
+	Frame frame;
+	frame.bounds = {CreateCaster(1.f, 0), CreateCaster(12.f, 1), CreateCaster(35.f, 2)};
+	frame.cache.Reset(4);
+
+	frame.Update(layers);
+	EXPECT_EQ(frame.plan.rebuild, std::vector<uint32_t>({0, 1, 2, 3}));
+	EXPECT_EQ(frame.plan.composite, std::vector<uint32_t>({0, 1, 2, 3}));
+	EXPECT_EQ(frame.plan.cached, 0);
+
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		frame.Update(layers);
+		EXPECT_TRUE(frame.plan.rebuild.empty());
+		EXPECT_TRUE(frame.plan.composite.empty());
+		EXPECT_EQ(frame.plan.cached, 4);
+	}
+}
+
+TEST(ShadowCache, MovingCasterOnlyCompositesItsLayers)
+{
+	auto layers = CreateLayers();
+
+	Frame frame;
+	frame.bounds = {CreateCaster(1.f, 0), CreateCaster(12.f, 1), CreateCaster(35.f, 2)};
+	frame.cache.Reset(4);
+	frame.Update(layers);
+
+	// Leaving the static set rebakes the layer once
+	frame.bounds[1] = CreateCaster(13.f, 1);
+	frame.Update(layers);
+	EXPECT_EQ(frame.plan.rebuild, std::vector<uint32_t>({1}));
+	EXPECT_EQ(frame.plan.composite, std::vector<uint32_t>({1}));
+
+	// Afterwards only its dynamic draw is redone
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		frame.bounds[1] = CreateCaster(14.f + static_cast<float>(i) * 0.5f, 1);
+		frame.Update(layers);
+		EXPECT_TRUE(frame.plan.rebuild.empty());
+		EXPECT_EQ(frame.plan.composite, std::vector<uint32_t>({1}));
+		EXPECT_EQ(frame.plan.cached, 3);
+	}
+
+	// Crossing into the next layer composites both, the one it left must lose its shadow
+	frame.bounds[1] = CreateCaster(19.5f, 1);
+	frame.Update(layers);
+	EXPECT_TRUE(frame.plan.rebuild.empty());
+	EXPECT_EQ(frame.plan.composite, std::vector<uint32_t>({1, 2}));
+
+	frame.bounds[1] = CreateCaster(22.f, 1);
+	frame.Update(layers);
+	EXPECT_TRUE(frame.plan.rebuild.empty());
+	EXPECT_EQ(frame.plan.composite, std::vector<uint32_t>({1, 2}));
+}
+
+TEST(ShadowCache, SettledCasterBecomesStatic)
+{
+	auto layers = CreateLayers();
+
+	Frame frame;
+	frame.bounds = {CreateCaster(1.f, 0), CreateCaster(12.f, 1)};
+	frame.cache.Reset(4);
+	frame.Update(layers);
+
+	frame.bounds[1] = CreateCaster(13.f, 1);
+	frame.Update(layers);
+	EXPECT_TRUE(frame.history.GetDynamic()[1]);
+
+	// Still dynamic, but unchanged, so nothing is drawn
+	for (uint32_t i = 1; i < ShadowCasterHistory::SettleFrames; i++)
+	{
+		frame.Update(layers);
+		EXPECT_TRUE(frame.history.GetDynamic()[1]);
+		EXPECT_TRUE(frame.plan.composite.empty());
+	}
+
+	// Joining the static set rebakes its layer once
+	frame.Update(layers);
+	EXPECT_FALSE(frame.history.GetDynamic()[1]);
+	EXPECT_EQ(frame.plan.rebuild, std::vector<uint32_t>({1}));
+
+	frame.Update(layers);
+	EXPECT_TRUE(frame.plan.composite.empty());
+	EXPECT_EQ(frame.plan.cached, 4);
+}
+
+TEST(ShadowCache, AnimatedCastersFollowTheAnimation)
+{
+	auto layers = CreateLayers();
+
+	Frame frame;
+	frame.bounds = {CreateCaster(1.f, 0), CreateCaster(31.f, 1, true)};
+	frame.cache.Reset(4);
+	frame.Update(layers, 0.f);
+
+	EXPECT_FALSE(frame.history.GetDynamic()[0]);
+	EXPECT_TRUE(frame.history.GetDynamic()[1]);
+
+	frame.Update(layers, 0.5f);
+	EXPECT_TRUE(frame.plan.rebuild.empty());
+	EXPECT_EQ(frame.plan.composite, std::vector<uint32_t>({3}));
+
+	// A paused animation keeps the cache
+	frame.Update(layers, 0.5f);
+	EXPECT_TRUE(frame.plan.composite.empty());
+}
+
+TEST(ShadowCache, LightChangesRebuildTheLayer)
+{
+	auto layers = CreateLayers();
+
+	Frame frame;
+	frame.bounds = {CreateCaster(1.f, 0)};
+	frame.cache.Reset(4);
+	frame.Update(layers);
+
+	layers[2].signature++;
+	frame.Update(layers);
+	EXPECT_EQ(frame.plan.rebuild, std::vector<uint32_t>({2}));
+	EXPECT_EQ(frame.plan.cached, 3);
+
+	// A new texture has undefined contents
+	frame.cache.Reset(4);
+	frame.Update(layers);
+	EXPECT_EQ(frame.plan.rebuild.size(), 4);
+}
+
+TEST(ShadowCache, LayoutChangesResetTheHistory)
+{
+	ShadowCasterHistory history;
+
+	std::vector<GPUScene::InstanceBound> bounds = {CreateCaster(0.f, 0), CreateCaster(2.f, 1)};
+	history.Update(bounds);
+
+	bounds[0] = CreateCaster(1.f, 0);
+	EXPECT_EQ(history.Update(bounds), std::vector<uint8_t>({1, 0}));
+
+	// Indices no longer refer to the same casters, nothing is known to move
+	bounds.push_back(CreateCaster(4.f, 2));
+	EXPECT_EQ(history.Update(bounds), std::vector<uint8_t>({0, 0, 0}));
+
+	bounds[0].mesh_id = 7;
+	EXPECT_EQ(history.Update(bounds), std::vector<uint8_t>({0, 0, 0}));
+}
@@ -0,0 +1,220 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/ShadowCulling.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+std::vector<GPUScene::InstanceBound> CreateBounds(uint32_t count, std::mt19937 &rng)
+{
+	std::uniform_real_distribution<float>   position(-100.f, 100.f);
+	std::uniform_real_distribution<float>   extent(0.1f, 10.f);
+	std::uniform_int_distribution<uint32_t> meshlets(0, 100);
+
+	std::vector<GPUScene::InstanceBound> bounds(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		glm::vec3 min           = glm::vec3(position(rng), position(rng), position(rng));
+		bounds[i].aabb          = AABB(min, min + glm::vec3(extent(rng), extent(rng), extent(rng)));
+		bounds[i].mesh_id       = i;
+		bounds[i].meshlet_count = meshlets(rng);
+	}
+	return bounds;
+}
+
+std::vector<ShadowView> CreateViews(std::mt19937 &rng)
+{
+	std::uniform_real_distribution<float> position(-50.f, 50.f);
+
+	std::vector<ShadowView> views;
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		Frustum frustum = CubeFaceFrustum(glm::vec3(position(rng), position(rng), position(rng)), i);
+		views.push_back(ShadowView{frustum.planes, i});
+	}
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		glm::mat4 view_projection = glm::perspective(glm::radians(60.f), 1.f, 0.1f, 50.f * static_cast<float>(i + 1)) *
+		                            glm::lookAt(glm::vec3(position(rng), position(rng), position(rng)), glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f));
+		views.push_back(ShadowView{Frustum(view_projection).planes, 6 + i});
+	}
+	return views;
+}
+
+// One box at a time and one meshlet at a time, then grouped as the task shader expects
+std::vector<ShadowTask> CullReference(const std::vector<ShadowView> &views, const std::vector<GPUScene::InstanceBound> &bounds)
+{
+	std::vector<ShadowTask> tasks;
+	for (uint32_t view_id = 0; view_id < views.size(); view_id++)
+	{
+		Frustum frustum;
+		frustum.planes = views[view_id].frustum;
+		for (uint32_t instance_id = 0; instance_id < bounds.size(); instance_id++)
+		{
+			if (!frustum.Intersect(bounds[instance_id].aabb))
+			{
+				continue;
+			}
+			for (uint32_t meshlet = 0; meshlet < bounds[instance_id].meshlet_count; meshlet++)
+			{
+				if (meshlet % ShadowTaskSize == 0)
+				{
+					tasks.push_back(ShadowTask{view_id, instance_id, meshlet, 0});
+				}
+				tasks.back().meshlet_count++;
+			}
+		}
+	}
+	return tasks;
+}
+
+bool operator==(const ShadowTask &lhs, const ShadowTask &rhs)
+{
+	return lhs.view_id == rhs.view_id && lhs.instance_id == rhs.instance_id && lhs.meshlet_offset == rhs.meshlet_offset && lhs.meshlet_count == rhs.meshlet_count;
+}
+
+// View projections of Source/Shaders/Shadow/OmniShadowMap.hlsl, applied to positions relative to the light
+glm::mat4 CubeFaceViewProjection(uint32_t face)
+{
+	const float data[6][16] = {
+	    {0, 0, 1.0001999f, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, -0.20002f, 0},
+	    {0, 0, -1.0001999f, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -0.20002f, 0},
+	    {1, 0, 0, 0, 0, 0, 1.0001999f, 1, 0, 1, 0, 0, 0, 0, -0.20002f, 0},
+	    {1, 0, 0, 0, 0, 0, -1.0001999f, -1, 0, -1, 0, 0, 0, 0, -0.20002f, 0},
+	    {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1.0001999f, -1, 0, 0, -0.20002f, 0},
+	    {-1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1.0001999f, 1, 0, 0, -0.20002f, 0},
+	};
+
+	// The shader multiplies by the transposed HLSL rows, which are the glm columns
+	glm::mat4 matrix;
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		matrix[i / 4][i % 4] = data[face][i];
+	}
+	return matrix;
+}
+}        // namespace
+
+TEST(ShadowCulling, MatchesScalarReference)
+{
+	std::mt19937 rng(11);
+
+	auto bounds = CreateBounds(500, rng);
+	auto views  = CreateViews(rng);
+
+	std::vector<ShadowTask> tasks;
+	CullShadowTasks(views, bounds, nullptr, 0, tasks);
+
+	auto reference = CullReference(views, bounds);
+	ASSERT_EQ(tasks.size(), reference.size());
+	for (size_t i = 0; i < tasks.size(); i++)
+	{
+		EXPECT_TRUE(tasks[i] == reference[i]) << "task " << i;
+	}
+
+	// Culling must leave a fraction of the dense meshlet x instance x view grid
+	uint32_t max_meshlet_count = 0;
+	for (auto &bound : bounds)
+	{
+		max_meshlet_count = std::max(max_meshlet_count, bound.meshlet_count);
+	}
+	size_t dense = (max_meshlet_count + ShadowTaskSize - 1) / ShadowTaskSize * bounds.size() * views.size();
+	EXPECT_LT(tasks.size(), dense);
+}
+
+TEST(ShadowCulling, DynamicFlagsSplitTheWork)
+{
+	std::mt19937 rng(13);
+
+	auto bounds = CreateBounds(300, rng);
+	auto views  = CreateViews(rng);
+
+	std::vector<uint8_t> dynamic(bounds.size());
+	for (size_t i = 0; i < dynamic.size(); i++)
+	{
+		dynamic[i] = i % 3 == 0;
+	}
+
+	std::vector<ShadowTask> all_tasks;
+	std::vector<ShadowTask> static_tasks;
+	std::vector<ShadowTask> dynamic_tasks;
+	CullShadowTasks(views, bounds, nullptr, 0, all_tasks);
+	CullShadowTasks(views, bounds, &dynamic, 0, static_tasks);
+	CullShadowTasks(views, bounds, &dynamic, 1, dynamic_tasks);
+
+	EXPECT_EQ(static_tasks.size() + dynamic_tasks.size(), all_tasks.size());
+	for (auto &task : static_tasks)
+	{
+		EXPECT_EQ(dynamic[task.instance_id], 0);
+	}
+	for (auto &task : dynamic_tasks)
+	{
+		EXPECT_EQ(dynamic[task.instance_id], 1);
+	}
+}
+
+TEST(ShadowCulling, EmptyInputs)
+{
+	std::mt19937 rng(17);
+
+	std::vector<ShadowTask> tasks = {ShadowTask{}};
+	CullShadowTasks(CreateViews(rng), {}, nullptr, 0, tasks);
+	EXPECT_TRUE(tasks.empty());
+
+	CullShadowTasks({}, CreateBounds(10, rng), nullptr, 0, tasks);
+	EXPECT_TRUE(tasks.empty());
+}
+
+TEST(ShadowCulling, CubeFacesMatchShaderProjections)
+{
+	std::mt19937                          rng(19);
+	std::normal_distribution<float>       direction(0.f, 1.f);
+	std::uniform_real_distribution<float> distance(1.f, 500.f);
+
+	glm::vec3 light = glm::vec3(3.f, -2.f, 5.f);
+
+	std::array<Frustum, 6> faces;
+	std::array<Frustum, 6> references;
+	for (uint32_t face = 0; face < 6; face++)
+	{
+		faces[face] = CubeFaceFrustum(light, face);
+
+		// Planes of the light relative projection, moved to world space
+		references[face] = Frustum(CubeFaceViewProjection(face));
+		for (auto &plane : references[face].planes)
+		{
+			plane.w -= glm::dot(glm::vec3(plane), light);
+		}
+	}
+
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		glm::vec3 point = light + glm::normalize(glm::vec3(direction(rng), direction(rng), direction(rng))) * distance(rng);
+
+		bool covered = false;
+		for (uint32_t face = 0; face < 6; face++)
+		{
+			// Points on a face edge may land on either side
+			float margin = std::numeric_limits<float>::max();
+			for (auto &plane : faces[face].planes)
+			{
+				margin = std::min(margin, std::abs(glm::dot(glm::vec3(plane), point) + plane.w));
+			}
+			if (margin < 1e-2f)
+			{
+				covered = true;
+				continue;
+			}
+
+			bool inside = faces[face].Intersect(AABB(point, point));
+			EXPECT_EQ(inside, references[face].Intersect(AABB(point, point))) << "face " << face;
+			covered |= inside;
+		}
+		EXPECT_TRUE(covered);
+	}
+}
@@ -0,0 +1,142 @@
+#include <RHI/RHIContext.hpp>
+#include <Renderer/RenderData.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+namespace
+{
+using SkinningEntry = GPUScene::AnimationBuffer::SkinningEntry;
+
+// Mirrors the lookup in Source/Shaders/UpdateBoneMatrics.hlsl, returns false for threads no entry evaluates
+bool FindEntry(const std::vector<SkinningEntry> &table, uint32_t thread_id, uint32_t &animation_id, uint32_t &bone_id)
+{
+	if (table.empty())
+	{
+		return false;
+	}
+
+	uint32_t begin = 0;
+	uint32_t end   = static_cast<uint32_t>(table.size());
+	while (begin + 1 < end)
+	{
+		uint32_t mid = (begin + end) / 2;
+		if (table[mid].offset <= thread_id)
+		{
+			begin = mid;
+		}
+		else
+		{
+			end = mid;
+		}
+	}
+
+	auto &entry = table[begin];
+	if (thread_id < entry.offset || thread_id - entry.offset >= entry.bone_count)
+	{
+		return false;
+	}
+
+	animation_id = entry.animation_id;
+	bone_id      = thread_id - entry.offset;
+	return true;
+}
+}        // namespace
+
+TEST(Skinning, TableHasOneEntryPerAnimation)
+{
+	std::vector<SkinningEntry> table;
+
+	uint32_t thread_count = BuildSkinningTable({4, 0, 10, 3}, {30, 30, 0, 1}, table);
+
+	ASSERT_EQ(table.size(), 4);
+	EXPECT_EQ(thread_count, 7);
+	EXPECT_TRUE(ValidateSkinningTable(table, thread_count));
+
+	for (uint32_t i = 0; i < table.size(); i++)
+	{
+		EXPECT_EQ(table[i].animation_id, i);
+	}
+
+	// Clips without bones or frames keep their slot with an empty palette range
+	EXPECT_EQ(table[0].offset, 0);
+	EXPECT_EQ(table[0].bone_count, 4);
+	EXPECT_EQ(table[1].bone_count, 0);
+	EXPECT_EQ(table[2].bone_count, 0);
+	EXPECT_EQ(table[3].offset, 4);
+	EXPECT_EQ(table[3].bone_count, 3);
+}
+
+TEST(Skinning, EveryPaletteMatrixHasOneWriter)
+{
+	std::vector<uint32_t> bone_counts  = {1, 0, 64, 65, 0, 0, 3, 128, 7};
+	std::vector<uint32_t> frame_counts = {1, 9, 30, 30, 0, 2, 0, 60, 1};
+
+	std::vector<SkinningEntry> table;
+
+	uint32_t thread_count = BuildSkinningTable(bone_counts, frame_counts, table);
+	ASSERT_TRUE(ValidateSkinningTable(table, thread_count));
+
+	// Threads past the palette belong to the last, partially filled group
+	std::vector<uint32_t> writers(thread_count, 0);
+	for (uint32_t thread_id = 0; thread_id < thread_count + 64; thread_id++)
+	{
+		uint32_t animation_id = 0;
+		uint32_t bone_id      = 0;
+		if (!FindEntry(table, thread_id, animation_id, bone_id))
+		{
+			EXPECT_GE(thread_id, thread_count);
+			continue;
+		}
+
+		ASSERT_LT(thread_id, thread_count);
+		EXPECT_LT(bone_id, bone_counts[animation_id]);
+		EXPECT_GT(frame_counts[animation_id], 0);
+		EXPECT_EQ(table[animation_id].offset + bone_id, thread_id);
+		writers[thread_id]++;
+	}
+
+	for (auto count : writers)
+	{
+		EXPECT_EQ(count, 1);
+	}
+}
+
+TEST(Skinning, EmptyTable)
+{
+	std::vector<SkinningEntry> table = {{}};
+
+	EXPECT_EQ(BuildSkinningTable({}, {}, table), 0);
+	EXPECT_TRUE(table.empty());
+	EXPECT_TRUE(ValidateSkinningTable(table, 0));
+	EXPECT_FALSE(ValidateSkinningTable(table, 1));
+}
+
+TEST(Skinning, ValidationRejectsBrokenTables)
+{
+	std::vector<SkinningEntry> table;
+
+	uint32_t thread_count = BuildSkinningTable({4, 5, 6}, {1, 1, 1}, table);
+	ASSERT_TRUE(ValidateSkinningTable(table, thread_count));
+
+	{
+		auto broken = table;
+		broken[1].offset++;
+		EXPECT_FALSE(ValidateSkinningTable(broken, thread_count));
+	}
+
+	{
+		auto broken = table;
+		std::swap(broken[0].animation_id, broken[1].animation_id);
+		EXPECT_FALSE(ValidateSkinningTable(broken, thread_count));
+	}
+
+	{
+		auto broken           = table;
+		broken[2].frame_count = 0;
+		EXPECT_FALSE(ValidateSkinningTable(broken, thread_count));
+	}
+
+	EXPECT_FALSE(ValidateSkinningTable(table, thread_count + 1));
+}
@@ -0,0 +1,237 @@
+#include <RHI/RHIContext.hpp>
+#include <RHI/RHITexture.hpp>
+#include <Resource/Resource/Animation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <random>
+
+using namespace Ilum;
+
+namespace
+{
+// Uneven key times with a few duplicated timestamps
+std::vector<float> CreateTimeStamps(size_t count, uint32_t seed)
+{
+	std::mt19937                          rng(seed);
+	std::uniform_real_distribution<float> dist(0.f, 0.1f);
+
+	std::vector<float> time_stamps = {0.f};
+	while (time_stamps.size() < count)
+	{
+		time_stamps.push_back(time_stamps.back() + (time_stamps.size() % 17 == 0 ? 0.f : dist(rng)));
+	}
+	return time_stamps;
+}
+
+Bone CreateBone(const std::vector<float> &time_stamps)
+{
+	std::vector<Bone::KeyPosition> positions;
+	std::vector<Bone::KeyRotation> rotations;
+	std::vector<Bone::KeyScale>    scales;
+	for (auto time : time_stamps)
+	{
+		positions.push_back(Bone::KeyPosition{glm::vec3(glm::sin(time), time, 1.f), time});
+		rotations.push_back(Bone::KeyRotation{glm::angleAxis(time, glm::normalize(glm::vec3(1.f, 2.f, 3.f))), time});
+		scales.push_back(Bone::KeyScale{glm::vec3(1.f + 0.1f * glm::cos(time)), time});
+	}
+	return Bone("Bone", 0, glm::mat4(1.f), std::move(positions), std::move(rotations), std::move(scales));
+}
+
+// What the lookup used to do, scan for the last interval starting at or before time
+size_t FindKeyIndexLinear(const std::vector<float> &time_stamps, float time)
+{
+	size_t index = 0;
+	for (size_t i = 1; i + 1 < time_stamps.size(); i++)
+	{
+		if (time_stamps[i] <= time)
+		{
+			index = i;
+		}
+	}
+	return index;
+}
+
+// Chain of bones one unit apart, every joint swinging around z at its own frequency, 30 keys per second
+std::vector<Bone> CreateChain(uint32_t count, float length, HierarchyNode &hierarchy)
+{
+	std::vector<Bone> bones;
+
+	HierarchyNode *node = &hierarchy;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::vector<Bone::KeyPosition> positions;
+		std::vector<Bone::KeyRotation> rotations;
+		std::vector<Bone::KeyScale>    scales;
+		for (float time = 0.f; time <= length; time += 1.f / 30.f)
+		{
+			positions.push_back(Bone::KeyPosition{glm::vec3(0.f, i == 0 ? 0.f : 1.f, 0.f), time});
+			rotations.push_back(Bone::KeyRotation{glm::angleAxis(0.3f * glm::sin(time * (1.f + 0.2f * static_cast<float>(i))), glm::vec3(0.f, 0.f, 1.f)), time});
+			scales.push_back(Bone::KeyScale{glm::vec3(1.f), time});
+		}
+
+		std::string name = fmt::format("Bone{}", i);
+		bones.emplace_back(name, i, glm::mat4(1.f), std::move(positions), std::move(rotations), std::move(scales));
+
+		if (i > 0)
+		{
+			node = &node->children.emplace_back();
+		}
+		node->name      = name;
+		node->transform = glm::translate(glm::mat4(1.f), glm::vec3(0.f, i == 0 ? 0.f : 1.f, 0.f));
+	}
+
+	return bones;
+}
+
+glm::vec3 GetEndEffector(const std::vector<Bone> &bones, float time)
+{
+	glm::mat4 transform = glm::mat4(1.f);
+	for (auto &bone : bones)
+	{
+		transform = transform * bone.GetLocalTransform(time);
+	}
+	return glm::vec3(transform[3]);
+}
+
+size_t GetKeyCount(const std::vector<Bone> &bones)
+{
+	size_t count = 0;
+	for (auto &bone : bones)
+	{
+		count += bone.GetKeyCount();
+	}
+	return count;
+}
+
+bool Equal(const glm::mat4 &lhs, const glm::mat4 &rhs)
+{
+	for (int32_t i = 0; i < 4; i++)
+	{
+		for (int32_t j = 0; j < 4; j++)
+		{
+			if (std::abs(lhs[i][j] - rhs[i][j]) > 1e-5f)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+}        // namespace
+
+TEST(Animation, KeyIndexMatchesLinearScan)
+{
+	auto time_stamps = CreateTimeStamps(500, 7);
+	Bone bone        = CreateBone(time_stamps);
+
+	std::mt19937                          rng(7);
+	std::uniform_real_distribution<float> dist(-1.f, time_stamps.back() + 1.f);
+
+	// Random seeks through a cursor exercise the binary search fallback
+	size_t cursor = 0;
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		float time = i % 5 == 0 ? time_stamps[rng() % time_stamps.size()] : dist(rng);
+		EXPECT_EQ(bone.GetPositionIndex(time), FindKeyIndexLinear(time_stamps, time)) << "time " << time;
+		EXPECT_EQ(bone.GetRotationIndex(time, &cursor), FindKeyIndexLinear(time_stamps, time)) << "time " << time;
+	}
+}
+
+TEST(Animation, CursorMatchesStatelessSampling)
+{
+	auto time_stamps = CreateTimeStamps(200, 11);
+	Bone bone        = CreateBone(time_stamps);
+
+	// Forward playback at 30 fps past the end, then once more from the start
+	Bone::Cursor cursor = {};
+	for (uint32_t loop = 0; loop < 2; loop++)
+	{
+		for (float time = 0.f; time < time_stamps.back() + 0.5f; time += 1.f / 30.f)
+		{
+			EXPECT_TRUE(Equal(bone.GetLocalTransform(time, &cursor), bone.GetLocalTransform(time))) << "time " << time;
+			EXPECT_EQ(cursor.position, FindKeyIndexLinear(time_stamps, time));
+		}
+	}
+}
+
+TEST(Animation, SampleMatchesMatrixProducts)
+{
+	auto time_stamps = CreateTimeStamps(50, 13);
+	Bone bone        = CreateBone(time_stamps);
+
+	for (float time = -0.5f; time < time_stamps.back() + 0.5f; time += 0.05f)
+	{
+		auto trs = bone.Sample(time);
+
+		glm::mat4 expected = glm::translate(glm::mat4(1.f), trs.translation) * glm::toMat4(trs.rotation) * glm::scale(glm::mat4(1.f), trs.scale);
+		EXPECT_TRUE(Equal(trs.GetMatrix(), expected)) << "time " << time;
+	}
+
+	// Times outside the clip clamp to the first and last keys
+	EXPECT_TRUE(Equal(bone.GetLocalTransform(-10.f), bone.GetLocalTransform(0.f)));
+	EXPECT_TRUE(Equal(bone.GetLocalTransform(time_stamps.back() + 10.f), bone.GetLocalTransform(time_stamps.back())));
+}
+
+TEST(Animation, CompressionDropsRedundantKeys)
+{
+	std::vector<Bone::KeyPosition> positions;
+	std::vector<Bone::KeyRotation> rotations;
+	std::vector<Bone::KeyScale>    scales;
+	for (float time = 0.f; time <= 10.f; time += 1.f / 30.f)
+	{
+		positions.push_back(Bone::KeyPosition{glm::vec3(time, 2.f * time, 0.f), time});
+		rotations.push_back(Bone::KeyRotation{glm::quat(1.f, 0.f, 0.f, 0.f), time});
+		scales.push_back(Bone::KeyScale{glm::vec3(2.f), time});
+	}
+
+	Bone bone      = Bone("Bone", 0, glm::mat4(1.f), std::move(positions), std::move(rotations), std::move(scales));
+	Bone reference = bone;
+
+	bone.Compress(1e-3f, 1.f);
+
+	// Linear motion keeps its end points, constant channels a single key
+	EXPECT_EQ(bone.GetKeyCount(), 4u);
+
+	for (float time = 0.f; time <= 10.f; time += 0.01f)
+	{
+		EXPECT_LE(glm::length(bone.Sample(time).translation - reference.Sample(time).translation), 1e-3f) << "time " << time;
+	}
+}
+
+TEST(Animation, CompressionBoundsEndEffectorError)
+{
+	RHIContext rhi_context(nullptr, "Null");
+
+	constexpr uint32_t BoneCount = 16;
+	constexpr float    Length    = 10.f;
+
+	HierarchyNode hierarchy;
+	auto          bones     = CreateChain(BoneCount, Length, hierarchy);
+	auto          reference = bones;
+
+	auto animation = std::make_unique<Resource<ResourceType::Animation>>(&rhi_context, "AnimationCompressionTest", std::move(bones), std::move(hierarchy));
+
+	const auto &compressed = animation->GetBones();
+	ASSERT_EQ(compressed.size(), reference.size());
+
+	float max_error = 0.f;
+	for (float time = 0.f; time <= Length; time += 1.f / 120.f)
+	{
+		max_error = glm::max(max_error, glm::length(GetEndEffector(compressed, time) - GetEndEffector(reference, time)));
+	}
+
+	float ratio = static_cast<float>(GetKeyCount(reference)) / static_cast<float>(GetKeyCount(compressed));
+
+	RecordProperty("CompressionRatio", std::to_string(ratio));
+	RecordProperty("MaxEndEffectorError", std::to_string(max_error));
+
+	// The reduction keeps joints within 1e-3 of the skeleton size, with slack for the small angle error model
+	float skeleton_size = static_cast<float>(BoneCount - 1);
+	EXPECT_LE(max_error, 2e-3f * skeleton_size);
+	EXPECT_GT(ratio, 2.f);
+
+	animation.reset();
+	std::filesystem::remove(fmt::format("Asset/Meta/AnimationCompressionTest.{}.asset", (uint32_t) ResourceType::Animation));
+}
@@ -0,0 +1,117 @@
+#include <RHI/RHITexture.hpp>
+#include <Resource/BinaryAsset.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+using namespace Ilum;
+
+namespace
+{
+std::string GetTempPath(const std::string &name)
+{
+	return (std::filesystem::temp_directory_path() / ("IlumTest" + name + ".bin")).string();
+}
+
+// Mesh-like asset with chunks of uneven sizes
+std::string WriteAsset(const std::string &name, std::vector<uint32_t> &indices, std::vector<uint8_t> &bytes)
+{
+	indices.resize(1001);
+	std::iota(indices.begin(), indices.end(), 0u);
+	bytes.resize(3);
+	std::iota(bytes.begin(), bytes.end(), uint8_t(7));
+
+	BinaryAsset binary;
+	binary.AddChunk(BinaryChunk::Index, indices);
+	binary.AddChunk(BinaryChunk::MeshletData, bytes);
+
+	std::string path = GetTempPath(name);
+	EXPECT_TRUE(binary.Save(path, ResourceType::Mesh));
+	return path;
+}
+
+template <typename T>
+void Patch(const std::string &path, size_t offset, const T &value)
+{
+	std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+	file.seekp(offset);
+	file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+}        // namespace
+
+TEST(BinaryAsset, ChunksRoundTripAligned)
+{
+	std::vector<uint32_t> indices;
+	std::vector<uint8_t>  bytes;
+	std::string           path = WriteAsset("RoundTrip", indices, bytes);
+
+	BinaryAsset binary;
+	ASSERT_TRUE(binary.Open(path, ResourceType::Mesh));
+
+	ASSERT_TRUE(binary.HasChunk(BinaryChunk::Index));
+	ASSERT_EQ(binary.GetChunkCount<uint32_t>(BinaryChunk::Index), indices.size());
+	EXPECT_EQ(std::memcmp(binary.GetChunkData(BinaryChunk::Index), indices.data(), indices.size() * sizeof(uint32_t)), 0);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(binary.GetChunkData(BinaryChunk::Index)) % BinaryAsset::Alignment, 0u);
+
+	ASSERT_EQ(binary.GetChunkSize(BinaryChunk::MeshletData), bytes.size());
+	EXPECT_EQ(std::memcmp(binary.GetChunkData(BinaryChunk::MeshletData), bytes.data(), bytes.size()), 0);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(binary.GetChunkData(BinaryChunk::MeshletData)) % BinaryAsset::Alignment, 0u);
+
+	EXPECT_FALSE(binary.HasChunk(BinaryChunk::Pixel));
+	EXPECT_EQ(binary.GetChunkData(BinaryChunk::Pixel), nullptr);
+
+	binary.Close();
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryAsset, RejectsOtherTypesAndVersions)
+{
+	std::vector<uint32_t> indices;
+	std::vector<uint8_t>  bytes;
+	std::string           path = WriteAsset("Version", indices, bytes);
+
+	EXPECT_FALSE(BinaryAsset().Open(path, ResourceType::Texture2D));
+
+	Patch(path, offsetof(BinaryAsset::Header, version), BinaryAsset::Version + 1);
+	EXPECT_FALSE(BinaryAsset().Open(path, ResourceType::Mesh));
+
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryAsset, RejectsChunkTableLargerThanFile)
+{
+	std::vector<uint32_t> indices;
+	std::vector<uint8_t>  bytes;
+	std::string           path = WriteAsset("ChunkCount", indices, bytes);
+
+	Patch(path, offsetof(BinaryAsset::Header, chunk_count), ~0u);
+	EXPECT_FALSE(BinaryAsset().Open(path, ResourceType::Mesh));
+
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryAsset, RejectsChunksWrappingAroundFileSize)
+{
+	std::vector<uint32_t> indices;
+	std::vector<uint8_t>  bytes;
+	std::string           path = WriteAsset("Overflow", indices, bytes);
+
+	// offset + size wraps to a small value that would pass a naive bounds check
+	uint64_t offset = ~uint64_t(0) & ~uint64_t(BinaryAsset::Alignment - 1);
+	uint64_t size   = 2 * BinaryAsset::Alignment;
+
+	size_t chunk = sizeof(BinaryAsset::Header);
+	Patch(path, chunk + offsetof(BinaryAsset::ChunkInfo, offset), offset);
+	Patch(path, chunk + offsetof(BinaryAsset::ChunkInfo, size), size);
+	EXPECT_FALSE(BinaryAsset().Open(path, ResourceType::Mesh));
+
+	// A size larger than the file is rejected on its own
+	Patch(path, chunk + offsetof(BinaryAsset::ChunkInfo, offset), uint64_t(BinaryAsset::Alignment));
+	Patch(path, chunk + offsetof(BinaryAsset::ChunkInfo, size), ~uint64_t(0));
+	EXPECT_FALSE(BinaryAsset().Open(path, ResourceType::Mesh));
+
+	std::filesystem::remove(path);
+}
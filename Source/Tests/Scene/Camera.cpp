@@ -0,0 +1,60 @@
+#include <Scene/Components/Camera/PerspectiveCamera.hpp>
+#include <Scene/Components/Transform.hpp>
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+namespace
+{
+bool Equal(const std::array<glm::vec4, 6> &lhs, const std::array<glm::vec4, 6> &rhs)
+{
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		if (glm::any(glm::greaterThan(glm::abs(lhs[i] - rhs[i]), glm::vec4(1e-5f))))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+}        // namespace
+
+TEST(Camera, FrustumFollowsCameraChanges)
+{
+	Scene scene;
+
+	auto *node      = scene.CreateNode();
+	auto *transform = node->AddComponent<Cmpt::Transform>(std::make_unique<Cmpt::Transform>(node));
+	auto *camera    = node->AddComponent<Cmpt::PerspectiveCamera>(std::make_unique<Cmpt::PerspectiveCamera>(node));
+
+	// Scene::Update clears the component update flags, the projection is only rebuilt while they are set
+	scene.Update();
+	camera->SetAspect(16.f / 9.f);
+
+	auto planes = camera->GetFrustumPlanes();
+	EXPECT_TRUE(Equal(planes, Frustum(camera->GetViewProjectionMatrix()).planes));
+
+	// Unchanged camera, same planes from the cache
+	EXPECT_EQ(&camera->GetFrustumPlanes(), &camera->GetFrustum().planes);
+	EXPECT_TRUE(Equal(camera->GetFrustumPlanes(), planes));
+
+	// Moving the camera
+	transform->SetTranslation(glm::vec3(0.f, 0.f, 10.f));
+	scene.Update();
+	EXPECT_FALSE(Equal(camera->GetFrustumPlanes(), planes));
+	EXPECT_TRUE(Equal(camera->GetFrustumPlanes(), Frustum(camera->GetViewProjectionMatrix()).planes));
+
+	// Changing the projection
+	planes = camera->GetFrustumPlanes();
+	camera->SetFov(90.f);
+	EXPECT_FALSE(Equal(camera->GetFrustumPlanes(), planes));
+	EXPECT_TRUE(Equal(camera->GetFrustumPlanes(), Frustum(camera->GetViewProjectionMatrix()).planes));
+
+	planes = camera->GetFrustumPlanes();
+	camera->SetFarPlane(50.f);
+	EXPECT_FALSE(Equal(camera->GetFrustumPlanes(), planes));
+	EXPECT_TRUE(Equal(camera->GetFrustumPlanes(), Frustum(camera->GetViewProjectionMatrix()).planes));
+}
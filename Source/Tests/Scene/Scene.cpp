@@ -0,0 +1,180 @@
+#include "AllocationCounter.hpp"
+
+#include <Scene/Components/AllComponents.hpp>
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace Ilum;
+
+namespace
+{
+Node *CreateLightNode(Scene &scene)
+{
+	auto *node = scene.CreateNode();
+	node->AddComponent<Cmpt::Transform>(std::make_unique<Cmpt::Transform>(node));
+	node->AddComponent<Cmpt::PointLight>(std::make_unique<Cmpt::PointLight>(node));
+	return node;
+}
+}        // namespace
+
+TEST(Scene, ComponentViewsTrackAddAndErase)
+{
+	Scene scene;
+
+	EXPECT_TRUE(scene.GetComponents<Cmpt::PointLight>().empty());
+
+	std::vector<Node *> nodes;
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		nodes.push_back(CreateLightNode(scene));
+	}
+
+	EXPECT_EQ(scene.GetComponents<Cmpt::Transform>().size(), 8u);
+	EXPECT_EQ(scene.GetComponents<Cmpt::PointLight>().size(), 8u);
+
+	// Erasing from the middle swaps the last component in, every remaining one is still reachable
+	scene.EraseNode(nodes[2]);
+	nodes[3]->EraseComponent<Cmpt::PointLight>();
+
+	auto lights = scene.GetComponents<Cmpt::PointLight>();
+	EXPECT_EQ(lights.size(), 6u);
+	for (auto *node : {nodes[0], nodes[1], nodes[4], nodes[5], nodes[6], nodes[7]})
+	{
+		EXPECT_NE(std::find(lights.begin(), lights.end(), node->GetComponent<Cmpt::PointLight>()), lights.end());
+	}
+
+	// A component removed after a swap can still be erased
+	nodes[7]->EraseComponent<Cmpt::PointLight>();
+	EXPECT_EQ(scene.GetComponents<Cmpt::PointLight>().size(), 5u);
+}
+
+TEST(Scene, WalkingComponentsDoesNotAllocate)
+{
+	Scene scene;
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		CreateLightNode(scene);
+	}
+
+	auto frame = [&scene]() {
+		size_t count = 0;
+		for (auto *transform : scene.GetComponents<Cmpt::Transform>())
+		{
+			count += transform->GetNode() != nullptr;
+		}
+		for (auto *light : scene.GetComponents<Cmpt::PointLight>())
+		{
+			count += light->GetNode() != nullptr;
+		}
+		count += scene.GetComponents<Cmpt::SpotLight>().size();
+		return count;
+	};
+
+	EXPECT_EQ(frame(), 2000u);
+
+	size_t allocations = Ilum::Test::GetAllocationCount();
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		frame();
+	}
+	EXPECT_EQ(Ilum::Test::GetAllocationCount(), allocations);
+}
+
+TEST(Scene, StaleHandlesAreRejected)
+{
+	Scene scene;
+
+	auto *node   = scene.CreateNode("A");
+	auto  handle = node->GetHandle();
+	EXPECT_EQ(scene.GetNode(handle), node);
+
+	scene.EraseNode(handle);
+	EXPECT_EQ(scene.GetNode(handle), nullptr);
+
+	// The slot is reused with a new generation, the old handle stays dead
+	auto *reused = scene.CreateNode("B");
+	EXPECT_EQ(reused->GetHandle().index, handle.index);
+	EXPECT_NE(reused->GetHandle(), handle);
+	EXPECT_EQ(scene.GetNode(handle), nullptr);
+	EXPECT_EQ(scene.GetNode(reused->GetHandle()), reused);
+
+	// Erasing twice through a stale handle is a no-op
+	scene.EraseNode(handle);
+	EXPECT_EQ(scene.GetNode(reused->GetHandle()), reused);
+
+	EXPECT_EQ(scene.GetNode(NodeHandle{}), nullptr);
+	EXPECT_EQ(scene.GetNode(NodeHandle{1000, 0}), nullptr);
+}
+
+TEST(Scene, EraseKeepsCreationOrder)
+{
+	Scene scene;
+
+	std::vector<Node *> roots;
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		roots.push_back(scene.CreateNode(std::to_string(i)));
+	}
+
+	// Under the compaction threshold and past it
+	std::vector<Node *> expected = roots;
+	for (uint32_t i : {1u, 4u, 5u, 6u, 7u, 8u})
+	{
+		scene.EraseNode(roots[i]);
+		expected.erase(std::find(expected.begin(), expected.end(), roots[i]));
+		EXPECT_EQ(scene.GetRoots(), expected);
+	}
+
+	std::vector<std::string> names;
+	for (auto *root : scene.GetRoots())
+	{
+		names.push_back(root->GetName());
+	}
+	EXPECT_EQ(names, (std::vector<std::string>{"0", "2", "3", "9"}));
+
+	// Surviving handles still resolve after compaction
+	for (auto *root : scene.GetRoots())
+	{
+		EXPECT_EQ(scene.GetNode(root->GetHandle()), root);
+	}
+}
+
+TEST(Scene, EraseRemovesWholeSubtree)
+{
+	Scene scene;
+
+	auto *root = scene.CreateNode("Root");
+	auto *keep = scene.CreateNode("Keep");
+
+	std::vector<NodeHandle> handles;
+	std::vector<Node *>     parents = {root};
+	for (uint32_t depth = 0; depth < 4; depth++)
+	{
+		std::vector<Node *> children;
+		for (auto *parent : parents)
+		{
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				auto *child = scene.CreateNode();
+				child->SetParent(parent);
+				handles.push_back(child->GetHandle());
+				children.push_back(child);
+			}
+		}
+		parents = std::move(children);
+	}
+
+	scene.EraseNode(root);
+
+	for (auto &handle : handles)
+	{
+		EXPECT_EQ(scene.GetNode(handle), nullptr);
+	}
+	ASSERT_EQ(scene.GetNodes().size(), 1u);
+	EXPECT_EQ(scene.GetNodes()[0].get(), keep);
+	EXPECT_EQ(scene.GetRoots(), std::vector<Node *>{keep});
+}
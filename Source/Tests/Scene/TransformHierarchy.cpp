@@ -0,0 +1,89 @@
+#include <Scene/Components/Transform.hpp>
+#include <Scene/Node.hpp>
+#include <Scene/Scene.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum;
+
+namespace
+{
+Cmpt::Transform *CreateTransformNode(Scene &scene, Node *parent)
+{
+	auto *node = scene.CreateNode();
+	node->SetParent(parent);
+	return node->AddComponent<Cmpt::Transform>(std::make_unique<Cmpt::Transform>(node));
+}
+
+bool Equal(const glm::mat4 &lhs, const glm::mat4 &rhs)
+{
+	for (int32_t i = 0; i < 4; i++)
+	{
+		for (int32_t j = 0; j < 4; j++)
+		{
+			if (std::abs(lhs[i][j] - rhs[i][j]) > 1e-4f)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+}        // namespace
+
+TEST(TransformHierarchy, MatchesRecursiveWorldTransforms)
+{
+	Scene scene;
+
+	// Chain of four under a root, plus a second root with one child
+	std::vector<Cmpt::Transform *> transforms = {CreateTransformNode(scene, nullptr)};
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		transforms.push_back(CreateTransformNode(scene, transforms.back()->GetNode()));
+		transforms.back()->SetTranslation(glm::vec3(1.f, 0.f, 0.f));
+		transforms.back()->SetRotation(glm::vec3(0.f, 30.f, 0.f));
+	}
+	auto *other = CreateTransformNode(scene, nullptr);
+	CreateTransformNode(scene, other->GetNode())->SetScale(glm::vec3(2.f));
+
+	transforms[0]->SetTranslation(glm::vec3(0.f, 5.f, 0.f));
+
+	scene.Update();
+
+	glm::mat4 world = glm::mat4(1.f);
+	for (auto *transform : transforms)
+	{
+		world = world * transform->GetLocalTransform();
+		EXPECT_TRUE(Equal(transform->GetWorldTransform(), world));
+	}
+}
+
+TEST(TransformHierarchy, ParentMovesBumpChildVersions)
+{
+	Scene scene;
+
+	auto *root    = CreateTransformNode(scene, nullptr);
+	auto *child   = CreateTransformNode(scene, root->GetNode());
+	auto *sibling = CreateTransformNode(scene, nullptr);
+
+	scene.Update();
+
+	uint64_t root_version    = root->GetVersion();
+	uint64_t child_version   = child->GetVersion();
+	uint64_t sibling_version = sibling->GetVersion();
+
+	// Nothing moved, nothing changes
+	scene.Update();
+	EXPECT_EQ(root->GetVersion(), root_version);
+	EXPECT_EQ(child->GetVersion(), child_version);
+
+	// Reading the version never resolves the hierarchy, the child catches up in Scene::Update
+	root->SetTranslation(glm::vec3(1.f, 2.f, 3.f));
+	EXPECT_GT(root->GetVersion(), root_version);
+	EXPECT_EQ(child->GetVersion(), child_version);
+
+	scene.Update();
+	EXPECT_GT(child->GetVersion(), child_version);
+	EXPECT_EQ(sibling->GetVersion(), sibling_version);
+	EXPECT_TRUE(Equal(child->GetWorldTransform(), root->GetWorldTransform()));
+}
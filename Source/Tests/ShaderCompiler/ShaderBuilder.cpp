@@ -0,0 +1,110 @@
+#include <ShaderCompiler/ShaderBuilder.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Ilum;
+
+TEST(ShaderBuilder, EnumeratesEveryMacroCombinationInAxisOrder)
+{
+	ShaderVariants variants = {
+	    ShaderPermutation{"Source/Shaders/Test.hlsl", "CSmain", RHIShaderStage::Compute, {"BASE"}},
+	    {{"HAS_A", "NO_A"}, {"LOW", "MEDIUM", "HIGH"}}};
+
+	auto permutations = ShaderBuilder::EnumeratePermutations(variants);
+	ASSERT_EQ(permutations.size(), 6u);
+
+	std::set<std::vector<std::string>> macros;
+	for (auto &permutation : permutations)
+	{
+		EXPECT_EQ(permutation.filename, "Source/Shaders/Test.hlsl");
+		EXPECT_EQ(permutation.entry_point, "CSmain");
+		ASSERT_EQ(permutation.macros.size(), 3u);
+		EXPECT_EQ(permutation.macros[0], "BASE");
+		macros.insert(permutation.macros);
+	}
+	EXPECT_EQ(macros.size(), 6u);
+	EXPECT_EQ(macros.count({"BASE", "NO_A", "HIGH"}), 1u);
+
+	// The permutation a pass requires at runtime hashes to the enumerated one
+	ShaderPermutation required = {"Source/Shaders/Test.hlsl", "CSmain", RHIShaderStage::Compute, {"BASE", "HAS_A", "LOW"}};
+	EXPECT_TRUE(std::any_of(permutations.begin(), permutations.end(), [&](const ShaderPermutation &permutation) { return permutation.Hash() == required.Hash(); }));
+}
+
+TEST(ShaderBuilder, MaterialShadersAppendSignatureAndInclude)
+{
+	ShaderVariants variants = {
+	    ShaderPermutation{"Source/Shaders/Test.hlsl", "ClosesthitMain", RHIShaderStage::ClosestHit, {"CLOSESTHIT_SHADER"}},
+	    {{"USE_SKYBOX", "NO_SKYBOX"}},
+	    true};
+
+	EXPECT_TRUE(ShaderBuilder::EnumeratePermutations(variants).empty());
+
+	std::vector<MaterialShader> materials = {{"Signature_1", "A.material.hlsli"}, {"Signature_2", "B.material.hlsli"}};
+
+	auto permutations = ShaderBuilder::EnumeratePermutations(variants, materials);
+	ASSERT_EQ(permutations.size(), 4u);
+	for (auto &permutation : permutations)
+	{
+		ASSERT_EQ(permutation.macros.size(), 3u);
+		ASSERT_EQ(permutation.includes.size(), 1u);
+		EXPECT_EQ(permutation.macros[2], permutation.includes[0] == "A.material.hlsli" ? "Signature_1" : "Signature_2");
+	}
+}
+
+TEST(ShaderBuilder, MaterialShadersComeFromMaterialGraphOutputs)
+{
+	auto directory = std::filesystem::temp_directory_path() / "IlumTestMaterialShaders";
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+
+	const std::string shader = "BSDF Evaluate() { return Lambertian(); }";
+	for (auto name : {"Wood.material.hlsli", "Metal.material.hlsli"})
+	{
+		std::ofstream(directory / name, std::ios::binary) << shader << name;
+	}
+	std::ofstream(directory / "Readme.txt") << "not a material";
+
+	auto materials = ShaderBuilder::GetMaterialShaders(directory.generic_string());
+	ASSERT_EQ(materials.size(), 2u);
+	EXPECT_EQ(materials[0].shader, "Metal.material.hlsli");
+	EXPECT_EQ(materials[1].shader, "Wood.material.hlsli");
+
+	// Material compilation names the signature after the hash of the generated source
+	EXPECT_EQ(materials[1].signature, fmt::format("Signature_{}", Hash(shader + "Wood.material.hlsli")));
+
+	EXPECT_TRUE(ShaderBuilder::GetMaterialShaders((directory / "Missing").generic_string()).empty());
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST(ShaderBuilder, TimingReportGroupsPermutationsByEntryPoint)
+{
+	ShaderPermutation blur    = {"Source/Shaders/Blur.hlsl", "CSmain", RHIShaderStage::Compute};
+	ShaderPermutation shading = {"Source/Shaders/Shading.hlsl", "PSmain", RHIShaderStage::Fragment};
+
+	std::vector<ShaderCompileResult> results = {
+	    {blur, 10.f, true},
+	    {shading, 40.f, true},
+	    {blur, 30.f, false},
+	    {shading, 5.f, true},
+	    {shading, 20.f, true},
+	};
+
+	auto timings = ShaderBuilder::SummarizeCompileResults(results);
+	ASSERT_EQ(timings.size(), 2u);
+
+	EXPECT_EQ(timings[0].name, "Source/Shaders/Shading.hlsl.PSmain");
+	EXPECT_EQ(timings[0].permutations, 3u);
+	EXPECT_EQ(timings[0].failed, 0u);
+	EXPECT_FLOAT_EQ(timings[0].total_time, 65.f);
+	EXPECT_FLOAT_EQ(timings[0].max_time, 40.f);
+
+	EXPECT_EQ(timings[1].name, "Source/Shaders/Blur.hlsl.CSmain");
+	EXPECT_EQ(timings[1].permutations, 2u);
+	EXPECT_EQ(timings[1].failed, 1u);
+	EXPECT_FLOAT_EQ(timings[1].total_time, 40.f);
+	EXPECT_FLOAT_EQ(timings[1].max_time, 30.f);
+}
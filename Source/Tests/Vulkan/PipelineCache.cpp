@@ -0,0 +1,108 @@
+#include <Vulkan/PipelineCache.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum::Vulkan;
+
+namespace
+{
+VkPhysicalDeviceProperties CreateProperties()
+{
+	VkPhysicalDeviceProperties properties = {};
+	properties.vendorID                   = 0x10de;
+	properties.deviceID                   = 0x2484;
+	for (uint32_t i = 0; i < VK_UUID_SIZE; i++)
+	{
+		properties.pipelineCacheUUID[i] = static_cast<uint8_t>(i * 7 + 1);
+	}
+	return properties;
+}
+
+// Header as the driver writes it, followed by an opaque payload
+std::vector<uint8_t> CreateCacheData(const VkPhysicalDeviceProperties &properties, size_t payload_size = 256)
+{
+	VkPipelineCacheHeaderVersionOne header = {};
+	header.headerSize                      = sizeof(header);
+	header.headerVersion                   = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+	header.vendorID                        = properties.vendorID;
+	header.deviceID                        = properties.deviceID;
+	std::memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+	std::vector<uint8_t> data(sizeof(header) + payload_size, 0xcd);
+	std::memcpy(data.data(), &header, sizeof(header));
+	return data;
+}
+
+VkPipelineCacheHeaderVersionOne &GetHeader(std::vector<uint8_t> &data)
+{
+	return *reinterpret_cast<VkPipelineCacheHeaderVersionOne *>(data.data());
+}
+}        // namespace
+
+TEST(PipelineCache, AcceptsDataOfTheSameDevice)
+{
+	auto properties = CreateProperties();
+	EXPECT_TRUE(ValidatePipelineCacheData(CreateCacheData(properties), properties));
+	EXPECT_TRUE(ValidatePipelineCacheData(CreateCacheData(properties, 0), properties));
+}
+
+TEST(PipelineCache, RejectsTruncatedHeader)
+{
+	auto properties = CreateProperties();
+	auto data       = CreateCacheData(properties, 0);
+
+	EXPECT_FALSE(ValidatePipelineCacheData({}, properties));
+
+	data.resize(sizeof(VkPipelineCacheHeaderVersionOne) - 1);
+	EXPECT_FALSE(ValidatePipelineCacheData(data, properties));
+}
+
+TEST(PipelineCache, RejectsInconsistentHeaderSize)
+{
+	auto properties = CreateProperties();
+	auto data       = CreateCacheData(properties);
+
+	// Claims more bytes than the file holds
+	GetHeader(data).headerSize = static_cast<uint32_t>(data.size() + 1);
+	EXPECT_FALSE(ValidatePipelineCacheData(data, properties));
+
+	GetHeader(data).headerSize = sizeof(VkPipelineCacheHeaderVersionOne) - 1;
+	EXPECT_FALSE(ValidatePipelineCacheData(data, properties));
+}
+
+TEST(PipelineCache, RejectsWrongHeaderVersion)
+{
+	auto properties = CreateProperties();
+	auto data       = CreateCacheData(properties);
+
+	GetHeader(data).headerVersion = static_cast<VkPipelineCacheHeaderVersion>(VK_PIPELINE_CACHE_HEADER_VERSION_ONE + 1);
+	EXPECT_FALSE(ValidatePipelineCacheData(data, properties));
+}
+
+TEST(PipelineCache, RejectsOtherVendorOrDevice)
+{
+	auto properties = CreateProperties();
+	auto data       = CreateCacheData(properties);
+
+	auto other_vendor     = properties;
+	other_vendor.vendorID = 0x1002;
+	EXPECT_FALSE(ValidatePipelineCacheData(data, other_vendor));
+
+	auto other_device     = properties;
+	other_device.deviceID = properties.deviceID + 1;
+	EXPECT_FALSE(ValidatePipelineCacheData(data, other_device));
+}
+
+TEST(PipelineCache, RejectsOtherDriverUUID)
+{
+	auto properties = CreateProperties();
+	auto data       = CreateCacheData(properties);
+
+	// A driver update changes the UUID while vendor and device stay the same
+	for (uint32_t i = 0; i < VK_UUID_SIZE; i += 5)
+	{
+		auto other_driver = properties;
+		other_driver.pipelineCacheUUID[i] ^= 0xff;
+		EXPECT_FALSE(ValidatePipelineCacheData(data, other_driver));
+	}
+}
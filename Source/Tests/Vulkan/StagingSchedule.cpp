@@ -0,0 +1,144 @@
+#include <Vulkan/StagingSchedule.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Ilum::Vulkan;
+
+namespace
+{
+constexpr uint64_t BufferA = 1;
+constexpr uint64_t BufferB = 2;
+}        // namespace
+
+TEST(StagingSchedule, AllocationsAreAlignedAndNeverWrap)
+{
+	StagingSchedule schedule(256, 16);
+
+	size_t offset = 0;
+	EXPECT_TRUE(schedule.Allocate(100, offset));
+	EXPECT_EQ(offset, 0u);
+	EXPECT_TRUE(schedule.Allocate(100, offset));
+	EXPECT_EQ(offset, 112u);
+	EXPECT_EQ(schedule.GetUsedSize(), 224u);
+
+	// 32 bytes are left before the end, the next allocation starts over at 0 once the first batch retires
+	uint64_t value = schedule.Submit();
+	EXPECT_FALSE(schedule.Allocate(100, offset));
+
+	schedule.Retire(value - 1);
+	EXPECT_FALSE(schedule.Allocate(100, offset));
+
+	schedule.Retire(value);
+	EXPECT_EQ(schedule.GetUsedSize(), 0u);
+	EXPECT_TRUE(schedule.Allocate(100, offset));
+	EXPECT_EQ(offset, 0u);
+}
+
+TEST(StagingSchedule, FullRingWaitsForTheOldestBatch)
+{
+	StagingSchedule schedule(256, 16);
+
+	size_t offset = 0;
+	EXPECT_EQ(schedule.GetOldestValue(), 0u);
+
+	ASSERT_TRUE(schedule.Allocate(128, offset));
+	uint64_t first = schedule.Submit();
+	ASSERT_TRUE(schedule.Allocate(128, offset));
+	uint64_t second = schedule.Submit();
+
+	EXPECT_FALSE(schedule.Allocate(16, offset));
+	EXPECT_EQ(schedule.GetOldestValue(), first);
+
+	schedule.Retire(first);
+	EXPECT_EQ(schedule.GetOldestValue(), second);
+	EXPECT_TRUE(schedule.Allocate(16, offset));
+	EXPECT_EQ(offset, 0u);
+}
+
+TEST(StagingSchedule, DirtySpansOnlyCoverUnsubmittedMemory)
+{
+	StagingSchedule schedule(256, 16);
+
+	EXPECT_TRUE(schedule.GetDirtySpans().empty());
+
+	size_t offset = 0;
+	ASSERT_TRUE(schedule.Allocate(160, offset));
+	auto spans = schedule.GetDirtySpans();
+	ASSERT_EQ(spans.size(), 1u);
+	EXPECT_EQ(spans[0].offset, 0u);
+	EXPECT_EQ(spans[0].size, 160u);
+
+	schedule.Retire(schedule.Submit());
+	EXPECT_TRUE(schedule.GetDirtySpans().empty());
+
+	// 64 bytes at the end, then 128 bytes that do not fit before the end and start over at 0
+	ASSERT_TRUE(schedule.Allocate(64, offset));
+	EXPECT_EQ(offset, 160u);
+	ASSERT_TRUE(schedule.Allocate(128, offset));
+	EXPECT_EQ(offset, 0u);
+
+	spans = schedule.GetDirtySpans();
+	ASSERT_EQ(spans.size(), 2u);
+	EXPECT_EQ(spans[0].offset, 160u);
+	EXPECT_EQ(spans[0].size, 96u);
+	EXPECT_EQ(spans[1].offset, 0u);
+	EXPECT_EQ(spans[1].size, 128u);
+}
+
+TEST(StagingSchedule, OverlappingCopiesInOneBatchAreOrdered)
+{
+	StagingSchedule schedule(256, 16);
+
+	EXPECT_FALSE(schedule.Write(BufferA, 0, 64));
+	EXPECT_FALSE(schedule.Write(BufferA, 64, 64));
+	EXPECT_FALSE(schedule.Write(BufferB, 0, 64));
+	EXPECT_TRUE(schedule.Write(BufferA, 32, 64));
+}
+
+TEST(StagingSchedule, OverlappingCopiesAcrossBatchesAreOrderedUntilRetired)
+{
+	StagingSchedule schedule(256, 16);
+
+	EXPECT_FALSE(schedule.Write(BufferA, 0, 64));
+	uint64_t first = schedule.Submit();
+
+	// The first batch may still be copying into the same range
+	EXPECT_TRUE(schedule.Write(BufferA, 32, 16));
+	EXPECT_FALSE(schedule.Write(BufferA, 64, 16));
+	uint64_t second = schedule.Submit();
+
+	schedule.Retire(first);
+	EXPECT_FALSE(schedule.Write(BufferA, 0, 16));
+	EXPECT_TRUE(schedule.Write(BufferA, 32, 16));
+
+	schedule.Submit();
+	schedule.Retire(second + 1);
+	EXPECT_FALSE(schedule.Write(BufferA, 0, 128));
+}
+
+TEST(StagingSchedule, DiscardAndRewindReleasePendingCopies)
+{
+	StagingSchedule schedule(256, 16);
+
+	size_t offset = 0;
+	ASSERT_TRUE(schedule.Allocate(64, offset));
+	schedule.Write(BufferA, 0, 64);
+	uint64_t value = schedule.Submit();
+
+	ASSERT_TRUE(schedule.Allocate(64, offset));
+	schedule.Write(BufferA, 64, 64);
+	schedule.Write(BufferB, 0, 64);
+
+	EXPECT_TRUE(schedule.Discard(BufferB));
+	EXPECT_FALSE(schedule.Discard(BufferB));
+
+	// Nothing pending is left, so the staged memory and ranges go back but the in flight batch stays tracked
+	schedule.Rewind();
+	EXPECT_TRUE(schedule.GetDirtySpans().empty());
+	EXPECT_EQ(schedule.GetUsedSize(), 64u);
+	EXPECT_FALSE(schedule.Write(BufferA, 64, 64));
+	EXPECT_TRUE(schedule.Write(BufferA, 0, 16));
+
+	schedule.Retire(value);
+	EXPECT_EQ(schedule.GetUsedSize(), 0u);
+}
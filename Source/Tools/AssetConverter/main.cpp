@@ -0,0 +1,140 @@
+#include <Core/Core.hpp>
+#include <Resource/BinaryAsset.hpp>
+#include <Resource/Resource/Mesh.hpp>
+
+#include <RHI/RHITexture.hpp>
+
+using namespace Ilum;
+
+using Clock = std::chrono::high_resolution_clock;
+
+inline float Elapsed(Clock::time_point start)
+{
+	return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+}
+
+// Deserialize the whole cereal asset, as loading did before binary assets
+float LoadLegacy(const std::string &name, ResourceType type, size_t &bytes)
+{
+	std::string path  = fmt::format("Asset/Meta/{}.{}.asset", name, (uint32_t) type);
+	auto        start = Clock::now();
+
+	std::vector<uint8_t> thumbnail_data;
+	if (type == ResourceType::Mesh)
+	{
+		std::vector<Resource<ResourceType::Mesh>::Vertex> vertices;
+		std::vector<uint32_t>                             indices;
+		std::vector<Meshlet>                              meshlets;
+		std::vector<uint32_t>                             meshlet_data;
+
+		DESERIALIZE(path, thumbnail_data, vertices, indices, meshlets, meshlet_data);
+
+		bytes = vertices.size() * sizeof(Resource<ResourceType::Mesh>::Vertex) + indices.size() * sizeof(uint32_t) + meshlets.size() * sizeof(Meshlet) + meshlet_data.size() * sizeof(uint32_t);
+	}
+	else
+	{
+		TextureDesc          desc;
+		std::vector<uint8_t> data;
+
+		DESERIALIZE(path, thumbnail_data, desc, data);
+
+		bytes = data.size();
+	}
+
+	return Elapsed(start);
+}
+
+// Map the binary asset and copy every payload once, as a staging upload does
+float LoadBinary(const std::string &name, ResourceType type)
+{
+	auto start = Clock::now();
+
+	BinaryAsset binary;
+	if (!binary.Open(BinaryAsset::GetPath(name, type), type))
+	{
+		return -1.f;
+	}
+
+	std::vector<uint8_t> staging;
+	for (auto chunk : {BinaryChunk::Vertex, BinaryChunk::Index, BinaryChunk::Meshlet, BinaryChunk::MeshletData, BinaryChunk::Pixel})
+	{
+		if (binary.HasChunk(chunk))
+		{
+			staging.resize(binary.GetChunkSize(chunk));
+			std::memcpy(staging.data(), binary.GetChunkData(chunk), staging.size());
+		}
+	}
+
+	return Elapsed(start);
+}
+
+// Convert cereal mesh and texture assets in Asset/Meta to binary assets and compare their load time
+int main()
+{
+	float    legacy_time   = 0.f;
+	float    binary_time   = 0.f;
+	size_t   total_bytes   = 0;
+	uint32_t convert_count = 0;
+	uint32_t failed_count  = 0;
+
+	for (const auto &file : std::filesystem::directory_iterator("Asset/Meta/"))
+	{
+		std::string filename = file.path().filename().string();
+		if (Path::GetInstance().GetFileExtension(filename) != ".asset")
+		{
+			continue;
+		}
+
+		size_t last_pos        = filename.find_last_of('.');
+		size_t second_last_pos = filename.substr(0, last_pos).find_last_of('.');
+
+		std::string  name = filename.substr(0, second_last_pos);
+		ResourceType type = (ResourceType) (std::atoi(filename.substr(second_last_pos + 1, last_pos - second_last_pos).c_str()));
+
+		if (type != ResourceType::Mesh && type != ResourceType::Texture2D)
+		{
+			continue;
+		}
+
+		if (BinaryAsset().Open(BinaryAsset::GetPath(name, type), type))
+		{
+			// Already converted
+			continue;
+		}
+
+		size_t bytes  = 0;
+		float  legacy = 0.f;
+
+		try
+		{
+			legacy = LoadLegacy(name, type, bytes);
+		}
+		catch (...)
+		{
+			LOG_ERROR("Failed to read {}", filename);
+			failed_count++;
+			continue;
+		}
+
+		if (!BinaryAsset::Convert(name, type))
+		{
+			LOG_ERROR("Failed to convert {}", filename);
+			failed_count++;
+			continue;
+		}
+
+		float binary = LoadBinary(name, type);
+
+		LOG_INFO("{}: {:.2f} MB, cereal {:.2f} ms, binary {:.2f} ms", filename, static_cast<float>(bytes) / 1024.f / 1024.f, legacy, binary);
+
+		legacy_time += legacy;
+		binary_time += binary;
+		total_bytes += bytes;
+		convert_count++;
+	}
+
+	LOG_INFO("Converted {} assets ({:.2f} MB), cereal {:.2f} ms, binary {:.2f} ms, {} failed",
+	         convert_count, static_cast<float>(total_bytes) / 1024.f / 1024.f, legacy_time, binary_time, failed_count);
+
+	return failed_count == 0 ? 0 : 1;
+}
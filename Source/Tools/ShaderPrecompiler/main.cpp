@@ -0,0 +1,140 @@
+#include <Core/Core.hpp>
+#include <Core/JobSystem.hpp>
+#include <ShaderCompiler/ShaderBuilder.hpp>
+#include <ShaderCompiler/ShaderCompiler.hpp>
+
+using namespace Ilum;
+
+// Shaders declared by every render pass plugin in ./shared/RenderPass
+static std::vector<ShaderVariants> CollectRenderPassShaders()
+{
+	std::vector<ShaderVariants> variants;
+
+	if (!Path::GetInstance().IsExist("shared/RenderPass"))
+	{
+		LOG_WARN("No render pass plugin found in ./shared/RenderPass, build the plugins first");
+		return variants;
+	}
+
+	for (const auto &file : std::filesystem::directory_iterator("shared/RenderPass/"))
+	{
+		if (file.path().extension() != ".dll" && file.path().extension() != ".so")
+		{
+			continue;
+		}
+		PluginManager::GetInstance().Call(file.path().string(), "RegisterShaders", &variants);
+	}
+
+	return variants;
+}
+
+// Rebuild every shader permutation of the render passes, the material graphs and the manifests in ./bin/Shaders in parallel
+// Usage: ShaderPrecompiler [--force] [--max-permutations <count>]
+int main(int argc, char **argv)
+{
+	bool     force_recompile  = false;
+	uint32_t max_permutations = 256;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string(argv[i]) == "--force")
+		{
+			force_recompile = true;
+		}
+		else if (std::string(argv[i]) == "--max-permutations" && i + 1 < argc)
+		{
+			max_permutations = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+	}
+
+	std::vector<ShaderPermutation> permutations;
+	std::unordered_set<size_t>     permutation_hashes;
+
+	auto add_permutation = [&](ShaderPermutation &&permutation) {
+		if (permutation_hashes.insert(permutation.Hash()).second)
+		{
+			permutations.emplace_back(std::move(permutation));
+		}
+	};
+
+	std::vector<MaterialShader> materials = ShaderBuilder::GetMaterialShaders();
+
+	for (auto &variants : CollectRenderPassShaders())
+	{
+		std::vector<ShaderPermutation> expanded = ShaderBuilder::EnumeratePermutations(variants, materials);
+		if (expanded.size() > max_permutations)
+		{
+			LOG_WARN("Skip {}.{}: {} permutations exceed --max-permutations {}, only recorded ones are rebuilt",
+			         variants.permutation.filename, variants.permutation.entry_point, expanded.size(), max_permutations);
+			continue;
+		}
+		for (auto &permutation : expanded)
+		{
+			add_permutation(std::move(permutation));
+		}
+	}
+
+	size_t enumerated_count = permutations.size();
+
+	// Permutations depending on scene contents are only known from what the engine compiled before
+	for (auto &permutation : ShaderBuilder::GetCachedPermutations())
+	{
+		add_permutation(std::move(permutation));
+	}
+
+	LOG_INFO("{} shader permutations from render passes and {} materials, {} more from manifests in ./bin/Shaders",
+	         enumerated_count, materials.size(), permutations.size() - enumerated_count);
+
+	if (permutations.empty())
+	{
+		LOG_WARN("No shader permutation to compile");
+		return 0;
+	}
+
+	// Initialize compiler on the main thread
+	ShaderCompiler::GetInstance();
+
+	std::vector<ShaderCompileResult> results(permutations.size());
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	JobHandle handle;
+	JobSystem::GetInstance().Dispatch(handle, static_cast<uint32_t>(permutations.size()), 1, [&](uint32_t i) {
+		auto shader_start = std::chrono::high_resolution_clock::now();
+
+		ShaderMeta           meta;
+		std::vector<uint8_t> shader_bin = ShaderBuilder::CompileShader(permutations[i], meta, force_recompile);
+
+		results[i].permutation = permutations[i];
+		results[i].time        = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - shader_start).count();
+		results[i].success     = !shader_bin.empty();
+	});
+	JobSystem::GetInstance().Wait(handle);
+
+	float total_time = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+	uint32_t failed_count = 0;
+	for (const auto &result : results)
+	{
+		if (!result.success)
+		{
+			std::string macros;
+			for (const auto &macro : result.permutation.macros)
+			{
+				macros += macros.empty() ? macro : " " + macro;
+			}
+			LOG_ERROR("Failed {}.{} [{}]", result.permutation.filename, result.permutation.entry_point, macros);
+			failed_count++;
+		}
+	}
+
+	LOG_INFO("{:>10} {:>10} {:>6} {:>6}  {}", "total ms", "max ms", "count", "failed", "shader");
+	for (const auto &timing : ShaderBuilder::SummarizeCompileResults(results))
+	{
+		LOG_INFO("{:>10.2f} {:>10.2f} {:>6} {:>6}  {}", timing.total_time, timing.max_time, timing.permutations, timing.failed, timing.name);
+	}
+
+	LOG_INFO("Compiled {} shader permutations in {:.2f} ms with {} threads, {} failed",
+	         results.size(), total_time, JobSystem::GetInstance().GetThreadCount(), failed_count);
+
+	return failed_count == 0 ? 0 : 1;
+}
@@ -36,4 +36,45 @@ target("Engine")
     add_headerfiles("Engine/**.hpp")
     add_includedirs("Engine", {public  = true})
     add_deps("Core", "RHI", "Scene", "Geometry", "Resource", "Renderer", "Editor", "Plugin")
-target_end()
\ No newline at end of file
+target_end()
+
+target("ShaderPrecompiler")
+    set_kind("binary")
+    set_group("Tools")
+    set_rundir("$(projectdir)")
+
+    add_files("Tools/ShaderPrecompiler/**.cpp")
+    add_deps("Core", "RHI", "ShaderCompiler")
+target_end()
+
+target("AssetConverter")
+    set_kind("binary")
+    set_group("Tools")
+    set_rundir("$(projectdir)")
+
+    add_files("Tools/AssetConverter/**.cpp")
+    add_deps("Core", "RHI", "Geometry", "Resource")
+target_end()
+
+
+target("Tests")
+    set_kind("binary")
+    set_group("Tests")
+    set_rundir("$(projectdir)")
+
+    add_files("Tests/**.cpp")
+    add_includedirs("Tests", "Plugin/RHI")
+    add_deps("Core", "RHI", "RenderGraph", "ShaderCompiler", "Geometry", "Resource", "Scene", "Renderer", "RHI.Null", "Importer.Assimp")
+    add_packages("gtest", "vulkan-headers")
+target_end()
+
+target("Benchmarks")
+    set_kind("binary")
+    set_group("Tests")
+    set_rundir("$(projectdir)")
+
+    add_files("Benchmarks/**.cpp", "Tests/AllocationCounter.cpp")
+    add_includedirs("Benchmarks", "Tests", "Plugin/RHI")
+    add_deps("Core", "RHI", "Geometry", "Resource", "Scene", "Renderer", "RHI.Null", "Importer.Assimp")
+    add_packages("benchmark")
+target_end()
@@ -13,7 +13,9 @@ rule("plugin")
     end)
     
     after_build(function (target)
-        local source_path = path.join(target:targetdir(), string.format("%s.dll", target:name()))
-        local target_path = path.join("$(projectdir)", "shared", string.sub(target:name(), 0, string.find(target:name(), "%.") - 1), string.format("%s.dll", target:name()))
+        -- PluginManager loads "<name>.dll" on Windows and "<name>.so" elsewhere, without the "lib" prefix
+        local extension = is_plat("windows") and "dll" or "so"
+        local source_path = target:targetfile()
+        local target_path = path.join("$(projectdir)", "shared", string.sub(target:name(), 0, string.find(target:name(), "%.") - 1), string.format("%s.%s", target:name(), extension))
         os.cp(source_path, target_path)
     end)